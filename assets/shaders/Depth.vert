@@ -1,11 +1,11 @@
 #version 330 core
 
 layout(location = 0) in vec3 a_Position;
+layout(location = 4) in mat4 a_InstanceTransform;
 
 uniform mat4 u_LightSpaceMatrix;
-uniform mat4 u_Transform;
 
 void main()
 {
-    gl_Position = u_LightSpaceMatrix * u_Transform * vec4(a_Position, 1.0);
+    gl_Position = u_LightSpaceMatrix * a_InstanceTransform * vec4(a_Position, 1.0);
 }
@@ -0,0 +1,13 @@
+#version 330 core
+
+layout(location = 0) out vec4 FragColor;
+
+in vec3 v_Normal;
+flat in vec3 v_Color;
+
+void main()
+{
+    // Fixed hemisphere light: enough to read shapes, no scene lighting.
+    float sky = 0.5 + 0.5 * normalize(v_Normal).y;
+    FragColor = vec4(v_Color * mix(0.3, 1.0, sky), 1.0);
+}
@@ -0,0 +1,34 @@
+#version 330 core
+
+// Drawn while the scene shaders are still compiling; kept minimal so it is
+// ready before the first frame.
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Normal;
+
+// Per-instance attributes (InstanceData)
+layout(location = 4)  in mat4 a_InstanceTransform;      // 4..7
+layout(location = 8)  in mat3 a_InstanceNormalMatrix;   // 8..10
+layout(location = 11) in vec4 a_InstanceMaterial;       // color.rgb, unused
+
+// ---- Camera (std140, binding UniformBinding::Camera; CameraBlock) ----
+layout(std140) uniform Camera {
+    mat4  u_ViewProjection;
+    vec3  u_CameraPos;
+    int   u_EnableShadows;
+    vec4  u_ViewDepth;     // view depth = dot(vec4(worldPos, 1.0), u_ViewDepth)
+    uvec4 u_ClusterDims;   // tiles x, tiles y, depth slices
+    vec4  u_ClusterDepth;  // near, slices / log(far / near)
+    vec4  u_CascadeSplits; // far view depth of each shadow cascade; 0 = unused
+    mat4  u_CascadeMatrices[4]; // world -> light clip space per cascade
+};
+
+out vec3 v_Normal;
+flat out vec3 v_Color;
+
+void main()
+{
+    v_Normal = normalize(a_InstanceNormalMatrix * a_Normal);
+    v_Color = a_InstanceMaterial.rgb;
+    gl_Position = u_ViewProjection * a_InstanceTransform * vec4(a_Position, 1.0);
+}
@@ -5,7 +5,6 @@ layout(location = 0) out vec4 FragColor;
 in vec3 v_Normal;
 in vec3 v_FragPos;
 in vec2 v_TexCoord;
-in vec4 v_FragPosLightSpace;
 
 // ---- Constants ----
 const float PI = 3.14159265359;
@@ -17,64 +16,117 @@ uniform sampler2D u_MetallicMap;   // slot 2
 uniform sampler2D u_RoughnessMap;  // slot 3
 uniform sampler2D u_AOMap;         // slot 4
 
-// ---- Material scalars (used when texture is disabled) ----
-uniform vec3  u_Albedo;
-uniform float u_Metallic;
-uniform float u_Roughness;
-uniform float u_AO;
-
-// ---- Texture usage flags ----
-uniform int u_UseAlbedoMap;
-uniform int u_UseNormalMap;
-uniform int u_UseMetallicMap;
-uniform int u_UseRoughnessMap;
-uniform int u_UseAOMap;
+// ---- Material scalars, per instance (used when texture is disabled) ----
+flat in vec3  v_Albedo;
+flat in float v_Metallic;
+flat in float v_Roughness;
+flat in float v_AO;
+
+// ---- Texture usage flags (std140, binding UniformBinding::Material; MaterialBlock) ----
+layout(std140) uniform Material {
+    int u_UseAlbedoMap;
+    int u_UseNormalMap;
+    int u_UseMetallicMap;
+    int u_UseRoughnessMap;
+    int u_UseAOMap;
+};
 
-// ---- Camera ----
-uniform vec3 u_CameraPos;
+// ---- Camera (std140, binding UniformBinding::Camera; CameraBlock) ----
+layout(std140) uniform Camera {
+    mat4  u_ViewProjection;
+    vec3  u_CameraPos;
+    int   u_EnableShadows;
+    vec4  u_ViewDepth;     // view depth = dot(vec4(worldPos, 1.0), u_ViewDepth)
+    uvec4 u_ClusterDims;   // tiles x, tiles y, depth slices
+    vec4  u_ClusterDepth;  // near, slices / log(far / near)
+    vec4  u_CascadeSplits; // far view depth of each shadow cascade; 0 = unused
+    mat4  u_CascadeMatrices[4]; // world -> light clip space per cascade
+};
 
 // ---- Shadow ----
-uniform sampler2D u_ShadowMap;  // slot 5
-uniform int u_EnableShadows;
+uniform sampler2DArray u_ShadowMap;  // slot 5: one layer per cascade
 
 // ---- Lights (same as Blinn-Phong shader) ----
 struct DirLight {
     vec3 direction;
     vec3 color;
 };
-uniform DirLight u_DirLight;
 
-#define MAX_POINT_LIGHTS 8
-struct PointLight {
-    vec3  position;
-    vec3  color;
-    float constant;
-    float linear;
-    float quadratic;
+// ---- Lights (std140, binding UniformBinding::Lights; LightsBlock) ----
+layout(std140) uniform Lights {
+    DirLight u_DirLight;
 };
-uniform int        u_NumPointLights;
-uniform PointLight u_PointLights[MAX_POINT_LIGHTS];
 
-#define MAX_SPOT_LIGHTS 8
-struct SpotLight {
+// ---- Clustered point and spot lights (LightClusters) ----
+uniform usamplerBuffer u_ClusterCells;    // slot 6: (offset, count) per cluster
+uniform usamplerBuffer u_ClusterIndices;  // slot 7: light indices
+uniform samplerBuffer  u_ClusterLights;   // slot 8: four texels per light
+
+struct ClusterLight {
     vec3  position;
+    float range;
+    vec3  color;       // pre-multiplied by intensity
+    float type;        // 0 = point, 1 = spot
     vec3  direction;
-    vec3  color;
-    float cutOff;
-    float outerCutOff;
+    float cutOff;      // cos(inner cone angle)
     float constant;
     float linear;
     float quadratic;
+    float outerCutOff; // cos(outer cone angle)
 };
-uniform int       u_NumSpotLights;
-uniform SpotLight u_SpotLights[MAX_SPOT_LIGHTS];
 
-// ---- Shadow calculation (3x3 PCF) ----
-float CalcShadow(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir)
+ClusterLight FetchClusterLight(int index)
+{
+    vec4 t0 = texelFetch(u_ClusterLights, index * 4);
+    vec4 t1 = texelFetch(u_ClusterLights, index * 4 + 1);
+    vec4 t2 = texelFetch(u_ClusterLights, index * 4 + 2);
+    vec4 t3 = texelFetch(u_ClusterLights, index * 4 + 3);
+    return ClusterLight(t0.xyz, t0.w, t1.xyz, t1.w, t2.xyz, t2.w, t3.x, t3.y, t3.z, t3.w);
+}
+
+// Same tile and exponential depth slice as LightClusters::FindCluster
+uvec2 GetClusterCell(vec3 fragPos)
+{
+    vec4 clip = u_ViewProjection * vec4(fragPos, 1.0);
+    vec2 tiles = vec2(u_ClusterDims.xy);
+    uvec2 tile = uvec2(clamp(floor((clip.xy / clip.w * 0.5 + 0.5) * tiles), vec2(0.0), tiles - 1.0));
+
+    float depth = max(dot(vec4(fragPos, 1.0), u_ViewDepth), u_ClusterDepth.x);
+    float slice = clamp(floor(log(depth / u_ClusterDepth.x) * u_ClusterDepth.y), 0.0, float(u_ClusterDims.z - 1u));
+
+    uint cluster = (uint(slice) * u_ClusterDims.y + tile.y) * u_ClusterDims.x + tile.x;
+    return texelFetch(u_ClusterCells, int(cluster)).xy;
+}
+
+// Distance attenuation times the spot cone, faded to zero at the light's range
+float ClusterLightFalloff(ClusterLight light, vec3 lightDir, float dist)
+{
+    float window = clamp(1.0 - pow(dist / light.range, 4.0), 0.0, 1.0);
+    float attenuation = window * window / (light.constant + light.linear * dist + light.quadratic * dist * dist);
+    if (light.type > 0.5)
+    {
+        float theta   = dot(lightDir, normalize(-light.direction));
+        float epsilon = light.cutOff - light.outerCutOff;
+        attenuation *= clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
+    }
+    return attenuation;
+}
+
+// ---- Shadow calculation (cascade selection + 3x3 PCF) ----
+float CalcShadow(vec3 fragPos, vec3 normal, vec3 lightDir)
 {
     if (u_EnableShadows == 0)
         return 0.0;
 
+    // First cascade whose slice reaches this depth; past the last one there is no shadow
+    float viewDepth = dot(vec4(fragPos, 1.0), u_ViewDepth);
+    int cascade = 0;
+    while (cascade < 4 && viewDepth > u_CascadeSplits[cascade])
+        cascade++;
+    if (cascade == 4)
+        return 0.0;
+    vec4 fragPosLightSpace = u_CascadeMatrices[cascade] * vec4(fragPos, 1.0);
+
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
     projCoords = projCoords * 0.5 + 0.5;
 
@@ -85,12 +137,12 @@ float CalcShadow(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir)
     float bias = max(0.005 * (1.0 - dot(normal, lightDir)), 0.001);
 
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(u_ShadowMap, 0);
+    vec2 texelSize = 1.0 / vec2(textureSize(u_ShadowMap, 0).xy);
     for (int x = -1; x <= 1; x++)
     {
         for (int y = -1; y <= 1; y++)
         {
-            float pcfDepth = texture(u_ShadowMap, projCoords.xy + vec2(x, y) * texelSize).r;
+            float pcfDepth = texture(u_ShadowMap, vec3(projCoords.xy + vec2(x, y) * texelSize, float(cascade))).r;
             shadow += currentDepth - bias > pcfDepth ? 1.0 : 0.0;
         }
     }
@@ -182,10 +234,10 @@ vec3 CalcPBRLight(vec3 lightDir, vec3 radiance, vec3 N, vec3 V,
 void main()
 {
     // Sample material properties
-    vec3  albedo    = u_UseAlbedoMap    == 1 ? pow(texture(u_AlbedoMap, v_TexCoord).rgb, vec3(2.2)) : u_Albedo;
-    float metallic  = u_UseMetallicMap  == 1 ? texture(u_MetallicMap, v_TexCoord).r : u_Metallic;
-    float roughness = u_UseRoughnessMap == 1 ? texture(u_RoughnessMap, v_TexCoord).r : u_Roughness;
-    float ao        = u_UseAOMap        == 1 ? texture(u_AOMap, v_TexCoord).r : u_AO;
+    vec3  albedo    = u_UseAlbedoMap    == 1 ? pow(texture(u_AlbedoMap, v_TexCoord).rgb, vec3(2.2)) : v_Albedo;
+    float metallic  = u_UseMetallicMap  == 1 ? texture(u_MetallicMap, v_TexCoord).r : v_Metallic;
+    float roughness = u_UseRoughnessMap == 1 ? texture(u_RoughnessMap, v_TexCoord).r : v_Roughness;
+    float ao        = u_UseAOMap        == 1 ? texture(u_AOMap, v_TexCoord).r : v_AO;
 
     // Clamp roughness to avoid divide-by-zero in GGX
     roughness = clamp(roughness, 0.04, 1.0);
@@ -202,34 +254,18 @@ void main()
     // Directional light (with shadow)
     {
         vec3 L = normalize(-u_DirLight.direction);
-        float shadow = CalcShadow(v_FragPosLightSpace, N, L);
+        float shadow = CalcShadow(v_FragPos, N, L);
         Lo += (1.0 - shadow) * CalcPBRLight(L, u_DirLight.color, N, V, albedo, metallic, roughness, F0);
     }
 
-    // Point lights
-    for (int i = 0; i < u_NumPointLights; i++)
+    // Point and spot lights of this fragment's cluster
+    uvec2 cell = GetClusterCell(v_FragPos);
+    for (uint i = 0u; i < cell.y; i++)
     {
-        vec3 L = normalize(u_PointLights[i].position - v_FragPos);
-        float dist = length(u_PointLights[i].position - v_FragPos);
-        float attenuation = 1.0 / (u_PointLights[i].constant + u_PointLights[i].linear * dist
-                          + u_PointLights[i].quadratic * dist * dist);
-        vec3 radiance = u_PointLights[i].color * attenuation;
-        Lo += CalcPBRLight(L, radiance, N, V, albedo, metallic, roughness, F0);
-    }
-
-    // Spot lights
-    for (int i = 0; i < u_NumSpotLights; i++)
-    {
-        vec3 L = normalize(u_SpotLights[i].position - v_FragPos);
-        float dist = length(u_SpotLights[i].position - v_FragPos);
-        float attenuation = 1.0 / (u_SpotLights[i].constant + u_SpotLights[i].linear * dist
-                          + u_SpotLights[i].quadratic * dist * dist);
-
-        float theta   = dot(L, normalize(-u_SpotLights[i].direction));
-        float epsilon = u_SpotLights[i].cutOff - u_SpotLights[i].outerCutOff;
-        float spotIntensity = clamp((theta - u_SpotLights[i].outerCutOff) / epsilon, 0.0, 1.0);
-
-        vec3 radiance = u_SpotLights[i].color * attenuation * spotIntensity;
+        ClusterLight light = FetchClusterLight(int(texelFetch(u_ClusterIndices, int(cell.x + i)).r));
+        vec3 L = normalize(light.position - v_FragPos);
+        float dist = length(light.position - v_FragPos);
+        vec3 radiance = light.color * ClusterLightFalloff(light, L, dist);
         Lo += CalcPBRLight(L, radiance, N, V, albedo, metallic, roughness, F0);
     }
 
@@ -5,59 +5,107 @@ layout(location = 0) out vec4 FragColor;
 in vec3 v_Normal;
 in vec3 v_FragPos;
 in vec2 v_TexCoord;
-in vec4 v_FragPosLightSpace;
 
-// ---- Material ----
-uniform vec3  u_Color;
-uniform float u_Shininess; // specular exponent (higher = sharper highlights)
-
-// ---- Camera ----
-uniform vec3 u_CameraPos;
+// ---- Material (per instance) ----
+flat in vec3  v_Color;
+flat in float v_Shininess; // specular exponent (higher = sharper highlights)
+
+// ---- Camera (std140, binding UniformBinding::Camera; CameraBlock) ----
+layout(std140) uniform Camera {
+    mat4  u_ViewProjection;
+    vec3  u_CameraPos;
+    int   u_EnableShadows;
+    vec4  u_ViewDepth;     // view depth = dot(vec4(worldPos, 1.0), u_ViewDepth)
+    uvec4 u_ClusterDims;   // tiles x, tiles y, depth slices
+    vec4  u_ClusterDepth;  // near, slices / log(far / near)
+    vec4  u_CascadeSplits; // far view depth of each shadow cascade; 0 = unused
+    mat4  u_CascadeMatrices[4]; // world -> light clip space per cascade
+};
 
 // ---- Shadow ----
-uniform sampler2D u_ShadowMap;  // slot 5
-uniform int u_EnableShadows;
+uniform sampler2DArray u_ShadowMap;  // slot 5: one layer per cascade
 
 // ---- Directional Light ----
 struct DirLight {
     vec3 direction;
     vec3 color; // pre-multiplied by intensity
 };
-uniform DirLight u_DirLight;
 
-// ---- Point Lights ----
-#define MAX_POINT_LIGHTS 8
-struct PointLight {
-    vec3  position;
-    vec3  color;
-    float constant;
-    float linear;
-    float quadratic;
+// ---- Lights (std140, binding UniformBinding::Lights; LightsBlock) ----
+layout(std140) uniform Lights {
+    DirLight u_DirLight;
 };
-uniform int        u_NumPointLights;
-uniform PointLight u_PointLights[MAX_POINT_LIGHTS];
 
-// ---- Spot Lights ----
-#define MAX_SPOT_LIGHTS 8
-struct SpotLight {
+// ---- Clustered point and spot lights (LightClusters) ----
+uniform usamplerBuffer u_ClusterCells;    // slot 6: (offset, count) per cluster
+uniform usamplerBuffer u_ClusterIndices;  // slot 7: light indices
+uniform samplerBuffer  u_ClusterLights;   // slot 8: four texels per light
+
+struct ClusterLight {
     vec3  position;
+    float range;
+    vec3  color;       // pre-multiplied by intensity
+    float type;        // 0 = point, 1 = spot
     vec3  direction;
-    vec3  color;
     float cutOff;      // cos(inner cone angle)
-    float outerCutOff; // cos(outer cone angle)
     float constant;
     float linear;
     float quadratic;
+    float outerCutOff; // cos(outer cone angle)
 };
-uniform int       u_NumSpotLights;
-uniform SpotLight u_SpotLights[MAX_SPOT_LIGHTS];
 
-// ---- Shadow calculation (3x3 PCF) ----
-float CalcShadow(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir)
+ClusterLight FetchClusterLight(int index)
+{
+    vec4 t0 = texelFetch(u_ClusterLights, index * 4);
+    vec4 t1 = texelFetch(u_ClusterLights, index * 4 + 1);
+    vec4 t2 = texelFetch(u_ClusterLights, index * 4 + 2);
+    vec4 t3 = texelFetch(u_ClusterLights, index * 4 + 3);
+    return ClusterLight(t0.xyz, t0.w, t1.xyz, t1.w, t2.xyz, t2.w, t3.x, t3.y, t3.z, t3.w);
+}
+
+// Same tile and exponential depth slice as LightClusters::FindCluster
+uvec2 GetClusterCell(vec3 fragPos)
+{
+    vec4 clip = u_ViewProjection * vec4(fragPos, 1.0);
+    vec2 tiles = vec2(u_ClusterDims.xy);
+    uvec2 tile = uvec2(clamp(floor((clip.xy / clip.w * 0.5 + 0.5) * tiles), vec2(0.0), tiles - 1.0));
+
+    float depth = max(dot(vec4(fragPos, 1.0), u_ViewDepth), u_ClusterDepth.x);
+    float slice = clamp(floor(log(depth / u_ClusterDepth.x) * u_ClusterDepth.y), 0.0, float(u_ClusterDims.z - 1u));
+
+    uint cluster = (uint(slice) * u_ClusterDims.y + tile.y) * u_ClusterDims.x + tile.x;
+    return texelFetch(u_ClusterCells, int(cluster)).xy;
+}
+
+// Distance attenuation times the spot cone, faded to zero at the light's range
+float ClusterLightFalloff(ClusterLight light, vec3 lightDir, float dist)
+{
+    float window = clamp(1.0 - pow(dist / light.range, 4.0), 0.0, 1.0);
+    float attenuation = window * window / (light.constant + light.linear * dist + light.quadratic * dist * dist);
+    if (light.type > 0.5)
+    {
+        float theta   = dot(lightDir, normalize(-light.direction));
+        float epsilon = light.cutOff - light.outerCutOff;
+        attenuation *= clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
+    }
+    return attenuation;
+}
+
+// ---- Shadow calculation (cascade selection + 3x3 PCF) ----
+float CalcShadow(vec3 fragPos, vec3 normal, vec3 lightDir)
 {
     if (u_EnableShadows == 0)
         return 0.0;
 
+    // First cascade whose slice reaches this depth; past the last one there is no shadow
+    float viewDepth = dot(vec4(fragPos, 1.0), u_ViewDepth);
+    int cascade = 0;
+    while (cascade < 4 && viewDepth > u_CascadeSplits[cascade])
+        cascade++;
+    if (cascade == 4)
+        return 0.0;
+    vec4 fragPosLightSpace = u_CascadeMatrices[cascade] * vec4(fragPos, 1.0);
+
     // Perspective divide
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
     projCoords = projCoords * 0.5 + 0.5;
@@ -73,12 +121,12 @@ float CalcShadow(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir)
 
     // 3x3 PCF
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(u_ShadowMap, 0);
+    vec2 texelSize = 1.0 / vec2(textureSize(u_ShadowMap, 0).xy);
     for (int x = -1; x <= 1; x++)
     {
         for (int y = -1; y <= 1; y++)
         {
-            float pcfDepth = texture(u_ShadowMap, projCoords.xy + vec2(x, y) * texelSize).r;
+            float pcfDepth = texture(u_ShadowMap, vec3(projCoords.xy + vec2(x, y) * texelSize, float(cascade))).r;
             shadow += currentDepth - bias > pcfDepth ? 1.0 : 0.0;
         }
     }
@@ -96,7 +144,7 @@ vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir)
 
     // Specular (Blinn-Phong)
     vec3 halfDir = normalize(lightDir + viewDir);
-    float spec = pow(max(dot(normal, halfDir), 0.0), u_Shininess);
+    float spec = pow(max(dot(normal, halfDir), 0.0), v_Shininess);
 
     vec3 diffuse  = diff * light.color;
     vec3 specular = spec * light.color;
@@ -104,20 +152,20 @@ vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir)
     return diffuse + specular;
 }
 
-vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
+vec3 CalcClusterLight(ClusterLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 {
     vec3 lightDir = normalize(light.position - fragPos);
     float distance = length(light.position - fragPos);
 
-    // Attenuation
-    float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * distance * distance);
+    // Attenuation (and spot cone)
+    float attenuation = ClusterLightFalloff(light, lightDir, distance);
 
     // Diffuse
     float diff = max(dot(normal, lightDir), 0.0);
 
     // Specular (Blinn-Phong)
     vec3 halfDir = normalize(lightDir + viewDir);
-    float spec = pow(max(dot(normal, halfDir), 0.0), u_Shininess);
+    float spec = pow(max(dot(normal, halfDir), 0.0), v_Shininess);
 
     vec3 diffuse  = diff * light.color * attenuation;
     vec3 specular = spec * light.color * attenuation;
@@ -125,32 +173,6 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
     return diffuse + specular;
 }
 
-vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
-{
-    vec3 lightDir = normalize(light.position - fragPos);
-    float distance = length(light.position - fragPos);
-
-    // Spot intensity (smooth falloff between inner and outer cone)
-    float theta = dot(lightDir, normalize(-light.direction));
-    float epsilon = light.cutOff - light.outerCutOff;
-    float spotIntensity = clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
-
-    // Attenuation
-    float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * distance * distance);
-
-    // Diffuse
-    float diff = max(dot(normal, lightDir), 0.0);
-
-    // Specular (Blinn-Phong)
-    vec3 halfDir = normalize(lightDir + viewDir);
-    float spec = pow(max(dot(normal, halfDir), 0.0), u_Shininess);
-
-    vec3 diffuse  = diff * light.color * attenuation * spotIntensity;
-    vec3 specular = spec * light.color * attenuation * spotIntensity;
-
-    return diffuse + specular;
-}
-
 void main()
 {
     vec3 normal  = normalize(v_Normal);
@@ -164,18 +186,18 @@ void main()
 
     // Directional light (with shadow)
     vec3 dirLightDir = normalize(-u_DirLight.direction);
-    float shadow = CalcShadow(v_FragPosLightSpace, normal, dirLightDir);
+    float shadow = CalcShadow(v_FragPos, normal, dirLightDir);
     lighting += (1.0 - shadow) * CalcDirLight(u_DirLight, normal, viewDir);
 
-    // Point lights
-    for (int i = 0; i < u_NumPointLights; i++)
-        lighting += CalcPointLight(u_PointLights[i], normal, v_FragPos, viewDir);
-
-    // Spot lights
-    for (int i = 0; i < u_NumSpotLights; i++)
-        lighting += CalcSpotLight(u_SpotLights[i], normal, v_FragPos, viewDir);
+    // Point and spot lights of this fragment's cluster
+    uvec2 cell = GetClusterCell(v_FragPos);
+    for (uint i = 0u; i < cell.y; i++)
+    {
+        int light = int(texelFetch(u_ClusterIndices, int(cell.x + i)).r);
+        lighting += CalcClusterLight(FetchClusterLight(light), normal, v_FragPos, viewDir);
+    }
 
-    vec3 result = (ambient + lighting) * u_Color;
+    vec3 result = (ambient + lighting) * v_Color;
 
     // Output linear HDR — tone mapping and gamma are in the composite post-process pass
     FragColor = vec4(result, 1.0);
@@ -4,22 +4,37 @@ layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec3 a_Normal;
 layout(location = 2) in vec2 a_TexCoord;
 
-uniform mat4 u_ViewProjection;
-uniform mat4 u_Transform;
-uniform mat3 u_NormalMatrix;
-uniform mat4 u_LightSpaceMatrix;
+// Per-instance attributes (InstanceData)
+layout(location = 4)  in mat4 a_InstanceTransform;      // 4..7
+layout(location = 8)  in mat3 a_InstanceNormalMatrix;   // 8..10
+layout(location = 11) in vec4 a_InstanceMaterial;       // color.rgb, shininess
+layout(location = 12) in vec4 a_InstanceSurface;        // unused by Blinn-Phong
+
+// ---- Camera (std140, binding UniformBinding::Camera; CameraBlock) ----
+layout(std140) uniform Camera {
+    mat4  u_ViewProjection;
+    vec3  u_CameraPos;
+    int   u_EnableShadows;
+    vec4  u_ViewDepth;     // view depth = dot(vec4(worldPos, 1.0), u_ViewDepth)
+    uvec4 u_ClusterDims;   // tiles x, tiles y, depth slices
+    vec4  u_ClusterDepth;  // near, slices / log(far / near)
+    vec4  u_CascadeSplits; // far view depth of each shadow cascade; 0 = unused
+    mat4  u_CascadeMatrices[4]; // world -> light clip space per cascade
+};
 
 out vec3 v_Normal;
 out vec3 v_FragPos;
 out vec2 v_TexCoord;
-out vec4 v_FragPosLightSpace;
+flat out vec3  v_Color;
+flat out float v_Shininess;
 
 void main()
 {
-    vec4 worldPos = u_Transform * vec4(a_Position, 1.0);
+    vec4 worldPos = a_InstanceTransform * vec4(a_Position, 1.0);
     v_FragPos = worldPos.xyz;
-    v_Normal = normalize(u_NormalMatrix * a_Normal);
+    v_Normal = normalize(a_InstanceNormalMatrix * a_Normal);
     v_TexCoord = a_TexCoord;
-    v_FragPosLightSpace = u_LightSpaceMatrix * worldPos;
+    v_Color = a_InstanceMaterial.rgb;
+    v_Shininess = a_InstanceMaterial.a;
     gl_Position = u_ViewProjection * worldPos;
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+// Purpose: Minimal timing helpers shared by the Zgine microbenchmarks.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+namespace ZgineBench {
+
+struct Timing {
+    double MedianMs = 0.0;
+    double MinMs = 0.0;
+};
+
+/**
+ * @brief Run @p body @p repetitions times (after one warm-up) and report wall-clock timings.
+ *
+ * The median is the headline number; the minimum shows the noise floor on a
+ * busy machine. No statistics library on purpose: these targets are meant to
+ * be read and tweaked, not to feed a dashboard.
+ */
+template<typename Body>
+Timing Measure(uint32_t repetitions, Body&& body) {
+    body();
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    for (uint32_t i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    return Timing{samples[samples.size() / 2], samples.front()};
+}
+
+/**
+ * @brief Keep the optimizer from discarding a computed value.
+ */
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+inline void PrintTitle(std::string_view title) {
+    std::printf("\n== %.*s ==\n", static_cast<int>(title.size()), title.data());
+}
+
+} // namespace ZgineBench
@@ -0,0 +1,107 @@
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Renderer/Culling/DynamicBVH.h>
+#include <Zgine/Renderer/Culling/Frustum.h>
+#include <Zgine/Core/Math/Math.h>
+#include <Zgine/Core/Math/Matrix4.h>
+
+#include "BenchmarkHarness.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kRepetitions = 9;
+
+using Zgine::AABB;
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+
+/**
+ * @brief Objects scattered through a cube of side @p worldSize, as in a large open scene.
+ */
+std::vector<AABB> MakeScene(size_t count, float worldSize) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-worldSize * 0.5f, worldSize * 0.5f);
+    std::uniform_real_distribution<float> size(0.25f, 2.0f);
+
+    std::vector<AABB> boxes;
+    boxes.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const Vector3 center(position(rng), position(rng) * 0.1f, position(rng));
+        const float half = size(rng);
+        boxes.emplace_back(Vector3(center.x - half, center.y - half, center.z - half),
+                           Vector3(center.x + half, center.y + half, center.z + half));
+    }
+    return boxes;
+}
+
+void BenchCount(size_t count) {
+    const float worldSize = 1000.0f;
+    const std::vector<AABB> boxes = MakeScene(count, worldSize);
+
+    // A 60 degree camera with a 300m far plane sees a small slice of the world.
+    const Matrix4 projection = Matrix4::Perspective(Zgine::Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+    const Matrix4 view = Matrix4::LookAt(Vector3(0.0f, 20.0f, 0.0f), Vector3(0.0f, 0.0f, -100.0f), Vector3(0.0f, 1.0f, 0.0f));
+    const Zgine::Frustum frustum = Zgine::Frustum::FromMatrix(projection * view);
+
+    Zgine::DynamicBVH tree;
+    std::vector<int32_t> proxies;
+    proxies.reserve(count);
+    const auto build = ZgineBench::Measure(1, [&] {
+        tree.Clear();
+        proxies.clear();
+        for (size_t i = 0; i < count; ++i) {
+            proxies.push_back(tree.CreateProxy(boxes[i], static_cast<uint32_t>(i)));
+        }
+    });
+
+    std::vector<uint32_t> visible;
+    visible.reserve(count);
+    const auto brute = ZgineBench::Measure(kRepetitions, [&] {
+        visible.clear();
+        for (size_t i = 0; i < count; ++i) {
+            if (frustum.Intersects(boxes[i])) {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        ZgineBench::DoNotOptimize(visible.data());
+    });
+    const size_t bruteVisible = visible.size();
+
+    const auto query = ZgineBench::Measure(kRepetitions, [&] {
+        visible.clear();
+        tree.Query(frustum, [&visible](uint32_t id) { visible.push_back(id); });
+        ZgineBench::DoNotOptimize(visible.data());
+    });
+
+    // 10% of the objects move by a little more than the fat margin every frame.
+    std::vector<AABB> moved = boxes;
+    float offset = 0.0f;
+    const auto update = ZgineBench::Measure(kRepetitions, [&] {
+        offset = offset > 0.0f ? 0.0f : 0.5f;
+        for (size_t i = 0; i < count; i += 10) {
+            moved[i] = AABB(Vector3(boxes[i].Min.x + offset, boxes[i].Min.y, boxes[i].Min.z),
+                            Vector3(boxes[i].Max.x + offset, boxes[i].Max.y, boxes[i].Max.z));
+            tree.MoveProxy(proxies[i], moved[i]);
+        }
+    });
+
+    std::printf("%9zu %8zu %8zu %12.3f %12.3f %9.2fx %12.3f %12.3f %6d\n", count, bruteVisible, visible.size(),
+        brute.MedianMs, query.MedianMs, brute.MedianMs / query.MedianMs, update.MedianMs, build.MedianMs,
+        tree.GetHeight());
+}
+
+} // namespace
+
+int main() {
+    ZgineBench::PrintTitle("Frustum culling: brute force vs DynamicBVH (ms)");
+    std::printf("%9s %8s %8s %12s %12s %10s %12s %12s %6s\n",
+        "objects", "visible", "bvh hits", "brute", "bvh query", "speedup", "move 10%", "build", "height");
+    for (size_t count : {1000u, 10000u, 100000u}) {
+        BenchCount(count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+#include <Zgine/Core/Jobs/JobSystem.h>
+
+#include "BenchmarkHarness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The pre-work-stealing JobSystem, kept as the baseline:
+ *        one std::queue of packaged_tasks behind one mutex, one future per job.
+ *
+ * Only change from the original: m_Workers is declared last so the threads
+ * are joined before the condition variable they wait on is destroyed.
+ */
+class LegacyJobPool {
+public:
+    explicit LegacyJobPool(uint32_t threadCount) {
+        m_Workers.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; ++i) {
+            m_Workers.emplace_back([this](std::stop_token st) { WorkerLoop(std::move(st)); });
+        }
+    }
+
+    [[nodiscard]] std::future<void> Submit(Zgine::Job job) {
+        std::packaged_task<void()> task(std::move(job));
+        std::future<void> future = task.get_future();
+        {
+            std::scoped_lock lock(m_QueueMutex);
+            m_Queue.push(std::move(task));
+        }
+        m_Condition.notify_one();
+        return future;
+    }
+
+private:
+    void WorkerLoop(std::stop_token stopToken) {
+        while (true) {
+            std::packaged_task<void()> task;
+            {
+                std::unique_lock lock(m_QueueMutex);
+                m_Condition.wait(lock, stopToken, [this] { return !m_Queue.empty(); });
+                if (stopToken.stop_requested() && m_Queue.empty())
+                    return;
+                task = std::move(m_Queue.front());
+                m_Queue.pop();
+            }
+            task();
+        }
+    }
+
+    std::queue<std::packaged_task<void()>> m_Queue;
+    std::mutex m_QueueMutex;
+    std::condition_variable_any m_Condition;
+    std::vector<std::jthread> m_Workers;
+};
+
+constexpr uint32_t kTinyJobCount = 100000;
+constexpr uint32_t kProducerCount = 4;
+constexpr uint32_t kParallelForCount = 1u << 20;
+constexpr uint32_t kParallelForGrain = 4096;
+constexpr uint32_t kRepetitions = 5;
+
+// A few hundred nanoseconds of work: small enough that scheduling overhead dominates.
+void TinyWork(std::atomic<uint32_t>& sink) {
+    float value = 1.0f;
+    for (int i = 0; i < 32; ++i) {
+        value = value * 1.0001f + 0.5f;
+    }
+    ZgineBench::DoNotOptimize(value);
+    sink.fetch_add(1, std::memory_order_relaxed);
+}
+
+double JobsPerMs(uint32_t jobCount, const ZgineBench::Timing& timing) {
+    return timing.MedianMs > 0.0 ? static_cast<double>(jobCount) / timing.MedianMs : 0.0;
+}
+
+void BenchFanOut(uint32_t threads) {
+    std::atomic<uint32_t> sink{0};
+
+    LegacyJobPool legacy(threads);
+    const auto legacyTiming = ZgineBench::Measure(kRepetitions, [&] {
+        std::vector<std::future<void>> futures;
+        futures.reserve(kTinyJobCount);
+        for (uint32_t i = 0; i < kTinyJobCount; ++i) {
+            futures.push_back(legacy.Submit([&sink] { TinyWork(sink); }));
+        }
+        for (auto& future : futures) {
+            future.wait();
+        }
+    });
+
+    Zgine::JobSystem jobs(threads);
+    const auto stealingTiming = ZgineBench::Measure(kRepetitions, [&] {
+        Zgine::JobCounter counter;
+        for (uint32_t i = 0; i < kTinyJobCount; ++i) {
+            jobs.Run([&sink] { TinyWork(sink); }, &counter);
+        }
+        jobs.Wait(counter);
+    });
+
+    std::printf("%8u %16.1f %16.1f %9.2fx\n", threads,
+        JobsPerMs(kTinyJobCount, legacyTiming), JobsPerMs(kTinyJobCount, stealingTiming),
+        legacyTiming.MedianMs / stealingTiming.MedianMs);
+}
+
+void BenchMultiProducer(uint32_t threads) {
+    std::atomic<uint32_t> sink{0};
+    const uint32_t perProducer = kTinyJobCount / kProducerCount;
+
+    LegacyJobPool legacy(threads);
+    const auto legacyTiming = ZgineBench::Measure(kRepetitions, [&] {
+        std::vector<std::jthread> producers;
+        for (uint32_t p = 0; p < kProducerCount; ++p) {
+            producers.emplace_back([&] {
+                std::vector<std::future<void>> futures;
+                futures.reserve(perProducer);
+                for (uint32_t i = 0; i < perProducer; ++i) {
+                    futures.push_back(legacy.Submit([&sink] { TinyWork(sink); }));
+                }
+                for (auto& future : futures) {
+                    future.wait();
+                }
+            });
+        }
+    });
+
+    Zgine::JobSystem jobs(threads);
+    const auto stealingTiming = ZgineBench::Measure(kRepetitions, [&] {
+        std::vector<std::jthread> producers;
+        for (uint32_t p = 0; p < kProducerCount; ++p) {
+            producers.emplace_back([&] {
+                Zgine::JobCounter counter;
+                for (uint32_t i = 0; i < perProducer; ++i) {
+                    jobs.Run([&sink] { TinyWork(sink); }, &counter);
+                }
+                jobs.Wait(counter);
+            });
+        }
+    });
+
+    std::printf("%8u %16.1f %16.1f %9.2fx\n", threads,
+        JobsPerMs(kTinyJobCount, legacyTiming), JobsPerMs(kTinyJobCount, stealingTiming),
+        legacyTiming.MedianMs / stealingTiming.MedianMs);
+}
+
+void BenchParallelFor(uint32_t threads) {
+    std::vector<float> data(kParallelForCount, 1.0f);
+    const auto body = [&data](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            data[i] = std::sqrt(data[i] * 1.5f + 2.0f);
+        }
+    };
+
+    // The legacy pool had no ParallelFor; chunked futures is what callers wrote by hand.
+    LegacyJobPool legacy(threads);
+    const auto legacyTiming = ZgineBench::Measure(kRepetitions, [&] {
+        std::vector<std::future<void>> futures;
+        for (uint32_t begin = 0; begin < kParallelForCount; begin += kParallelForGrain) {
+            const uint32_t end = std::min(begin + kParallelForGrain, kParallelForCount);
+            futures.push_back(legacy.Submit([&body, begin, end] { body(begin, end); }));
+        }
+        for (auto& future : futures) {
+            future.wait();
+        }
+    });
+
+    Zgine::JobSystem jobs(threads);
+    const auto stealingTiming = ZgineBench::Measure(kRepetitions, [&] {
+        jobs.ParallelFor(0, kParallelForCount, kParallelForGrain, body);
+    });
+
+    std::printf("%8u %16.3f %16.3f %9.2fx\n", threads,
+        legacyTiming.MedianMs, stealingTiming.MedianMs,
+        legacyTiming.MedianMs / stealingTiming.MedianMs);
+}
+
+} // namespace
+
+int main() {
+    const std::vector<uint32_t> threadCounts{1, 2, 4, 8, 16, 32, 64};
+
+    ZgineBench::PrintTitle("Fan-out: 100k tiny jobs from one thread (jobs/ms)");
+    std::printf("%8s %16s %16s %10s\n", "threads", "legacy", "work-stealing", "speedup");
+    for (uint32_t threads : threadCounts) {
+        BenchFanOut(threads);
+    }
+
+    ZgineBench::PrintTitle("Multi-producer: 4 threads x 25k tiny jobs (jobs/ms)");
+    std::printf("%8s %16s %16s %10s\n", "threads", "legacy", "work-stealing", "speedup");
+    for (uint32_t threads : threadCounts) {
+        BenchMultiProducer(threads);
+    }
+
+    ZgineBench::PrintTitle("ParallelFor: 1M floats, grain 4096 (ms)");
+    std::printf("%8s %16s %16s %10s\n", "threads", "legacy", "work-stealing", "speedup");
+    for (uint32_t threads : threadCounts) {
+        BenchParallelFor(threads);
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <Zgine/Renderer/Lighting/LightClusters.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Core/Math/Math.h>
+#include <Zgine/Core/Math/Matrix4.h>
+
+#include "BenchmarkHarness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+namespace {
+
+constexpr uint32_t kRepetitions = 9;
+
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+
+/**
+ * @brief Small point and spot lights scattered over a 200m square, as in a lit town.
+ */
+Zgine::LightingData MakeLights(uint32_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> unit(0.2f, 1.0f);
+
+    Zgine::LightingData lights{};
+    for (uint32_t i = 0; i < count; ++i) {
+        const Vector3 at(position(rng), position(rng) * 0.05f + 5.0f, position(rng));
+        const Vector3 color(unit(rng), unit(rng), unit(rng));
+        if (i % 4 == 3) {
+            lights.spots.push_back({ at, Vector3(0.0f, -1.0f, 0.0f), color, 2.0f, 0.95f, 0.9f, 1.0f, 0.22f, 0.2f });
+        } else {
+            lights.points.push_back({ at, color, 2.0f, 1.0f, 0.22f, 0.2f });
+        }
+    }
+    return lights;
+}
+
+void BenchCount(Zgine::JobSystem& jobs, uint32_t count) {
+    const Zgine::LightingData lights = MakeLights(count);
+    const Matrix4 projection = Matrix4::Perspective(Zgine::Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 300.0f);
+    const Matrix4 view = Matrix4::LookAt(Vector3(0.0f, 10.0f, 100.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+    Zgine::LightClusters clusters;
+    const auto serial = ZgineBench::Measure(kRepetitions, [&] {
+        clusters.Build(lights, view, projection, 0.1f, 300.0f);
+        ZgineBench::DoNotOptimize(clusters.GetLightIndices().data());
+    });
+    const auto parallel = ZgineBench::Measure(kRepetitions, [&] {
+        clusters.Build(lights, view, projection, 0.1f, 300.0f, &jobs);
+        ZgineBench::DoNotOptimize(clusters.GetLightIndices().data());
+    });
+
+    // Lights a fragment loops over: the lights of its cluster instead of all of them.
+    uint32_t occupied = 0;
+    uint32_t most = 0;
+    for (const Zgine::ClusterCell& cell : clusters.GetCells()) {
+        occupied += cell.Count > 0 ? 1u : 0u;
+        most = std::max(most, cell.Count);
+    }
+    const double average = occupied > 0 ? static_cast<double>(clusters.GetLightIndices().size()) / occupied : 0.0;
+
+    std::printf("%8u %12.3f %12.3f %9.2fx %10zu %12.1f %10u\n", count, serial.MedianMs, parallel.MedianMs,
+        serial.MedianMs / parallel.MedianMs, clusters.GetLightIndices().size(), average, most);
+}
+
+} // namespace
+
+int main() {
+    Zgine::JobSystem jobs;
+
+    ZgineBench::PrintTitle("Clustered lighting: LightClusters::Build serial vs JobSystem (ms)");
+    std::printf("(16x9x24 clusters, %u workers; avg/max = lights per occupied cluster)\n", jobs.GetThreadCount());
+    std::printf("%8s %12s %12s %10s %10s %12s %10s\n",
+        "lights", "serial", "parallel", "speedup", "entries", "avg/cluster", "max");
+    for (uint32_t count : {64u, 256u, 1024u, 4096u}) {
+        BenchCount(jobs, count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <Zgine/Core/Math/MathBatch.h>
+#include <Zgine/Core/Math/MathTypes.h>
+
+#include "BenchmarkHarness.h"
+#include "MathGLMReference.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kRepetitions = 9;
+
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+
+/**
+ * @brief Inputs shared by every kernel at one problem size.
+ */
+struct Dataset {
+    explicit Dataset(size_t count)
+        : Matrices(count), Others(count), Results(count), Points(count), PointResults(count),
+          Xs(count), Ys(count), Zs(count), OutX(count), OutY(count), OutZ(count),
+          Tx(count), Ty(count), Tz(count), Rx(count), Ry(count), Rz(count), Sx(count), Sy(count), Sz(count) {
+        for (size_t i = 0; i < count; ++i) {
+            const float f = static_cast<float>(i);
+            for (int e = 0; e < 16; ++e) {
+                Matrices[i].m[e] = std::sin(f + static_cast<float>(e));
+                Others[i].m[e] = std::cos(f * 0.5f + static_cast<float>(e));
+            }
+            Points[i] = Vector3(f, -f, f * 0.25f);
+            Xs[i] = Points[i].x; Ys[i] = Points[i].y; Zs[i] = Points[i].z;
+            Tx[i] = f; Ty[i] = 1.0f; Tz[i] = -f;
+            Rx[i] = std::fmod(f * 7.0f, 360.0f); Ry[i] = std::fmod(f * 13.0f, 360.0f); Rz[i] = 45.0f;
+            Sx[i] = 1.0f; Sy[i] = 2.0f; Sz[i] = 1.0f + f * 1e-4f;
+        }
+    }
+
+    std::vector<Matrix4> Matrices, Others, Results;
+    std::vector<Vector3> Points, PointResults;
+    std::vector<float> Xs, Ys, Zs, OutX, OutY, OutZ;
+    std::vector<float> Tx, Ty, Tz, Rx, Ry, Rz, Sx, Sy, Sz;
+};
+
+double NanosecondsPerItem(const ZgineBench::Timing& timing, size_t count) {
+    return timing.MedianMs * 1e6 / static_cast<double>(count);
+}
+
+void PrintRow(const char* kernel, size_t count, const ZgineBench::Timing& glm,
+              const ZgineBench::Timing& single, const ZgineBench::Timing& batch) {
+    std::printf("%-18s %9zu %12.2f %12.2f %12.2f %9.2fx\n", kernel, count,
+        NanosecondsPerItem(glm, count), NanosecondsPerItem(single, count),
+        NanosecondsPerItem(batch, count), glm.MedianMs / batch.MedianMs);
+}
+
+void BenchMultiply(Dataset& data) {
+    const size_t count = data.Matrices.size();
+    const auto glm = ZgineBench::Measure(kRepetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            data.Results[i] = ZgineBench::GLMReference::Multiply(data.Matrices[i], data.Others[i]);
+        }
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    const auto single = ZgineBench::Measure(kRepetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            data.Results[i] = data.Matrices[i] * data.Others[i];
+        }
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    const auto batch = ZgineBench::Measure(kRepetitions, [&] {
+        Zgine::Math::MultiplyMatrices(data.Matrices.data(), data.Others.data(), data.Results.data(), count);
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    PrintRow("multiply", count, glm, single, batch);
+}
+
+void BenchTransformPoints(Dataset& data) {
+    const size_t count = data.Points.size();
+    const Matrix4 m = data.Matrices[0];
+    const auto glm = ZgineBench::Measure(kRepetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            data.PointResults[i] = ZgineBench::GLMReference::TransformPoint(m, data.Points[i]);
+        }
+        ZgineBench::DoNotOptimize(data.PointResults.data());
+    });
+    const auto aos = ZgineBench::Measure(kRepetitions, [&] {
+        Zgine::Math::TransformPoints(m, data.Points.data(), data.PointResults.data(), count);
+        ZgineBench::DoNotOptimize(data.PointResults.data());
+    });
+    const auto soa = ZgineBench::Measure(kRepetitions, [&] {
+        Zgine::Math::TransformPoints(m, data.Xs.data(), data.Ys.data(), data.Zs.data(),
+                                     data.OutX.data(), data.OutY.data(), data.OutZ.data(), count);
+        ZgineBench::DoNotOptimize(data.OutX.data());
+    });
+    PrintRow("transform points", count, glm, aos, soa);
+}
+
+void BenchCompose(Dataset& data) {
+    const size_t count = data.Tx.size();
+    const auto glm = ZgineBench::Measure(kRepetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            data.Results[i] = ZgineBench::GLMReference::Compose(
+                Vector3(data.Tx[i], data.Ty[i], data.Tz[i]),
+                Vector3(data.Rx[i], data.Ry[i], data.Rz[i]),
+                Vector3(data.Sx[i], data.Sy[i], data.Sz[i]));
+        }
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    const auto single = ZgineBench::Measure(kRepetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            data.Results[i] = Zgine::Math::ComposeTransform(
+                Vector3(data.Tx[i], data.Ty[i], data.Tz[i]),
+                Vector3(data.Rx[i], data.Ry[i], data.Rz[i]),
+                Vector3(data.Sx[i], data.Sy[i], data.Sz[i]));
+        }
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    const Zgine::Math::TransformStreamsSoA streams{
+        data.Tx.data(), data.Ty.data(), data.Tz.data(),
+        data.Rx.data(), data.Ry.data(), data.Rz.data(),
+        data.Sx.data(), data.Sy.data(), data.Sz.data()
+    };
+    const auto batch = ZgineBench::Measure(kRepetitions, [&] {
+        Zgine::Math::ComposeTransforms(streams, data.Results.data(), count);
+        ZgineBench::DoNotOptimize(data.Results.data());
+    });
+    PrintRow("compose TRS", count, glm, single, batch);
+}
+
+} // namespace
+
+int main() {
+    ZgineBench::PrintTitle("Math kernels (ns per item)");
+    std::printf("SIMD backend: %s\n", Zgine::Math::GetSimdBackendName());
+    std::printf("%-18s %9s %12s %12s %12s %10s\n", "kernel", "count", "glm", "single/aos", "batch/soa", "speedup");
+    for (size_t count : {1024u, 16384u, 262144u}) {
+        Dataset data(count);
+        BenchMultiply(data);
+        BenchTransformPoints(data);
+        BenchCompose(data);
+    }
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+// GLM adapter for MathBenchmark only. Like src/Core/Math/Backend/GLM, this is
+// the one translation unit of its target that includes GLM; it reproduces the
+// conversions the backend performed before the inline SIMD paths existed.
+#include "MathGLMReference.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstring>
+
+namespace ZgineBench::GLMReference {
+
+namespace {
+    glm::mat4 ToGLM(const Zgine::Math::Matrix4& m) {
+        glm::mat4 result;
+        std::memcpy(glm::value_ptr(result), m.m, 16 * sizeof(float));
+        return result;
+    }
+
+    Zgine::Math::Matrix4 FromGLM(const glm::mat4& m) {
+        Zgine::Math::Matrix4 result;
+        std::memcpy(result.m, glm::value_ptr(m), 16 * sizeof(float));
+        return result;
+    }
+
+    Zgine::Math::Matrix4 Rotation(float degrees, const glm::vec3& axis) {
+        return FromGLM(glm::rotate(glm::mat4(1.0f), glm::radians(degrees), axis));
+    }
+}
+
+Zgine::Math::Matrix4 Multiply(const Zgine::Math::Matrix4& a, const Zgine::Math::Matrix4& b) {
+    return FromGLM(ToGLM(a) * ToGLM(b));
+}
+
+Zgine::Math::Matrix4 Compose(const Zgine::Math::Vector3& translation,
+                             const Zgine::Math::Vector3& rotationDegrees,
+                             const Zgine::Math::Vector3& scale) {
+    const Zgine::Math::Matrix4 rotation = Multiply(
+        Multiply(Rotation(rotationDegrees.x, glm::vec3(1, 0, 0)), Rotation(rotationDegrees.y, glm::vec3(0, 1, 0))),
+        Rotation(rotationDegrees.z, glm::vec3(0, 0, 1)));
+    const Zgine::Math::Matrix4 translate = FromGLM(glm::translate(glm::mat4(1.0f), glm::vec3(translation.x, translation.y, translation.z)));
+    const Zgine::Math::Matrix4 scaling = FromGLM(glm::scale(glm::mat4(1.0f), glm::vec3(scale.x, scale.y, scale.z)));
+    return Multiply(Multiply(translate, rotation), scaling);
+}
+
+Zgine::Math::Vector3 TransformPoint(const Zgine::Math::Matrix4& m, const Zgine::Math::Vector3& point) {
+    const glm::vec4 result = ToGLM(m) * glm::vec4(point.x, point.y, point.z, 1.0f);
+    return Zgine::Math::Vector3(result.x, result.y, result.z);
+}
+
+} // namespace ZgineBench::GLMReference
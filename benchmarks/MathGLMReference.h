@@ -0,0 +1,27 @@
+#pragma once
+
+// Purpose: The pre-SIMD GLM code paths, kept out of line as the baseline for MathBenchmark.
+
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector3.h>
+
+namespace ZgineBench::GLMReference {
+
+/**
+ * @brief Matrix4 product through glm::mat4, copying in and out like the old backend.
+ */
+Zgine::Math::Matrix4 Multiply(const Zgine::Math::Matrix4& a, const Zgine::Math::Matrix4& b);
+
+/**
+ * @brief The old TransformComponent::GetTransform: three axis rotations, translate, scale and four products.
+ */
+Zgine::Math::Matrix4 Compose(const Zgine::Math::Vector3& translation,
+                             const Zgine::Math::Vector3& rotationDegrees,
+                             const Zgine::Math::Vector3& scale);
+
+/**
+ * @brief m * (point, 1) through glm::vec4, dropping w.
+ */
+Zgine::Math::Vector3 TransformPoint(const Zgine::Math::Matrix4& m, const Zgine::Math::Vector3& point);
+
+} // namespace ZgineBench::GLMReference
@@ -0,0 +1,134 @@
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <Zgine/Resources/Mesh/MeshLoader.h>
+#include <Zgine/Resources/Mesh/MeshOptimizer.h>
+#include <Zgine/Resources/Mesh/VertexFormat.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+
+#include "BenchmarkHarness.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kRepetitions = 9;
+constexpr float kPi = 3.14159265358979f;
+
+using Zgine::MeshData;
+using Zgine::Vertex;
+using Zgine::VertexFormat;
+
+/**
+ * @brief UV sphere with a seam, as an imported mesh would arrive: one vertex
+ *        per face corner before welding.
+ */
+MeshData MakeSphere(uint32_t rings, uint32_t segments) {
+    MeshData data;
+    const auto corner = [&](uint32_t ring, uint32_t segment) {
+        const float theta = kPi * static_cast<float>(ring) / static_cast<float>(rings);
+        const float phi = 2.0f * kPi * static_cast<float>(segment) / static_cast<float>(segments);
+        Vertex vertex{};
+        vertex.Normal = Zgine::Math::Vector3(std::sin(theta) * std::cos(phi), std::cos(theta),
+                                             std::sin(theta) * std::sin(phi));
+        vertex.Position = Zgine::Math::Vector3(vertex.Normal.x * 2.0f, vertex.Normal.y * 2.0f, vertex.Normal.z * 2.0f);
+        vertex.TexCoords = Zgine::Math::Vector2(static_cast<float>(segment) / static_cast<float>(segments),
+                                                static_cast<float>(ring) / static_cast<float>(rings));
+        vertex.Color = Zgine::Math::Vector4(1.0f);
+        data.Indices.push_back(static_cast<unsigned int>(data.Vertices.size()));
+        data.Vertices.push_back(vertex);
+    };
+    for (uint32_t ring = 0; ring < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            corner(ring, segment);
+            corner(ring + 1, segment);
+            corner(ring, segment + 1);
+            corner(ring, segment + 1);
+            corner(ring + 1, segment);
+            corner(ring + 1, segment + 1);
+        }
+    }
+    return data;
+}
+
+Zgine::AABB GetBounds(const std::vector<Vertex>& vertices) {
+    Zgine::AABB bounds(vertices.front().Position, vertices.front().Position);
+    for (const Vertex& vertex : vertices) {
+        bounds.Min = Zgine::Math::Vector3(std::fmin(bounds.Min.x, vertex.Position.x),
+            std::fmin(bounds.Min.y, vertex.Position.y), std::fmin(bounds.Min.z, vertex.Position.z));
+        bounds.Max = Zgine::Math::Vector3(std::fmax(bounds.Max.x, vertex.Position.x),
+            std::fmax(bounds.Max.y, vertex.Position.y), std::fmax(bounds.Max.z, vertex.Position.z));
+    }
+    return bounds;
+}
+
+void BenchSphere(uint32_t rings) {
+    const MeshData source = MakeSphere(rings, rings * 2);
+
+    // The import-time passes MeshLoader runs before the vertices are encoded.
+    MeshData optimized;
+    const auto optimize = ZgineBench::Measure(1, [&] {
+        optimized = source;
+        Zgine::MeshOptimizer::WeldVertices(optimized);
+        Zgine::MeshOptimizer::BuildLodChain(optimized, 4, 0.5f, 0.02f, 0.3f);
+        for (const Zgine::MeshLod& lod : optimized.Lods) {
+            Zgine::MeshOptimizer::OptimizeVertexCache(optimized.Indices.data() + lod.FirstIndex, lod.IndexCount,
+                                                      optimized.Vertices.size());
+        }
+        Zgine::MeshOptimizer::OptimizeVertexFetch(optimized);
+    });
+
+    const Zgine::AABB bounds = GetBounds(optimized.Vertices);
+    const size_t indexBytes = optimized.Indices.size() * sizeof(uint32_t);
+    for (VertexFormat format : { VertexFormat::Float, VertexFormat::Quantized, VertexFormat::QuantizedColor }) {
+        std::vector<uint8_t> encoded;
+        const auto encode = ZgineBench::Measure(kRepetitions, [&] {
+            encoded = Zgine::VertexQuantization::EncodeVertices(optimized.Vertices, format, bounds);
+            ZgineBench::DoNotOptimize(encoded.data());
+        });
+
+        std::printf("%9zu %-15s %7u %12.1f %12.1f %12.3f %12.3f\n", optimized.Vertices.size(),
+            Zgine::VertexFormatToString(format), Zgine::GetVertexStride(format), encoded.size() / 1024.0,
+            (encoded.size() + indexBytes) / 1024.0, encode.MedianMs, optimize.MedianMs);
+    }
+}
+
+void BenchModel(const char* path) {
+    ZgineBench::PrintTitle("MeshLoader::LoadModel (CPU only, ms)");
+    std::printf("%-15s %10s %12s %12s\n", "format", "meshes", "KiB", "import");
+    for (VertexFormat format : { VertexFormat::Float, VertexFormat::Quantized }) {
+        Zgine::MeshImportSettings settings;
+        settings.Format = format;
+        std::vector<std::shared_ptr<Zgine::Mesh>> meshes;
+        const auto import = ZgineBench::Measure(3, [&] {
+            meshes = Zgine::MeshLoader::LoadModel(path, settings);
+        });
+
+        size_t bytes = 0;
+        for (const auto& mesh : meshes) {
+            bytes += mesh->GetMemorySize();
+        }
+        std::printf("%-15s %10zu %12.1f %12.3f\n", Zgine::VertexFormatToString(format), meshes.size(),
+            bytes / 1024.0, import.MedianMs);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // Measure the CPU side only; meshes skip the GPU upload without a backend.
+    Zgine::RendererAPI::SetAPI(Zgine::RendererAPI::API::None);
+
+    ZgineBench::PrintTitle("Vertex formats: GPU memory and encode time (sphere, KiB / ms)");
+    std::printf("%9s %-15s %7s %12s %12s %12s %12s\n",
+        "vertices", "format", "stride", "vertices", "+indices", "encode", "optimize");
+    for (uint32_t rings : {32u, 128u, 256u}) {
+        BenchSphere(rings);
+    }
+
+    // Optionally time a real import: MeshImportBenchmark path/to/model.gltf
+    if (argc > 1) {
+        BenchModel(argv[1]);
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <Zgine/World/Systems/SystemManager.h>
+
+#include "BenchmarkHarness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kFramesPerSample = 1000;
+constexpr uint32_t kRepetitions = 7;
+
+/**
+ * @brief Does almost nothing, so the measurement is pure dispatch overhead.
+ */
+class TrivialSystem final : public Zgine::ISystem {
+public:
+    explicit TrivialSystem(int priority) : m_Priority(priority) {}
+
+    void Initialize() override {}
+    void Shutdown() override {}
+    void Update(Zgine::World*, float deltaTime) override { m_Accumulated += deltaTime; }
+    void FixedUpdate(Zgine::World*, float fixedDeltaTime) override { m_Accumulated += fixedDeltaTime; }
+    const char* GetName() const override { return "TrivialSystem"; }
+    int GetPriority() const override { return m_Priority; }
+
+    [[nodiscard]] float GetAccumulated() const { return m_Accumulated; }
+
+private:
+    int m_Priority;
+    float m_Accumulated = 0.0f;
+};
+
+/**
+ * @brief The pre-dispatch-table UpdateAll: collect, stable_sort with hash-map
+ *        tie-breaks and walk a fresh vector on every call.
+ */
+class LegacyDispatch {
+public:
+    void Register(Zgine::ISystem* system) {
+        m_Systems.push_back(system);
+        m_RegistrationOrder[system] = m_RegistrationOrder.size();
+    }
+
+    void UpdateAll(float deltaTime) {
+        std::vector<Zgine::ISystem*> allSystems;
+        allSystems.reserve(m_Systems.size());
+        for (Zgine::ISystem* system : m_Systems) {
+            allSystems.push_back(system);
+        }
+
+        std::stable_sort(allSystems.begin(), allSystems.end(),
+            [this](Zgine::ISystem* a, Zgine::ISystem* b) {
+                if (a->GetPriority() != b->GetPriority()) {
+                    return a->GetPriority() < b->GetPriority();
+                }
+                auto aOrderIt = m_RegistrationOrder.find(a);
+                auto bOrderIt = m_RegistrationOrder.find(b);
+                size_t aOrder = aOrderIt != m_RegistrationOrder.end() ? aOrderIt->second : std::numeric_limits<size_t>::max();
+                size_t bOrder = bOrderIt != m_RegistrationOrder.end() ? bOrderIt->second : std::numeric_limits<size_t>::max();
+                return aOrder < bOrder;
+            });
+
+        for (Zgine::ISystem* system : allSystems) {
+            if (system && system->IsEnabled()) {
+                system->Update(nullptr, deltaTime);
+            }
+        }
+    }
+
+private:
+    std::vector<Zgine::ISystem*> m_Systems;
+    std::unordered_map<Zgine::ISystem*, size_t> m_RegistrationOrder;
+};
+
+double MicrosecondsPerFrame(const ZgineBench::Timing& timing) {
+    return timing.MedianMs * 1000.0 / kFramesPerSample;
+}
+
+void BenchUpdateAll(uint32_t systemCount) {
+    // A handful of priority buckets, like real projects, so ties are common.
+    std::vector<std::unique_ptr<TrivialSystem>> systems;
+    for (uint32_t i = 0; i < systemCount; ++i) {
+        systems.push_back(std::make_unique<TrivialSystem>(static_cast<int>((i * 7) % 10) * 10));
+    }
+
+    LegacyDispatch legacy;
+    Zgine::SystemManager timed;
+    Zgine::SystemManager untimed;
+    timed.SetTimingEnabled(true);
+    for (auto& system : systems) {
+        legacy.Register(system.get());
+        timed.RegisterExternalSystem(system.get());
+        untimed.RegisterExternalSystem(system.get());
+    }
+
+    const auto legacyTiming = ZgineBench::Measure(kRepetitions, [&] {
+        for (uint32_t frame = 0; frame < kFramesPerSample; ++frame) {
+            legacy.UpdateAll(0.016f);
+        }
+    });
+    const auto untimedTiming = ZgineBench::Measure(kRepetitions, [&] {
+        for (uint32_t frame = 0; frame < kFramesPerSample; ++frame) {
+            untimed.UpdateAll(nullptr, 0.016f);
+        }
+    });
+    const auto timedTiming = ZgineBench::Measure(kRepetitions, [&] {
+        for (uint32_t frame = 0; frame < kFramesPerSample; ++frame) {
+            timed.UpdateAll(nullptr, 0.016f);
+        }
+    });
+
+    float sink = 0.0f;
+    for (const auto& system : systems) {
+        sink += system->GetAccumulated();
+    }
+    ZgineBench::DoNotOptimize(sink);
+
+    std::printf("%8u %14.2f %14.2f %14.2f %9.2fx\n", systemCount,
+        MicrosecondsPerFrame(legacyTiming), MicrosecondsPerFrame(untimedTiming),
+        MicrosecondsPerFrame(timedTiming), legacyTiming.MedianMs / untimedTiming.MedianMs);
+}
+
+} // namespace
+
+int main() {
+    ZgineBench::PrintTitle("SystemManager::UpdateAll with trivial systems (us per frame)");
+    std::printf("%8s %14s %14s %14s %10s\n", "systems", "sort/frame", "table", "table+timing", "speedup");
+    for (uint32_t systemCount : {100u, 250u, 500u, 1000u}) {
+        BenchUpdateAll(systemCount);
+    }
+
+    return 0;
+}
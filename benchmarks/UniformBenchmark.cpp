@@ -0,0 +1,210 @@
+#include <Zgine/Renderer/Pipeline/UniformBlocks.h>
+#include <Zgine/Renderer/RHI/RecordingRendererAPI.h>
+#include <Zgine/Renderer/RHI/Shader.h>
+#include <Zgine/Renderer/RHI/UniformBuffer.h>
+#include <Zgine/Core/Math/Matrix3.h>
+#include <Zgine/Core/Math/Matrix4.h>
+
+#include "BenchmarkHarness.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kRepetitions = 9;
+constexpr uint32_t kMaterials = 32;
+constexpr int kLights = 8; // per type, the old uniform array size
+
+/**
+ * @brief CPU side of OpenGLShader: name -> location cache plus a store per value.
+ *
+ * The GL call itself is replaced by a write into a float array, so the
+ * numbers show what the renderer spends before the driver is involved.
+ */
+class CachingShader final : public Zgine::Shader {
+public:
+    void Bind() const override {}
+    void Unbind() const override {}
+    void SetUniform1i(const std::string& name, int value) override { Store(name, static_cast<float>(value)); }
+    void SetUniform1f(const std::string& name, float value) override { Store(name, value); }
+    void SetUniform2f(const std::string& name, float v0, float) override { Store(name, v0); }
+    void SetUniform3f(const std::string& name, float v0, float, float) override { Store(name, v0); }
+    void SetUniform4f(const std::string& name, float v0, float, float, float) override { Store(name, v0); }
+    void SetUniformMat3f(const std::string& name, const Zgine::Math::Matrix3& matrix) override { Store(name, matrix.m[0]); }
+    void SetUniformMat4f(const std::string& name, const Zgine::Math::Matrix4& matrix) override { Store(name, matrix.m[0]); }
+    void SetUniformBlockBinding(const std::string&, uint32_t) override {}
+    uint32_t GetID() const override { return 0; }
+    bool IsReady() const override { return true; }
+
+    [[nodiscard]] float Sum() const {
+        float sum = 0.0f;
+        for (float value : m_Values) {
+            sum += value;
+        }
+        return sum;
+    }
+
+private:
+    void Store(const std::string& name, float value) {
+        const auto [it, inserted] = m_Locations.try_emplace(name, static_cast<int>(m_Values.size()));
+        if (inserted) {
+            m_Values.push_back(0.0f);
+        }
+        m_Values[static_cast<size_t>(it->second)] = value;
+    }
+
+    std::unordered_map<std::string, int> m_Locations;
+    std::vector<float> m_Values;
+};
+
+/** @brief UniformBuffer whose upload is a memcpy into system memory. */
+class MemoryUniformBuffer final : public Zgine::UniformBuffer {
+public:
+    MemoryUniformBuffer(uint32_t size, uint32_t binding)
+        : m_Data(size), m_Binding(binding) {}
+
+    void SetData(const void* data, uint32_t size, uint32_t offset) override {
+        std::memcpy(m_Data.data() + offset, data, size);
+    }
+    uint32_t GetSize() const override { return static_cast<uint32_t>(m_Data.size()); }
+    uint32_t GetBinding() const override { return m_Binding; }
+
+private:
+    std::vector<std::byte> m_Data;
+    uint32_t m_Binding;
+};
+
+Zgine::LightingData MakeLights() {
+    Zgine::LightingData lights{};
+    lights.directional = {Zgine::Math::Vector3(0.0f, -1.0f, -0.5f), Zgine::Math::Vector3(1.0f, 1.0f, 1.0f), 1.0f};
+    for (int i = 0; i < kLights; ++i) {
+        lights.points.push_back({Zgine::Math::Vector3(static_cast<float>(i), 2.0f, 0.0f),
+                                 Zgine::Math::Vector3(1.0f, 0.8f, 0.6f), 4.0f, 1.0f, 0.09f, 0.032f});
+    }
+    for (int i = 0; i < kLights; ++i) {
+        lights.spots.push_back({Zgine::Math::Vector3(0.0f, 5.0f, static_cast<float>(i)), Zgine::Math::Vector3(0.0f, -1.0f, 0.0f),
+                                Zgine::Math::Vector3(1.0f, 1.0f, 1.0f), 8.0f, 0.97f, 0.95f, 1.0f, 0.09f, 0.032f});
+    }
+    return lights;
+}
+
+// What RenderSystem did per draw before uniform blocks: frame, light and
+// material state by name, light names built with std::to_string.
+void SetFrameUniformsByName(Zgine::Shader& shader, const Zgine::LightingData& lights, const Zgine::Math::Matrix4& viewProjection) {
+    shader.SetUniformMat4f("u_ViewProjection", viewProjection);
+    shader.SetUniform3f("u_CameraPos", 0.0f, 2.0f, 5.0f);
+    shader.SetUniformMat4f("u_LightSpaceMatrix", viewProjection);
+    shader.SetUniform1i("u_EnableShadows", 1);
+
+    const auto& dir = lights.directional;
+    shader.SetUniform3f("u_DirLight.direction", dir.direction.x, dir.direction.y, dir.direction.z);
+    shader.SetUniform3f("u_DirLight.color", dir.color.x * dir.intensity, dir.color.y * dir.intensity, dir.color.z * dir.intensity);
+    shader.SetUniform1i("u_NumPointLights", static_cast<int>(lights.points.size()));
+    for (size_t i = 0; i < lights.points.size(); i++) {
+        const auto& pl = lights.points[i];
+        const std::string prefix = "u_PointLights[" + std::to_string(i) + "].";
+        shader.SetUniform3f(prefix + "position", pl.position.x, pl.position.y, pl.position.z);
+        shader.SetUniform3f(prefix + "color", pl.color.x * pl.intensity, pl.color.y * pl.intensity, pl.color.z * pl.intensity);
+        shader.SetUniform1f(prefix + "constant", pl.constant);
+        shader.SetUniform1f(prefix + "linear", pl.linear);
+        shader.SetUniform1f(prefix + "quadratic", pl.quadratic);
+    }
+    shader.SetUniform1i("u_NumSpotLights", static_cast<int>(lights.spots.size()));
+    for (size_t i = 0; i < lights.spots.size(); i++) {
+        const auto& sl = lights.spots[i];
+        const std::string prefix = "u_SpotLights[" + std::to_string(i) + "].";
+        shader.SetUniform3f(prefix + "position", sl.position.x, sl.position.y, sl.position.z);
+        shader.SetUniform3f(prefix + "direction", sl.direction.x, sl.direction.y, sl.direction.z);
+        shader.SetUniform3f(prefix + "color", sl.color.x * sl.intensity, sl.color.y * sl.intensity, sl.color.z * sl.intensity);
+        shader.SetUniform1f(prefix + "cutOff", sl.cutOff);
+        shader.SetUniform1f(prefix + "outerCutOff", sl.outerCutOff);
+        shader.SetUniform1f(prefix + "constant", sl.constant);
+        shader.SetUniform1f(prefix + "linear", sl.linear);
+        shader.SetUniform1f(prefix + "quadratic", sl.quadratic);
+    }
+}
+
+void SetMaterialByName(Zgine::Shader& shader, uint32_t material) {
+    shader.SetUniform1i("u_UseAlbedoMap", static_cast<int>(material & 1));
+    shader.SetUniform1i("u_UseNormalMap", static_cast<int>((material >> 1) & 1));
+    shader.SetUniform1i("u_UseMetallicMap", static_cast<int>((material >> 2) & 1));
+    shader.SetUniform1i("u_UseRoughnessMap", static_cast<int>((material >> 3) & 1));
+    shader.SetUniform1i("u_UseAOMap", static_cast<int>((material >> 4) & 1));
+}
+
+void BenchDraws(uint32_t draws) {
+    const Zgine::LightingData lights = MakeLights();
+    const Zgine::Math::Matrix4 viewProjection(1.0f);
+    std::vector<Zgine::Math::Matrix4> transforms(draws, Zgine::Math::Matrix4(1.0f));
+    const Zgine::Math::Matrix3 normalMatrix(1.0f);
+
+    Zgine::RecordingRendererAPI api;
+    CachingShader shader;
+
+    // Everything by name, every draw.
+    const auto perDraw = ZgineBench::Measure(kRepetitions, [&] {
+        api.Reset();
+        for (uint32_t i = 0; i < draws; ++i) {
+            SetFrameUniformsByName(shader, lights, viewProjection);
+            SetMaterialByName(shader, i * kMaterials / draws);
+            shader.SetUniformMat4f("u_Transform", transforms[i]);
+            shader.SetUniformMat3f("u_NormalMatrix", normalMatrix);
+            api.DrawBound(36);
+        }
+        ZgineBench::DoNotOptimize(shader.Sum());
+    });
+
+    // Camera and lights once per frame, material once per material change,
+    // transforms still per draw through cached locations.
+    MemoryUniformBuffer cameraBuffer(sizeof(Zgine::CameraBlock), Zgine::UniformBinding::Camera);
+    MemoryUniformBuffer lightBuffer(sizeof(Zgine::LightsBlock), Zgine::UniformBinding::Lights);
+    MemoryUniformBuffer materialBuffer(sizeof(Zgine::MaterialBlock), Zgine::UniformBinding::Material);
+    const auto blocks = ZgineBench::Measure(kRepetitions, [&] {
+        api.Reset();
+        Zgine::CameraBlock camera;
+        camera.ViewProjection = viewProjection;
+        camera.CascadeMatrices[0] = viewProjection;
+        camera.EnableShadows = 1;
+        cameraBuffer.SetData(&camera, sizeof(camera), 0);
+        const Zgine::LightsBlock lightBlock = Zgine::MakeLightsBlock(lights);
+        lightBuffer.SetData(&lightBlock, sizeof(lightBlock), 0);
+
+        uint32_t currentMaterial = ~0u;
+        for (uint32_t i = 0; i < draws; ++i) {
+            const uint32_t material = i * kMaterials / draws;
+            if (material != currentMaterial) {
+                currentMaterial = material;
+                Zgine::MaterialBlock block;
+                block.UseAlbedoMap = static_cast<int32_t>(material & 1);
+                block.UseNormalMap = static_cast<int32_t>((material >> 1) & 1);
+                materialBuffer.SetData(&block, sizeof(block), 0);
+            }
+            shader.SetUniformMat4f("u_Transform", transforms[i]);
+            shader.SetUniformMat3f("u_NormalMatrix", normalMatrix);
+            api.DrawBound(36);
+        }
+        ZgineBench::DoNotOptimize(shader.Sum());
+    });
+
+    std::printf("%8u %14.3f %14.3f %9.2fx %14.1f %14.1f\n", draws, perDraw.MedianMs, blocks.MedianMs,
+        perDraw.MedianMs / blocks.MedianMs,
+        perDraw.MedianMs * 1.0e6 / draws, blocks.MedianMs * 1.0e6 / draws);
+}
+
+} // namespace
+
+int main() {
+    ZgineBench::PrintTitle("Per-frame CPU time: uniforms by name vs std140 uniform blocks (ms)");
+    std::printf("(by name: 8 point + 8 spot lights; blocks: directional light, the rest is clustered; %u materials)\n", kMaterials);
+    std::printf("%8s %14s %14s %10s %14s %14s\n", "draws", "per-draw", "blocks", "speedup", "ns/draw old", "ns/draw new");
+    for (uint32_t draws : {1000u, 10000u}) {
+        BenchDraws(draws);
+    }
+
+    return 0;
+}
@@ -20,6 +20,7 @@
 #include <Zgine/Physics/PhysicsSystem.h>
 #include <Zgine/Audio/AudioSystem.h>
 #include <Zgine/Scripting/ScriptSystem.h>
+#include <Zgine/World/Systems/TransformSystem.h>
 #include <Zgine/Resources/Core/AssetManager.h>
 #include <Zgine/Resources/Material/PBRMaterialPreset.h>
 #include <Zgine/World/Camera/Camera.h>
@@ -50,6 +51,7 @@ namespace Zgine {
 
             // Initialize asset manager and material presets
             AssetManager::Get().Initialize();
+            AssetManager::Get().SetJobSystem(&Application::Get().GetJobSystem());
             // PBRMaterialPresetRegistry::Initialize();
 
             // Initialize physics system
@@ -62,6 +64,7 @@ namespace Zgine {
             m_ScriptSystem.Initialize();
             // m_ScriptSystem.SetPhysicsSystem(&m_PhysicsSystem); // Removed: SetPhysicsSystem not needed
             m_ScriptSystem.SetAudioSystem(&m_AudioSystem);
+            m_TransformSystem.SetJobSystem(&Application::Get().GetJobSystem());
 
             // Initialize rendering systems
             const RendererAPI::API rendererAPI = RendererAPI::GetAPI();
@@ -74,6 +77,7 @@ namespace Zgine {
                 return;
             }
 
+            m_RenderSystem.SetJobSystem(&Application::Get().GetJobSystem());
             m_RenderSystem.Initialize();
 
             // Create framebuffer for World rendering
@@ -98,6 +102,7 @@ namespace Zgine {
                 systems.RegisterExternalSystem(&m_PhysicsSystem);
                 systems.RegisterExternalSystem(&m_AudioSystem);
                 systems.RegisterExternalSystem(&m_ScriptSystem);
+                systems.RegisterExternalSystem(&m_TransformSystem);
             });
 
             // Setup Editor callbacks
@@ -131,6 +136,7 @@ namespace Zgine {
             m_AudioSystem.Shutdown();
             m_PhysicsSystem.Shutdown();
             m_RenderSystem.Shutdown();
+            AssetManager::Get().SetJobSystem(nullptr);
         }
 
         virtual void OnFixedUpdate(Timestep ts) override {
@@ -140,6 +146,7 @@ namespace Zgine {
         }
 
         virtual void OnUpdate(Timestep ts) override {
+            AssetManager::Get().Update();
             if (!m_RenderingAvailable || !m_SceneFramebuffer) {
                 return;
             }
@@ -421,10 +428,10 @@ namespace Zgine {
                 const auto& path = e.GetAssetPath();
                 std::string ext = path.extension().string();
                 if (ext == ".obj" || ext == ".fbx" || ext == ".gltf" || ext == ".glb") {
-                    // Load model - the MeshComponent uses AssetHandle for mesh loading
+                    // The renderer loads the mesh from its handle on first use.
+                    const AssetHandle handle = AssetManager::Get().RegisterAsset(path, AssetType::Mesh);
                     auto entity = World->CreateEntity(path.stem().string());
-                    entity.AddComponent<MeshComponent>();
-                    // TODO: Use AssetManager to load mesh and assign MeshHandle
+                    entity.AddComponent<MeshComponent>().MeshHandle = handle;
                     ZGINE_CORE_INFO("Model entity created: {}", path.string());
                 } else if (ext == ".lua") {
                     // Attach script to selected entity
@@ -534,6 +541,7 @@ namespace Zgine {
         PhysicsSystem m_PhysicsSystem;
         AudioSystem m_AudioSystem;
         ScriptSystem m_ScriptSystem;
+        TransformSystem m_TransformSystem;
         RenderSystem m_RenderSystem;
 
         // Editor
@@ -24,6 +24,7 @@ public:
     void Update(World* World, float deltaTime) override;
     const char* GetName() const override { return "AudioSystem"; }
     int GetPriority() const override { return 20; }  // Audio runs after physics
+    void DescribeAccess(SystemPhase phase, SystemAccess& access) const override;
 
     void OnSceneStart(World* World) override;
     void OnSceneStop() override;
@@ -7,6 +7,7 @@
 #include <Zgine/Platform/Window.h>
 #include <Zgine/Core/Time/Timestep.h>
 #include <Zgine/Core/Time/TimerManager.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 #include <Zgine/Gui/GuiLayer.h>
 
 namespace Zgine {
@@ -27,6 +28,7 @@ namespace Zgine {
         inline float GetTime() const { return static_cast<float>(Timestep::GetTime()); }
         inline Timestep GetTimestep() const { return m_Timestep; }
         inline TimerManager& GetTimerManager() { return m_TimerManager; }
+        inline JobSystem& GetJobSystem() { return *m_JobSystem; }
 
         inline static Application& Get() { return *s_Instance; }
 
@@ -39,6 +41,9 @@ namespace Zgine {
         bool m_Running = true;
         bool m_Minimized = false;
 
+        // Declared before the layers so layers can still wait on jobs while detaching.
+        std::unique_ptr<JobSystem> m_JobSystem;
+
         // CRITICAL: m_GuiLayer must be declared BEFORE m_LayerStack!
         // Members destruct in reverse declaration order.
         // m_LayerStack holds a raw pointer to GuiLayer, so it must destruct first.
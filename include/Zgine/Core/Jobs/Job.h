@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 
 namespace Zgine {
@@ -7,10 +9,36 @@ namespace Zgine {
 /**
  * @brief A single unit of work submitted to the JobSystem.
  *
- * Using std::function<void()> keeps things simple and learnable.
- * For perf-critical engines you'd use a custom allocator or coroutines,
- * but for a learning engine std::function is perfect.
+ * Using std::function<void()> keeps things simple and learnable. Small
+ * captures (a pointer plus a couple of indices, as ParallelFor uses) fit in
+ * the small-buffer storage, so hot paths do not allocate for the callable.
  */
 using Job = std::function<void()>;
 
+/**
+ * @brief Completion counter shared by a group of jobs.
+ *
+ * JobSystem::Run increments the counter before a job is queued and decrements
+ * it after the job body returns, so a counter at zero means every job in the
+ * group has finished. It is the engine's dependency handle: instead of holding
+ * one std::future per job, callers pass one counter to many Run calls and then
+ * JobSystem::Wait on it, which helps execute queued work while waiting.
+ *
+ * Counters are not copyable and must outlive every job that references them.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    [[nodiscard]] bool IsDone() const noexcept { return m_Pending.load(std::memory_order_acquire) == 0; }
+    [[nodiscard]] uint32_t GetPending() const noexcept { return m_Pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_Pending{0};
+};
+
 } // namespace Zgine
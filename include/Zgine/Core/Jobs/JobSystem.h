@@ -1,32 +1,43 @@
 #pragma once
 
 #include <Zgine/Core/Jobs/Job.h>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
-#include <atomic>
-#include <semaphore>
 
 namespace Zgine {
 
 /**
- * @brief Lightweight fixed-size thread pool for background work.
+ * @brief Work-stealing thread pool for frame and background work.
  *
- * Uses C++20 std::jthread (auto-joining on destruction) and
- * std::counting_semaphore to demonstrate modern C++ concurrency primitives.
+ * Every worker owns a lock-free Chase-Lev deque: it pushes and pops its own
+ * jobs LIFO at the bottom (cache-warm), while idle workers steal FIFO from the
+ * top of other deques. The thread that constructed the JobSystem (normally
+ * the main thread) owns one extra deque so it can fan out work without
+ * touching a lock. Any other thread submits through a small mutex-protected
+ * injection queue, which is also the overflow path when a deque is full.
  *
- * Design goals (learning engine):
- *   - Simple to understand: one queue, N workers
- *   - Safe: no raw thread management; jthread joins automatically
- *   - Modern: leans on C++20 stop_token for cooperative cancellation
+ * Jobs are fire-and-forget. Group them with a JobCounter and call Wait(),
+ * which runs queued jobs on the calling thread until the group is done, so a
+ * waiting thread never sits idle while work is pending. Submit() still hands
+ * out a std::future for code that needs one, at the cost of an allocation.
+ *
+ * Jobs must not throw; an exception escaping Run() terminates the program.
  *
  * Usage:
  *   JobSystem js(4);  // 4 worker threads
- *   auto future = js.Submit([]{ expensiveWork(); });
- *   future.wait();    // optional — block until done
+ *   JobCounter counter;
+ *   js.Run([]{ expensiveWork(); }, &counter);
+ *   js.Wait(counter); // helps execute jobs until the group is done
+ *
+ *   js.ParallelFor(0, count, 256, [&](uint32_t begin, uint32_t end) { ... });
  */
 class JobSystem {
 public:
@@ -37,7 +48,7 @@ public:
     explicit JobSystem(uint32_t threadCount = 0);
 
     /**
-     * @brief Destructor — signals all workers to stop and joins them.
+     * @brief Destructor — drains pending jobs, then stops and joins all workers.
      */
     ~JobSystem();
 
@@ -45,29 +56,162 @@ public:
     JobSystem(const JobSystem&)            = delete;
     JobSystem& operator=(const JobSystem&) = delete;
 
+    /**
+     * @brief Queue a job for execution without allocating a future.
+     * @param counter Optional group counter; incremented now, decremented when the job finishes.
+     */
+    void Run(Job job, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Execute queued jobs on the calling thread until @p counter reaches zero.
+     */
+    void Wait(const JobCounter& counter);
+
+    /**
+     * @brief Work the owner thread does whenever Wait() finds no job to run.
+     *
+     * For steps only the owner thread may take, such as GPU uploads, that a
+     * job can block on: without it, the owner waiting on that job and the job
+     * waiting on the owner would deadlock. @p work returns whether it did
+     * anything and is not re-entered. Set from the owner thread; null clears it.
+     */
+    void SetOwnerWork(std::function<bool()> work);
+
+    /**
+     * @brief Wake the owner thread if it is blocked in Wait(), so it runs the owner work again.
+     *        Call from any thread after queuing something the owner work handles.
+     */
+    void NotifyOwner();
+
     /**
      * @brief Submit a job for async execution.
      * @return std::future<void> that becomes ready when the job completes.
+     *         Exceptions thrown by the job are forwarded through the future.
      */
     [[nodiscard]] std::future<void> Submit(Job job);
 
     /**
-     * @brief Wait for all pending jobs to complete.
+     * @brief Wait for all pending jobs to complete, helping execute them meanwhile.
      */
     void WaitAll();
 
+    /**
+     * @brief Split [begin, end) into chunks of @p grain indices and run them in parallel.
+     *
+     * @p body is invoked as body(chunkBegin, chunkEnd). The calling thread runs
+     * the last chunk itself and then helps with the rest, so ParallelFor is
+     * safe to call from inside a job.
+     */
+    template<typename Body>
+    void ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, const Body& body);
+
+    /**
+     * @brief Map every chunk of [begin, end) to a partial value and fold the partials.
+     *
+     * @p map is invoked as map(chunkBegin, chunkEnd) -> T and partials are
+     * combined in chunk order with combine(T, T) -> T, so the result is
+     * deterministic for a fixed grain even when combine is not commutative.
+     */
+    template<typename T, typename Map, typename Combine>
+    [[nodiscard]] T ParallelReduce(uint32_t begin, uint32_t end, uint32_t grain,
+                                   T identity, const Map& map, const Combine& combine);
+
     /**
      * @brief Number of worker threads in this pool.
      */
     [[nodiscard]] uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Workers.size()); }
 
+    /**
+     * @brief Number of jobs queued or running.
+     */
+    [[nodiscard]] uint32_t GetPendingJobCount() const noexcept { return m_PendingJobs.load(std::memory_order_acquire); }
+
 private:
-    void WorkerLoop(std::stop_token stopToken);
+    struct Task;
+    struct WorkerQueue;
+
+    void WorkerLoop(std::stop_token stopToken, uint32_t queueIndex);
+    void Enqueue(Task* task);
+    void HelpUntilZero(const std::atomic<uint32_t>& pending);
+    [[nodiscard]] bool TryRunOne();
+    [[nodiscard]] bool RunOwnerWork();
+    [[nodiscard]] Task* FindTask(int32_t queueIndex);
+    [[nodiscard]] Task* PopInjected();
+    [[nodiscard]] int32_t GetCurrentQueueIndex() const;
+    void Execute(Task* task);
+    void WakeWorker();
+
+    // Slot 0 belongs to the owner thread; slot i + 1 belongs to worker i.
+    std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+    std::vector<std::jthread>                 m_Workers;
+    std::thread::id                           m_OwnerThread;
+    std::function<bool()>                     m_OwnerWork; // owner thread only
+    bool                                      m_InOwnerWork = false;
 
-    std::vector<std::jthread>       m_Workers;
-    std::queue<std::packaged_task<void()>> m_Queue;
-    std::mutex                      m_QueueMutex;
-    std::condition_variable_any     m_Condition;   // supports stop_token
+    std::mutex           m_InjectMutex;
+    std::deque<Task*>    m_Injected;
+    std::atomic<uint32_t> m_InjectedCount{0};
+
+    std::atomic<uint32_t> m_PendingJobs{0};
+
+    // Idle workers sleep on m_WakeEpoch; blocked non-worker waiters sleep on
+    // m_CompletionEpoch. Producers only issue a notify when someone sleeps.
+    std::atomic<uint32_t> m_WakeEpoch{0};
+    std::atomic<uint32_t> m_SleepingWorkers{0};
+    std::atomic<uint32_t> m_CompletionEpoch{0};
+    std::atomic<uint32_t> m_BlockedWaiters{0};
 };
 
+template<typename Body>
+void JobSystem::ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, const Body& body) {
+    if (begin >= end) {
+        return;
+    }
+
+    grain = std::max(grain, 1u);
+    if (end - begin <= grain) {
+        body(begin, end);
+        return;
+    }
+
+    JobCounter counter;
+    uint32_t chunkBegin = begin;
+    while (end - chunkBegin > grain) {
+        const uint32_t chunkEnd = chunkBegin + grain;
+        // Pointer + two indices stays inside std::function's small buffer.
+        const Body* bodyPtr = &body;
+        Run([bodyPtr, chunkBegin, chunkEnd] { (*bodyPtr)(chunkBegin, chunkEnd); }, &counter);
+        chunkBegin = chunkEnd;
+    }
+
+    body(chunkBegin, end);
+    Wait(counter);
+}
+
+template<typename T, typename Map, typename Combine>
+T JobSystem::ParallelReduce(uint32_t begin, uint32_t end, uint32_t grain,
+                            T identity, const Map& map, const Combine& combine) {
+    if (begin >= end) {
+        return identity;
+    }
+
+    grain = std::max(grain, 1u);
+    const uint32_t chunkCount = (end - begin + grain - 1) / grain;
+    std::vector<T> partials(chunkCount, identity);
+
+    ParallelFor(0, chunkCount, 1, [&](uint32_t firstChunk, uint32_t lastChunk) {
+        for (uint32_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+            const uint32_t chunkBegin = begin + chunk * grain;
+            const uint32_t chunkEnd = std::min(chunkBegin + grain, end);
+            partials[chunk] = map(chunkBegin, chunkEnd);
+        }
+    });
+
+    T result = identity;
+    for (const T& partial : partials) {
+        result = combine(result, partial);
+    }
+    return result;
+}
+
 } // namespace Zgine
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector3.h>
+#include <cstddef>
+
+namespace Zgine::Math {
+
+/**
+ * @brief Structure-of-arrays view over N translation/rotation/scale triples
+ *
+ * Rotation is Euler angles in degrees, applied like TransformComponent
+ * (R = Rx * Ry * Rz). Every pointer must address at least the count passed
+ * to ComposeTransforms; no alignment is required.
+ */
+struct TransformStreamsSoA {
+    const float* TranslationX = nullptr;
+    const float* TranslationY = nullptr;
+    const float* TranslationZ = nullptr;
+    const float* RotationX = nullptr;
+    const float* RotationY = nullptr;
+    const float* RotationZ = nullptr;
+    const float* ScaleX = nullptr;
+    const float* ScaleY = nullptr;
+    const float* ScaleZ = nullptr;
+};
+
+/**
+ * @brief T * Rx * Ry * Rz * S for one transform; rotation in degrees.
+ *
+ * Same result as composing Matrix4::Translation/Rotation/Scale, without the
+ * four intermediate matrix products.
+ */
+[[nodiscard]] Matrix4 ComposeTransform(const Vector3& translation, const Vector3& rotationDegrees, const Vector3& scale);
+
+/**
+ * @brief Compose @p count TRS matrices, four at a time with vector sin/cos.
+ */
+void ComposeTransforms(const TransformStreamsSoA& streams, Matrix4* out, size_t count);
+
+/**
+ * @brief out[i] = m * (points[i], 1), dropping w (no perspective divide).
+ *
+ * @p out may equal @p points.
+ */
+void TransformPoints(const Matrix4& m, const Vector3* points, Vector3* out, size_t count);
+
+/**
+ * @brief SoA variant of TransformPoints; processes 4 (or 8 with AVX2) points per step.
+ *
+ * Output streams may alias the matching input streams.
+ */
+void TransformPoints(const Matrix4& m, const float* xs, const float* ys, const float* zs,
+                     float* outX, float* outY, float* outZ, size_t count);
+
+/**
+ * @brief out[i] = lhs[i] * rhs[i]; @p out may alias either input.
+ */
+void MultiplyMatrices(const Matrix4* lhs, const Matrix4* rhs, Matrix4* out, size_t count);
+
+/**
+ * @brief out[i] = lhs * rhs[i], e.g. one parent applied to many children.
+ */
+void MultiplyMatrices(const Matrix4& lhs, const Matrix4* rhs, Matrix4* out, size_t count);
+
+/**
+ * @brief Instruction set the math kernels were compiled for ("AVX2", "SSE2", "NEON" or "Scalar").
+ */
+[[nodiscard]] const char* GetSimdBackendName();
+
+} // namespace Zgine::Math
@@ -2,11 +2,16 @@
 
 #include <Zgine/Core/Math/Vector3.h>
 #include <Zgine/Core/Math/Vector4.h>
+#include <Zgine/Core/Math/Simd.h>
 
 namespace Zgine::Math {
 
 /**
  * @brief Backend-agnostic 4x4 matrix
+ *
+ * Construction, element access and the multiply operators are defined inline
+ * below on top of Simd.h, so hot loops never leave the caller's translation
+ * unit. Everything else goes through the math backend.
  */
 struct Matrix4 {
     float m[16]; // Column-major order
@@ -42,4 +47,70 @@ Vector3 ExtractScale(const Matrix4& m);
 const float* ValuePtr(const Matrix4& m);
 float* ValuePtr(Matrix4& m);  // Non-const version for ImGuizmo
 
+// ============================================================================
+// Inline fast paths
+// ============================================================================
+
+namespace Detail {
+
+/**
+ * @brief out = a * b for column-major float[16]; @p out may alias @p a or @p b.
+ */
+ZGINE_FORCE_INLINE void MultiplyColumnMajor(const float* a, const float* b, float* out) {
+    const Simd::Float4 a0 = Simd::Load(a);
+    const Simd::Float4 a1 = Simd::Load(a + 4);
+    const Simd::Float4 a2 = Simd::Load(a + 8);
+    const Simd::Float4 a3 = Simd::Load(a + 12);
+    for (int col = 0; col < 4; ++col) {
+        const Simd::Float4 bc = Simd::Load(b + col * 4);
+        Simd::Float4 r = Simd::Mul(a0, Simd::SplatLane<0>(bc));
+        r = Simd::MulAdd(a1, Simd::SplatLane<1>(bc), r);
+        r = Simd::MulAdd(a2, Simd::SplatLane<2>(bc), r);
+        r = Simd::MulAdd(a3, Simd::SplatLane<3>(bc), r);
+        Simd::Store(out + col * 4, r);
+    }
+}
+
+} // namespace Detail
+
+inline Matrix4::Matrix4() : m{} {}
+
+inline Matrix4::Matrix4(float diagonal) : m{} {
+    m[0] = diagonal;
+    m[5] = diagonal;
+    m[10] = diagonal;
+    m[15] = diagonal;
+}
+
+// Element access (column-major: m[col * 4 + row])
+inline float& Matrix4::operator()(int row, int col) {
+    return m[col * 4 + row];
+}
+
+inline const float& Matrix4::operator()(int row, int col) const {
+    return m[col * 4 + row];
+}
+
+inline Matrix4 Matrix4::operator*(const Matrix4& other) const {
+    Matrix4 result;
+    Detail::MultiplyColumnMajor(m, other.m, result.m);
+    return result;
+}
+
+inline Vector4 Matrix4::operator*(const Vector4& v) const {
+    const Simd::Float4 vec = Simd::Load(v.data);
+    Simd::Float4 r = Simd::Mul(Simd::Load(m), Simd::SplatLane<0>(vec));
+    r = Simd::MulAdd(Simd::Load(m + 4), Simd::SplatLane<1>(vec), r);
+    r = Simd::MulAdd(Simd::Load(m + 8), Simd::SplatLane<2>(vec), r);
+    r = Simd::MulAdd(Simd::Load(m + 12), Simd::SplatLane<3>(vec), r);
+    Vector4 result;
+    Simd::Store(result.data, r);
+    return result;
+}
+
+inline Matrix4& Matrix4::operator*=(const Matrix4& other) {
+    Detail::MultiplyColumnMajor(m, other.m, m);
+    return *this;
+}
+
 } // namespace Zgine::Math
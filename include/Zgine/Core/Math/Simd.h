@@ -0,0 +1,339 @@
+#pragma once
+
+#include <Zgine/Core/Foundation/Macro.h>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Minimal 4-wide float SIMD layer used by the math fast paths
+ *
+ * Exactly one of ZGINE_SIMD_SSE, ZGINE_SIMD_NEON or ZGINE_SIMD_SCALAR is
+ * defined. SSE2 is the x86-64 baseline; building with AVX2 (see the
+ * ZGINE_ENABLE_AVX2 CMake option) additionally turns MulAdd into a fused
+ * multiply-add and enables the 256-bit batch kernels in MathBatch.cpp.
+ * Everything here is header-only and force-inlined so callers in other
+ * translation units get straight-line vector code.
+ *
+ * Lanes are addressed x, y, z, w in memory order.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZGINE_SIMD_SSE 1
+    #include <immintrin.h>
+    #if defined(__AVX2__)
+        #define ZGINE_SIMD_AVX2 1
+    #endif
+    #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+        #define ZGINE_SIMD_FMA 1
+    #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define ZGINE_SIMD_NEON 1
+    #include <arm_neon.h>
+#else
+    #define ZGINE_SIMD_SCALAR 1
+#endif
+
+namespace Zgine::Math::Simd {
+
+#if defined(ZGINE_SIMD_SSE)
+using Float4 = __m128;
+using Int4   = __m128i;
+using Mask4  = __m128;
+#elif defined(ZGINE_SIMD_NEON)
+using Float4 = float32x4_t;
+using Int4   = int32x4_t;
+using Mask4  = uint32x4_t;
+#else
+struct Float4 { float v[4]; };
+struct Int4   { int32_t v[4]; };
+struct Mask4  { bool v[4]; };
+#endif
+
+// ============================================================================
+// Load / store
+// ============================================================================
+
+/** @brief Load four floats; @p p needs no particular alignment. */
+ZGINE_FORCE_INLINE Float4 Load(const float* p) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_loadu_ps(p);
+#elif defined(ZGINE_SIMD_NEON)
+    return vld1q_f32(p);
+#else
+    return Float4{{p[0], p[1], p[2], p[3]}};
+#endif
+}
+
+ZGINE_FORCE_INLINE void Store(float* p, Float4 v) {
+#if defined(ZGINE_SIMD_SSE)
+    _mm_storeu_ps(p, v);
+#elif defined(ZGINE_SIMD_NEON)
+    vst1q_f32(p, v);
+#else
+    p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3];
+#endif
+}
+
+/** @brief Load x, y, z without touching p[3]; w is 0. */
+ZGINE_FORCE_INLINE Float4 LoadFloat3(const float* p) {
+#if defined(ZGINE_SIMD_SSE)
+    const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)));
+    return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+#elif defined(ZGINE_SIMD_NEON)
+    return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.0f), 0));
+#else
+    return Float4{{p[0], p[1], p[2], 0.0f}};
+#endif
+}
+
+/** @brief Store x, y, z without touching p[3]. */
+ZGINE_FORCE_INLINE void StoreFloat3(float* p, Float4 v) {
+#if defined(ZGINE_SIMD_SSE)
+    _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(v));
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+#elif defined(ZGINE_SIMD_NEON)
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+#else
+    p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2];
+#endif
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+ZGINE_FORCE_INLINE Float4 Splat(float value) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_set1_ps(value);
+#elif defined(ZGINE_SIMD_NEON)
+    return vdupq_n_f32(value);
+#else
+    return Float4{{value, value, value, value}};
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 Set(float x, float y, float z, float w) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_setr_ps(x, y, z, w);
+#elif defined(ZGINE_SIMD_NEON)
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+#else
+    return Float4{{x, y, z, w}};
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 Zero() { return Splat(0.0f); }
+
+/** @brief Broadcast lane @p Lane of @p v to all four lanes. */
+template<int Lane>
+ZGINE_FORCE_INLINE Float4 SplatLane(Float4 v) {
+    static_assert(Lane >= 0 && Lane < 4);
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+#elif defined(ZGINE_SIMD_NEON)
+    return vdupq_laneq_f32(v, Lane);
+#else
+    return Splat(v.v[Lane]);
+#endif
+}
+
+// ============================================================================
+// Arithmetic
+// ============================================================================
+
+#if defined(ZGINE_SIMD_SCALAR)
+#define ZGINE_SIMD_SCALAR_BINARY(expr) \
+    Float4 r; for (int i = 0; i < 4; ++i) { r.v[i] = (expr); } return r
+#endif
+
+ZGINE_FORCE_INLINE Float4 Add(Float4 a, Float4 b) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_add_ps(a, b);
+#elif defined(ZGINE_SIMD_NEON)
+    return vaddq_f32(a, b);
+#else
+    ZGINE_SIMD_SCALAR_BINARY(a.v[i] + b.v[i]);
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 Sub(Float4 a, Float4 b) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_sub_ps(a, b);
+#elif defined(ZGINE_SIMD_NEON)
+    return vsubq_f32(a, b);
+#else
+    ZGINE_SIMD_SCALAR_BINARY(a.v[i] - b.v[i]);
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 Mul(Float4 a, Float4 b) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_mul_ps(a, b);
+#elif defined(ZGINE_SIMD_NEON)
+    return vmulq_f32(a, b);
+#else
+    ZGINE_SIMD_SCALAR_BINARY(a.v[i] * b.v[i]);
+#endif
+}
+
+/** @brief a * b + c, fused when the target has FMA. */
+ZGINE_FORCE_INLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c) {
+#if defined(ZGINE_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#elif defined(ZGINE_SIMD_SSE)
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#elif defined(ZGINE_SIMD_NEON)
+    return vfmaq_f32(c, a, b);
+#else
+    ZGINE_SIMD_SCALAR_BINARY(a.v[i] * b.v[i] + c.v[i]);
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 Negate(Float4 v) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_xor_ps(v, _mm_set1_ps(-0.0f));
+#elif defined(ZGINE_SIMD_NEON)
+    return vnegq_f32(v);
+#else
+    ZGINE_SIMD_SCALAR_BINARY(-v.v[i]);
+#endif
+}
+
+#if defined(ZGINE_SIMD_SCALAR)
+#undef ZGINE_SIMD_SCALAR_BINARY
+#endif
+
+// ============================================================================
+// Integer lanes and selection (used by the vector sin/cos)
+// ============================================================================
+
+/** @brief Convert to int32 rounding to nearest (ties to even). */
+ZGINE_FORCE_INLINE Int4 RoundToInt(Float4 v) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_cvtps_epi32(v);
+#elif defined(ZGINE_SIMD_NEON)
+    return vcvtnq_s32_f32(v);
+#else
+    Int4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = static_cast<int32_t>(std::nearbyint(v.v[i])); }
+    return r;
+#endif
+}
+
+ZGINE_FORCE_INLINE Float4 ToFloat(Int4 v) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_cvtepi32_ps(v);
+#elif defined(ZGINE_SIMD_NEON)
+    return vcvtq_f32_s32(v);
+#else
+    Float4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = static_cast<float>(v.v[i]); }
+    return r;
+#endif
+}
+
+/** @brief Lanes where (v & bits) != 0. */
+ZGINE_FORCE_INLINE Mask4 TestBits(Int4 v, int32_t bits) {
+#if defined(ZGINE_SIMD_SSE)
+    const __m128i masked = _mm_and_si128(v, _mm_set1_epi32(bits));
+    const __m128i isZero = _mm_cmpeq_epi32(masked, _mm_setzero_si128());
+    return _mm_castsi128_ps(_mm_xor_si128(isZero, _mm_set1_epi32(-1)));
+#elif defined(ZGINE_SIMD_NEON)
+    return vtstq_s32(v, vdupq_n_s32(bits));
+#else
+    Mask4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = (v.v[i] & bits) != 0; }
+    return r;
+#endif
+}
+
+ZGINE_FORCE_INLINE Int4 AddInt(Int4 a, int32_t b) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_add_epi32(a, _mm_set1_epi32(b));
+#elif defined(ZGINE_SIMD_NEON)
+    return vaddq_s32(a, vdupq_n_s32(b));
+#else
+    Int4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = a.v[i] + b; }
+    return r;
+#endif
+}
+
+/** @brief Per lane: mask ? a : b. */
+ZGINE_FORCE_INLINE Float4 Select(Mask4 mask, Float4 a, Float4 b) {
+#if defined(ZGINE_SIMD_SSE)
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#elif defined(ZGINE_SIMD_NEON)
+    return vbslq_f32(mask, a, b);
+#else
+    Float4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = mask.v[i] ? a.v[i] : b.v[i]; }
+    return r;
+#endif
+}
+
+// ============================================================================
+// Shuffles
+// ============================================================================
+
+/** @brief In-place 4x4 transpose: rows become columns. */
+ZGINE_FORCE_INLINE void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+#if defined(ZGINE_SIMD_SSE)
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#elif defined(ZGINE_SIMD_NEON)
+    const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+    const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else
+    Float4 rows[4] = {r0, r1, r2, r3};
+    for (int row = 0; row < 4; ++row) {
+        r0.v[row] = rows[row].v[0];
+        r1.v[row] = rows[row].v[1];
+        r2.v[row] = rows[row].v[2];
+        r3.v[row] = rows[row].v[3];
+    }
+#endif
+}
+
+// ============================================================================
+// Transcendentals
+// ============================================================================
+
+/**
+ * @brief Sine and cosine of four angles in radians.
+ *
+ * Cody-Waite reduction to [-pi/4, pi/4] followed by the Cephes single
+ * precision polynomials; absolute error stays below 2e-7 for |x| < 8192,
+ * which covers any angle a transform component holds in practice.
+ */
+ZGINE_FORCE_INLINE void SinCos(Float4 x, Float4& outSin, Float4& outCos) {
+    const Int4 quadrant = RoundToInt(Mul(x, Splat(0.636619772367581343f))); // 2 / pi
+    const Float4 q = ToFloat(quadrant);
+
+    Float4 r = MulAdd(q, Splat(-1.5703125f), x);
+    r = MulAdd(q, Splat(-4.837512969970703125e-4f), r);
+    r = MulAdd(q, Splat(-7.54978995489188216e-8f), r);
+    const Float4 r2 = Mul(r, r);
+
+    Float4 sinPoly = MulAdd(r2, Splat(-1.9515295891e-4f), Splat(8.3321608736e-3f));
+    sinPoly = MulAdd(sinPoly, r2, Splat(-1.6666654611e-1f));
+    sinPoly = MulAdd(Mul(sinPoly, r2), r, r);
+
+    Float4 cosPoly = MulAdd(r2, Splat(2.443315711809948e-5f), Splat(-1.388731625493765e-3f));
+    cosPoly = MulAdd(cosPoly, r2, Splat(4.166664568298827e-2f));
+    cosPoly = MulAdd(Mul(cosPoly, r2), r2, MulAdd(r2, Splat(-0.5f), Splat(1.0f)));
+
+    // Odd quadrants swap sin and cos; quadrants 2,3 negate sin and 1,2 negate cos.
+    const Mask4 swap = TestBits(quadrant, 1);
+    const Float4 sinValue = Select(swap, cosPoly, sinPoly);
+    const Float4 cosValue = Select(swap, sinPoly, cosPoly);
+    outSin = Select(TestBits(quadrant, 2), Negate(sinValue), sinValue);
+    outCos = Select(TestBits(AddInt(quadrant, 1), 2), Negate(cosValue), cosValue);
+}
+
+} // namespace Zgine::Math::Simd
@@ -18,9 +18,9 @@ struct Vector3 {
     };
 
     // Constructors
-    Vector3();
-    explicit Vector3(float scalar);
-    Vector3(float x, float y, float z);
+    Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
+    explicit Vector3(float scalar) : x(scalar), y(scalar), z(scalar) {}
+    Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
 
     // Operators
     Vector3& operator=(const Vector3& other) = default;
@@ -20,9 +20,9 @@ struct Vector4 {
     };
 
     // Constructors
-    Vector4();
-    explicit Vector4(float scalar);
-    Vector4(float x, float y, float z, float w);
+    Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+    explicit Vector4(float scalar) : x(scalar), y(scalar), z(scalar), w(scalar) {}
+    Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
     Vector4(const Vector3& vec3, float w);
 
     // Operators
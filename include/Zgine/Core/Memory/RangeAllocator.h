@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+namespace Zgine {
+
+/**
+ * @brief Sub-allocates [offset, offset + size) ranges out of a fixed capacity.
+ *
+ * Keeps no memory of its own: offsets and sizes are in whatever unit the
+ * caller manages (vertices, indices, bytes of a GPU buffer). Allocate() is
+ * first fit over the free ranges ordered by offset, and Free() merges a range
+ * with its free neighbours, so freeing everything always restores one block.
+ */
+class RangeAllocator {
+public:
+    static constexpr uint32_t kInvalidOffset = UINT32_MAX;
+
+    explicit RangeAllocator(uint32_t capacity = 0);
+
+    /** @brief Forget every allocation and manage @p capacity units from offset 0. */
+    void Reset(uint32_t capacity);
+
+    /** @brief Offset of @p size free units, or kInvalidOffset when no free range is large enough. */
+    [[nodiscard]] uint32_t Allocate(uint32_t size);
+    /** @brief Return a range obtained from Allocate() with the same @p size. */
+    void Free(uint32_t offset, uint32_t size);
+
+    [[nodiscard]] uint32_t GetCapacity() const noexcept { return m_Capacity; }
+    [[nodiscard]] uint32_t GetUsed() const noexcept { return m_Used; }
+    [[nodiscard]] uint32_t GetFreeRangeCount() const noexcept { return static_cast<uint32_t>(m_FreeRanges.size()); }
+    [[nodiscard]] uint32_t GetLargestFreeRange() const noexcept;
+
+private:
+    std::map<uint32_t, uint32_t> m_FreeRanges; // offset -> size
+    uint32_t m_Capacity = 0;
+    uint32_t m_Used = 0;
+};
+
+} // namespace Zgine
@@ -20,6 +20,7 @@ public:
     void FixedUpdate(World* World, float fixedDeltaTime) override;
     const char* GetName() const override { return "PhysicsSystem"; }
     int GetPriority() const override { return 10; }  // Physics runs early
+    void DescribeAccess(SystemPhase phase, SystemAccess& access) const override;
 
     void OnSceneStart(World* World) override;
     void OnSceneStop() override;
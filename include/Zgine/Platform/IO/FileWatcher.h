@@ -1,24 +1,56 @@
 #pragma once
 
+#include <chrono>
 #include <filesystem>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
+#include <vector>
 
 namespace Zgine {
 
 enum class FileStatus { Created, Modified, Removed };
 
+struct FileWatcherConfig {
+    /** @brief Quiet time after the last change to a file before its callback fires; a save burst reports once. */
+    std::chrono::milliseconds Debounce{100};
+    /** @brief Stat every watched path on each Poll() even where OS notifications are available. */
+    bool ForcePolling = false;
+};
+
 /**
- * @brief Polls a set of watched paths and fires a callback on filesystem changes.
+ * @brief Watches a set of paths and fires a callback on filesystem changes.
  *
  * Lives in Platform/IO because filesystem notifications are OS-dependent.
- * Uses std::filesystem for cross-platform stat queries.
+ * On Linux the parent directories are watched with inotify, so Poll() only
+ * drains pending events and looks at the files they name; it costs nothing
+ * per watched file. Directories watched this way also see editors that save
+ * by renaming a temporary file over the original, which reports as Modified.
+ * Elsewhere, and for paths whose directory cannot be watched (it does not
+ * exist yet, or the inotify watch limit is reached), Poll() falls back to a
+ * std::filesystem stat of each such path.
+ *
+ * Changes are reported once the file has been quiet for the debounce time,
+ * compared against the state last reported: a write burst is one Modified,
+ * and a file deleted and recreated in between is Modified as well.
  */
 class FileWatcher {
 public:
     using Callback = std::function<void(const std::filesystem::path&, FileStatus)>;
 
+    explicit FileWatcher(const FileWatcherConfig& config = {});
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /*
+        Purpose : Apply a new configuration; watched paths are kept.
+    */
+    void SetConfig(const FileWatcherConfig& config);
+    [[nodiscard]] const FileWatcherConfig& GetConfig() const { return m_Config; }
+
     /*
         Purpose : Begin watching a path for changes.
     */
@@ -37,19 +69,52 @@ public:
     void SetCallback(Callback callback);
 
     /*
-        Purpose : Poll all watched paths and fire callback for any changes.
+        Purpose : Collect changes and fire the callback for those past the debounce time.
         Notes   : Call once per frame from the main loop.
     */
     void Poll();
 
+    /** @brief Number of watched paths that are stat-polled rather than notified. */
+    [[nodiscard]] size_t GetPolledCount() const { return m_Polled.size(); }
+
 private:
+    using Clock = std::chrono::steady_clock;
+
     struct FileRecord {
-        std::filesystem::file_time_type LastWriteTime{};
-        bool Exists = false;
+        std::filesystem::file_time_type LastWriteTime{};     // as last seen
+        std::filesystem::file_time_type ReportedWriteTime{}; // as last reported
+        bool Exists = false;                                // as last reported
+        bool SeenExists = false;
+        bool Pending = false;
+        Clock::time_point LastChange{};
+        int Directory = -1; // inotify watch of the parent directory; -1 when polled
     };
 
+    struct DirectoryWatch {
+        std::string Path;
+        size_t FileCount = 0;
+    };
+
+    void Open();
+    void Close();
+    void Attach(const std::string& key, FileRecord& record);
+    void Detach(FileRecord& record);
+    void DropDirectory(int directory, Clock::time_point now);
+    void ReadEvents(Clock::time_point now);
+    void PollStat(Clock::time_point now);
+    void MarkPending(const std::string& key, FileRecord& record, Clock::time_point now);
+    void Report(Clock::time_point now);
+
+    FileWatcherConfig m_Config;
     std::unordered_map<std::string, FileRecord> m_Records;
+    std::unordered_set<std::string> m_Polled;
+    std::vector<std::string> m_Pending;
     Callback m_Callback;
+
+    int m_Notify = -1; // inotify descriptor; -1 when only polling
+    std::unordered_map<int, DirectoryWatch> m_Directories;
+    std::unordered_map<std::string, int> m_DirectoryByPath;
+    bool m_WatchLimitWarned = false;
 };
 
 } // namespace Zgine
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Zgine {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Lives in Platform/IO because mapping is OS-specific (mmap, or a file
+ * mapping object on Windows). Pages are faulted in on first touch, so a
+ * caller that hands GetData() straight to a GPU upload reads the file once
+ * with no intermediate copy. Bypasses the VFS: archives cannot be mapped.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /*
+        Purpose : Map @p path for reading.
+        Return  : The mapping; IsOpen() is false when the file is missing,
+                  empty or cannot be mapped.
+    */
+    [[nodiscard]] static MappedFile Open(const std::filesystem::path& path);
+
+    [[nodiscard]] bool IsOpen() const { return m_Data != nullptr; }
+    [[nodiscard]] const uint8_t* GetData() const { return m_Data; }
+    [[nodiscard]] size_t GetSize() const { return m_Size; }
+
+    /*
+        Purpose : Fault in [data, data + size), a range inside the mapping, on
+                  the calling thread. Worker threads call it so that a later
+                  read of the range (an upload) does not wait on the disk.
+    */
+    void Prefetch(const void* data, size_t size) const;
+
+    /*
+        Purpose : Unmap the file; pointers into it become invalid.
+    */
+    void Close();
+
+private:
+    const uint8_t* m_Data = nullptr;
+    size_t m_Size = 0;
+#if defined(_WIN32)
+    void* m_Mapping = nullptr;
+#endif
+};
+
+} // namespace Zgine
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector3.h>
+#include <algorithm>
+
+namespace Zgine {
+
+/**
+ * @brief Axis-aligned bounding box. An empty box has Min > Max.
+ */
+struct AABB {
+    Math::Vector3 Min{0.0f};
+    Math::Vector3 Max{0.0f};
+
+    AABB() = default;
+    AABB(const Math::Vector3& min, const Math::Vector3& max) : Min(min), Max(max) {}
+
+    [[nodiscard]] Math::Vector3 GetCenter() const {
+        return Math::Vector3((Min.x + Max.x) * 0.5f, (Min.y + Max.y) * 0.5f, (Min.z + Max.z) * 0.5f);
+    }
+
+    [[nodiscard]] Math::Vector3 GetExtents() const {
+        return Math::Vector3((Max.x - Min.x) * 0.5f, (Max.y - Min.y) * 0.5f, (Max.z - Min.z) * 0.5f);
+    }
+
+    /**
+     * @brief Half the surface area; the insertion cost metric of DynamicBVH.
+     */
+    [[nodiscard]] float GetHalfArea() const {
+        const float dx = Max.x - Min.x;
+        const float dy = Max.y - Min.y;
+        const float dz = Max.z - Min.z;
+        return dx * dy + dy * dz + dz * dx;
+    }
+
+    [[nodiscard]] bool Contains(const AABB& other) const {
+        return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+            && other.Max.x <= Max.x && other.Max.y <= Max.y && other.Max.z <= Max.z;
+    }
+
+    [[nodiscard]] bool Overlaps(const AABB& other) const {
+        return Min.x <= other.Max.x && other.Min.x <= Max.x
+            && Min.y <= other.Max.y && other.Min.y <= Max.y
+            && Min.z <= other.Max.z && other.Min.z <= Max.z;
+    }
+
+    [[nodiscard]] AABB Expanded(float margin) const {
+        return AABB(Math::Vector3(Min.x - margin, Min.y - margin, Min.z - margin),
+                    Math::Vector3(Max.x + margin, Max.y + margin, Max.z + margin));
+    }
+
+    [[nodiscard]] static AABB Union(const AABB& a, const AABB& b) {
+        return AABB(Math::Vector3(std::min(a.Min.x, b.Min.x), std::min(a.Min.y, b.Min.y), std::min(a.Min.z, b.Min.z)),
+                    Math::Vector3(std::max(a.Max.x, b.Max.x), std::max(a.Max.y, b.Max.y), std::max(a.Max.z, b.Max.z)));
+    }
+
+    /**
+     * @brief Tight world-space box of @p local transformed by the affine @p transform.
+     */
+    [[nodiscard]] static AABB Transform(const AABB& local, const Math::Matrix4& transform);
+};
+
+} // namespace Zgine
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Renderer/Culling/Frustum.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief Incrementally updated bounding-volume hierarchy of boxes.
+ *
+ * Each proxy stores its box enlarged by a margin ("fat" bounds). Moving a
+ * proxy costs nothing while the new tight box still fits inside the fat one;
+ * otherwise the leaf is removed and reinserted at the sibling with the lowest
+ * surface-area cost, and tree rotations keep it balanced. This makes per-frame
+ * updates proportional to the number of objects that actually moved.
+ *
+ * Queries return every proxy whose fat bounds overlap, so results are
+ * conservative by at most the margin. Whole subtrees that lie inside a
+ * frustum are reported without further plane tests.
+ *
+ * Threading: queries from several threads are safe only while nothing
+ * modifies the tree; the tree itself is single-threaded.
+ */
+class DynamicBVH {
+public:
+    static constexpr int32_t kNullProxy = -1;
+
+    explicit DynamicBVH(float margin = 0.1f);
+
+    /**
+     * @brief Insert a box; @p userData is handed back by queries.
+     */
+    int32_t CreateProxy(const AABB& bounds, uint32_t userData);
+
+    void DestroyProxy(int32_t proxy);
+
+    /**
+     * @brief Update the tight box of @p proxy.
+     * @return true if the proxy was reinserted (it left its fat bounds or shrank a lot).
+     */
+    bool MoveProxy(int32_t proxy, const AABB& bounds);
+
+    void Clear();
+
+    [[nodiscard]] uint32_t GetUserData(int32_t proxy) const { return m_Nodes[static_cast<size_t>(proxy)].UserData; }
+    [[nodiscard]] const AABB& GetFatBounds(int32_t proxy) const { return m_Nodes[static_cast<size_t>(proxy)].Bounds; }
+    [[nodiscard]] size_t GetProxyCount() const noexcept { return m_ProxyCount; }
+
+    /**
+     * @brief Height of the tree (0 when empty, 1 for a single leaf).
+     */
+    [[nodiscard]] int32_t GetHeight() const;
+
+    /**
+     * @brief Check parent links, heights and bounds. For tests and debugging.
+     */
+    [[nodiscard]] bool Validate() const;
+
+    /**
+     * @brief Call @p callback(userData) for every proxy that may intersect @p frustum.
+     * @return Number of proxies reported.
+     */
+    template<typename Callback>
+    size_t Query(const Frustum& frustum, Callback&& callback) const;
+
+    /**
+     * @brief Call @p callback(userData) for every proxy whose fat bounds overlap @p bounds.
+     */
+    template<typename Callback>
+    size_t Query(const AABB& bounds, Callback&& callback) const;
+
+private:
+    static constexpr int32_t kNullNode = -1;
+
+    struct Node {
+        AABB Bounds;
+        int32_t Parent = kNullNode;   // next free node while on the free list
+        int32_t Child1 = kNullNode;
+        int32_t Child2 = kNullNode;
+        int32_t Height = -1;          // 0 for leaves, -1 for free nodes
+        uint32_t UserData = 0;
+
+        [[nodiscard]] bool IsLeaf() const noexcept { return Child1 == kNullNode; }
+    };
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t node);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t node);
+    bool ValidateNode(int32_t node, int32_t parent) const;
+
+    template<typename Callback>
+    size_t ReportSubtree(int32_t node, Callback& callback) const;
+
+    std::vector<Node> m_Nodes;
+    int32_t m_Root = kNullNode;
+    int32_t m_FreeList = kNullNode;
+    size_t m_ProxyCount = 0;
+    float m_Margin;
+
+    // Scratch traversal stack; see the threading note above.
+    mutable std::vector<int32_t> m_Stack;
+};
+
+template<typename Callback>
+size_t DynamicBVH::ReportSubtree(int32_t node, Callback& callback) const {
+    // Runs on its own stack region above the caller's entries.
+    const size_t base = m_Stack.size();
+    size_t reported = 0;
+    m_Stack.push_back(node);
+    while (m_Stack.size() > base) {
+        const Node& current = m_Nodes[static_cast<size_t>(m_Stack.back())];
+        m_Stack.pop_back();
+        if (current.IsLeaf()) {
+            callback(current.UserData);
+            ++reported;
+        } else {
+            m_Stack.push_back(current.Child1);
+            m_Stack.push_back(current.Child2);
+        }
+    }
+    return reported;
+}
+
+template<typename Callback>
+size_t DynamicBVH::Query(const Frustum& frustum, Callback&& callback) const {
+    if (m_Root == kNullNode) {
+        return 0;
+    }
+
+    size_t reported = 0;
+    m_Stack.clear();
+    m_Stack.push_back(m_Root);
+    while (!m_Stack.empty()) {
+        const int32_t index = m_Stack.back();
+        m_Stack.pop_back();
+        const Node& node = m_Nodes[static_cast<size_t>(index)];
+
+        const FrustumTest test = frustum.Test(node.Bounds);
+        if (test == FrustumTest::Outside) {
+            continue;
+        }
+        if (test == FrustumTest::Inside || node.IsLeaf()) {
+            reported += ReportSubtree(index, callback);
+            continue;
+        }
+        m_Stack.push_back(node.Child1);
+        m_Stack.push_back(node.Child2);
+    }
+    return reported;
+}
+
+template<typename Callback>
+size_t DynamicBVH::Query(const AABB& bounds, Callback&& callback) const {
+    if (m_Root == kNullNode) {
+        return 0;
+    }
+
+    size_t reported = 0;
+    m_Stack.clear();
+    m_Stack.push_back(m_Root);
+    while (!m_Stack.empty()) {
+        const Node& node = m_Nodes[static_cast<size_t>(m_Stack.back())];
+        m_Stack.pop_back();
+        if (!node.Bounds.Overlaps(bounds)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            callback(node.UserData);
+            ++reported;
+        } else {
+            m_Stack.push_back(node.Child1);
+            m_Stack.push_back(node.Child2);
+        }
+    }
+    return reported;
+}
+
+} // namespace Zgine
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <cstdint>
+
+namespace Zgine {
+
+/**
+ * @brief Result of testing a box against a frustum.
+ */
+enum class FrustumTest : uint8_t {
+    Outside,
+    Intersects,
+    Inside
+};
+
+/**
+ * @brief Six inward-facing planes extracted from a view-projection matrix.
+ *
+ * Works for perspective and orthographic projections (OpenGL clip space,
+ * z in [-w, w]); a plane stores (normal, distance) with normal·p + distance
+ * >= 0 on the visible side.
+ */
+class Frustum {
+public:
+    Frustum() = default;
+
+    /**
+     * @brief Planes of everything @p viewProjection maps into clip space.
+     */
+    [[nodiscard]] static Frustum FromMatrix(const Math::Matrix4& viewProjection);
+
+    /**
+     * @brief Conservative test: may report Intersects for boxes just outside a corner.
+     */
+    [[nodiscard]] FrustumTest Test(const AABB& box) const;
+
+    [[nodiscard]] bool Intersects(const AABB& box) const { return Test(box) != FrustumTest::Outside; }
+
+private:
+    struct Plane {
+        float X = 0.0f, Y = 0.0f, Z = 0.0f, W = 0.0f;
+    };
+
+    Plane m_Planes[6];
+};
+
+} // namespace Zgine
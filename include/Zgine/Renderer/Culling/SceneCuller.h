@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Zgine/Renderer/Culling/DynamicBVH.h>
+#include <Zgine/Renderer/Culling/Frustum.h>
+#include <Zgine/Resources/Mesh/PrimitiveMesh.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Zgine {
+
+class World;
+class MeshAsset;
+
+/**
+ * @brief Keeps a DynamicBVH of world-space bounds for every renderable entity.
+ *
+ * Sync() walks the entities with a PrimitiveComponent or a loaded
+ * MeshComponent once per frame and only touches the tree for entities whose
+ * world transform version, primitive or mesh changed, so static scenes cost
+ * one comparison per entity. Cull() then
+ * reports the entities whose bounds may intersect a frustum.
+ *
+ * Entities are identified by their raw handle value (EntityHandle::GetValue).
+ */
+class SceneCuller {
+public:
+    SceneCuller() = default;
+
+    /**
+     * @brief Add, move and remove proxies to match @p world.
+     *
+     * Syncing a different World than last time starts over from an empty tree.
+     * @return Number of proxies created, moved or removed.
+     */
+    size_t Sync(World& world);
+
+    /**
+     * @brief Append the entities that may be visible in @p frustum to @p outEntities.
+     * @return Number of entities appended.
+     */
+    size_t Cull(const Frustum& frustum, std::vector<uint32_t>& outEntities) const;
+
+    void Clear();
+
+    [[nodiscard]] size_t GetObjectCount() const noexcept { return m_Records.size(); }
+    [[nodiscard]] const DynamicBVH& GetTree() const noexcept { return m_Tree; }
+
+    /**
+     * @brief Object-space bounds of a built-in primitive mesh.
+     */
+    [[nodiscard]] static AABB GetLocalBounds(PrimitiveType type);
+    /**
+     * @brief Object-space bounds of all sub-meshes of @p mesh.
+     */
+    [[nodiscard]] static AABB GetLocalBounds(const MeshAsset& mesh);
+
+private:
+    struct Record {
+        uint32_t Entity = 0;
+        int32_t Proxy = DynamicBVH::kNullProxy;
+        uint32_t TransformVersion = 0;
+        uint32_t SyncStamp = 0;
+        PrimitiveType Type = PrimitiveType::None;
+        const MeshAsset* Mesh = nullptr;
+    };
+
+    DynamicBVH m_Tree;
+    std::vector<Record> m_Records;
+    std::unordered_map<uint32_t, uint32_t> m_RecordIndex;
+    uint32_t m_SyncStamp = 0;
+    const World* m_World = nullptr;
+};
+
+} // namespace Zgine
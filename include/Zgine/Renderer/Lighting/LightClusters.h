@@ -0,0 +1,142 @@
+#pragma once
+
+#include <Zgine/Renderer/Lighting/LightData.h>
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector3.h>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+class JobSystem;
+
+/**
+ * @brief Froxel grid dimensions: screen tiles times exponential depth slices.
+ */
+struct ClusterGridConfig {
+    uint32_t TilesX = 16;
+    uint32_t TilesY = 9;
+    uint32_t Slices = 24;
+};
+
+/** @brief Range of one cluster in LightClusters::GetLightIndices(); one RG32UI texel. */
+struct ClusterCell {
+    uint32_t Offset = 0;
+    uint32_t Count = 0;
+};
+
+/**
+ * @brief A point or spot light as the shaders read it: four RGBA32F texels.
+ *
+ * Spot lights carry their cone; point lights leave Direction and the cutoffs
+ * unused.
+ */
+struct ClusterLight {
+    float Position[3];
+    float Range;           // attenuation is faded to zero here
+    float Color[3];        // pre-multiplied by intensity
+    float Type;            // 0 = point, 1 = spot
+    float Direction[3];
+    float CutOff;          // cos(inner cone angle)
+    float Constant;
+    float Linear;
+    float Quadratic;
+    float OuterCutOff;     // cos(outer cone angle)
+};
+
+static_assert(sizeof(ClusterLight) == 64, "ClusterLight is read as four vec4 texels");
+static_assert(sizeof(ClusterCell) == 8, "ClusterCell is read as one uvec2 texel");
+
+/**
+ * @brief Clustered forward lighting: assigns point and spot lights to view-space froxels.
+ *
+ * The view frustum is split into TilesX x TilesY screen tiles and Slices
+ * exponentially spaced depth slices. Build() bounds every light by a sphere
+ * of its attenuation range and lists it in each cluster whose view-space box
+ * the sphere touches. A fragment then only shades the lights of its own
+ * cluster, found from its NDC position and view depth exactly as
+ * FindCluster() does, so the number of lights in a scene is unbounded.
+ *
+ * The build is pure CPU work; with a JobSystem the depth slices are filled in
+ * parallel. Results stay valid until the next Build().
+ */
+class LightClusters {
+public:
+    /** @brief Attenuated radiance (brightest channel) below which a light is out of range. */
+    static constexpr float kLightCutoff = 0.01f;
+    /** @brief Range used when the attenuation never falls below kLightCutoff. */
+    static constexpr float kMaxLightRange = 1.0e4f;
+    /** @brief Closest depth the slices are spaced from; keeps the log well defined. */
+    static constexpr float kMinClusterNear = 0.05f;
+
+    explicit LightClusters(const ClusterGridConfig& config = {});
+
+    /**
+     * @brief Rebuild the light lists for a camera.
+     *
+     * @p nearPlane and @p farPlane are the camera's clip distances; depths
+     * outside them fall into the first or last slice.
+     * @param jobs Job system to fill the depth slices on; nullptr builds serially.
+     */
+    void Build(const LightingData& lights, const Math::Matrix4& view, const Math::Matrix4& projection,
+               float nearPlane, float farPlane, JobSystem* jobs = nullptr);
+
+    [[nodiscard]] const ClusterGridConfig& GetConfig() const noexcept { return m_Config; }
+    [[nodiscard]] uint32_t GetClusterCount() const noexcept { return m_Config.TilesX * m_Config.TilesY * m_Config.Slices; }
+    [[nodiscard]] uint32_t GetClusterIndex(uint32_t tileX, uint32_t tileY, uint32_t slice) const noexcept {
+        return (slice * m_Config.TilesY + tileY) * m_Config.TilesX + tileX;
+    }
+
+    /** @brief Depth slice holding view depth @p depth (distance in front of the camera). */
+    [[nodiscard]] uint32_t GetSlice(float depth) const;
+    /** @brief Cluster holding the view-space point @p viewPosition; mirrors the shaders. */
+    [[nodiscard]] uint32_t FindCluster(const Math::Vector3& viewPosition) const;
+
+    /** @brief Near depth of the slice distribution (see ClusterDepth in CameraBlock). */
+    [[nodiscard]] float GetSliceNear() const noexcept { return m_SliceNear; }
+    /** @brief Slices per unit of log(depth / near) (see ClusterDepth in CameraBlock). */
+    [[nodiscard]] float GetSliceScale() const noexcept { return m_SliceScale; }
+
+    [[nodiscard]] const std::vector<ClusterLight>& GetLights() const noexcept { return m_Lights; }
+    [[nodiscard]] const std::vector<ClusterCell>& GetCells() const noexcept { return m_Cells; }
+    [[nodiscard]] const std::vector<uint32_t>& GetLightIndices() const noexcept { return m_Indices; }
+    /** @brief View-space bounds of a cluster. */
+    [[nodiscard]] const AABB& GetClusterBounds(uint32_t cluster) const { return m_Bounds[cluster]; }
+
+    /**
+     * @brief Distance at which (color * intensity) / (c + l d + q d^2) drops below kLightCutoff.
+     * @return 0 for a black light, kMaxLightRange when it never drops that far.
+     */
+    [[nodiscard]] static float ComputeLightRange(const Math::Vector3& color, float intensity,
+                                                 float constant, float linear, float quadratic);
+
+private:
+    struct Sphere {
+        Math::Vector3 Center; // view space
+        float Radius = 0.0f;
+    };
+
+    void UpdateBounds(const Math::Matrix4& projection, float nearPlane, float farPlane);
+    void FillSlices(uint32_t firstSlice, uint32_t lastSlice);
+    void PackSlices(uint32_t firstSlice, uint32_t lastSlice);
+
+    ClusterGridConfig m_Config;
+    Math::Matrix4 m_Projection;
+    float m_Near = 0.0f;
+    float m_Far = 0.0f;
+    float m_SliceNear = kMinClusterNear;
+    float m_SliceScale = 0.0f;
+    bool m_BoundsValid = false;
+
+    std::vector<AABB> m_Bounds;
+    std::vector<ClusterLight> m_Lights;
+    std::vector<Sphere> m_Spheres;
+    std::vector<ClusterCell> m_Cells;
+    std::vector<uint32_t> m_Indices;
+    std::vector<uint32_t> m_SliceOffsets;
+    std::vector<std::vector<uint32_t>> m_SliceIndices; // per-slice lists, reused across builds
+    std::vector<std::vector<uint32_t>> m_SliceLights;  // per-slice depth candidates
+};
+
+} // namespace Zgine
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Zgine/Core/Math/MathTypes.h>
+#include <vector>
 
 namespace Zgine {
 
@@ -34,12 +35,14 @@ struct SpotLightData {
     float quadratic;
 };
 
+/**
+ * @brief Every light in the scene; point and spot lights are unbounded and
+ *        reach the shaders through LightClusters.
+ */
 struct LightingData {
     DirectionalLightData directional;
-    PointLightData points[8];
-    SpotLightData spots[8];
-    int numPointLights = 0;
-    int numSpotLights = 0;
+    std::vector<PointLightData> points;
+    std::vector<SpotLightData> spots;
 };
 
 } // namespace Zgine
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector3.h>
+#include <array>
+#include <cstdint>
+
+namespace Zgine {
+
+/** @brief Cascades the shaders and the shadow map array have room for. */
+inline constexpr uint32_t kMaxShadowCascades = 4;
+
+/**
+ * @brief How the camera frustum is split into directional shadow cascades.
+ */
+struct ShadowCascadeSettings {
+    uint32_t CascadeCount = 4;      // clamped to [1, kMaxShadowCascades]
+    uint32_t Resolution = 2048;     // texels per side of each cascade
+    float MaxDistance = 100.0f;     // shadows end here (or at the camera far plane)
+    float SplitLambda = 0.75f;      // 0 = uniform splits, 1 = logarithmic
+    float CasterDistance = 50.0f;   // casters this far towards the light still land in the map
+};
+
+/**
+ * @brief One cascade: a light-space box around a depth slice of the camera frustum.
+ */
+struct ShadowCascade {
+    Math::Matrix4 ViewProjection;   // world -> light clip space, snapped to whole texels
+    Math::Vector3 Center{0.0f};     // bounding sphere of the slice, world space
+    float Radius = 0.0f;
+    float SplitNear = 0.0f;         // view depth range the cascade is used for
+    float SplitFar = 0.0f;
+};
+
+/**
+ * @brief View depth of the far end of cascade @p index out of @p count.
+ *
+ * Blends uniform and logarithmic splits of [nearPlane, farPlane] by
+ * @p lambda (the "practical" split scheme), so near cascades stay small
+ * without starving the far ones.
+ */
+[[nodiscard]] float ComputeCascadeSplit(uint32_t index, uint32_t count, float nearPlane, float farPlane, float lambda);
+
+/**
+ * @brief Fit the cascades of a directional light to a camera.
+ *
+ * Each cascade is an orthographic box around the bounding sphere of its
+ * frustum slice, so its size does not change as the camera rotates. The box
+ * is moved in whole shadow-map texels, which keeps shadow edges from
+ * shimmering while the camera moves, and extends CasterDistance towards the
+ * light so off-screen casters still write depth.
+ *
+ * @param view,projection The camera matrices; nearPlane/farPlane its clip distances.
+ * @param lightDirection Direction the light travels in (need not be normalized).
+ * @return Number of cascades written to @p out.
+ */
+uint32_t FitShadowCascades(const ShadowCascadeSettings& settings, const Math::Matrix4& view,
+                           const Math::Matrix4& projection, float nearPlane, float farPlane,
+                           const Math::Vector3& lightDirection,
+                           std::array<ShadowCascade, kMaxShadowCascades>& out);
+
+} // namespace Zgine
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Zgine/Core/Memory/RangeAllocator.h>
+#include <Zgine/Renderer/RHI/BufferLayout.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Zgine {
+
+class VertexArray;
+class VertexBuffer;
+class IndexBuffer;
+
+/**
+ * @brief Where a mesh lives inside a MeshArena; draw it with
+ *        RendererAPI::DrawBound(IndexCount, n, FirstIndex, BaseVertex) after binding Array.
+ */
+struct MeshRange {
+    VertexArray* Array = nullptr;
+    uint32_t Page = 0;
+    uint32_t BaseVertex = 0;
+    uint32_t VertexCount = 0;
+    uint32_t FirstIndex = 0;
+    uint32_t IndexCount = 0;
+
+    [[nodiscard]] bool IsValid() const noexcept { return Array != nullptr; }
+};
+
+/**
+ * @brief Shared GPU vertex and index storage for static meshes.
+ *
+ * Instead of one vertex array and two buffers per mesh, meshes are copied
+ * into large pages (one vertex buffer, one index buffer and one vertex array
+ * each) and identified by their range. Draws of different meshes on the same
+ * page then only differ in their DrawBound() offsets, so the renderer binds a
+ * page once for all of them. Indices stay relative to the mesh's first vertex
+ * and are rebased with the draw's base vertex.
+ *
+ * Ranges are sub-allocated with a RangeAllocator per buffer; a mesh that does
+ * not fit any page gets a new one (sized to fit if it is larger than a page).
+ * Pages are kept for reuse when they empty.
+ *
+ * Creates GPU resources, so it must only be used on the render thread.
+ */
+class MeshArena {
+public:
+    static constexpr uint32_t kDefaultPageVertices = 256 * 1024;
+    static constexpr uint32_t kDefaultPageIndices = 1024 * 1024;
+
+    /**
+     * @param layout Vertex layout shared by every mesh in the arena.
+     */
+    explicit MeshArena(BufferLayout layout, uint32_t pageVertices = kDefaultPageVertices,
+                       uint32_t pageIndices = kDefaultPageIndices);
+    ~MeshArena();
+
+    MeshArena(const MeshArena&) = delete;
+    MeshArena& operator=(const MeshArena&) = delete;
+
+    /**
+     * @brief Copy a mesh into the arena.
+     * @param vertices @p vertexCount vertices in the arena's layout.
+     * @return The mesh's range; invalid when the backend cannot create the buffers.
+     */
+    [[nodiscard]] MeshRange Allocate(const void* vertices, uint32_t vertexCount,
+                                     const uint32_t* indices, uint32_t indexCount);
+    /** @brief Release a range returned by Allocate(); invalid ranges are ignored. */
+    void Free(const MeshRange& range);
+
+    [[nodiscard]] const BufferLayout& GetLayout() const noexcept { return m_Layout; }
+    [[nodiscard]] uint32_t GetPageCount() const noexcept { return static_cast<uint32_t>(m_Pages.size()); }
+    /** @brief Vertices currently allocated across all pages. */
+    [[nodiscard]] uint32_t GetVertexCount() const noexcept;
+
+private:
+    struct Page {
+        std::shared_ptr<VertexArray> Array;
+        std::shared_ptr<VertexBuffer> Vertices;
+        std::shared_ptr<IndexBuffer> Indices;
+        RangeAllocator VertexRanges;
+        RangeAllocator IndexRanges;
+    };
+
+    [[nodiscard]] bool CreatePage(uint32_t vertexCapacity, uint32_t indexCapacity);
+
+    BufferLayout m_Layout;
+    uint32_t m_PageVertices = 0;
+    uint32_t m_PageIndices = 0;
+    std::vector<Page> m_Pages;
+};
+
+} // namespace Zgine
@@ -22,10 +22,12 @@ enum class RenderPath { Basic, Advanced };
 
 /** @brief Shadow / quality knobs */
 struct RenderQuality {
-    int  ShadowMapSize     = 2048;
-    int  CascadeCount      = 4;
-    int  MSAASamples       = 4;
-    bool EnablePostProcess = false;
+    int   ShadowMapSize      = 2048;   // texels per side of each shadow cascade
+    int   CascadeCount       = 4;      // directional shadow cascades, 1..kMaxShadowCascades
+    float ShadowDistance     = 100.0f; // view depth where directional shadows end
+    float CascadeSplitLambda = 0.75f;  // 0 = uniform cascade splits, 1 = logarithmic
+    int   MSAASamples        = 4;
+    bool  EnablePostProcess  = false;
 };
 
 /**
@@ -41,6 +43,7 @@ struct RenderConfig {
     bool EnableIBL          = false;
     bool EnableShadows      = false;
     bool EnablePostProcess  = false;
+    bool EnableFrustumCulling = true;
 
     [[nodiscard]] static constexpr bool IsIBLAvailable()         { return ZGINE_ENABLE_IBL; }
     [[nodiscard]] static constexpr bool IsShadowsAvailable()     { return ZGINE_ENABLE_SHADOWS; }
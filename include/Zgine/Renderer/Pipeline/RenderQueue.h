@@ -0,0 +1,265 @@
+#pragma once
+
+#include <Zgine/Renderer/Pipeline/RenderStats.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <Zgine/Renderer/RHI/BufferLayout.h>
+#include <Zgine/Core/Math/Matrix3.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+class Shader;
+class VertexArray;
+
+/**
+ * @brief Pass a draw packet belongs to; passes execute in this order.
+ */
+enum class RenderPass : uint8_t {
+    Shadow = 0,
+    Opaque = 1
+};
+
+/**
+ * @brief 64-bit draw sort key.
+ *
+ * From the most significant bit down:
+ *
+ *   | pass:4 | shader:8 | material:16 | mesh:16 | depth:20 |
+ *
+ * Sorting ascending groups draws by pass, then by the most expensive state
+ * (shader, material, mesh), and finally front to back so early depth
+ * rejection works inside each state bucket.
+ */
+namespace SortKey {
+
+inline constexpr uint32_t kDepthBits = 20;
+inline constexpr uint32_t kMeshBits = 16;
+inline constexpr uint32_t kMaterialBits = 16;
+inline constexpr uint32_t kShaderBits = 8;
+inline constexpr uint32_t kPassBits = 4;
+
+inline constexpr uint32_t kMeshShift = kDepthBits;
+inline constexpr uint32_t kMaterialShift = kMeshShift + kMeshBits;
+inline constexpr uint32_t kShaderShift = kMaterialShift + kMaterialBits;
+inline constexpr uint32_t kPassShift = kShaderShift + kShaderBits;
+
+inline constexpr uint32_t kMaxMeshes = 1u << kMeshBits;
+inline constexpr uint32_t kMaxMaterials = 1u << kMaterialBits;
+inline constexpr uint32_t kMaxShaders = 1u << kShaderBits;
+
+/**
+ * @brief Quantize a view depth to 20 bits; negative depths clamp to 0.
+ *
+ * Uses the top bits of the IEEE pattern, which is monotonic for positive
+ * floats, so no near/far range is needed.
+ */
+[[nodiscard]] uint32_t QuantizeDepth(float depth);
+
+/**
+ * @brief Pack the fields; each id is masked to its field width.
+ */
+[[nodiscard]] constexpr uint64_t Encode(RenderPass pass, uint32_t shader, uint32_t material,
+                                        uint32_t mesh, uint32_t depth) {
+    return (static_cast<uint64_t>(pass) & ((1u << kPassBits) - 1)) << kPassShift
+         | (static_cast<uint64_t>(shader) & (kMaxShaders - 1)) << kShaderShift
+         | (static_cast<uint64_t>(material) & (kMaxMaterials - 1)) << kMaterialShift
+         | (static_cast<uint64_t>(mesh) & (kMaxMeshes - 1)) << kMeshShift
+         | (static_cast<uint64_t>(depth) & ((1u << kDepthBits) - 1));
+}
+
+[[nodiscard]] constexpr RenderPass GetPass(uint64_t key) {
+    return static_cast<RenderPass>(key >> kPassShift);
+}
+
+[[nodiscard]] constexpr uint32_t GetMaterial(uint64_t key) {
+    return static_cast<uint32_t>(key >> kMaterialShift) & (kMaxMaterials - 1);
+}
+
+} // namespace SortKey
+
+/**
+ * @brief Compact sortable handle: the key plus the index of its DrawItem.
+ */
+struct DrawPacket {
+    uint64_t Key = 0;
+    uint32_t Item = 0;
+};
+
+/**
+ * @brief Packets [Begin, End) of a sorted RenderQueue, recorded as one unit.
+ */
+struct PacketRange {
+    uint32_t Begin = 0;
+    uint32_t End = 0;
+};
+
+/**
+ * @brief Per-instance vertex data read by the instanced scene shaders.
+ *
+ * Tightly packed to match GetInstanceLayout(). Besides the matrices it carries
+ * the scalar material parameters, so draws that differ only in those values
+ * still share one instanced batch.
+ */
+struct InstanceData {
+    Math::Matrix4 Transform;
+    Math::Matrix3 NormalMatrix;
+    float Material[4]{};   // albedo.rgb, metallic (Blinn-Phong: color.rgb, shininess)
+    float Surface[4]{};    // roughness, ao, unused, unused
+
+    /**
+     * @brief Per-instance layout: a_InstanceTransform, a_InstanceNormalMatrix,
+     *        a_InstanceMaterial and a_InstanceSurface from VertexArray::kInstanceAttributeBase.
+     */
+    [[nodiscard]] static BufferLayout GetLayout();
+};
+
+static_assert(sizeof(InstanceData) == 132, "InstanceData must stay tightly packed");
+
+/**
+ * @brief Everything needed to issue one draw once its state is bound.
+ *
+ * Meshes sub-allocated from a shared vertex array (MeshArena) are told apart
+ * by their index range and base vertex.
+ */
+struct DrawItem {
+    Shader* ShaderProgram = nullptr;
+    VertexArray* Mesh = nullptr;
+    uint32_t Material = 0;
+    uint32_t IndexCount = 0;
+    uint32_t FirstIndex = 0;
+    int32_t BaseVertex = 0;
+    uint32_t Entity = 0;
+    InstanceData Instance;
+};
+
+/**
+ * @brief Sort @p packets ascending by key with an LSD radix sort.
+ *
+ * Byte passes in which every key has the same digit are skipped, so keys
+ * that only differ in a few fields cost few passes. Stable; @p scratch is
+ * resized as needed and can be reused across frames.
+ */
+void SortDrawPackets(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch);
+
+/**
+ * @brief Per-frame list of draws that is sorted by key and replayed as instanced batches.
+ *
+ * Usage: Clear(), Push() every draw, Sort(), then Execute() with a hooks
+ * object providing
+ *
+ *   void OnInstances(const InstanceData* data, uint32_t count);   // upload, once per Execute
+ *   void OnShader(Shader& shader);                                // after a shader bind
+ *   void OnMaterial(Shader& shader, uint32_t material);           // material changed
+ *   void OnBatch(VertexArray& mesh, uint32_t firstInstance);      // point mesh at its instances
+ *
+ * Execute() gathers the instance data in sorted order, so consecutive
+ * packets with the same shader, material and mesh form one contiguous run
+ * that is drawn with a single instanced call. Shaders and vertex arrays are
+ * bound through the RendererAPI only when they differ from the previous
+ * batch, and each change is counted in RenderStats.
+ */
+class RenderQueue {
+public:
+    void Clear();
+    void Reserve(size_t count);
+
+    /** @brief Queue a draw; items without a shader or mesh are dropped. */
+    void Push(uint64_t key, const DrawItem& item);
+    void Sort();
+
+    [[nodiscard]] size_t GetSize() const noexcept { return m_Packets.size(); }
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_Packets.empty(); }
+    [[nodiscard]] const std::vector<DrawPacket>& GetPackets() const noexcept { return m_Packets; }
+    [[nodiscard]] const DrawItem& GetItem(const DrawPacket& packet) const { return m_Items[packet.Item]; }
+
+    template<typename Hooks>
+    void Execute(RendererAPI& api, RenderStats& stats, Hooks& hooks);
+
+    /**
+     * @brief Split the sorted packets into at most @p maxRanges ranges for parallel recording.
+     *
+     * Ranges hold about the same number of packets and only end where
+     * Execute() starts a new batch, so recording each range into its own
+     * command buffer (Vulkan secondary buffers) issues the same draws as
+     * recording the whole queue. Recorders must rebind all state at the
+     * start of every range.
+     */
+    void Partition(uint32_t maxRanges, std::vector<PacketRange>& ranges) const;
+
+private:
+    /** @brief Whether @p next continues the instanced batch of @p item. */
+    [[nodiscard]] static bool IsSameBatch(const DrawItem& item, const DrawItem& next) {
+        return next.ShaderProgram == item.ShaderProgram && next.Material == item.Material
+            && next.Mesh == item.Mesh && next.IndexCount == item.IndexCount
+            && next.FirstIndex == item.FirstIndex && next.BaseVertex == item.BaseVertex;
+    }
+
+    std::vector<DrawPacket> m_Packets;
+    std::vector<DrawPacket> m_Scratch;
+    std::vector<DrawItem> m_Items;
+    std::vector<InstanceData> m_Instances;
+};
+
+template<typename Hooks>
+void RenderQueue::Execute(RendererAPI& api, RenderStats& stats, Hooks& hooks) {
+    if (m_Packets.empty()) {
+        return;
+    }
+
+    m_Instances.clear();
+    m_Instances.reserve(m_Packets.size());
+    for (const DrawPacket& packet : m_Packets) {
+        m_Instances.push_back(m_Items[packet.Item].Instance);
+    }
+    hooks.OnInstances(m_Instances.data(), static_cast<uint32_t>(m_Instances.size()));
+
+    Shader* currentShader = nullptr;
+    VertexArray* currentMesh = nullptr;
+    uint32_t currentMaterial = 0;
+    bool materialBound = false;
+
+    const size_t count = m_Packets.size();
+    size_t first = 0;
+    while (first < count) {
+        const DrawItem& item = m_Items[m_Packets[first].Item];
+
+        size_t last = first + 1;
+        while (last < count && IsSameBatch(item, m_Items[m_Packets[last].Item])) {
+            ++last;
+        }
+
+        if (item.ShaderProgram != currentShader) {
+            currentShader = item.ShaderProgram;
+            api.BindShader(*currentShader);
+            hooks.OnShader(*currentShader);
+            materialBound = false; // material uniforms live in the program
+            stats.ShaderBinds++;
+        }
+        if (!materialBound || item.Material != currentMaterial) {
+            currentMaterial = item.Material;
+            materialBound = true;
+            hooks.OnMaterial(*currentShader, currentMaterial);
+            stats.MaterialBinds++;
+        }
+        if (item.Mesh != currentMesh) {
+            currentMesh = item.Mesh;
+            api.BindVertexArray(currentMesh);
+            stats.MeshBinds++;
+        }
+
+        const auto instances = static_cast<uint32_t>(last - first);
+        hooks.OnBatch(*currentMesh, static_cast<uint32_t>(first));
+        api.DrawBound(item.IndexCount, instances, item.FirstIndex, item.BaseVertex);
+        stats.DrawCalls++;
+        stats.Instances += instances;
+        stats.Triangles += item.IndexCount / 3 * instances;
+        first = last;
+    }
+
+    api.BindVertexArray(nullptr);
+}
+
+} // namespace Zgine
@@ -8,6 +8,25 @@ namespace Zgine {
 struct RenderStats {
     uint32_t DrawCalls = 0;
     uint32_t Triangles = 0;
+    uint32_t Instances = 0; // objects drawn; DrawCalls counts the instanced batches
+
+    // Frustum culling: renderables kept / rejected for the camera and shadow passes;
+    // shadow casters are counted once per cascade.
+    uint32_t VisibleObjects = 0;
+    uint32_t CulledObjects = 0;
+    uint32_t ShadowCastersVisible = 0;
+    uint32_t ShadowCastersCulled = 0;
+
+    // Clustered lighting: point and spot lights in range, and their cluster list entries.
+    uint32_t Lights = 0;
+    uint32_t LightClusterEntries = 0;
+
+    // State changes issued by the render queue after redundant binds were skipped.
+    uint32_t ShaderBinds = 0;
+    uint32_t MaterialBinds = 0;
+    uint32_t MeshBinds = 0;
+
+    [[nodiscard]] uint32_t GetStateChanges() const { return ShaderBinds + MaterialBinds + MeshBinds; }
 };
 
 } // namespace Zgine
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 #include <Zgine/Renderer/Pipeline/RenderStats.h>
 #include <Zgine/Renderer/Pipeline/RenderConfig.h>
 #include <Zgine/Renderer/Lighting/LightData.h>
+#include <Zgine/Renderer/Lighting/LightClusters.h>
+#include <Zgine/Renderer/Lighting/ShadowCascades.h>
 #include <Zgine/Renderer/PostProcess/PostProcessPipeline.h>
+#include <Zgine/Renderer/Culling/SceneCuller.h>
+#include <Zgine/Renderer/Pipeline/RenderQueue.h>
 #include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Resources/Core/AssetHandle.h>
 
 namespace Zgine {
     class World;
@@ -16,6 +24,9 @@ namespace Zgine {
     class Framebuffer;
     class VertexArray;
     class VertexBuffer;
+    class UniformBuffer;
+    class TextureBuffer;
+    class JobSystem;
     class Entity;
 
     class RenderSystem {
@@ -37,23 +48,76 @@ namespace Zgine {
         [[nodiscard]] const RenderStats&  GetStats()        const { return m_FrameStats; }
         PostProcessPipeline& GetPostProcess() { return m_PostProcess; }
 
+        /**
+         * @brief Job system shader sources are read, light clusters are built and texture mips
+         *        are loaded on; nullptr runs serially.
+         *
+         * Set it before Initialize() for the shader reads and texture streaming to use it.
+         */
+        void SetJobSystem(JobSystem* jobs) noexcept { m_JobSystem = jobs; }
+
     private:
         void CollectLights(World& world, LightingData& lightData);
-        void SetupLightUniforms(Shader* shader, const LightingData& lightData);
-        void SetupMaterialUniforms(Shader* shader, World& world, uint32_t entity);
-        void RenderShadowPass(World* world);
+        void UploadLightClusters(const Camera& camera);
+        void SetupMaterialUniforms(World& world, uint32_t entity);
+        /** @brief Load the mesh assets of MeshComponents whose handle is not resolved yet. */
+        void ResolveMeshes(World& world);
+        void RenderShadowPass(World* world, const Camera& camera);
+        void CollectVisible(World& world, const Math::Matrix4& viewProjection,
+                            uint32_t& visibleCount, uint32_t& culledCount);
+        void BuildQueue(World& world, RenderPass pass, Shader* shader,
+                        const Math::Vector3& eye, const Math::Vector3& forward);
+        /** @brief Screen-height fraction covered by a bounding sphere, from m_LodView. */
+        [[nodiscard]] float GetScreenSize(const Math::Vector3& center, float radius) const;
 
         Shader* GetActiveShader() const;
+        /** @brief Set up the scene shaders whose background build finished. */
+        void PollShaders();
+        void ConfigureSceneShader(Shader& shader);
 
         RenderConfig               m_Config;
         std::shared_ptr<Shader>    m_SimpleShader;
         std::shared_ptr<Shader>    m_PBRShader;
         std::shared_ptr<Shader>    m_DepthShader;
+        std::shared_ptr<Shader>    m_FallbackShader; // drawn with until the scene shaders are ready
+        struct {
+            bool Simple = false;
+            bool PBR = false;
+            bool Depth = false;
+        }                          m_ReadyShaders;   // built and configured
+        bool                       m_ShadersPending = false;
+        std::chrono::steady_clock::time_point m_ShaderBuildStart;
         std::shared_ptr<Framebuffer> m_ShadowMapFBO;
-        Math::Matrix4              m_LightSpaceMatrix;
+        std::array<ShadowCascade, kMaxShadowCascades> m_Cascades{}; // one layer of m_ShadowMapFBO each
+        uint32_t                   m_CascadeCount = 0;              // cascades drawn this frame
+        struct {
+            Math::Vector3 Eye{0.0f};
+            float ProjectionScale = 1.0f; // P(1,1) of the camera projection
+            bool Perspective = true;
+        }                          m_LodView;        // main camera; shadows pick the same mesh LODs
+        uint32_t                   m_ViewportHeight = 720; // turns screen sizes into pixels for texture streaming
         LightingData               m_LightingData{};
         PostProcessPipeline        m_PostProcess;
         bool                       m_Initialized = false;
         RenderStats                m_FrameStats{};
+        SceneCuller                m_Culler;
+        std::vector<uint32_t>      m_VisibleEntities;
+        std::unordered_set<AssetHandle> m_FailedMeshes; // warned about until they load again
+
+        // Per-frame sort ids for shaders, meshes and materials (defined in the .cpp).
+        struct DrawTables;
+        std::unique_ptr<DrawTables> m_DrawTables;
+        RenderQueue                m_Queue;
+        std::shared_ptr<VertexBuffer> m_InstanceBuffer; // InstanceData for the pass being drawn
+        std::shared_ptr<UniformBuffer> m_CameraUniforms;   // CameraBlock
+        std::shared_ptr<UniformBuffer> m_LightUniforms;    // LightsBlock
+        std::shared_ptr<UniformBuffer> m_MaterialUniforms; // MaterialBlock
+
+        // Clustered point and spot lights, read by the scene shaders with texelFetch.
+        LightClusters                  m_LightClusters;
+        std::shared_ptr<TextureBuffer> m_ClusterCells;   // ClusterCell per cluster
+        std::shared_ptr<TextureBuffer> m_ClusterIndices; // light indices
+        std::shared_ptr<TextureBuffer> m_ClusterLights;  // ClusterLight per light
+        JobSystem*                     m_JobSystem = nullptr;
     };
 }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Zgine {
+
+class JobSystem;
+
+/**
+ * @brief Normalize GLSL text read from disk: drop a UTF-8 BOM and turn CRLF/CR line ends into LF.
+ *
+ * Some drivers reject a BOM, and identical shaders checked out with
+ * different line endings then share one ShaderCache entry.
+ */
+[[nodiscard]] std::string PreprocessShaderSource(std::string source);
+
+/**
+ * @brief Read and preprocess shader files, one job per file when @p jobs is given.
+ *
+ * The result has one entry per path, in order; a file that cannot be read
+ * gives an empty string (File::ReadFile logs why).
+ */
+[[nodiscard]] std::vector<std::string> ReadShaderSources(std::initializer_list<std::string_view> paths, JobSystem* jobs);
+
+} // namespace Zgine
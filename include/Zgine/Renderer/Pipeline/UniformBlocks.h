@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Zgine/Renderer/Lighting/LightData.h>
+#include <Zgine/Renderer/Lighting/ShadowCascades.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <cstdint>
+
+namespace Zgine {
+
+/**
+ * @brief UniformBuffer binding points shared by the scene shaders.
+ */
+namespace UniformBinding {
+
+inline constexpr uint32_t Camera = 0;
+inline constexpr uint32_t Lights = 1;
+inline constexpr uint32_t Material = 2;
+
+} // namespace UniformBinding
+
+// CPU mirrors of the std140 blocks declared in assets/shaders. In std140 a
+// vec3 is 16-byte aligned, so every vec3 is followed by a scalar or padding,
+// and structs and arrays of structs round up to 16 bytes.
+
+/** @brief `uniform Camera`: uploaded once per frame. */
+struct CameraBlock {
+    Math::Matrix4 ViewProjection;
+    float CameraPosition[3]{};
+    int32_t EnableShadows = 0;
+    float ViewDepth[4]{};     // dot(vec4(worldPos, 1), ViewDepth) = distance in front of the camera
+    uint32_t ClusterDims[4]{}; // tiles x, tiles y, depth slices, unused
+    float ClusterDepth[4]{};   // near, slices / log(far / near), unused, unused
+    float CascadeSplits[kMaxShadowCascades]{}; // far view depth of each cascade; 0 = unused
+    Math::Matrix4 CascadeMatrices[kMaxShadowCascades]; // world -> light clip space per cascade
+};
+
+struct DirectionalLightBlock {
+    float Direction[3];
+    float Pad0;
+    float Color[3];        // pre-multiplied by intensity
+    float Pad1;
+};
+
+/**
+ * @brief `uniform Lights`: uploaded once per frame.
+ *
+ * Point and spot lights are not part of the block; they are clustered on
+ * the CPU and read from texture buffers (see LightClusters).
+ */
+struct LightsBlock {
+    DirectionalLightBlock Directional;
+};
+
+/** @brief `uniform Material`: texture switches, uploaded when the material changes. */
+struct MaterialBlock {
+    int32_t UseAlbedoMap = 0;
+    int32_t UseNormalMap = 0;
+    int32_t UseMetallicMap = 0;
+    int32_t UseRoughnessMap = 0;
+    int32_t UseAOMap = 0;
+    int32_t Pad[3]{};
+};
+
+static_assert(sizeof(CameraBlock) == 400, "CameraBlock must match the std140 layout");
+static_assert(sizeof(DirectionalLightBlock) == 32, "DirectionalLightBlock must match the std140 layout");
+static_assert(sizeof(LightsBlock) == 32, "LightsBlock must match the std140 layout");
+static_assert(sizeof(MaterialBlock) == 32, "MaterialBlock must match the std140 layout");
+
+/**
+ * @brief Pack the directional light of @p lights; its color is pre-multiplied by intensity.
+ */
+[[nodiscard]] LightsBlock MakeLightsBlock(const LightingData& lights);
+
+} // namespace Zgine
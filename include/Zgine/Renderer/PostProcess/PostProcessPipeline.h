@@ -6,18 +6,21 @@ namespace Zgine {
 
 class Shader;
 class Framebuffer;
+class JobSystem;
 
 class PostProcessPipeline {
 public:
     PostProcessPipeline();
     ~PostProcessPipeline();
 
-    void Initialize(uint32_t width, uint32_t height);
+    // Shader sources are read on @p jobs when given
+    void Initialize(uint32_t width, uint32_t height, JobSystem* jobs = nullptr);
     void Shutdown();
     void Resize(uint32_t width, uint32_t height);
 
     // Run full post-process chain on the scene framebuffer's color attachment
-    // Returns the final texture ID to display
+    // Returns the final texture ID to display; the scene texture itself until
+    // the post-process shaders have finished compiling
     uint32_t Process(uint32_t sceneColorTexture);
 
     void SetBloomEnabled(bool enabled) { m_BloomEnabled = enabled; }
@@ -27,6 +30,8 @@ public:
 private:
     void CreateFullscreenQuad();
     void DrawFullscreenQuad();
+    // Set sampler slots once all shaders are built; false while any is still compiling
+    bool PollShaders();
 
     std::shared_ptr<Shader> m_BrightPassShader;
     std::shared_ptr<Shader> m_BlurShader;
@@ -48,6 +53,7 @@ private:
     uint32_t m_Width = 0;
     uint32_t m_Height = 0;
     bool m_Initialized = false;
+    bool m_ShadersReady = false;
 };
 
 } // namespace Zgine
@@ -20,7 +20,12 @@ enum class ShaderDataType : uint8_t {
     Int2,
     Int3,
     Int4,
-    Bool
+    Bool,
+    // Packed vertex formats; read as floats by the shader (normalized when the element says so).
+    UShort4,    // 4 x 16-bit unsigned
+    Half2,      // 2 x IEEE half float
+    Int1010102, // signed 10:10:10:2 in one 32-bit word
+    UByte4      // 4 x 8-bit unsigned
 };
 
 inline uint32_t ShaderDataTypeSize(ShaderDataType type) {
@@ -36,12 +41,24 @@ inline uint32_t ShaderDataTypeSize(ShaderDataType type) {
         case ShaderDataType::Int3:   return 4 * 3;
         case ShaderDataType::Int4:   return 4 * 4;
         case ShaderDataType::Bool:   return 4;
+        case ShaderDataType::UShort4:    return 2 * 4;
+        case ShaderDataType::Half2:      return 2 * 2;
+        case ShaderDataType::Int1010102: return 4;
+        case ShaderDataType::UByte4:     return 4;
         case ShaderDataType::None:   return 0;
     }
 
     return 0;
 }
 
+/**
+ * @brief How often a vertex buffer advances: once per vertex or once per instance.
+ */
+enum class VertexStepRate : uint8_t {
+    PerVertex = 0,
+    PerInstance
+};
+
 struct BufferElement {
     std::string Name;
     ShaderDataType Type = ShaderDataType::None;
@@ -72,6 +89,10 @@ struct BufferElement {
             case ShaderDataType::Int3:   return 3;
             case ShaderDataType::Int4:   return 4;
             case ShaderDataType::Bool:   return 1;
+            case ShaderDataType::UShort4:    return 4;
+            case ShaderDataType::Half2:      return 2;
+            case ShaderDataType::Int1010102: return 4;
+            case ShaderDataType::UByte4:     return 4;
             case ShaderDataType::None:   return 0;
         }
 
@@ -83,13 +104,27 @@ class BufferLayout {
 public:
     BufferLayout() = default;
 
-    BufferLayout(std::initializer_list<BufferElement> elements)
+    BufferLayout(std::initializer_list<BufferElement> elements, VertexStepRate stepRate = VertexStepRate::PerVertex)
         : m_Elements(elements)
+        , m_StepRate(stepRate)
     {
         CalculateOffsetsAndStride();
     }
 
     [[nodiscard]] uint32_t GetStride() const { return m_Stride; }
+    [[nodiscard]] VertexStepRate GetStepRate() const { return m_StepRate; }
+    [[nodiscard]] bool IsPerInstance() const { return m_StepRate == VertexStepRate::PerInstance; }
+
+    /**
+     * @brief Number of vertex attribute slots the layout occupies (matrices take one per column).
+     */
+    [[nodiscard]] uint32_t GetAttributeCount() const {
+        uint32_t count = 0;
+        for (const BufferElement& element : m_Elements) {
+            count += element.Type == ShaderDataType::Mat4 ? 4 : element.Type == ShaderDataType::Mat3 ? 3 : 1;
+        }
+        return count;
+    }
     [[nodiscard]] const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
     std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
@@ -111,6 +146,7 @@ private:
 
     std::vector<BufferElement> m_Elements;
     uint32_t m_Stride = 0;
+    VertexStepRate m_StepRate = VertexStepRate::PerVertex;
 };
 
 } // namespace Zgine
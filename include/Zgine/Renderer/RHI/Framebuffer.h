@@ -11,6 +11,7 @@ struct FramebufferSpec {
     bool HDR = true;            // GL_RGBA16F vs GL_RGBA8
     bool DepthStencil = true;   // depth+stencil renderbuffer
     bool DepthTexture = false;  // depth as texture (for shadow maps, readable in shader)
+    uint32_t Layers = 1;        // >1 with DepthTexture: depth texture array (shadow cascades)
 };
 
 class Framebuffer {
@@ -20,6 +21,8 @@ public:
     virtual void Bind() = 0;
     virtual void Unbind() = 0;
     virtual void Resize(uint32_t width, uint32_t height) = 0;
+    /** @brief Render into one layer of a layered depth texture; Bind() starts at layer 0. */
+    virtual void BindLayer(uint32_t layer) = 0;
 
     virtual uint32_t GetColorAttachmentID() const = 0;
     virtual uint32_t GetDepthAttachmentID() const = 0;
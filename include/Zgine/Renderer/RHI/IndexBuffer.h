@@ -15,7 +15,16 @@ namespace Zgine {
         virtual uint32_t GetCount() const = 0;
         virtual uint32_t GetID() const = 0;
 
+        /**
+         * @brief Overwrite @p count indices starting at index @p firstIndex; the range must fit the buffer.
+         *
+         * Does not disturb the index buffer of the currently bound vertex array.
+         */
+        virtual void SetSubData(const uint32_t* indices, uint32_t count, uint32_t firstIndex) = 0;
+
         static std::shared_ptr<IndexBuffer> Create(uint32_t* indices, uint32_t count);
+        /** @brief Buffer of @p count indices, filled later with SetSubData(). */
+        static std::shared_ptr<IndexBuffer> Create(uint32_t count);
     };
 
 }
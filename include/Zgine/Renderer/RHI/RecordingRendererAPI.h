@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief One call captured by RecordingRendererAPI.
+ */
+struct RecordedCommand {
+    enum class Type : uint8_t {
+        SetViewport,
+        SetClearColor,
+        Clear,
+        BindShader,
+        BindVertexArray,
+        DrawIndexed,
+        DrawIndexedInstanced,
+        DrawBound
+    };
+
+    Type Kind = Type::Clear;
+    const void* Object = nullptr;   // shader or vertex array, identity only
+    uint32_t Count = 0;             // index count for draws
+    uint32_t Instances = 0;         // instance count for draws
+    uint32_t FirstIndex = 0;        // DrawBound only
+    int32_t BaseVertex = 0;         // DrawBound only
+};
+
+/**
+ * @brief Headless backend that records commands instead of talking to a GPU.
+ *
+ * Used by tests and tools to check what the renderer submits (draw order,
+ * redundant state changes) without a window or context. Bound objects are
+ * recorded by address and never dereferenced, so any Shader or VertexArray
+ * implementation works.
+ */
+class RecordingRendererAPI final : public RendererAPI {
+public:
+    void Init() override {}
+    void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    void SetClearColor(const Math::Vector4& color) override;
+    void Clear() override;
+    void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+    void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                              uint32_t instanceCount) override;
+
+    void BindShader(const Shader& shader) override;
+    void BindVertexArray(const VertexArray* vertexArray) override;
+    void DrawBound(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0,
+                   int32_t baseVertex = 0) override;
+
+    [[nodiscard]] const std::vector<RecordedCommand>& GetCommands() const noexcept { return m_Commands; }
+    [[nodiscard]] size_t CountCommands(RecordedCommand::Type type) const;
+    void Reset() { m_Commands.clear(); }
+
+private:
+    std::vector<RecordedCommand> m_Commands;
+};
+
+} // namespace Zgine
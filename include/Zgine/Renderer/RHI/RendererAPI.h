@@ -6,6 +6,7 @@
 
 namespace Zgine {
 
+class Shader;
 class VertexArray;
 
 /**
@@ -29,6 +30,26 @@ public:
     virtual void Clear() = 0;
 
     virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+    /**
+     * @brief Draw @p instanceCount instances; per-instance attributes come from the
+     *        vertex array's instance buffer (VertexArray::SetInstanceBuffer).
+     */
+    virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                      uint32_t instanceCount);
+
+    // Explicit state path used by RenderQueue: bind once, then draw many times.
+    virtual void BindShader(const Shader& shader);
+    /** @brief Bind @p vertexArray for DrawBound(); nullptr unbinds. */
+    virtual void BindVertexArray(const VertexArray* vertexArray);
+    /**
+     * @brief Draw @p indexCount indices of @p instanceCount instances from the bound vertex array.
+     *
+     * Indices are read from @p firstIndex on and @p baseVertex is added to
+     * each of them, so meshes sub-allocated from shared buffers (MeshArena)
+     * draw without rebinding.
+     */
+    virtual void DrawBound(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0,
+                           int32_t baseVertex = 0);
 
     static API GetAPI() { return s_API; }
     static void SetAPI(API api);
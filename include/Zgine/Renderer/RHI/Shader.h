@@ -25,8 +25,25 @@ public:
     virtual void SetUniformMat3f(const std::string& name, const Math::Matrix3& matrix) = 0;
     virtual void SetUniformMat4f(const std::string& name, const Math::Matrix4& matrix) = 0;
 
+    /**
+     * @brief Connect the uniform block @p blockName to a UniformBuffer binding point.
+     *
+     * Call once after creation; the association is stored in the program.
+     */
+    virtual void SetUniformBlockBinding(const std::string& blockName, uint32_t binding) = 0;
+
     virtual uint32_t GetID() const = 0;
 
+    /**
+     * @brief Whether the program has finished building.
+     *
+     * Backends may compile and link in the background after Create(). Using
+     * a shader that is not ready yet (Bind, uniforms) waits for it, so poll
+     * this first and draw with something else meanwhile. Backends that cannot
+     * build in the background finish the program here instead.
+     */
+    virtual bool IsReady() const = 0;
+
     static std::shared_ptr<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
     static std::shared_ptr<Shader> Create(const std::string& filepath);
 };
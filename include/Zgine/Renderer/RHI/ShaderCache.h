@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief On-disk cache of linked shader program binaries.
+ *
+ * Entries are keyed by ComputeKey() over the stage sources (which carry any
+ * #defines) and the driver identity, so editing a shader or updating the
+ * driver simply misses and the caller compiles from source again. Each entry
+ * is one file under the cache directory; a truncated, corrupt or foreign file
+ * reads as a miss.
+ *
+ * The cache only stores bytes. Whether a blob is still accepted by the driver
+ * is up to the backend, which should Remove() entries it rejects.
+ */
+class ShaderCache {
+public:
+    /** @brief Default location, relative to the working directory. */
+    static constexpr const char* kDefaultDirectory = "cache/shaders";
+
+    struct Entry {
+        uint32_t Format = 0;          // backend binary format (e.g. the GL binaryFormat enum)
+        std::vector<uint8_t> Binary;
+    };
+
+    explicit ShaderCache(std::filesystem::path directory = kDefaultDirectory);
+
+    /**
+     * @brief Key of a program built from @p sources (in stage order) on the driver @p driverIdentity.
+     */
+    [[nodiscard]] static uint64_t ComputeKey(std::initializer_list<std::string_view> sources, std::string_view driverIdentity);
+
+    /** @brief Read the entry for @p key; false on a miss or an unreadable entry. */
+    bool Load(uint64_t key, Entry& entry);
+    /** @brief Write the entry for @p key, replacing any previous one; false when it could not be written. */
+    bool Store(uint64_t key, const Entry& entry);
+    void Remove(uint64_t key);
+
+    [[nodiscard]] const std::filesystem::path& GetDirectory() const noexcept { return m_Directory; }
+    [[nodiscard]] std::filesystem::path GetEntryPath(uint64_t key) const;
+
+    [[nodiscard]] uint32_t GetHitCount() const noexcept { return m_Hits; }
+    [[nodiscard]] uint32_t GetMissCount() const noexcept { return m_Misses; }
+
+private:
+    std::filesystem::path m_Directory;
+    uint32_t m_Hits = 0;
+    uint32_t m_Misses = 0;
+};
+
+} // namespace Zgine
@@ -3,6 +3,7 @@
 #include <string>
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 namespace Zgine {
 
@@ -13,6 +14,20 @@ namespace Zgine {
         bool Linear = true;
     };
 
+    /** @brief Storage of pre-built texture data, see Texture::Create(TextureFormat, ...). */
+    enum class TextureFormat : uint8_t {
+        RGBA8 = 0, // 4 bytes per texel
+        BC3        // DXT5: 16 bytes per 4x4 block, RGB in BC1 plus interpolated alpha
+    };
+
+    /** @brief One mip level of pre-built data; borrowed for the duration of the upload only. */
+    struct TextureMip {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        const void* Data = nullptr;
+        size_t Size = 0;
+    };
+
     class Texture {
     public:
         virtual ~Texture() = default;
@@ -25,10 +40,43 @@ namespace Zgine {
         virtual uint32_t GetID() const = 0;
         virtual const std::string& GetFilePath() const = 0;
 
+        /** @brief Bytes the texture occupies on the GPU, mips included. */
+        virtual size_t GetMemorySize() const { return 0; }
+
+        /**
+         * @brief Finest level on the GPU, counted in the full chain. Non-zero only
+         *        for textures created from a mip chain with firstMip > 0 or
+         *        changed by SetResidentMips(); GetWidth()/GetHeight() stay the
+         *        level 0 size either way.
+         */
+        virtual uint32_t GetResidentMip() const { return 0; }
+
+        /**
+         * @brief Keep levels [firstMip, end) of @p mips, the full chain the
+         *        texture was created from, on the GPU. Used by TextureStreamer to
+         *        add or drop high mips: only levels not yet resident are uploaded,
+         *        dropping levels uploads nothing, and GetID() stays the same.
+         * @return false when the texture was not created from a mip chain.
+         */
+        virtual bool SetResidentMips(const std::vector<TextureMip>& mips, uint32_t firstMip) {
+            (void)mips;
+            (void)firstMip;
+            return false;
+        }
+
         static std::shared_ptr<Texture> Create(const std::string& path);
         static std::shared_ptr<Texture> Create(const std::string& path, const TextureSettings& settings);
         static std::shared_ptr<Texture> Create(const unsigned char* data, int size, const std::string& debugName);
         static std::shared_ptr<Texture> Create(const unsigned char* rgbaData, int width, int height, const std::string& debugName);
+        /**
+         * @brief Upload a complete mip chain as is, largest level first; nothing is
+         *        decoded or generated. settings.GenerateMipmaps is ignored: the
+         *        filter uses mipmaps whenever more than one level is given.
+         * @param firstMip Upload levels [firstMip, end) only; see SetResidentMips().
+         */
+        static std::shared_ptr<Texture> Create(TextureFormat format, const std::vector<TextureMip>& mips,
+                                               const TextureSettings& settings, const std::string& debugName,
+                                               uint32_t firstMip = 0);
     };
 
 }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+
+namespace Zgine {
+
+    /** @brief Texel format a TextureBuffer is sampled with. */
+    enum class TextureBufferFormat : uint8_t {
+        R32UI = 0,  // usamplerBuffer, one uint per texel
+        RG32UI,     // usamplerBuffer, two uints per texel
+        RGBA32F     // samplerBuffer, one vec4 per texel
+    };
+
+    /**
+     * @brief Linear GPU buffer read in shaders with texelFetch().
+     *
+     * Used for per-frame arrays too large for a uniform block, such as the
+     * clustered light lists. Unlike a Texture it has no filtering or mips and
+     * is addressed by texel index.
+     */
+    class TextureBuffer {
+    public:
+        virtual ~TextureBuffer() = default;
+
+        /** @brief Replace the contents; the buffer grows as needed. */
+        virtual void SetData(const void* data, uint32_t size) = 0;
+        virtual void Bind(uint32_t slot) const = 0;
+
+        virtual TextureBufferFormat GetFormat() const = 0;
+        virtual uint32_t GetCapacity() const = 0;
+
+        /** @brief Buffer with room for @p size bytes, filled later with SetData(). */
+        static std::shared_ptr<TextureBuffer> Create(TextureBufferFormat format, uint32_t size);
+    };
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+
+namespace Zgine {
+
+    /**
+     * @brief GPU buffer backing a std140 uniform block.
+     *
+     * The buffer is attached to a fixed binding point when it is created;
+     * shaders connect their blocks to the same point with
+     * Shader::SetUniformBlockBinding(). Contents are uploaded with SetData()
+     * once per frame or per material rather than uniform by uniform.
+     */
+    class UniformBuffer {
+    public:
+        virtual ~UniformBuffer() = default;
+
+        /** @brief Upload @p size bytes at @p offset; the range must fit in the buffer. */
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+        virtual uint32_t GetSize() const = 0;
+        virtual uint32_t GetBinding() const = 0;
+
+        static std::shared_ptr<UniformBuffer> Create(uint32_t size, uint32_t binding);
+    };
+
+}
@@ -11,6 +11,14 @@ namespace Zgine {
 
     class VertexArray {
     public:
+        /**
+         * @brief First attribute location used by per-instance data.
+         *
+         * Locations below it belong to the mesh's own vertex layout; shaders
+         * declare instance inputs from here on (see assets/shaders).
+         */
+        static constexpr uint32_t kInstanceAttributeBase = 4;
+
         virtual ~VertexArray() = default;
 
         virtual void Bind() const = 0;
@@ -19,6 +27,15 @@ namespace Zgine {
         virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) = 0;
         virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) = 0;
 
+        /**
+         * @brief Source per-instance attributes from @p instanceBuffer, starting at @p firstInstance.
+         *
+         * Cheap when nothing changed, so renderers may call it before every
+         * instanced draw. Shared meshes can be drawn with different instance
+         * ranges of one buffer this way without base-instance support.
+         */
+        virtual void SetInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer, uint32_t firstInstance = 0) = 0;
+
         virtual uint32_t GetID() const = 0;
         virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const = 0;
 
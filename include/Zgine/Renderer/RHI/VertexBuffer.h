@@ -18,7 +18,18 @@ namespace Zgine {
         virtual void SetLayout(const BufferLayout& layout) = 0;
         virtual const BufferLayout& GetLayout() const = 0;
 
+        /**
+         * @brief Replace the contents; the buffer grows as needed. Meant for dynamic buffers.
+         */
+        virtual void SetData(const void* data, uint32_t size) = 0;
+        /**
+         * @brief Overwrite @p size bytes at @p offset without touching the rest; the range must fit the buffer.
+         */
+        virtual void SetSubData(const void* data, uint32_t size, uint32_t offset) = 0;
+
         static std::shared_ptr<VertexBuffer> Create(const void* data, uint32_t size);
+        /** @brief Dynamic buffer of @p size bytes, filled later with SetData(). */
+        static std::shared_ptr<VertexBuffer> Create(uint32_t size);
     };
 
 }
@@ -18,7 +18,10 @@ public:
 
     AssetHandle GetHandle() const { return m_Handle; }
     virtual AssetType GetType() const = 0;
+    /** @brief Bytes the asset holds in system memory. */
     virtual size_t GetSizeBytes() const = 0;
+    /** @brief Bytes the asset holds in GPU memory. */
+    virtual size_t GetGpuSizeBytes() const { return 0; }
 
 private:
     AssetHandle m_Handle;
@@ -26,30 +29,32 @@ private:
 
 class TextureAsset final : public Asset {
 public:
-    TextureAsset(AssetHandle handle, std::shared_ptr<Texture> texture, size_t sizeBytes)
-        : Asset(handle), m_Texture(std::move(texture)), m_SizeBytes(sizeBytes) {}
+    TextureAsset(AssetHandle handle, std::shared_ptr<Texture> texture, size_t gpuSizeBytes)
+        : Asset(handle), m_Texture(std::move(texture)), m_GpuSizeBytes(gpuSizeBytes) {}
 
     AssetType GetType() const override { return AssetType::Texture; }
-    size_t GetSizeBytes() const override { return m_SizeBytes; }
+    size_t GetSizeBytes() const override { return 0; }
+    size_t GetGpuSizeBytes() const override { return m_GpuSizeBytes; }
     const std::shared_ptr<Texture>& GetTexture() const { return m_Texture; }
 
 private:
     std::shared_ptr<Texture> m_Texture;
-    size_t m_SizeBytes = 0;
+    size_t m_GpuSizeBytes = 0;
 };
 
 class MeshAsset final : public Asset {
 public:
-    MeshAsset(AssetHandle handle, std::vector<std::shared_ptr<Mesh>> meshes, size_t sizeBytes)
-        : Asset(handle), m_Meshes(std::move(meshes)), m_SizeBytes(sizeBytes) {}
+    MeshAsset(AssetHandle handle, std::vector<std::shared_ptr<Mesh>> meshes, size_t gpuSizeBytes)
+        : Asset(handle), m_Meshes(std::move(meshes)), m_GpuSizeBytes(gpuSizeBytes) {}
 
     AssetType GetType() const override { return AssetType::Mesh; }
-    size_t GetSizeBytes() const override { return m_SizeBytes; }
+    size_t GetSizeBytes() const override { return 0; }
+    size_t GetGpuSizeBytes() const override { return m_GpuSizeBytes; }
     const std::vector<std::shared_ptr<Mesh>>& GetMeshes() const { return m_Meshes; }
 
 private:
     std::vector<std::shared_ptr<Mesh>> m_Meshes;
-    size_t m_SizeBytes = 0;
+    size_t m_GpuSizeBytes = 0;
 };
 
 class AudioAsset final : public Asset {
@@ -68,16 +73,17 @@ private:
 
 class ShaderAsset final : public Asset {
 public:
-    ShaderAsset(AssetHandle handle, std::shared_ptr<Shader> shader, size_t sizeBytes)
-        : Asset(handle), m_Shader(std::move(shader)), m_SizeBytes(sizeBytes) {}
+    ShaderAsset(AssetHandle handle, std::shared_ptr<Shader> shader, size_t gpuSizeBytes)
+        : Asset(handle), m_Shader(std::move(shader)), m_GpuSizeBytes(gpuSizeBytes) {}
 
     AssetType GetType() const override { return AssetType::Shader; }
-    size_t GetSizeBytes() const override { return m_SizeBytes; }
+    size_t GetSizeBytes() const override { return 0; }
+    size_t GetGpuSizeBytes() const override { return m_GpuSizeBytes; }
     const std::shared_ptr<Shader>& GetShader() const { return m_Shader; }
 
 private:
     std::shared_ptr<Shader> m_Shader;
-    size_t m_SizeBytes = 0;
+    size_t m_GpuSizeBytes = 0;
 };
 
 }
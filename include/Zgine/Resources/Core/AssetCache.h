@@ -0,0 +1,160 @@
+#pragma once
+
+#include <Zgine/Resources/Core/Asset.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Zgine {
+
+class MemoryPool;
+
+struct AssetCacheConfig {
+    /** @brief System-memory bytes (Asset::GetSizeBytes()) the cache may keep alive. */
+    size_t CpuBudgetBytes = 256 * 1024 * 1024;
+    /** @brief GPU bytes (Asset::GetGpuSizeBytes()) the cache may keep alive. */
+    size_t GpuBudgetBytes = 512 * 1024 * 1024;
+    /** @brief Independently locked parts of the cache; rounded up to a power of two. */
+    uint32_t ShardCount = 16;
+    /** @brief Entries preallocated across all shards; more fall back to the heap. */
+    size_t EntryPoolSize = 1024;
+};
+
+/**
+ * @brief Loaded assets by handle, bounded by a CPU and a GPU byte budget.
+ *
+ * Handles hash to one of several shards, each with its own lock, map and
+ * intrusive LRU list, so lookups from different threads rarely contend.
+ * Every access stamps the entry from a global counter; eviction compares the
+ * tails of the shards and drops the oldest, which is the exact global LRU
+ * order at a cost proportional to the shard count, not the entry count.
+ *
+ * Eviction never waits on assets still in use: the cache drops its reference
+ * and stops counting their bytes, but remembers them weakly, so a later Find()
+ * returns the same object instead of a second copy.
+ *
+ * Inserts and lookups may evict from any thread, but an evicted asset can own
+ * GPU objects that only the render thread may free. The cache therefore never
+ * destroys an asset itself: evicted, replaced and removed references wait until
+ * the owner calls ReleaseEvicted() on the main thread.
+ */
+class AssetCache {
+public:
+    struct TypeStats {
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;
+    };
+
+    struct Stats {
+        size_t EntryCount = 0; // assets the cache keeps alive
+        size_t CpuBytes = 0;
+        size_t GpuBytes = 0;
+        uint64_t Evictions = 0;
+        size_t PendingReleases = 0; // references waiting for ReleaseEvicted()
+        std::array<TypeStats, kAssetTypeCount> Types{};
+
+        [[nodiscard]] const TypeStats& Get(AssetType type) const { return Types[static_cast<size_t>(type)]; }
+    };
+
+    explicit AssetCache(const AssetCacheConfig& config = {});
+    ~AssetCache();
+
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    /** @brief Drop every entry and counter and rebuild the shards for @p config. Not thread-safe. */
+    void Configure(const AssetCacheConfig& config);
+    [[nodiscard]] const AssetCacheConfig& GetConfig() const { return m_Config; }
+
+    /** @brief The asset for @p handle, marked most recently used and counted as a hit; null if absent. */
+    [[nodiscard]] std::shared_ptr<Asset> Find(AssetHandle handle);
+
+    /** @brief Whether Find() would return an asset; touches nothing. */
+    [[nodiscard]] bool Contains(AssetHandle handle) const;
+
+    /** @brief Whether the asset for @p handle is alive and referenced outside the cache. */
+    [[nodiscard]] bool IsInUse(AssetHandle handle) const;
+
+    /** @brief Count a miss; the caller knows the type the cache could not find. */
+    void RecordMiss(AssetType type);
+
+    /** @brief Insert or replace the entry for @p asset's handle, then evict down to the budgets. */
+    void Insert(const std::shared_ptr<Asset>& asset);
+
+    /** @brief Forget @p handle. @return whether it was present. */
+    bool Remove(AssetHandle handle);
+
+    /** @brief Evict down to the budgets and forget weak entries whose asset died. Visits every entry. */
+    void Trim();
+
+    /**
+     * @brief Drop the references evicted, replaced or removed since the last call.
+     *        Call on the main thread: the last reference runs the asset's destructor.
+     * @return the number of references dropped.
+     */
+    size_t ReleaseEvicted();
+
+    /** @brief Forget every entry and release the evicted references. Main thread only. */
+    void Clear();
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    struct Entry {
+        AssetHandle Handle;
+        std::shared_ptr<Asset> Strong; // null once evicted while in use
+        std::weak_ptr<Asset> Weak;
+        size_t CpuBytes = 0;
+        size_t GpuBytes = 0;
+        uint64_t LastAccess = 0;
+        Entry* Prev = nullptr; // LRU links; only entries holding Strong are linked
+        Entry* Next = nullptr;
+    };
+
+    struct Shard {
+        mutable std::mutex Mutex;
+        std::unordered_map<AssetHandle, Entry*> Entries;
+        Entry* Head = nullptr; // most recently used
+        Entry* Tail = nullptr;
+        std::unique_ptr<MemoryPool> Pool;
+    };
+
+    [[nodiscard]] Shard& GetShard(AssetHandle handle) const;
+    [[nodiscard]] bool IsOverBudget() const;
+    void EnforceBudget();
+
+    // Callers hold the shard lock. Retain() links an entry holding its asset and
+    // counts its bytes, Drop() undoes that; Evict() drops and then forgets the
+    // entry unless the asset is still in use. Defer() queues a reference for
+    // ReleaseEvicted() instead of dropping it under the lock.
+    static void Link(Shard& shard, Entry* entry);
+    static void Unlink(Shard& shard, Entry* entry);
+    void Retain(Shard& shard, Entry* entry);
+    void Drop(Shard& shard, Entry* entry);
+    void Evict(Shard& shard, Entry* entry);
+    void Defer(std::shared_ptr<Asset> asset);
+    static Entry* Allocate(Shard& shard);
+    static void Destroy(Shard& shard, Entry* entry);
+
+    AssetCacheConfig m_Config;
+    std::vector<std::unique_ptr<Shard>> m_Shards;
+    size_t m_ShardMask = 0;
+
+    std::atomic<uint64_t> m_Clock{0};
+    std::atomic<size_t> m_EntryCount{0};
+    std::atomic<size_t> m_CpuBytes{0};
+    std::atomic<size_t> m_GpuBytes{0};
+    std::atomic<uint64_t> m_Evictions{0};
+    std::array<std::atomic<uint64_t>, kAssetTypeCount> m_Hits{};
+    std::array<std::atomic<uint64_t>, kAssetTypeCount> m_Misses{};
+
+    mutable std::mutex m_ReleaseMutex; // taken inside shard locks, never the other way round
+    std::vector<std::shared_ptr<Asset>> m_Released;
+};
+
+} // namespace Zgine
@@ -12,10 +12,18 @@
 
 namespace Zgine {
 
+class JobSystem;
+
 struct AssetDatabaseConfig {
     std::filesystem::path AssetsRoot = "assets";
     bool IncludeDirectories = true;
     bool IncludeUnknownFiles = true;
+    /** @brief Fill AssetRecord::Metadata with every .meta field, not only the handle and type. */
+    bool LoadMetadata = false;
+    /** @brief Reuse and update the persistent AssetIndex, so unchanged .meta files are not read. */
+    bool UseIndex = true;
+    /** @brief Where the index lives; empty means `<AssetsRoot>/.assetindex`. */
+    std::filesystem::path IndexPath{};
 };
 
 struct AssetRecord {
@@ -25,13 +33,35 @@ struct AssetRecord {
     std::filesystem::path RelativePath;
     bool IsDirectory = false;
     bool HasMetadata = false;
+    std::optional<AssetMetadata> Metadata; // with AssetDatabaseConfig::LoadMetadata
 };
 
+/**
+ * @brief The files under an assets root, with the handle and type their .meta files record.
+ *
+ * Scan() enumerates directories and reads .meta files on the JobSystem when
+ * one is set. With UseIndex it first loads the AssetIndex from the previous
+ * scan: a file whose source and .meta modification time and size are
+ * unchanged is taken from the index, parsed metadata included, without
+ * opening its .meta. The index is written back only when something changed.
+ */
 class AssetDatabase {
 public:
+    struct ScanStats {
+        size_t FileCount = 0;      // files seen, whatever the config includes
+        size_t IndexHits = 0;      // taken from the index unchanged
+        size_t MetadataReads = 0;  // .meta files opened
+        size_t MetadataParses = 0; // of those, parsed: the bytes differ from the index
+        bool IndexSaved = false;
+    };
+
+    void SetJobSystem(JobSystem* jobs) { m_Jobs = jobs; }
+
     void Scan(const AssetDatabaseConfig& config = {});
     void Clear();
 
+    [[nodiscard]] const ScanStats& GetScanStats() const { return m_ScanStats; }
+
     [[nodiscard]] bool IsScanned() const { return m_Scanned; }
     [[nodiscard]] const std::filesystem::path& GetAssetsRoot() const { return m_AssetsRoot; }
     [[nodiscard]] const std::vector<AssetRecord>& GetRecords() const { return m_Records; }
@@ -45,7 +75,6 @@ private:
     static std::filesystem::path NormalizeRelativePath(const std::filesystem::path& root,
                                                        const std::filesystem::path& path);
     static std::filesystem::path GetMetaPath(const std::filesystem::path& sourcePath);
-    static std::optional<AssetMetadata> LoadMetadata(const std::filesystem::path& metaPath);
 
     [[nodiscard]] std::string MakePathKey(const std::filesystem::path& path) const;
     void AddRecord(AssetRecord record);
@@ -55,6 +84,8 @@ private:
     std::unordered_map<std::string, size_t> m_PathToRecord;
     std::unordered_map<AssetHandle, size_t> m_HandleToRecord;
     bool m_Scanned = false;
+    ScanStats m_ScanStats;
+    JobSystem* m_Jobs = nullptr;
 };
 
 } // namespace Zgine
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Zgine/Resources/Core/AssetMetadata.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Zgine {
+
+/**
+ * @brief What a scan learned about one file, keyed by its path under the assets root.
+ *
+ * A file whose source and .meta stats still match its entry is taken from the
+ * index without opening the .meta. Metadata holds the parsed .meta fields, so
+ * such a file is not parsed either.
+ */
+struct AssetIndexEntry {
+    int64_t SourceWriteTime = 0;
+    uint64_t SourceSize = 0;
+    bool HasMetaFile = false;
+    int64_t MetaWriteTime = 0;
+    uint64_t MetaSize = 0;
+    uint64_t MetaHash = 0; // of the .meta bytes; a touched but unchanged file is not parsed again
+    std::optional<AssetMetadata> Metadata; // none when there is no .meta or it does not parse
+
+    [[nodiscard]] bool HasSameStats(const AssetIndexEntry& other) const {
+        return SourceWriteTime == other.SourceWriteTime && SourceSize == other.SourceSize
+            && HasMetaFile == other.HasMetaFile && MetaWriteTime == other.MetaWriteTime
+            && MetaSize == other.MetaSize;
+    }
+};
+
+/**
+ * @brief Persistent AssetDatabase scan results, stored as one binary file in the assets root.
+ *
+ * The file is a cache: a missing, truncated or older-version index loads as
+ * empty and the next scan rebuilds it. Writes go through a temporary file and
+ * a rename, so a reader never sees half an index.
+ */
+class AssetIndex {
+public:
+    static constexpr uint32_t kVersion = 2;
+    static constexpr const char* kFileName = ".assetindex";
+
+    /** @brief Replace the entries with those in @p path. @return false (and empty) if it cannot be used. */
+    bool Load(const std::filesystem::path& path);
+
+    /** @brief Write every entry to @p path. @return false if the file cannot be written. */
+    bool Save(const std::filesystem::path& path) const;
+
+    [[nodiscard]] const AssetIndexEntry* Find(std::string_view relativePath) const;
+    void Set(std::string relativePath, AssetIndexEntry entry);
+    void Clear() { m_Entries.clear(); }
+
+    [[nodiscard]] size_t GetSize() const { return m_Entries.size(); }
+
+    /** @brief Hash of a .meta file's bytes, as stored in AssetIndexEntry::MetaHash. */
+    [[nodiscard]] static uint64_t HashText(std::string_view text);
+
+private:
+    std::unordered_map<std::string, AssetIndexEntry> m_Entries;
+};
+
+} // namespace Zgine
@@ -1,22 +1,77 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <span>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
+#include <Zgine/Core/Jobs/Job.h>
+#include <Zgine/Resources/Core/AssetCache.h>
 #include <Zgine/Resources/Core/AssetMetadata.h>
 #include <Zgine/Resources/Import/AssetImporter.h>
+#include <Zgine/Resources/Texture/TextureStreamer.h>
 #include <Zgine/Platform/IO/FileWatcher.h>
-#include <Zgine/Core/Memory/MemoryPool.h>
 
 namespace Zgine {
 
+class JobSystem;
+class World;
+
+/** @brief Where an asset stands; see AssetManager::GetLoadState(). */
+enum class AssetLoadState : uint8_t {
+    Unloaded = 0, // neither cached nor being loaded
+    Queued,       // waiting for a worker
+    Loading,      // being read and decoded
+    Uploading,    // decoded, waiting in the main-thread upload queue
+    Loaded,       // in the cache
+    Failed        // the last load failed; loading it again retries, hot reload and UnloadAsset() reset it
+};
+
+/**
+ * @brief A batch started by AssetManager::LoadAssetsAsync(). Copies share the
+ *        batch; it holds every asset it loaded, so none is evicted while a
+ *        copy lives.
+ */
+class AssetLoadGroup {
+public:
+    AssetLoadGroup() = default;
+
+    /** @brief Assets in the batch: the requested ones and everything they depend on. */
+    [[nodiscard]] size_t GetTotal() const;
+    /** @brief Assets finished so far, loaded or failed. */
+    [[nodiscard]] size_t GetCompleted() const;
+    [[nodiscard]] size_t GetFailed() const;
+    /** @brief GetCompleted() / GetTotal(); 1 for an empty batch. */
+    [[nodiscard]] float GetProgress() const;
+    [[nodiscard]] bool IsDone() const;
+
+    /** @brief The asset loaded for @p handle, or null if it failed, is unfinished or not in the batch. */
+    [[nodiscard]] std::shared_ptr<Asset> GetAsset(AssetHandle handle) const;
+
+private:
+    friend class AssetManager;
+    struct State;
+
+    std::shared_ptr<State> m_State;
+};
+
 struct AssetManagerConfig {
     std::filesystem::path AssetsRoot = "assets";
-    size_t MaxCacheSizeBytes = 256 * 1024 * 1024;
-    size_t CacheEntryPoolSize = 1024;
+    /** @brief Budgets and sharding of the loaded-asset cache; see AssetCache. */
+    AssetCacheConfig Cache;
+    /** @brief Main-thread time Update() spends finishing GPU uploads; at least one runs per call. */
+    float UploadBudgetMs = 4.0f;
+    /** @brief Cooked textures load their mip tail and stream the rest; see TextureStreamer. */
+    TextureStreamerConfig TextureStreaming;
+    /** @brief How source and .meta files are watched for hot reload; see FileWatcher. */
+    FileWatcherConfig FileWatching;
 };
 
 class AssetManager {
@@ -37,6 +92,10 @@ public:
     const AssetMetadata* GetMetadata(AssetHandle handle) const;
     const AssetMetadata* GetMetadata(const std::filesystem::path& path) const;
 
+    /**
+     * @brief Load @p handle on the calling thread, GPU work included, without
+     *        holding the manager lock; joins a load already in flight instead.
+     */
     std::shared_ptr<Asset> LoadAsset(AssetHandle handle);
 
     template <typename T>
@@ -45,10 +104,59 @@ public:
         return std::dynamic_pointer_cast<T>(asset);
     }
 
+    /**
+     * @brief Load @p handle in the background. The file is read and decoded on
+     *        the JobSystem (inline without one); assets whose importer
+     *        UploadsToGpu() then wait in the upload queue that Update() drains
+     *        on the main thread. Requests for a handle already loading share
+     *        that load.
+     */
     std::future<std::shared_ptr<Asset>> LoadAssetAsync(AssetHandle handle);
 
+    /** @brief Block until @p handle is loaded or failed; on the main thread this drains the upload queue meanwhile. */
+    std::shared_ptr<Asset> WaitForAsset(AssetHandle handle);
+
+    /**
+     * @brief Load @p handles and, transitively, the dependencies recorded in
+     *        their metadata. Assets start once everything they depend on has
+     *        finished, so independent leaves load in parallel and dependents
+     *        find theirs in the cache. A dependency cycle is logged and its
+     *        members start together.
+     */
+    AssetLoadGroup LoadAssetsAsync(std::span<const AssetHandle> handles);
+
+    /** @brief LoadAssetsAsync() for every asset the components of @p world reference. */
+    AssetLoadGroup Prefetch(const World& world);
+
+    /** @brief Block until @p group is done, as WaitForAsset(); true if nothing failed. */
+    bool WaitForAssets(const AssetLoadGroup& group);
+
+    [[nodiscard]] AssetLoadState GetLoadState(AssetHandle handle) const;
+
+    /**
+     * @brief Workers for LoadAssetAsync(); waits for loads running on the previous one.
+     *        Call from the main thread: while it waits on @p jobs it also finishes GPU
+     *        uploads, so a job that loads a pending GPU asset cannot deadlock it.
+     */
+    void SetJobSystem(JobSystem* jobs);
+
+    /**
+     * @brief Offline cook: write the cooked file of every registered asset
+     *        whose file is missing or stale. Does not touch the GPU.
+     * @return Number of assets with an up-to-date cooked file afterwards.
+     */
+    size_t CookAssets();
+
     void UnloadAsset(AssetHandle handle);
+    /** @brief Cancel pending loads and drop every loaded asset, keeping the registered metadata. */
+    void UnloadAll();
+    /** @brief Evict down to the cache budgets and forget evicted assets that are no longer in use. */
     void TrimCache();
+
+    /** @brief Loaded assets; GetStats() has the budgets' usage and per-type hits and misses. */
+    [[nodiscard]] const AssetCache& GetCache() const { return m_Cache; }
+
+    /** @brief Once per frame on the main thread: finish queued GPU uploads within UploadBudgetMs, free evicted assets, then hot reload. */
     void Update();
 
     void SetHotReloadEnabled(bool enabled);
@@ -56,34 +164,48 @@ public:
 
     const std::filesystem::path& GetAssetsRoot() const { return m_Config.AssetsRoot; }
 
-private:
-    struct CacheEntry {
-        std::shared_ptr<Asset> AssetData;
-        size_t SizeBytes = 0;
-        uint64_t LastAccess = 0;
-    };
+    /** @brief Streams the high mips of imported textures; the renderer drives it each frame. */
+    TextureStreamer& GetTextureStreamer() { return m_TextureStreamer; }
 
-    struct CacheEntryDeleter {
-        MemoryPool* Pool = nullptr;
-        void operator()(CacheEntry* entry) const;
+private:
+    // Called without the lock once a load finishes; null if it failed.
+    using LoadCallback = std::function<void(const std::shared_ptr<Asset>&)>;
+
+    // One in-flight load per handle; everyone waiting on it left a callback.
+    struct PendingLoad {
+        AssetMetadata Metadata; // copied, so the worker reads it without the lock
+        AssetImporter* Importer = nullptr;
+        AssetLoadState State = AssetLoadState::Queued;
+        std::unique_ptr<AssetPayload> Payload;
+        std::vector<LoadCallback> Waiters;
     };
 
-    using CacheEntryPtr = std::unique_ptr<CacheEntry, CacheEntryDeleter>;
+    using PendingLoadPtr = std::shared_ptr<PendingLoad>;
 
     AssetManager() = default;
 
     void RegisterImporters();
-    CacheEntryPtr CreateCacheEntry(const std::shared_ptr<Asset>& asset);
-    std::shared_ptr<Asset> LoadAssetInternal(AssetHandle handle);
+    std::shared_ptr<Asset> FindCachedLocked(AssetHandle handle);
+    PendingLoadPtr CreateLoadLocked(AssetHandle handle);
+    void RequestLoad(AssetHandle handle, LoadCallback callback);
+    void StartGroupLoad(const std::shared_ptr<AssetLoadGroup::State>& group, size_t index);
+    void RunPrepare(const PendingLoadPtr& load);
+    std::shared_ptr<Asset> CompleteLoad(const PendingLoadPtr& load, AssetImportResult result);
+    bool ProcessUploads(float budgetMs);
+    std::shared_ptr<Asset> Await(std::future<std::shared_ptr<Asset>> future);
+    void DrainUploadsUntil(const std::function<bool()>& ready);
+    void CancelLoads();
     AssetImportResult ImportAssetInternal(AssetMetadata& metadata);
     void SaveMetadata(const AssetMetadata& metadata) const;
     std::optional<AssetMetadata> LoadMetadata(const std::filesystem::path& metaPath) const;
+    // Registers @p assetPath under @p normalized with the .meta contents, if any; the caller holds the lock.
+    AssetHandle AddAsset(const std::filesystem::path& assetPath, std::string normalized, AssetType type,
+                         std::optional<AssetMetadata> loaded);
     std::filesystem::path GetMetaPath(const std::filesystem::path& assetPath) const;
     std::string NormalizePath(const std::filesystem::path& path) const;
     void WatchAssetPaths(const AssetMetadata& metadata);
     void OnFileChanged(const std::filesystem::path& path, FileStatus status);
     void MarkDirty(AssetHandle handle);
-    bool IsThreadSafeAsset(AssetType type) const;
 
     AssetManagerConfig m_Config;
     bool m_Initialized = false;
@@ -93,14 +215,21 @@ private:
     std::unordered_map<AssetHandle, AssetMetadata> m_Metadata;
     std::unordered_map<std::string, AssetHandle> m_PathToHandle;
 
-    std::unordered_map<AssetHandle, CacheEntryPtr> m_Cache;
-    size_t m_CurrentCacheBytes = 0;
-    uint64_t m_AccessCounter = 0;
+    // Hits are served without m_Mutex unless an asset awaits hot reload.
+    AssetCache m_Cache;
+    std::atomic<bool> m_HasDirtyAssets{false};
 
-    std::unique_ptr<MemoryPool> m_CacheEntryPool;
     FileWatcher m_FileWatcher;
     std::unordered_set<AssetHandle> m_DirtyAssets;
     std::unordered_map<AssetType, std::unique_ptr<AssetImporter>> m_Importers;
+
+    JobSystem* m_Jobs = nullptr;
+    JobCounter m_LoadCounter;
+    std::thread::id m_MainThread;
+    std::unordered_map<AssetHandle, PendingLoadPtr> m_PendingLoads;
+    std::deque<PendingLoadPtr> m_UploadQueue;
+    std::unordered_set<AssetHandle> m_FailedLoads;
+    TextureStreamer m_TextureStreamer;
 };
 
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <string>
@@ -19,6 +20,8 @@ enum class AssetType : uint8_t {
     Script
 };
 
+inline constexpr size_t kAssetTypeCount = static_cast<size_t>(AssetType::Script) + 1;
+
 const char* AssetTypeToString(AssetType type);
 AssetType AssetTypeFromString(const std::string& value);
 AssetType AssetTypeFromPath(const std::filesystem::path& path);
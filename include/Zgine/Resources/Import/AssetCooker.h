@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Zgine/Platform/IO/MappedFile.h>
+#include <Zgine/Renderer/RHI/Texture.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief Writes engine-native binary copies ("cooked" files) of imported assets.
+ *
+ * A cooked file sits next to the source's .meta file and holds the data in
+ * the form the GPU takes it: encoded vertex and index streams for meshes,
+ * the full mip chain (optionally BC3-compressed) for textures. Streams of a
+ * page or more start on a page boundary, so the readers below can map the
+ * file and hand pointers into the mapping straight to the upload.
+ *
+ * Every file records the CookKey it was cooked with. A file is fresh when its
+ * settings hash matches and the source's size and write time are the ones
+ * recorded; only when those differ (a touched or copied source) are the
+ * source bytes hashed and compared. A stale file is cooked again.
+ */
+struct CookKey {
+    uint64_t Settings = 0;        // format version and serialized import settings
+    uint64_t SourceSize = 0;
+    int64_t SourceWriteTime = 0;
+    uint64_t SourceHash = 0;      // AssetCooker::HashSource(); only needed to write a file
+};
+
+class AssetCooker {
+public:
+    static constexpr uint32_t kVersion = 2;
+    static constexpr size_t kPageAlignment = 4096;
+    static constexpr const char* kExtension = ".cooked";
+
+    /** @brief `<source>.cooked`, beside `<source>.meta`. */
+    [[nodiscard]] static std::filesystem::path GetCookedPath(const std::filesystem::path& sourcePath);
+
+    /**
+     * @brief Key of @p sourcePath cooked with @p settings (the serialized import settings),
+     *        from the source's stats only; SourceHash is left 0.
+     * @return Empty when the source does not exist.
+     */
+    [[nodiscard]] static std::optional<CookKey> GetKey(const std::filesystem::path& sourcePath, std::string_view settings);
+
+    /** @brief Hash of the bytes of @p sourcePath; 0 when it cannot be read. */
+    [[nodiscard]] static uint64_t HashSource(const std::filesystem::path& sourcePath);
+
+    /** @brief Write @p meshes (in order) to @p path; false if the file cannot be written. */
+    static bool WriteMesh(const std::filesystem::path& path, const CookKey& key, const std::vector<EncodedMeshData>& meshes);
+
+    /** @brief Write a mip chain, largest level first, to @p path; false if the file cannot be written. */
+    static bool WriteTexture(const std::filesystem::path& path, const CookKey& key, TextureFormat format,
+                             const std::vector<TextureMip>& mips);
+
+    /**
+     * @brief Box-filtered mip chain of an RGBA8 image down to 1x1, level 0 included.
+     * @param srgb Average the color channels in linear light; alpha is always linear.
+     */
+    [[nodiscard]] static std::vector<std::vector<uint8_t>> BuildMipChain(const uint8_t* rgba, uint32_t width,
+                                                                         uint32_t height, bool srgb);
+
+    /** @brief Size of a mip level in @p format. */
+    [[nodiscard]] static size_t GetMipSize(TextureFormat format, uint32_t width, uint32_t height);
+
+    /** @brief Compress an RGBA8 image to BC3, GetMipSize(TextureFormat::BC3, width, height) bytes. */
+    [[nodiscard]] static std::vector<uint8_t> CompressBC3(const uint8_t* rgba, uint32_t width, uint32_t height);
+};
+
+/**
+ * @brief A cooked mesh file mapped into memory.
+ *
+ * GetMeshes() points into the mapping and is only valid while this object
+ * lives; pass each entry to Mesh(const EncodedMeshData&) to upload it.
+ */
+class CookedMesh {
+public:
+    /**
+     * @brief Map @p path; empty when it is missing, stale (cooked with another key) or malformed.
+     * @param sourcePath Hashed when @p key's source stats differ from the recorded ones; without it such a file is stale.
+     */
+    [[nodiscard]] static std::optional<CookedMesh> Open(const std::filesystem::path& path, const CookKey& key,
+                                                        const std::filesystem::path& sourcePath = {});
+
+    [[nodiscard]] const std::vector<EncodedMeshData>& GetMeshes() const { return m_Meshes; }
+
+    /** @brief Fault in the whole file on the calling thread; see MappedFile::Prefetch(). */
+    void Prefetch() const { m_File.Prefetch(m_File.GetData(), m_File.GetSize()); }
+
+private:
+    MappedFile m_File;
+    std::vector<EncodedMeshData> m_Meshes;
+};
+
+/**
+ * @brief A cooked texture file mapped into memory; GetMips() points into the mapping.
+ */
+class CookedTexture {
+public:
+    /** @brief Map @p path; see CookedMesh::Open(). */
+    [[nodiscard]] static std::optional<CookedTexture> Open(const std::filesystem::path& path, const CookKey& key,
+                                                           const std::filesystem::path& sourcePath = {});
+
+    [[nodiscard]] TextureFormat GetFormat() const { return m_Format; }
+    [[nodiscard]] const std::vector<TextureMip>& GetMips() const { return m_Mips; }
+
+    /** @brief Fault in levels [firstMip, endMip) on the calling thread; see MappedFile::Prefetch(). */
+    void Prefetch(uint32_t firstMip, uint32_t endMip) const;
+
+private:
+    MappedFile m_File;
+    TextureFormat m_Format = TextureFormat::RGBA8;
+    std::vector<TextureMip> m_Mips;
+};
+
+} // namespace Zgine
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <nlohmann/json.hpp>
 #include <Zgine/Resources/Core/AssetType.h>
+#include <Zgine/Resources/Mesh/VertexFormat.h>
 
 namespace Zgine {
 
@@ -18,6 +20,21 @@ struct MeshImportSettings {
     bool Triangulate = true;
     bool FlipUVs = true;
     bool CalcTangents = true;
+
+    // Import-time optimization (see MeshOptimizer).
+    bool WeldVertices = true;
+    bool OptimizeVertexCache = true;
+    bool OptimizeOverdraw = true;
+    float OverdrawThreshold = 1.05f;  // vertex cache miss ratio the overdraw order may cost
+    uint32_t LodCount = 4;            // levels including the full-detail one; 1 disables LODs
+    float LodReduction = 0.5f;        // index count of each level relative to the previous one
+    float LodMaxError = 0.02f;        // simplification error limit, relative to the mesh extent
+    float LodScreenSize = 0.3f;       // screen height fraction below which LOD 1 is used
+
+    // GPU vertex storage. Quantized formats are about a third of Float;
+    // colors are only kept when the source has them and this asks for it.
+    VertexFormat Format = VertexFormat::Quantized;
+    bool KeepVertexColors = false;
 };
 
 struct AudioImportSettings {
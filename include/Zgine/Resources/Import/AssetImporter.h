@@ -18,30 +18,77 @@ struct AssetImportResult {
     std::vector<AssetHandle> Dependencies;
 };
 
+/** @brief CPU-side data an importer reads and decodes in Prepare() and builds the asset from in Finalize(). */
+struct AssetPayload {
+    virtual ~AssetPayload() = default;
+};
+
+/**
+ * @brief Turns a source file into an Asset in two stages.
+ *
+ * Prepare() reads and decodes the file. AssetManager runs it on a worker
+ * thread with no lock held, so it must not touch the GPU. Finalize() builds
+ * the asset from the payload; when UploadsToGpu() is true it runs on the main
+ * thread from AssetManager's upload queue, otherwise straight after Prepare().
+ */
 class AssetImporter {
 public:
     virtual ~AssetImporter() = default;
-    virtual AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context) = 0;
+
+    /** @brief Both stages back to back on the calling thread. */
+    AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context);
+
+    /** @brief Read and decode; null when there is nothing to hand over (Finalize() still runs). */
+    virtual std::unique_ptr<AssetPayload> Prepare(const AssetMetadata& metadata, AssetImportContext& context) = 0;
+
+    /** @brief Build the asset from Prepare()'s payload. */
+    virtual AssetImportResult Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                                       AssetImportContext& context) = 0;
+
+    /** @brief Finalize() creates GPU objects and must run on the main thread. */
+    [[nodiscard]] virtual bool UploadsToGpu() const { return false; }
+
+    /**
+     * @brief Write the cooked file of @p metadata (see AssetCooker) unless it is up to date.
+     * @return true when an up-to-date cooked file exists afterwards; false for types that are not cooked.
+     */
+    virtual bool Cook(const AssetMetadata& /*metadata*/) { return false; }
 };
 
+/** @brief Loads the cooked mip chain, cooking it from the source image first when stale. */
 class TextureImporter final : public AssetImporter {
 public:
-    AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context) override;
+    std::unique_ptr<AssetPayload> Prepare(const AssetMetadata& metadata, AssetImportContext& context) override;
+    AssetImportResult Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                               AssetImportContext& context) override;
+    bool UploadsToGpu() const override { return true; }
+    bool Cook(const AssetMetadata& metadata) override;
 };
 
+/** @brief Loads the cooked vertex and index streams, cooking them through Assimp first when stale. */
 class MeshImporter final : public AssetImporter {
 public:
-    AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context) override;
+    std::unique_ptr<AssetPayload> Prepare(const AssetMetadata& metadata, AssetImportContext& context) override;
+    AssetImportResult Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                               AssetImportContext& context) override;
+    bool UploadsToGpu() const override { return true; }
+    bool Cook(const AssetMetadata& metadata) override;
 };
 
 class AudioImporter final : public AssetImporter {
 public:
-    AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context) override;
+    std::unique_ptr<AssetPayload> Prepare(const AssetMetadata& metadata, AssetImportContext& context) override;
+    AssetImportResult Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                               AssetImportContext& context) override;
 };
 
+/** @brief Reads the .vert/.frag pair on a worker; compiles on the main thread. */
 class ShaderImporter final : public AssetImporter {
 public:
-    AssetImportResult Import(const AssetMetadata& metadata, AssetImportContext& context) override;
+    std::unique_ptr<AssetPayload> Prepare(const AssetMetadata& metadata, AssetImportContext& context) override;
+    AssetImportResult Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                               AssetImportContext& context) override;
+    bool UploadsToGpu() const override { return true; }
 };
 
 }
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Zgine/Core/Math/MathTypes.h>
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Renderer/Pipeline/MeshArena.h>
+#include <Zgine/Resources/Mesh/VertexFormat.h>
 #include <vector>
 #include <memory>
 
@@ -13,36 +16,101 @@ struct Vertex {
     Math::Vector4 Color;
 };
 
+/**
+ * @brief One level of detail: a run of MeshData::Indices over the shared vertices.
+ */
+struct MeshLod {
+    uint32_t FirstIndex = 0;
+    uint32_t IndexCount = 0;
+    float ScreenSize = 0.0f; // used while the mesh covers at least this fraction of the screen height
+    float Error = 0.0f;      // simplification error relative to the mesh extent
+};
+
 struct MeshData {
     std::vector<Vertex> Vertices;
     std::vector<unsigned int> Indices;
     Math::Vector4 BaseColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+    std::vector<MeshLod> Lods; // finest first; empty means one level over all indices
+    bool HasColors = false;    // the source had a vertex color stream
+};
+
+/**
+ * @brief Geometry already in its GPU form, e.g. pointing into a mapped cooked
+ *        file; the pointers only need to outlive the Mesh constructor.
+ */
+struct EncodedMeshData {
+    VertexFormat Format = VertexFormat::Float;
+    const uint8_t* Vertices = nullptr;  // VertexCount * GetVertexStride(Format) bytes
+    uint32_t VertexCount = 0;
+    const uint32_t* Indices = nullptr;
+    uint32_t IndexCount = 0;
+    AABB Bounds;                        // the bounds the vertices were quantized against
+    Math::Vector4 BaseColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+    std::vector<MeshLod> Lods;
 };
 
+/**
+ * @brief Static mesh whose geometry lives in the shared MeshArena.
+ *
+ * The vertices and indices are uploaded once on construction and the CPU
+ * copies are dropped; the renderer draws the mesh through its MeshRange
+ * like any other queued draw. Each VertexFormat has its own arena, since a
+ * page holds a single layout. Must be created and destroyed on the render
+ * thread.
+ */
 class Mesh {
 public:
-    Mesh(const MeshData& data);
+    explicit Mesh(const MeshData& data, VertexFormat format = VertexFormat::Float);
+    /** @brief Upload pre-encoded vertices as they are; nothing is converted on the CPU. */
+    explicit Mesh(const EncodedMeshData& data);
     ~Mesh();
 
-    void Bind() const;
-    void Unbind() const;
-    void Draw() const;
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
 
-    inline unsigned int GetVertexCount() const { return static_cast<unsigned int>(m_Vertices.size()); }
-    inline unsigned int GetIndexCount() const { return static_cast<unsigned int>(m_Indices.size()); }
+    inline unsigned int GetVertexCount() const { return m_VertexCount; }
+    inline unsigned int GetIndexCount() const { return m_IndexCount; }
     inline const Math::Vector4& GetBaseColor() const { return m_BaseColor; }
+    inline VertexFormat GetVertexFormat() const { return m_Format; }
+    /** @brief GPU bytes of the vertices and indices, LODs included. */
+    [[nodiscard]] size_t GetMemorySize() const;
 
-private:
-    void SetupMesh();
+    /**
+     * @brief Scale and offset to apply before the model matrix
+     *        (model * translate(offset) * scale(scale)); identity for VertexFormat::Float.
+     */
+    [[nodiscard]] const Math::Vector3& GetDequantizeScale() const { return m_DequantizeScale; }
+    [[nodiscard]] const Math::Vector3& GetDequantizeOffset() const { return m_DequantizeOffset; }
+
+    /** @brief Object-space bounds of the vertices. */
+    [[nodiscard]] const AABB& GetBounds() const { return m_Bounds; }
+    /** @brief Location in the arena; invalid when there is no GPU backend or the upload failed. */
+    [[nodiscard]] const MeshRange& GetRange() const { return m_Range; }
+
+    /** @brief Number of detail levels; always at least one. */
+    [[nodiscard]] uint32_t GetLodCount() const { return static_cast<uint32_t>(m_Lods.size()); }
+    [[nodiscard]] const MeshLod& GetLod(uint32_t lod) const { return m_Lods[lod]; }
+    /** @brief GetRange() narrowed to the indices of one level (clamped to the coarsest). */
+    [[nodiscard]] MeshRange GetLodRange(uint32_t lod) const;
+    /**
+     * @brief Finest level whose MeshLod::ScreenSize is at most @p screenSize.
+     * @param screenSize Projected bounding-sphere diameter as a fraction of the screen height.
+     */
+    [[nodiscard]] uint32_t SelectLod(float screenSize) const;
 
 private:
-    std::vector<Vertex> m_Vertices;
-    std::vector<unsigned int> m_Indices;
-    Math::Vector4 m_BaseColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+    void Upload(const void* vertices, const uint32_t* indices);
 
-    unsigned int m_VAO = 0;
-    unsigned int m_VBO = 0;
-    unsigned int m_EBO = 0;
+    std::shared_ptr<MeshArena> m_Arena;
+    MeshRange m_Range;
+    AABB m_Bounds;
+    std::vector<MeshLod> m_Lods;
+    VertexFormat m_Format = VertexFormat::Float;
+    Math::Vector3 m_DequantizeScale{1.0f};
+    Math::Vector3 m_DequantizeOffset{0.0f};
+    unsigned int m_VertexCount = 0;
+    unsigned int m_IndexCount = 0;
+    Math::Vector4 m_BaseColor = { 1.0f, 1.0f, 1.0f, 1.0f };
 };
 
 } // namespace Zgine
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Zgine/Renderer/Pipeline/MeshArena.h>
+#include <Zgine/Resources/Mesh/VertexFormat.h>
+#include <array>
+#include <memory>
+
+namespace Zgine {
+
+/**
+ * @brief The MeshArena shared by all meshes of each VertexFormat.
+ *
+ * Arenas are created on first use on the main thread. Shutdown() drops them
+ * while the graphics context still exists; a mesh still alive at that point
+ * keeps its own arena until it is destroyed.
+ */
+class MeshArenas {
+public:
+    static void Shutdown();
+
+    [[nodiscard]] static const std::shared_ptr<MeshArena>& Get(VertexFormat format = VertexFormat::Float);
+
+private:
+    static std::array<std::shared_ptr<MeshArena>, 3> s_Arenas;
+};
+
+} // namespace Zgine
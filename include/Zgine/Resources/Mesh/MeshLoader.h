@@ -21,12 +21,18 @@ public:
                                                         const MeshImportSettings& settings = {});
     static std::shared_ptr<Mesh> LoadMesh(const std::string& path,
                                           const MeshImportSettings& settings = {});
+    /** @brief Import and optimize on the CPU only; what LoadModel() uploads. */
+    static std::vector<MeshData> LoadModelData(const std::string& path, const MeshImportSettings& settings = {});
+    /** @brief GPU vertex format LoadModel() stores @p data in. */
+    [[nodiscard]] static VertexFormat ChooseVertexFormat(const MeshData& data, const MeshImportSettings& settings);
 
 private:
-    static void ProcessNode(const ::aiNode* node, const ::aiScene* World,
-                           const std::string& directory, std::vector<std::shared_ptr<Mesh>>& meshes);
+    static void ProcessNode(const ::aiNode* node, const ::aiScene* World, const std::string& directory,
+                            const MeshImportSettings& settings, std::vector<MeshData>& meshes);
     static MeshData ProcessMesh(const ::aiMesh* mesh, const ::aiScene* World,
                                const std::string& directory);
+    /** @brief Weld, build the LOD chain and reorder for the vertex cache, overdraw and fetch. */
+    static void OptimizeMesh(MeshData& data, const MeshImportSettings& settings);
     static std::vector<std::shared_ptr<Texture>> LoadMaterialTextures(const ::aiMaterial* mat,
                                                                       const ::aiScene* World,
                                                                       int type, const std::string& typeName,
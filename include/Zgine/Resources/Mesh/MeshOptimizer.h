@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief Import-time index and vertex reordering for triangle lists.
+ *
+ * MeshLoader runs these in the usual order: WeldVertices, BuildLodChain,
+ * then per level OptimizeVertexCache and OptimizeOverdraw, and finally
+ * OptimizeVertexFetch. None of them change what is rendered, except the
+ * coarser levels produced by Simplify.
+ */
+namespace MeshOptimizer {
+
+/** @brief Post-transform cache size the orderings are tuned for. */
+inline constexpr uint32_t kVertexCacheSize = 16;
+
+/**
+ * @brief Merge bit-identical vertices and remap the indices.
+ * @return Number of vertices removed.
+ */
+uint32_t WeldVertices(MeshData& data);
+
+/**
+ * @brief Reorder the triangles of @p indices for the post-transform vertex cache
+ *        (Forsyth's linear-speed algorithm).
+ */
+void OptimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount);
+
+/**
+ * @brief Reorder cache-optimized triangles so outward-facing clusters come first.
+ *
+ * Triangles are split into clusters where the vertex cache order starts
+ * over anyway, or where a split costs less than @p threshold times the
+ * cluster's cache miss ratio, and the clusters are sorted so those facing
+ * away from the mesh centre are drawn before the ones they occlude.
+ */
+void OptimizeOverdraw(unsigned int* indices, size_t indexCount, const std::vector<Vertex>& vertices,
+                      float threshold);
+
+/**
+ * @brief Renumber the vertices in the order the indices first use them and drop unused ones.
+ */
+void OptimizeVertexFetch(MeshData& data);
+
+/**
+ * @brief Average cache misses per triangle for a FIFO cache of @p cacheSize vertices.
+ */
+[[nodiscard]] float AnalyzeVertexCache(const unsigned int* indices, size_t indexCount, size_t vertexCount,
+                                       uint32_t cacheSize = kVertexCacheSize);
+
+/**
+ * @brief Reduce @p indices towards @p targetIndexCount with quadric-error edge collapses.
+ *
+ * Vertices only collapse onto existing vertices, so the result indexes the
+ * same vertex array. Open borders (including UV and normal seams after
+ * welding) are kept in place, and collapses that would flip a triangle are
+ * rejected.
+ *
+ * @param maxError Largest allowed error, relative to the mesh extent.
+ * @param outError Receives the error of the result, relative to the mesh extent.
+ */
+[[nodiscard]] std::vector<unsigned int> Simplify(const std::vector<Vertex>& vertices,
+                                                 const std::vector<unsigned int>& indices,
+                                                 size_t targetIndexCount, float maxError,
+                                                 float* outError = nullptr);
+
+/**
+ * @brief Append up to @p lodCount - 1 simplified levels to @p data and fill MeshData::Lods.
+ *
+ * Each level targets @p reduction times the indices of the previous one;
+ * the chain stops early once the error limit keeps a level from getting
+ * meaningfully smaller. Level i is used down to a screen size of
+ * @p screenSize * sqrt(reduction)^i and the last level below that, which
+ * keeps the triangle density on screen roughly constant across switches.
+ */
+void BuildLodChain(MeshData& data, uint32_t lodCount, float reduction, float maxError, float screenSize);
+
+} // namespace MeshOptimizer
+
+} // namespace Zgine
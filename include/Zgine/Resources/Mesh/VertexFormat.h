@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Zgine/Core/Math/Vector3.h>
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Renderer/RHI/BufferLayout.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Zgine {
+
+struct Vertex;
+
+/**
+ * @brief GPU storage of static mesh vertices.
+ *
+ * All formats bind to the same shader inputs (a_Position, a_Normal,
+ * a_TexCoord and a_Color at locations 0-3); the quantized ones are expanded
+ * by the vertex fetch, so the shaders do not change. Quantized positions are
+ * 16-bit fractions of the mesh bounds and must be drawn with the transform
+ * from GetDequantizeScale()/GetDequantizeOffset() folded into the model
+ * matrix.
+ */
+enum class VertexFormat : uint8_t {
+    Float = 0,      // Vertex as is: 48 bytes
+    Quantized,      // unorm16 position, snorm 10:10:10:2 normal, half UV: 16 bytes
+    QuantizedColor  // Quantized plus unorm8 RGBA color: 20 bytes
+};
+
+const char* VertexFormatToString(VertexFormat format);
+/** @brief Inverse of VertexFormatToString(); unknown names read as VertexFormat::Float. */
+VertexFormat VertexFormatFromString(const std::string& value);
+
+[[nodiscard]] BufferLayout GetVertexLayout(VertexFormat format);
+[[nodiscard]] uint32_t GetVertexStride(VertexFormat format);
+
+namespace VertexQuantization {
+
+/** @brief IEEE half float, rounded to nearest; out-of-range values saturate to infinity. */
+[[nodiscard]] uint16_t FloatToHalf(float value);
+[[nodiscard]] float HalfToFloat(uint16_t value);
+
+/** @brief Signed normalized 10:10:10:2 (GL_INT_2_10_10_10_REV) with w = 0. */
+[[nodiscard]] uint32_t PackSnorm1010102(const Math::Vector3& value);
+[[nodiscard]] Math::Vector3 UnpackSnorm1010102(uint32_t packed);
+
+/**
+ * @brief Per-axis scale and offset that map the unorm16 positions [0, 1]
+ *        back onto @p bounds; unit scale and zero offset for VertexFormat::Float.
+ */
+[[nodiscard]] Math::Vector3 GetDequantizeScale(VertexFormat format, const AABB& bounds);
+[[nodiscard]] Math::Vector3 GetDequantizeOffset(VertexFormat format, const AABB& bounds);
+
+/** @brief Bounds of the vertex positions; what the quantized formats are encoded against. */
+[[nodiscard]] AABB ComputeBounds(const std::vector<Vertex>& vertices);
+
+/**
+ * @brief Write @p vertices in @p format, GetVertexStride(format) bytes each.
+ * @param bounds Bounds of the positions; only used by the quantized formats.
+ */
+[[nodiscard]] std::vector<uint8_t> EncodeVertices(const std::vector<Vertex>& vertices, VertexFormat format,
+                                                  const AABB& bounds);
+
+} // namespace VertexQuantization
+
+} // namespace Zgine
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Zgine/Core/Jobs/Job.h>
+#include <Zgine/Renderer/RHI/Texture.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Zgine {
+
+class CookedTexture;
+class JobSystem;
+
+struct TextureStreamerConfig {
+    bool Enabled = true;
+    /** @brief GPU bytes all streamed textures may hold; high mips are evicted above it. */
+    size_t GpuBudgetBytes = 512 * 1024 * 1024;
+    /** @brief Levels no larger than this on either side are the mip tail, always resident. */
+    uint32_t TailSize = 64;
+    /** @brief Upload bytes per Update(); a single larger level still goes through alone. */
+    size_t UploadBytesPerFrame = 32 * 1024 * 1024;
+    /** @brief Updates a texture keeps its mips after the renderer last asked for it. */
+    uint32_t RetainFrames = 120;
+};
+
+/**
+ * @brief Keeps the mip levels of cooked textures on the GPU that the screen needs.
+ *
+ * A registered texture starts with its mip tail resident. Each frame the
+ * renderer reports how many pixels a texture covers through Request(), and
+ * Update() works out the level it needs: about one texel per pixel.
+ * Missing levels are faulted in from the cooked file's mapping by a job on
+ * the JobSystem, then uploaded on the render thread under a per-frame byte
+ * budget. When the wanted levels of all textures exceed the GPU budget, the
+ * textures requested longest ago give up their high mips first.
+ *
+ * Request() and Update() belong to the render thread; Register() may be
+ * called from any thread and takes effect on the next Update().
+ */
+class TextureStreamer {
+public:
+    struct Stats {
+        size_t TextureCount = 0;
+        size_t ResidentBytes = 0;
+        size_t PendingLoads = 0;
+        size_t UploadedBytes = 0; // last Update()
+        size_t EvictedBytes = 0;  // last Update()
+    };
+
+    explicit TextureStreamer(const TextureStreamerConfig& config = {});
+    ~TextureStreamer();
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    void SetConfig(const TextureStreamerConfig& config);
+    [[nodiscard]] const TextureStreamerConfig& GetConfig() const { return m_Config; }
+
+    /**
+     * @brief Run loads on @p jobs; null loads inline in Update(). Waits for
+     *        loads already running on the previous JobSystem.
+     */
+    void SetJobSystem(JobSystem* jobs);
+
+    /**
+     * @brief Stream @p texture, created from @p source's mips with Texture::Create(..., firstMip).
+     *        The streamer keeps @p source mapped while the texture lives.
+     */
+    void Register(const std::shared_ptr<Texture>& texture, std::shared_ptr<const CookedTexture> source);
+
+    /**
+     * @brief The renderer draws @p texture across about @p screenPixels pixels
+     *        this frame. Unregistered textures are ignored.
+     */
+    void Request(const Texture* texture, float screenPixels);
+
+    /** @brief Evict, start loads and upload finished ones; once per frame on the render thread. */
+    void Update();
+
+    /** @brief Drop every texture after waiting for running loads. */
+    void Clear();
+
+    [[nodiscard]] Stats GetStats() const;
+
+    /** @brief First level of @p mips no larger than @p tailSize on either side, or the last level. */
+    [[nodiscard]] static uint32_t GetTailMip(const std::vector<TextureMip>& mips, uint32_t tailSize);
+
+    /**
+     * @brief Coarsest level of a @p width x @p height texture that still has a
+     *        texel per pixel across @p screenPixels; UINT32_MAX below one pixel.
+     */
+    [[nodiscard]] static uint32_t GetDesiredMip(uint32_t width, uint32_t height, float screenPixels);
+
+private:
+    // Shared with the load job, which may finish after its entry is dropped.
+    struct Load {
+        std::shared_ptr<const CookedTexture> Source;
+        uint32_t FirstMip = 0;
+        uint32_t EndMip = 0;
+        std::atomic<bool> Done{false};
+    };
+
+    struct Entry {
+        std::weak_ptr<Texture> TextureRef;
+        std::shared_ptr<const CookedTexture> Source;
+        uint32_t TailMip = 0;
+        uint32_t RequestedMip = 0;
+        uint64_t LastRequestFrame = 0;
+        bool Requested = false;
+        std::shared_ptr<Load> PendingLoad;
+    };
+
+    void AcceptRegistrations();
+    void StartLoad(Entry& entry, uint32_t firstMip);
+    void WaitForLoads();
+
+    TextureStreamerConfig m_Config;
+    JobSystem* m_Jobs = nullptr;
+    JobCounter m_LoadCounter;
+
+    std::unordered_map<const Texture*, Entry> m_Entries;
+    uint64_t m_Frame = 0;
+    Stats m_Stats;
+
+    std::mutex m_RegisterMutex;
+    std::vector<Entry> m_Registrations;
+};
+
+} // namespace Zgine
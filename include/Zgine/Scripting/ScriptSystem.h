@@ -20,6 +20,7 @@ namespace Zgine {
         void Update(World* World, float deltaTime) override;
         const char* GetName() const override { return "ScriptSystem"; }
         int GetPriority() const override { return 30; }  // Scripts run after physics and audio
+        void DescribeAccess(SystemPhase phase, SystemAccess& access) const override;
 
         void OnSceneStart(World* World) override;
         void OnSceneStop() override;
@@ -13,6 +13,7 @@
 #include <Zgine/World/Components/Core/IDComponent.h>
 #include <Zgine/World/Components/Core/RelationshipComponent.h>
 #include <Zgine/World/Components/Core/TransformComponent.h>
+#include <Zgine/World/Components/Core/WorldTransformComponent.h>
 
 // Rendering components
 #include <Zgine/World/Components/Rendering/MeshComponent.h>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Zgine/Core/Math/MathTypes.h>
+#include <Zgine/Core/Math/MathBatch.h>
 
 namespace Zgine {
 
@@ -16,16 +17,11 @@ struct TransformComponent {
     TransformComponent(const TransformComponent&) = default;
     TransformComponent(const Math::Vector3& translation) : Translation(translation) {}
 
+    /**
+     * @brief Translation * RotationX * RotationY * RotationZ * Scale (rotation in degrees)
+     */
     Math::Matrix4 GetTransform() const {
-        using namespace Math;
-
-        Matrix4 rotation = Matrix4::Rotation(DegToRad(Rotation.x), Vector3(1, 0, 0))
-                         * Matrix4::Rotation(DegToRad(Rotation.y), Vector3(0, 1, 0))
-                         * Matrix4::Rotation(DegToRad(Rotation.z), Vector3(0, 0, 1));
-
-        return Matrix4::Translation(Translation)
-             * rotation
-             * Matrix4::Scale(Scale);
+        return Math::ComposeTransform(Translation, Rotation, Scale);
     }
 };
 
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Zgine/Core/Math/MathTypes.h>
+#include <cstdint>
+
+namespace Zgine {
+
+/**
+ * @brief Cached world-space matrix of an entity, derived from TransformComponent
+ *
+ * Maintained by World::UpdateWorldTransforms (normally through TransformSystem):
+ * WorldMatrix = parent WorldMatrix * LocalMatrix, recomputed only when the
+ * entity's own TransformComponent or one of its ancestors changed. Readers
+ * (rendering, physics) use WorldMatrix instead of rebuilding TRS matrices.
+ *
+ * Runtime-only: never serialized, and never written by gameplay code.
+ */
+struct WorldTransformComponent {
+    Math::Matrix4 WorldMatrix = Math::Matrix4(1.0f);
+    Math::Matrix4 LocalMatrix = Math::Matrix4(1.0f);
+
+    // Local TRS that LocalMatrix was built from; a mismatch marks the entity dirty.
+    Math::Vector3 CachedTranslation = { 0.0f, 0.0f, 0.0f };
+    Math::Vector3 CachedRotation = { 0.0f, 0.0f, 0.0f };
+    Math::Vector3 CachedScale = { 1.0f, 1.0f, 1.0f };
+
+    // Incremented every time WorldMatrix changes; 0 means never resolved.
+    uint32_t Version = 0;
+
+    [[nodiscard]] bool IsValid() const noexcept { return Version != 0; }
+};
+
+} // namespace Zgine
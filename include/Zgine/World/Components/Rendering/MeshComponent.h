@@ -5,18 +5,18 @@
 
 namespace Zgine {
 
-class VertexArray;
-class VertexBuffer;
-class IndexBuffer;
+class MeshAsset;
 
 /**
  * @brief Mesh component for renderable geometry
+ *
+ * Only MeshHandle is persistent. The renderer resolves it to LoadedMesh and
+ * draws every sub-mesh through the same queue as primitives; an entity with
+ * a PrimitiveComponent as well is drawn as the primitive.
  */
 struct MeshComponent {
-    std::shared_ptr<VertexArray> VertexArray;
-    std::shared_ptr<VertexBuffer> VertexBuffer;
-    std::shared_ptr<IndexBuffer> IndexBuffer;
     AssetHandle MeshHandle;
+    std::shared_ptr<MeshAsset> LoadedMesh; // runtime cache of MeshHandle
 
     MeshComponent() = default;
     MeshComponent(const MeshComponent&) = default;
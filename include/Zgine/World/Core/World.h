@@ -10,6 +10,7 @@ namespace Zgine {
 
 class Entity;
 class EntityManager;
+class JobSystem;
 namespace Internal { struct WorldRegistryAccess; }
 
 /**
@@ -35,6 +36,14 @@ public:
     Entity DuplicateEntity(Entity source);
     [[nodiscard]] std::unique_ptr<World> CloneForRuntime() const;
 
+    /**
+     * @brief Refresh WorldTransformComponent of entities whose own transform or
+     *        an ancestor's changed since the last call
+     * @param jobs Optional job system; independent root subtrees update in parallel
+     * @return Number of world matrices recomputed (0 when nothing moved)
+     */
+    size_t UpdateWorldTransforms(JobSystem* jobs = nullptr);
+
     // System Updates
     void OnUpdate(float deltaTime);
     void OnRender();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Zgine/World/Systems/SystemAccess.h>
 #include <string>
 
 namespace Zgine {
@@ -62,11 +63,26 @@ public:
 
     /*
         Purpose : Get update priority; lower values execute first.
-        Notes   : 0–9 Input, 10–19 Physics, 20–29 Audio, 30–39 Script, 50+ Rendering.
+        Notes   : 0–9 Input, 10–19 Physics, 20–29 Audio, 30–39 Script, 40–49 Transform, 50+ Rendering.
         Return  : Priority integer.
     */
     [[nodiscard]] virtual int GetPriority() const { return 100; }
 
+    /**
+     * @brief Declare the component types this system touches in @p phase
+     *
+     * SystemManager overlaps systems whose declarations do not conflict when
+     * a JobSystem is attached. Called once per phase: a phase left without a
+     * declaration is exclusive, so a system that declares nothing, or only
+     * handles some phases, runs alone in priority order wherever it is silent.
+     * Declare a phase the system does nothing in with SetNoAccess().
+     * Queried when the schedule is rebuilt, not every frame.
+     */
+    virtual void DescribeAccess(SystemPhase phase, SystemAccess& access) const {
+        (void)phase;
+        access.SetExclusive();
+    }
+
     /*
         Purpose : Check whether the system is currently active.
     */
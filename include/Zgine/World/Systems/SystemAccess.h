@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief SystemManager pass that an access declaration applies to.
+ */
+enum class SystemPhase : uint8_t {
+    Update,
+    FixedUpdate
+};
+
+/**
+ * @brief Component types a system reads and writes during one phase.
+ *
+ * SystemManager uses these declarations to run systems concurrently. Two
+ * systems conflict when one writes a component type the other reads or
+ * writes, or when either one is exclusive; conflicting systems keep their
+ * priority order, everything else may overlap.
+ *
+ * A non-exclusive system may only touch the component types it declared and
+ * must not create or destroy entities or add or remove components while it
+ * runs. Systems that need to do that, or that call into other shared state
+ * (scripting VMs, audio engines, ...), stay exclusive.
+ *
+ * A declaration that says nothing at all is treated as exclusive, so a
+ * system that only describes some phases runs alone in the others. A phase
+ * the system does nothing in is declared with SetNoAccess().
+ *
+ * Usage:
+ *   access.Read<TransformComponent, CameraComponent>()
+ *         .Write<AudioSourceComponent>();
+ */
+class SystemAccess {
+public:
+    template<typename... Components>
+    SystemAccess& Read() {
+        (Insert(m_Reads, std::type_index(typeid(Components))), ...);
+        m_Declared = true;
+        return *this;
+    }
+
+    template<typename... Components>
+    SystemAccess& Write() {
+        (Insert(m_Writes, std::type_index(typeid(Components))), ...);
+        m_Declared = true;
+        return *this;
+    }
+
+    /**
+     * @brief Mark the system as touching everything; it never overlaps another system.
+     */
+    SystemAccess& SetExclusive(bool exclusive = true) {
+        m_Exclusive = exclusive;
+        m_Declared = true;
+        return *this;
+    }
+
+    /**
+     * @brief Declare that the system touches no component in this phase, e.g. because it does nothing there.
+     */
+    SystemAccess& SetNoAccess() {
+        m_Declared = true;
+        return *this;
+    }
+
+    [[nodiscard]] bool IsExclusive() const noexcept { return m_Exclusive; }
+    /** @brief Whether anything was declared; SystemManager treats an empty declaration as exclusive. */
+    [[nodiscard]] bool IsDeclared() const noexcept { return m_Declared; }
+    [[nodiscard]] const std::vector<std::type_index>& GetReads() const noexcept { return m_Reads; }
+    [[nodiscard]] const std::vector<std::type_index>& GetWrites() const noexcept { return m_Writes; }
+
+    /**
+     * @brief True if the two systems must not run at the same time.
+     */
+    [[nodiscard]] bool ConflictsWith(const SystemAccess& other) const;
+
+    void Clear();
+
+private:
+    // Both sets are kept sorted and unique so conflict checks are linear merges.
+    static void Insert(std::vector<std::type_index>& set, std::type_index type);
+
+    std::vector<std::type_index> m_Reads;
+    std::vector<std::type_index> m_Writes;
+    bool m_Exclusive = false;
+    bool m_Declared = false;
+};
+
+} // namespace Zgine
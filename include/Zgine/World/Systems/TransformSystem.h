@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Zgine/World/Systems/ISystem.h>
+#include <cstddef>
+
+namespace Zgine {
+
+class JobSystem;
+
+/**
+ * @brief Resolves WorldTransformComponent after gameplay has moved entities.
+ *
+ * Runs after physics and scripts and before rendering, so renderers and
+ * other late readers see world matrices that match this frame's local
+ * transforms. Only entities whose own transform or an ancestor's changed are
+ * recomputed; independent root subtrees are split across the JobSystem.
+ */
+class TransformSystem : public ISystem {
+public:
+    void Initialize() override {}
+    void Shutdown() override {}
+    void Update(World* World, float deltaTime) override;
+    const char* GetName() const override { return "TransformSystem"; }
+    int GetPriority() const override { return 40; }  // After scripts, before rendering
+    void DescribeAccess(SystemPhase phase, SystemAccess& access) const override;
+
+    /**
+     * @brief Job system used to update root subtrees in parallel; nullptr updates serially.
+     */
+    void SetJobSystem(JobSystem* jobs) noexcept { m_JobSystem = jobs; }
+
+    /**
+     * @brief Number of world matrices recomputed by the last Update.
+     */
+    [[nodiscard]] size_t GetLastUpdatedCount() const noexcept { return m_LastUpdatedCount; }
+
+private:
+    JobSystem* m_JobSystem = nullptr;
+    size_t m_LastUpdatedCount = 0;
+};
+
+} // namespace Zgine
@@ -26,6 +26,7 @@
 #include <Zgine/World/Components/Components.h>
 #include <Zgine/World/Camera/Camera.h>
 #include <Zgine/World/Serialization/WorldSerializer.h>
+#include <Zgine/World/Systems/TransformSystem.h>
 
 #include <Zgine/Physics/PhysicsSystem.h>
 #include <Zgine/Audio/AudioSystem.h>
@@ -25,13 +25,17 @@ namespace Zgine {
 
             // Initialize required systems
             AssetManager::Get().Initialize();
+            AssetManager::Get().SetJobSystem(&Application::Get().GetJobSystem());
             PBRMaterialPresetRegistry::Initialize();
 
             m_ScriptSystem.SetAudioSystem(&m_AudioSystem);
+            m_TransformSystem.SetJobSystem(&Application::Get().GetJobSystem());
             auto& systems = m_World.GetSystemManager();
+            systems.SetJobSystem(&Application::Get().GetJobSystem());
             systems.RegisterExternalSystem(&m_PhysicsSystem);
             systems.RegisterExternalSystem(&m_AudioSystem);
             systems.RegisterExternalSystem(&m_ScriptSystem);
+            systems.RegisterExternalSystem(&m_TransformSystem);
             systems.InitializeAll();
 
             // 初始化渲染系统 / Initialize rendering system
@@ -39,6 +43,7 @@ namespace Zgine {
             m_RenderingAvailable = RendererAPI::IsAvailable(rendererAPI);
             m_OpenGLSceneRendering = rendererAPI == RendererAPI::API::OpenGL && m_RenderingAvailable;
             if (m_RenderingAvailable) {
+                m_RenderSystem.SetJobSystem(&Application::Get().GetJobSystem());
                 m_RenderSystem.Initialize();
             }
 
@@ -111,6 +116,7 @@ namespace Zgine {
         virtual void OnDetach() override {
             m_World.GetSystemManager().ShutdownAll();
             m_RenderSystem.Shutdown();
+            AssetManager::Get().SetJobSystem(nullptr);
         }
 
         virtual void OnFixedUpdate(Timestep ts) override {
@@ -118,6 +124,8 @@ namespace Zgine {
         }
 
         virtual void OnUpdate(Timestep ts) override {
+            AssetManager::Get().Update();
+
             // Simple camera controller
             float mouseSensitivity = 0.1f;
             float moveSpeed = 10.0f * ts.GetSecondsF();
@@ -181,6 +189,7 @@ namespace Zgine {
         PhysicsSystem m_PhysicsSystem;
         AudioSystem m_AudioSystem;
         ScriptSystem m_ScriptSystem;
+        TransformSystem m_TransformSystem;
         RenderSystem m_RenderSystem;
 
         // 高级渲染系统（在基本模式下不使用）/ Advanced systems (not used in basic mode)
@@ -116,6 +116,17 @@ void AudioSystem::Update(World* World, float deltaTime) {
     }
 }
 
+void AudioSystem::DescribeAccess(SystemPhase phase, SystemAccess& access) const {
+    // Audio has no FixedUpdate. Update only moves the listener and spatialized
+    // sources; the miniaudio engine is owned by this system alone.
+    if (phase == SystemPhase::Update) {
+        access.Read<TransformComponent, CameraComponent, AudioListenerComponent>()
+              .Write<AudioSourceComponent>();
+    } else {
+        access.SetNoAccess();
+    }
+}
+
 void AudioSystem::CreateAudioSource(Entity entity) {
     if (!m_Initialized || !m_Engine || !entity.HasComponent<AudioSourceComponent>()) {
         return;
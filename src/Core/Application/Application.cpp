@@ -6,6 +6,8 @@
 #include <Zgine/Core/Foundation/Assert.h>
 #include <Zgine/Core/Time/Timestep.h>
 
+#include <thread>
+
 namespace Zgine {
 
     Application* Application::s_Instance = nullptr;
@@ -32,6 +34,10 @@ namespace Zgine {
         ZGINE_CORE_ASSERT(!s_Instance, "Application already exists!");
         s_Instance = this;
 
+        // The main thread helps while it waits, so leave it one core.
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        m_JobSystem = std::make_unique<JobSystem>(hardwareThreads > 1 ? hardwareThreads - 1 : 1);
+
         // Initialize VFS (Virtual File System)
         if (!VFS::Initialize("Zgine")) {
             ZGINE_CORE_ERROR("Failed to initialize VFS!");
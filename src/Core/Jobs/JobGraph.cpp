@@ -0,0 +1,191 @@
+#include <Zgine/Core/Jobs/JobGraph.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Core/Log/Log.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace Zgine {
+
+JobGraph::JobGraph() = default;
+JobGraph::~JobGraph() = default;
+
+JobNodeId JobGraph::AddNode(std::string_view name, Job job) {
+    const auto id = static_cast<JobNodeId>(m_Nodes.size());
+    Node node;
+    node.Name = std::string(name);
+    node.Function = std::move(job);
+    m_Nodes.push_back(std::move(node));
+    m_Compiled = false;
+    return id;
+}
+
+bool JobGraph::AddEdge(JobNodeId before, JobNodeId after) {
+    if (before >= m_Nodes.size() || after >= m_Nodes.size()) {
+        ZGINE_CORE_WARN("JobGraph::AddEdge ignored unknown node ({} -> {}).", before, after);
+        return false;
+    }
+    if (before == after) {
+        ZGINE_CORE_WARN("JobGraph::AddEdge ignored self-dependency on '{}'.", m_Nodes[before].Name);
+        return false;
+    }
+
+    m_Edges.emplace_back(before, after);
+    m_Compiled = false;
+    return true;
+}
+
+bool JobGraph::Compile() {
+    std::sort(m_Edges.begin(), m_Edges.end());
+    m_Edges.erase(std::unique(m_Edges.begin(), m_Edges.end()), m_Edges.end());
+
+    for (Node& node : m_Nodes) {
+        node.SuccessorCount = 0;
+        node.PredecessorCount = 0;
+    }
+    for (const auto& [before, after] : m_Edges) {
+        ++m_Nodes[before].SuccessorCount;
+        ++m_Nodes[after].PredecessorCount;
+    }
+
+    // Edges are sorted by source, so each node's successors are contiguous.
+    m_Successors.resize(m_Edges.size());
+    uint32_t offset = 0;
+    for (Node& node : m_Nodes) {
+        node.FirstSuccessor = offset;
+        offset += node.SuccessorCount;
+    }
+    for (size_t i = 0; i < m_Edges.size(); ++i) {
+        m_Successors[i] = m_Edges[i].second;
+    }
+
+    // Kahn's algorithm; the min-heap makes the order deterministic (lowest id first).
+    std::vector<uint32_t> remaining(m_Nodes.size());
+    std::priority_queue<JobNodeId, std::vector<JobNodeId>, std::greater<>> ready;
+    m_Roots.clear();
+    for (JobNodeId id = 0; id < m_Nodes.size(); ++id) {
+        remaining[id] = m_Nodes[id].PredecessorCount;
+        if (remaining[id] == 0) {
+            m_Roots.push_back(id);
+            ready.push(id);
+        }
+    }
+
+    m_TopologicalOrder.clear();
+    m_TopologicalOrder.reserve(m_Nodes.size());
+    while (!ready.empty()) {
+        const JobNodeId id = ready.top();
+        ready.pop();
+        m_TopologicalOrder.push_back(id);
+
+        const Node& node = m_Nodes[id];
+        for (uint32_t i = 0; i < node.SuccessorCount; ++i) {
+            const JobNodeId successor = m_Successors[node.FirstSuccessor + i];
+            if (--remaining[successor] == 0) {
+                ready.push(successor);
+            }
+        }
+    }
+
+    if (m_TopologicalOrder.size() != m_Nodes.size()) {
+        for (JobNodeId id = 0; id < m_Nodes.size(); ++id) {
+            if (remaining[id] != 0) {
+                ZGINE_CORE_ERROR("JobGraph cycle involves node '{}'.", m_Nodes[id].Name);
+            }
+        }
+        m_TopologicalOrder.clear();
+        m_Compiled = false;
+        return false;
+    }
+
+    m_RemainingPredecessors = std::make_unique<std::atomic<uint32_t>[]>(m_Nodes.size());
+    m_Compiled = true;
+    return true;
+}
+
+bool JobGraph::Execute(JobSystem& jobs) {
+    if (!m_Compiled && !Compile()) {
+        return false;
+    }
+    if (m_Nodes.empty()) {
+        return true;
+    }
+
+    for (size_t i = 0; i < m_Nodes.size(); ++i) {
+        m_RemainingPredecessors[i].store(m_Nodes[i].PredecessorCount, std::memory_order_relaxed);
+    }
+
+    JobCounter counter;
+    const ExecutionContext context{this, &jobs, &counter};
+    const ExecutionContext* contextPtr = &context;
+
+    // Queue every root but the last, which the caller starts itself.
+    for (size_t i = 0; i + 1 < m_Roots.size(); ++i) {
+        const JobNodeId root = m_Roots[i];
+        jobs.Run([contextPtr, root] { RunNode(*contextPtr, root); }, &counter);
+    }
+    RunNode(context, m_Roots.back());
+
+    jobs.Wait(counter);
+    return true;
+}
+
+bool JobGraph::ExecuteSerial() {
+    if (!m_Compiled && !Compile()) {
+        return false;
+    }
+
+    for (JobNodeId id : m_TopologicalOrder) {
+        if (m_Nodes[id].Function) {
+            m_Nodes[id].Function();
+        }
+    }
+    return true;
+}
+
+void JobGraph::Clear() {
+    m_Nodes.clear();
+    m_Edges.clear();
+    m_Successors.clear();
+    m_Roots.clear();
+    m_TopologicalOrder.clear();
+    m_RemainingPredecessors.reset();
+    m_Compiled = false;
+}
+
+const std::string& JobGraph::GetNodeName(JobNodeId node) const {
+    static const std::string kUnknown = "<invalid>";
+    return node < m_Nodes.size() ? m_Nodes[node].Name : kUnknown;
+}
+
+void JobGraph::RunNode(const ExecutionContext& context, JobNodeId node) {
+    JobGraph& graph = *context.Graph;
+    const ExecutionContext* contextPtr = &context;
+
+    JobNodeId current = node;
+    while (current != kInvalidJobNode) {
+        const Node& entry = graph.m_Nodes[current];
+        if (entry.Function) {
+            entry.Function();
+        }
+
+        // Release successors. The last one that becomes ready continues on
+        // this thread; the others are queued for idle workers to steal.
+        JobNodeId next = kInvalidJobNode;
+        for (uint32_t i = 0; i < entry.SuccessorCount; ++i) {
+            const JobNodeId successor = graph.m_Successors[entry.FirstSuccessor + i];
+            if (graph.m_RemainingPredecessors[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                continue;
+            }
+            if (next != kInvalidJobNode) {
+                const JobNodeId queued = next;
+                context.Jobs->Run([contextPtr, queued] { RunNode(*contextPtr, queued); }, context.Counter);
+            }
+            next = successor;
+        }
+        current = next;
+    }
+}
+
+} // namespace Zgine
@@ -1,66 +1,299 @@
 #include <Zgine/Core/Jobs/JobSystem.h>
-#include <algorithm>
+#include "WorkStealingDeque.h"
+
+#include <exception>
+#include <functional>
+#include <utility>
 
 namespace Zgine {
 
-JobSystem::JobSystem(uint32_t threadCount) {
+namespace {
+
+// Large enough that a ParallelFor over a typical ECS view never overflows;
+// full deques spill into the shared injection queue rather than failing.
+constexpr size_t kWorkerQueueCapacity = 4096;
+
+// How many empty help attempts a non-worker waiter makes before it blocks.
+constexpr uint32_t kSpinsBeforeBlocking = 64;
+
+struct WorkerBinding {
+    const JobSystem* System = nullptr;
+    int32_t QueueIndex = -1;
+};
+
+thread_local WorkerBinding t_Worker;
+
+uint32_t NextStealIndex(uint32_t count) {
+    // Per-thread xorshift: thieves start at different victims so they do
+    // not all contend on the same deque top.
+    thread_local uint32_t state =
+        static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % count;
+}
+
+} // namespace
+
+struct JobSystem::Task {
+    Job Function;
+    JobCounter* Counter = nullptr;
+};
+
+struct JobSystem::WorkerQueue {
+    WorkStealingDeque<Task> Deque{kWorkerQueueCapacity};
+};
+
+JobSystem::JobSystem(uint32_t threadCount)
+    : m_OwnerThread(std::this_thread::get_id()) {
     if (threadCount == 0)
         threadCount = std::max(1u, std::thread::hardware_concurrency());
 
+    m_Queues.reserve(threadCount + 1);
+    for (uint32_t i = 0; i < threadCount + 1; ++i) {
+        m_Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
     m_Workers.reserve(threadCount);
     for (uint32_t i = 0; i < threadCount; ++i) {
-        m_Workers.emplace_back([this](std::stop_token st) {
-            WorkerLoop(std::move(st));
+        m_Workers.emplace_back([this, i](std::stop_token st) {
+            WorkerLoop(std::move(st), i + 1);
         });
     }
 }
 
 JobSystem::~JobSystem() {
-    // jthread destructors automatically request_stop() then join().
+    WaitAll();
+
+    for (std::jthread& worker : m_Workers) {
+        worker.request_stop();
+    }
+    m_WakeEpoch.fetch_add(1);
+    m_WakeEpoch.notify_all();
+
+    // Join before the queues are destroyed.
+    m_Workers.clear();
+}
+
+void JobSystem::Run(Job job, JobCounter* counter) {
+    if (counter) {
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Enqueue(new Task{std::move(job), counter});
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+    HelpUntilZero(counter.m_Pending);
 }
 
 std::future<void> JobSystem::Submit(Job job) {
-    std::packaged_task<void()> task(std::move(job));
-    std::future<void> future = task.get_future();
+    auto promise = std::make_shared<std::promise<void>>();
+    std::future<void> future = promise->get_future();
 
-    {
-        std::scoped_lock lock(m_QueueMutex);
-        m_Queue.push(std::move(task));
-    }
-    m_Condition.notify_one();
+    Run([job = std::move(job), promise] {
+        try {
+            job();
+            promise->set_value();
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
 
     return future;
 }
 
+void JobSystem::SetOwnerWork(std::function<bool()> work) {
+    m_OwnerWork = std::move(work);
+}
+
+void JobSystem::NotifyOwner() {
+    m_CompletionEpoch.fetch_add(1);
+    if (m_BlockedWaiters.load() > 0) {
+        m_CompletionEpoch.notify_all();
+    }
+}
+
 void JobSystem::WaitAll() {
-    // Simple strategy: submit a sentinel per worker and wait for all.
-    std::vector<std::future<void>> barriers;
-    barriers.reserve(m_Workers.size());
-    for (size_t i = 0; i < m_Workers.size(); ++i)
-        barriers.push_back(Submit([] {}));
-    for (auto& f : barriers) f.wait();
+    HelpUntilZero(m_PendingJobs);
 }
 
-void JobSystem::WorkerLoop(std::stop_token stopToken) {
-    while (true) {
-        std::packaged_task<void()> task;
+void JobSystem::Enqueue(Task* task) {
+    m_PendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+    const int32_t queueIndex = GetCurrentQueueIndex();
+    if (queueIndex < 0 || !m_Queues[static_cast<size_t>(queueIndex)]->Deque.Push(task)) {
+        std::scoped_lock lock(m_InjectMutex);
+        m_Injected.push_back(task);
+        m_InjectedCount.fetch_add(1, std::memory_order_release);
+    }
+
+    WakeWorker();
+}
+
+void JobSystem::WakeWorker() {
+    // Pairs with the sleeper's increment of m_SleepingWorkers before waiting:
+    // either the sleeper sees the new epoch or we see it sleeping.
+    m_WakeEpoch.fetch_add(1);
+    if (m_SleepingWorkers.load() > 0) {
+        m_WakeEpoch.notify_one();
+    }
+}
+
+void JobSystem::HelpUntilZero(const std::atomic<uint32_t>& pending) {
+    // Workers never block here: a worker waiting inside a job must keep
+    // draining queues, otherwise nested waits could starve the pool.
+    const bool isWorker = t_Worker.System == this;
+    const bool isOwner = !isWorker && std::this_thread::get_id() == m_OwnerThread;
+    uint32_t idleSpins = 0;
+
+    while (pending.load(std::memory_order_acquire) != 0) {
+        if (TryRunOne() || (isOwner && RunOwnerWork())) {
+            idleSpins = 0;
+            continue;
+        }
+
+        if (isWorker || ++idleSpins < kSpinsBeforeBlocking) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Work queued before NotifyOwner() bumped the epoch is picked up here.
+        const uint32_t epoch = m_CompletionEpoch.load();
+        if (pending.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+        if (isOwner && RunOwnerWork()) {
+            idleSpins = 0;
+            continue;
+        }
+        m_BlockedWaiters.fetch_add(1);
+        m_CompletionEpoch.wait(epoch);
+        m_BlockedWaiters.fetch_sub(1);
+        idleSpins = 0;
+    }
+}
+
+bool JobSystem::TryRunOne() {
+    Task* task = FindTask(GetCurrentQueueIndex());
+    if (!task) {
+        return false;
+    }
+
+    Execute(task);
+    return true;
+}
+
+bool JobSystem::RunOwnerWork() {
+    if (!m_OwnerWork || m_InOwnerWork) {
+        return false;
+    }
+    m_InOwnerWork = true;
+    const bool didWork = m_OwnerWork();
+    m_InOwnerWork = false;
+    return didWork;
+}
 
-        {
-            std::unique_lock lock(m_QueueMutex);
-            // Wait until there's work OR a stop was requested.
-            m_Condition.wait(lock, stopToken, [this] {
-                return !m_Queue.empty();
-            });
+JobSystem::Task* JobSystem::FindTask(int32_t queueIndex) {
+    if (queueIndex >= 0) {
+        if (Task* task = m_Queues[static_cast<size_t>(queueIndex)]->Deque.Pop()) {
+            return task;
+        }
+    }
 
-            if (stopToken.stop_requested() && m_Queue.empty())
-                return;
+    if (Task* task = PopInjected()) {
+        return task;
+    }
 
-            task = std::move(m_Queue.front());
-            m_Queue.pop();
+    const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+    const uint32_t start = NextStealIndex(queueCount);
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        const uint32_t victim = (start + i) % queueCount;
+        if (static_cast<int32_t>(victim) == queueIndex) {
+            continue;
         }
+        if (Task* task = m_Queues[victim]->Deque.Steal()) {
+            return task;
+        }
+    }
 
-        task();   // Execute outside the lock
+    return nullptr;
+}
+
+JobSystem::Task* JobSystem::PopInjected() {
+    if (m_InjectedCount.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    std::scoped_lock lock(m_InjectMutex);
+    if (m_Injected.empty()) {
+        return nullptr;
     }
+
+    Task* task = m_Injected.front();
+    m_Injected.pop_front();
+    m_InjectedCount.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+int32_t JobSystem::GetCurrentQueueIndex() const {
+    if (t_Worker.System == this) {
+        return t_Worker.QueueIndex;
+    }
+    if (std::this_thread::get_id() == m_OwnerThread) {
+        return 0;
+    }
+    return -1;
+}
+
+void JobSystem::Execute(Task* task) {
+    task->Function();
+
+    JobCounter* counter = task->Counter;
+    delete task;
+
+    // The counter may be destroyed by its waiter as soon as it reaches zero,
+    // so it is never touched after the decrement; wake-ups go through the
+    // JobSystem-owned completion epoch instead.
+    const bool groupDone = counter
+        && counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    const bool allDone = m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    if (groupDone || allDone) {
+        m_CompletionEpoch.fetch_add(1);
+        if (m_BlockedWaiters.load() > 0) {
+            m_CompletionEpoch.notify_all();
+        }
+    }
+}
+
+void JobSystem::WorkerLoop(std::stop_token stopToken, uint32_t queueIndex) {
+    t_Worker = WorkerBinding{this, static_cast<int32_t>(queueIndex)};
+
+    while (true) {
+        if (Task* task = FindTask(static_cast<int32_t>(queueIndex))) {
+            Execute(task);
+            continue;
+        }
+
+        // Read the epoch before the final check so a job queued in between
+        // changes it and the wait below returns immediately.
+        const uint32_t epoch = m_WakeEpoch.load();
+        if (Task* task = FindTask(static_cast<int32_t>(queueIndex))) {
+            Execute(task);
+            continue;
+        }
+
+        if (stopToken.stop_requested())
+            break;
+
+        m_SleepingWorkers.fetch_add(1);
+        m_WakeEpoch.wait(epoch);
+        m_SleepingWorkers.fetch_sub(1);
+    }
+
+    t_Worker = WorkerBinding{};
 }
 
 } // namespace Zgine
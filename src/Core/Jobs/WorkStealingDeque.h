@@ -0,0 +1,120 @@
+#pragma once
+
+// Purpose: Fixed-capacity Chase-Lev work-stealing deque used by JobSystem workers.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Zgine {
+
+/**
+ * @brief Single-owner, multi-thief lock-free deque of pointers.
+ *
+ * The owning thread calls Push/Pop at the bottom; any thread may Steal from
+ * the top. Follows Lê, Pop, Cohen & Zappa Nardelli, "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ * The ring does not grow: Push returns false when full and JobSystem routes
+ * the job to its shared injection queue instead. That keeps the deque free of
+ * buffer reclamation problems, which is the hard part of the growable variant.
+ */
+template<typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(size_t capacity)
+        : m_Capacity(static_cast<int64_t>(RoundUpPow2(capacity)))
+        , m_Mask(m_Capacity - 1)
+        , m_Buffer(std::make_unique<std::atomic<T*>[]>(static_cast<size_t>(m_Capacity))) {}
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Owner only. Returns false when the ring is full.
+     */
+    bool Push(T* item) {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top >= m_Capacity) {
+            return false;
+        }
+
+        m_Buffer[bottom & m_Mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Owner only. Pops the most recently pushed item, or nullptr.
+     */
+    T* Pop() {
+        const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item: race thieves for it through m_Top.
+            if (!m_Top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * @brief Any thread. Takes the oldest item, or nullptr if empty or the race was lost.
+     */
+    T* Steal() {
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T* item = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /**
+     * @brief Approximate; exact only when called by the owner with no concurrent thieves.
+     */
+    [[nodiscard]] bool IsEmpty() const {
+        return m_Top.load(std::memory_order_acquire) >= m_Bottom.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t RoundUpPow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Top and bottom live on separate cache lines: thieves hammer m_Top while
+    // the owner updates m_Bottom on every push/pop.
+    alignas(64) std::atomic<int64_t> m_Top{0};
+    alignas(64) std::atomic<int64_t> m_Bottom{0};
+    alignas(64) const int64_t m_Capacity;
+    const int64_t m_Mask;
+    std::unique_ptr<std::atomic<T*>[]> m_Buffer;
+};
+
+} // namespace Zgine
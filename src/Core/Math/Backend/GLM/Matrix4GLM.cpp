@@ -23,42 +23,8 @@ static Matrix4 FromGLM(const glm::mat4& m) {
     return result;
 }
 
-// Constructors
-Matrix4::Matrix4() {
-    std::memset(m, 0, 16 * sizeof(float));
-}
-
-Matrix4::Matrix4(float diagonal) {
-    std::memset(m, 0, 16 * sizeof(float));
-    m[0] = diagonal;
-    m[5] = diagonal;
-    m[10] = diagonal;
-    m[15] = diagonal;
-}
-
-// Element access (column-major: m[col * 4 + row])
-float& Matrix4::operator()(int row, int col) {
-    return m[col * 4 + row];
-}
-
-const float& Matrix4::operator()(int row, int col) const {
-    return m[col * 4 + row];
-}
-
-// Operators
-Matrix4 Matrix4::operator*(const Matrix4& other) const {
-    return FromGLM(ToGLM(*this) * ToGLM(other));
-}
-
-Vector4 Matrix4::operator*(const Vector4& v) const {
-    glm::vec4 result = ToGLM(*this) * glm::vec4(v.x, v.y, v.z, v.w);
-    return Vector4(result.x, result.y, result.z, result.w);
-}
-
-Matrix4& Matrix4::operator*=(const Matrix4& other) {
-    *this = *this * other;
-    return *this;
-}
+// Constructors, element access and the multiply operators are inline in
+// Matrix4.h (SIMD fast paths).
 
 // Static constructors
 Matrix4 Matrix4::Identity() {
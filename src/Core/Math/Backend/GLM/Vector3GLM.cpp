@@ -16,11 +16,6 @@ const Vector3 Vector3::Right(1.0f, 0.0f, 0.0f);
 const Vector3 Vector3::Forward(0.0f, 0.0f, -1.0f);
 const Vector3 Vector3::Back(0.0f, 0.0f, 1.0f);
 
-// Constructors
-Vector3::Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
-Vector3::Vector3(float scalar) : x(scalar), y(scalar), z(scalar) {}
-Vector3::Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
-
 // Operators
 Vector3 Vector3::operator+(const Vector3& other) const {
     return Vector3(x + other.x, y + other.y, z + other.z);
@@ -12,10 +12,7 @@ const Vector4 Vector4::Zero(0.0f, 0.0f, 0.0f, 0.0f);
 const Vector4 Vector4::One(1.0f, 1.0f, 1.0f, 1.0f);
 
 // Constructors
-Vector4::Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
-Vector4::Vector4(float scalar) : x(scalar), y(scalar), z(scalar), w(scalar) {}
 Vector4::Vector4(const Vector3& vec3, float w) : x(vec3.x), y(vec3.y), z(vec3.z), w(w) {}
-Vector4::Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
 
 // Operators
 Vector4 Vector4::operator+(const Vector4& other) const {
@@ -0,0 +1,247 @@
+#include <Zgine/Core/Math/MathBatch.h>
+#include <Zgine/Core/Math/MathTypes.h>
+#include <Zgine/Core/Math/Simd.h>
+#include <algorithm>
+
+namespace Zgine::Math {
+
+namespace {
+    using Simd::Float4;
+
+    constexpr size_t kLanes = 4;
+
+#if defined(ZGINE_SIMD_AVX2)
+    ZGINE_FORCE_INLINE __m256 MulAdd8(__m256 a, __m256 b, __m256 c) {
+    #if defined(ZGINE_SIMD_FMA)
+        return _mm256_fmadd_ps(a, b, c);
+    #else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+    #endif
+    }
+
+    ZGINE_FORCE_INLINE __m256 LoadDuplicated(const float* p) {
+        const __m128 half = _mm_loadu_ps(p);
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(half), half, 1);
+    }
+#endif
+
+    // out = a * b (column-major); out may alias a or b.
+    ZGINE_FORCE_INLINE void Multiply(const float* a, const float* b, float* out) {
+#if defined(ZGINE_SIMD_AVX2)
+        // Two output columns per iteration: each 128-bit half splats its own column of b.
+        const __m256 a0 = LoadDuplicated(a);
+        const __m256 a1 = LoadDuplicated(a + 4);
+        const __m256 a2 = LoadDuplicated(a + 8);
+        const __m256 a3 = LoadDuplicated(a + 12);
+        for (int pair = 0; pair < 2; ++pair) {
+            const __m256 bc = _mm256_loadu_ps(b + pair * 8);
+            __m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(bc, bc, 0x00));
+            r = MulAdd8(a1, _mm256_shuffle_ps(bc, bc, 0x55), r);
+            r = MulAdd8(a2, _mm256_shuffle_ps(bc, bc, 0xAA), r);
+            r = MulAdd8(a3, _mm256_shuffle_ps(bc, bc, 0xFF), r);
+            _mm256_storeu_ps(out + pair * 8, r);
+        }
+#else
+        Detail::MultiplyColumnMajor(a, b, out);
+#endif
+    }
+
+    /**
+     * @brief Compose four TRS matrices whose components are given lane-wise
+     *        and write the first @p count of them.
+     */
+    ZGINE_FORCE_INLINE void Compose4(Float4 tx, Float4 ty, Float4 tz,
+                                     Float4 rx, Float4 ry, Float4 rz,
+                                     Float4 sx, Float4 sy, Float4 sz,
+                                     Matrix4* out, size_t count) {
+        const Float4 toRadians = Simd::Splat(DEG2RAD);
+        Float4 sa, ca, sb, cb, sc, cc;
+        Simd::SinCos(Simd::Mul(rx, toRadians), sa, ca);
+        Simd::SinCos(Simd::Mul(ry, toRadians), sb, cb);
+        Simd::SinCos(Simd::Mul(rz, toRadians), sc, cc);
+
+        // Rx * Ry * Rz expanded; Rij is row i, column j.
+        const Float4 sasb = Simd::Mul(sa, sb);
+        const Float4 casb = Simd::Mul(ca, sb);
+        const Float4 r00 = Simd::Mul(cb, cc);
+        const Float4 r10 = Simd::MulAdd(sasb, cc, Simd::Mul(ca, sc));
+        const Float4 r20 = Simd::Sub(Simd::Mul(sa, sc), Simd::Mul(casb, cc));
+        const Float4 r01 = Simd::Negate(Simd::Mul(cb, sc));
+        const Float4 r11 = Simd::Sub(Simd::Mul(ca, cc), Simd::Mul(sasb, sc));
+        const Float4 r21 = Simd::MulAdd(casb, sc, Simd::Mul(sa, cc));
+        const Float4 r02 = sb;
+        const Float4 r12 = Simd::Negate(Simd::Mul(sa, cb));
+        const Float4 r22 = Simd::Mul(ca, cb);
+
+        // Each column arrives lane-per-matrix; a transpose turns it into one
+        // contiguous column per matrix.
+        Float4 columns[4][4] = {
+            { Simd::Mul(r00, sx), Simd::Mul(r10, sx), Simd::Mul(r20, sx), Simd::Zero() },
+            { Simd::Mul(r01, sy), Simd::Mul(r11, sy), Simd::Mul(r21, sy), Simd::Zero() },
+            { Simd::Mul(r02, sz), Simd::Mul(r12, sz), Simd::Mul(r22, sz), Simd::Zero() },
+            { tx, ty, tz, Simd::Splat(1.0f) },
+        };
+        for (int col = 0; col < 4; ++col) {
+            Float4* rows = columns[col];
+            Simd::Transpose(rows[0], rows[1], rows[2], rows[3]);
+            for (size_t lane = 0; lane < count; ++lane) {
+                Simd::Store(out[lane].m + col * 4, rows[lane]);
+            }
+        }
+    }
+
+    ZGINE_FORCE_INLINE void TransformPoint(Float4 c0, Float4 c1, Float4 c2, Float4 c3,
+                                           const float* point, float* out) {
+        const Float4 p = Simd::LoadFloat3(point);
+        Float4 r = Simd::MulAdd(c0, Simd::SplatLane<0>(p), c3);
+        r = Simd::MulAdd(c1, Simd::SplatLane<1>(p), r);
+        r = Simd::MulAdd(c2, Simd::SplatLane<2>(p), r);
+        Simd::StoreFloat3(out, r);
+    }
+}
+
+Matrix4 ComposeTransform(const Vector3& translation, const Vector3& rotationDegrees, const Vector3& scale) {
+    // One vector sin/cos covers all three angles; the rest is scalar.
+    float sines[4];
+    float cosines[4];
+    Float4 sinValues, cosValues;
+    Simd::SinCos(Simd::Mul(Simd::Set(rotationDegrees.x, rotationDegrees.y, rotationDegrees.z, 0.0f), Simd::Splat(DEG2RAD)),
+                 sinValues, cosValues);
+    Simd::Store(sines, sinValues);
+    Simd::Store(cosines, cosValues);
+    const float sa = sines[0], sb = sines[1], sc = sines[2];
+    const float ca = cosines[0], cb = cosines[1], cc = cosines[2];
+
+    // Same expansion of Rx * Ry * Rz as Compose4.
+    const float sasb = sa * sb;
+    const float casb = ca * sb;
+    Matrix4 result;
+    float* m = result.m;
+    m[0] = cb * cc * scale.x;
+    m[1] = (sasb * cc + ca * sc) * scale.x;
+    m[2] = (sa * sc - casb * cc) * scale.x;
+    m[4] = -(cb * sc) * scale.y;
+    m[5] = (ca * cc - sasb * sc) * scale.y;
+    m[6] = (casb * sc + sa * cc) * scale.y;
+    m[8] = sb * scale.z;
+    m[9] = -(sa * cb) * scale.z;
+    m[10] = ca * cb * scale.z;
+    m[12] = translation.x;
+    m[13] = translation.y;
+    m[14] = translation.z;
+    m[15] = 1.0f;
+    return result;
+}
+
+void ComposeTransforms(const TransformStreamsSoA& streams, Matrix4* out, size_t count) {
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes) {
+        Compose4(Simd::Load(streams.TranslationX + i), Simd::Load(streams.TranslationY + i), Simd::Load(streams.TranslationZ + i),
+                 Simd::Load(streams.RotationX + i), Simd::Load(streams.RotationY + i), Simd::Load(streams.RotationZ + i),
+                 Simd::Load(streams.ScaleX + i), Simd::Load(streams.ScaleY + i), Simd::Load(streams.ScaleZ + i),
+                 out + i, kLanes);
+    }
+
+    if (i == count) {
+        return;
+    }
+
+    // Pad the tail into full lanes so it takes the same code path as the body.
+    const float* sources[9] = {
+        streams.TranslationX, streams.TranslationY, streams.TranslationZ,
+        streams.RotationX, streams.RotationY, streams.RotationZ,
+        streams.ScaleX, streams.ScaleY, streams.ScaleZ,
+    };
+    float tail[9][kLanes] = {};
+    for (int stream = 0; stream < 9; ++stream) {
+        std::copy(sources[stream] + i, sources[stream] + count, tail[stream]);
+    }
+    Compose4(Simd::Load(tail[0]), Simd::Load(tail[1]), Simd::Load(tail[2]),
+             Simd::Load(tail[3]), Simd::Load(tail[4]), Simd::Load(tail[5]),
+             Simd::Load(tail[6]), Simd::Load(tail[7]), Simd::Load(tail[8]),
+             out + i, count - i);
+}
+
+void TransformPoints(const Matrix4& m, const Vector3* points, Vector3* out, size_t count) {
+    const Float4 c0 = Simd::Load(m.m);
+    const Float4 c1 = Simd::Load(m.m + 4);
+    const Float4 c2 = Simd::Load(m.m + 8);
+    const Float4 c3 = Simd::Load(m.m + 12);
+    for (size_t i = 0; i < count; ++i) {
+        TransformPoint(c0, c1, c2, c3, points[i].data, out[i].data);
+    }
+}
+
+void TransformPoints(const Matrix4& m, const float* xs, const float* ys, const float* zs,
+                     float* outX, float* outY, float* outZ, size_t count) {
+    size_t i = 0;
+#if defined(ZGINE_SIMD_AVX2)
+    {
+        const __m256 m00 = _mm256_set1_ps(m.m[0]), m10 = _mm256_set1_ps(m.m[1]), m20 = _mm256_set1_ps(m.m[2]);
+        const __m256 m01 = _mm256_set1_ps(m.m[4]), m11 = _mm256_set1_ps(m.m[5]), m21 = _mm256_set1_ps(m.m[6]);
+        const __m256 m02 = _mm256_set1_ps(m.m[8]), m12 = _mm256_set1_ps(m.m[9]), m22 = _mm256_set1_ps(m.m[10]);
+        const __m256 m03 = _mm256_set1_ps(m.m[12]), m13 = _mm256_set1_ps(m.m[13]), m23 = _mm256_set1_ps(m.m[14]);
+        for (; i + 8 <= count; i += 8) {
+            const __m256 x = _mm256_loadu_ps(xs + i);
+            const __m256 y = _mm256_loadu_ps(ys + i);
+            const __m256 z = _mm256_loadu_ps(zs + i);
+            _mm256_storeu_ps(outX + i, MulAdd8(m02, z, MulAdd8(m01, y, MulAdd8(m00, x, m03))));
+            _mm256_storeu_ps(outY + i, MulAdd8(m12, z, MulAdd8(m11, y, MulAdd8(m10, x, m13))));
+            _mm256_storeu_ps(outZ + i, MulAdd8(m22, z, MulAdd8(m21, y, MulAdd8(m20, x, m23))));
+        }
+    }
+#endif
+    const Float4 m00 = Simd::Splat(m.m[0]), m10 = Simd::Splat(m.m[1]), m20 = Simd::Splat(m.m[2]);
+    const Float4 m01 = Simd::Splat(m.m[4]), m11 = Simd::Splat(m.m[5]), m21 = Simd::Splat(m.m[6]);
+    const Float4 m02 = Simd::Splat(m.m[8]), m12 = Simd::Splat(m.m[9]), m22 = Simd::Splat(m.m[10]);
+    const Float4 m03 = Simd::Splat(m.m[12]), m13 = Simd::Splat(m.m[13]), m23 = Simd::Splat(m.m[14]);
+    for (; i + kLanes <= count; i += kLanes) {
+        const Float4 x = Simd::Load(xs + i);
+        const Float4 y = Simd::Load(ys + i);
+        const Float4 z = Simd::Load(zs + i);
+        Simd::Store(outX + i, Simd::MulAdd(m02, z, Simd::MulAdd(m01, y, Simd::MulAdd(m00, x, m03))));
+        Simd::Store(outY + i, Simd::MulAdd(m12, z, Simd::MulAdd(m11, y, Simd::MulAdd(m10, x, m13))));
+        Simd::Store(outZ + i, Simd::MulAdd(m22, z, Simd::MulAdd(m21, y, Simd::MulAdd(m20, x, m23))));
+    }
+
+    const Float4 c0 = Simd::Load(m.m);
+    const Float4 c1 = Simd::Load(m.m + 4);
+    const Float4 c2 = Simd::Load(m.m + 8);
+    const Float4 c3 = Simd::Load(m.m + 12);
+    for (; i < count; ++i) {
+        const float point[3] = {xs[i], ys[i], zs[i]};
+        float result[3];
+        TransformPoint(c0, c1, c2, c3, point, result);
+        outX[i] = result[0];
+        outY[i] = result[1];
+        outZ[i] = result[2];
+    }
+}
+
+void MultiplyMatrices(const Matrix4* lhs, const Matrix4* rhs, Matrix4* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        Multiply(lhs[i].m, rhs[i].m, out[i].m);
+    }
+}
+
+void MultiplyMatrices(const Matrix4& lhs, const Matrix4* rhs, Matrix4* out, size_t count) {
+    // Copied so writing out[i] cannot change lhs when it lives inside out.
+    const Matrix4 left = lhs;
+    for (size_t i = 0; i < count; ++i) {
+        Multiply(left.m, rhs[i].m, out[i].m);
+    }
+}
+
+const char* GetSimdBackendName() {
+#if defined(ZGINE_SIMD_AVX2)
+    return "AVX2";
+#elif defined(ZGINE_SIMD_SSE)
+    return "SSE2";
+#elif defined(ZGINE_SIMD_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+} // namespace Zgine::Math
@@ -0,0 +1,77 @@
+#include <Zgine/Core/Memory/RangeAllocator.h>
+#include <algorithm>
+#include <iterator>
+
+namespace Zgine {
+
+RangeAllocator::RangeAllocator(uint32_t capacity) {
+    Reset(capacity);
+}
+
+void RangeAllocator::Reset(uint32_t capacity) {
+    m_FreeRanges.clear();
+    m_Capacity = capacity;
+    m_Used = 0;
+    if (capacity > 0) {
+        m_FreeRanges.emplace(0, capacity);
+    }
+}
+
+uint32_t RangeAllocator::Allocate(uint32_t size) {
+    if (size == 0) {
+        return kInvalidOffset;
+    }
+
+    for (auto it = m_FreeRanges.begin(); it != m_FreeRanges.end(); ++it) {
+        if (it->second < size) {
+            continue;
+        }
+
+        const uint32_t offset = it->first;
+        const uint32_t remaining = it->second - size;
+        m_FreeRanges.erase(it);
+        if (remaining > 0) {
+            m_FreeRanges.emplace(offset + size, remaining);
+        }
+        m_Used += size;
+        return offset;
+    }
+    return kInvalidOffset;
+}
+
+void RangeAllocator::Free(uint32_t offset, uint32_t size) {
+    if (offset == kInvalidOffset || size == 0) {
+        return;
+    }
+
+    uint32_t begin = offset;
+    uint32_t end = offset + size;
+
+    // Merge with the free range that ends where this one starts...
+    auto next = m_FreeRanges.lower_bound(offset);
+    if (next != m_FreeRanges.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == begin) {
+            begin = previous->first;
+            m_FreeRanges.erase(previous);
+        }
+    }
+    // ...and with the one that starts where it ends.
+    if (next != m_FreeRanges.end() && next->first == end) {
+        end += next->second;
+        m_FreeRanges.erase(next);
+    }
+
+    m_FreeRanges.emplace(begin, end - begin);
+    m_Used -= size;
+}
+
+uint32_t RangeAllocator::GetLargestFreeRange() const noexcept {
+    uint32_t largest = 0;
+    for (const auto& [offset, size] : m_FreeRanges) {
+        largest = std::max(largest, size);
+    }
+    return largest;
+}
+
+} // namespace Zgine
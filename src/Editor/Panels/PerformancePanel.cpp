@@ -57,7 +57,14 @@ namespace Zgine
         {
             ImGui::Separator();
             ImGui::Text("Draw Calls: %u", m_RenderStats->DrawCalls);
+            ImGui::Text("Instances: %u", m_RenderStats->Instances);
             ImGui::Text("Triangles: %u", m_RenderStats->Triangles);
+            ImGui::Text("Visible: %u (culled %u)", m_RenderStats->VisibleObjects, m_RenderStats->CulledObjects);
+            ImGui::Text("Shadow Casters: %u (culled %u)",
+                m_RenderStats->ShadowCastersVisible, m_RenderStats->ShadowCastersCulled);
+            ImGui::Text("Lights: %u (%u cluster entries)", m_RenderStats->Lights, m_RenderStats->LightClusterEntries);
+            ImGui::Text("State Changes: %u (shader %u, material %u, mesh %u)", m_RenderStats->GetStateChanges(),
+                m_RenderStats->ShaderBinds, m_RenderStats->MaterialBinds, m_RenderStats->MeshBinds);
             ImGui::Text("GPU: N/A");
         }
 
@@ -1,6 +1,7 @@
 #include <Zgine/Editor/UI/Inspectors/RenderingInspector.h>
 #include <Zgine/Gui/Backend/ImGui/ImGuiWidgets.h>
 #include <Zgine/World/Components/Components.h>
+#include <Zgine/Resources/Core/Asset.h>
 #include <Zgine/Core/Foundation/Macro.h>
 #include <imgui.h>
 
@@ -74,7 +75,11 @@ void RenderingInspector::DrawMeshRendererProperties(Entity entity) {
     } else {
         ImGui::TextDisabled("No mesh assigned");
     }
-    ImGui::Text("Has VAO: %s", mesh.VertexArray ? "Yes" : "No");
+    if (mesh.LoadedMesh) {
+        ImGui::Text("Sub-meshes: %zu", mesh.LoadedMesh->GetMeshes().size());
+    } else {
+        ImGui::TextDisabled("Not loaded");
+    }
 }
 
 void RenderingInspector::DrawPrimitiveProperties(Entity entity) {
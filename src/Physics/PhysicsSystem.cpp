@@ -19,6 +19,7 @@
 #include <Jolt/Physics/Body/BodyLock.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <thread>
 
@@ -37,6 +38,51 @@ namespace {
         free(ptr);
     }
 
+    // Convert Euler angles (degrees) to Jolt Quat
+    Quat EulerDegreesToQuat(const Math::Vector3& eulerDegrees) {
+        float rx = Math::DegToRad(eulerDegrees.x);
+        float ry = Math::DegToRad(eulerDegrees.y);
+        float rz = Math::DegToRad(eulerDegrees.z);
+        float cy = std::cos(rz * 0.5f), sy = std::sin(rz * 0.5f);
+        float cp = std::cos(ry * 0.5f), sp = std::sin(ry * 0.5f);
+        float cr = std::cos(rx * 0.5f), sr = std::sin(rx * 0.5f);
+        return Quat(
+            sr * cp * cy - cr * sp * sy,  // x
+            cr * sp * cy + sr * cp * sy,  // y
+            cr * cp * sy - sr * sp * cy,  // z
+            cr * cp * cy + sr * sp * sy   // w
+        );
+    }
+
+    struct WorldPose {
+        Vec3 Position;
+        Quat Rotation;
+        Vec3 Scale;
+    };
+
+    // Bodies are placed from the cached world matrix so parented colliders
+    // land where they are rendered; unresolved entities use their local TRS.
+    WorldPose GetWorldPose(Entity entity) {
+        if (entity.HasComponent<WorldTransformComponent>()) {
+            const auto& worldTransform = entity.GetComponent<WorldTransformComponent>();
+            if (worldTransform.IsValid()) {
+                const float* m = Math::ValuePtr(worldTransform.WorldMatrix);
+                Mat44 matrix(Vec4(m[0], m[1], m[2], m[3]), Vec4(m[4], m[5], m[6], m[7]),
+                             Vec4(m[8], m[9], m[10], m[11]), Vec4(m[12], m[13], m[14], m[15]));
+                Vec3 scale;
+                Mat44 rotationTranslation = matrix.Decompose(scale);
+                return WorldPose{ rotationTranslation.GetTranslation(), rotationTranslation.GetQuaternion().Normalized(), scale };
+            }
+        }
+
+        const auto& transform = entity.GetComponent<TransformComponent>();
+        return WorldPose{
+            Vec3(transform.Translation.x, transform.Translation.y, transform.Translation.z),
+            EulerDegreesToQuat(transform.Rotation),
+            Vec3(transform.Scale.x, transform.Scale.y, transform.Scale.z)
+        };
+    }
+
     static constexpr ObjectLayer LAYER_NON_MOVING = 0;
     static constexpr ObjectLayer LAYER_MOVING = 1;
     static constexpr ObjectLayer LAYER_COUNT = 2;
@@ -215,6 +261,9 @@ void PhysicsSystem::OnSceneStart(World* World) {
 
     // 遍历所有实体，创建物理体
     if (World) {
+        // Edit-mode changes have not been resolved by TransformSystem yet.
+        World->UpdateWorldTransforms();
+
         auto& registry = Internal::GetRegistry(*World);
         auto view = registry.view<RigidbodyComponent, TransformComponent, BoxColliderComponent>();
         for (auto entity : view) {
@@ -274,6 +323,15 @@ void PhysicsSystem::FixedUpdate(World* World, float fixedDeltaTime) {
     SyncPhysicsToECS(World);
 }
 
+void PhysicsSystem::DescribeAccess(SystemPhase phase, SystemAccess& access) const {
+    // Update is a no-op; the simulation step and ECS sync run in FixedUpdate.
+    if (phase == SystemPhase::FixedUpdate) {
+        access.Read<BoxColliderComponent>()
+              .Write<RigidbodyComponent, TransformComponent>();
+    } else {
+        access.SetNoAccess();
+    }
+}
 
 void PhysicsSystem::CreateBody(Entity entity) {
     if (!m_Initialized || !m_Impl->BodyInterface ||
@@ -284,27 +342,22 @@ void PhysicsSystem::CreateBody(Entity entity) {
     }
 
     auto& rigidBody = entity.GetComponent<RigidbodyComponent>();
-    auto& transform = entity.GetComponent<TransformComponent>();
     auto& collider = entity.GetComponent<BoxColliderComponent>();
+    const WorldPose pose = GetWorldPose(entity);
 
     // 创建形状
     Vec3 halfExtent(
-        collider.Size.x * transform.Scale.x * 0.5f,
-        collider.Size.y * transform.Scale.y * 0.5f,
-        collider.Size.z * transform.Scale.z * 0.5f
+        collider.Size.x * pose.Scale.GetX() * 0.5f,
+        collider.Size.y * pose.Scale.GetY() * 0.5f,
+        collider.Size.z * pose.Scale.GetZ() * 0.5f
     );
     BoxShapeSettings boxShapeSettings(halfExtent);
     ShapeSettings::ShapeResult shapeResult = boxShapeSettings.Create();
     RefConst<Shape> shape = shapeResult.Get();
 
     // 创建体设置
-    Vec3 position(
-        transform.Translation.x + collider.Offset.x,
-        transform.Translation.y + collider.Offset.y,
-        transform.Translation.z + collider.Offset.z
-    );
-
-    Quat rotation = Quat::sIdentity(); // 简化：暂时不考虑旋转
+    Vec3 position = pose.Position + Vec3(collider.Offset.x, collider.Offset.y, collider.Offset.z);
+    Quat rotation = pose.Rotation;
 
     EMotionType motionType = EMotionType::Static;
     if (rigidBody.Type == RigidbodyType::Dynamic) {
@@ -437,7 +490,8 @@ void PhysicsSystem::SyncPhysicsToECS(World* World) {
                 Vec3 position = body.GetPosition();
                 Quat rotation = body.GetRotation();
 
-                // 更新 TransformComponent
+                // 更新 TransformComponent (dynamic bodies are expected to be hierarchy roots,
+                // so the simulated world pose is written back as the local pose)
                 transform.Translation = Math::Vector3(position.GetX(), position.GetY(), position.GetZ());
 
                 // 将 Jolt 四元数转换为欧拉角（简化实现）
@@ -465,7 +519,6 @@ void PhysicsSystem::UpdateBodyTransform(Entity entity) {
     }
 
     auto& rigidBody = entity.GetComponent<RigidbodyComponent>();
-    auto& transform = entity.GetComponent<TransformComponent>();
 
     if (!rigidBody.RuntimeBody.IsValid()) {
         CreateBody(entity);
@@ -474,22 +527,13 @@ void PhysicsSystem::UpdateBodyTransform(Entity entity) {
 
     const BodyID bodyID = ToBodyID(rigidBody.RuntimeBody);
 
-    Vec3 position(transform.Translation.x, transform.Translation.y, transform.Translation.z);
-    // Convert Euler angles (degrees) to Jolt Quat
-    float rx = Math::DegToRad(transform.Rotation.x);
-    float ry = Math::DegToRad(transform.Rotation.y);
-    float rz = Math::DegToRad(transform.Rotation.z);
-    float cy = std::cos(rz * 0.5f), sy = std::sin(rz * 0.5f);
-    float cp = std::cos(ry * 0.5f), sp = std::sin(ry * 0.5f);
-    float cr = std::cos(rx * 0.5f), sr = std::sin(rx * 0.5f);
-    Quat rotation(
-        sr * cp * cy - cr * sp * sy,  // x
-        cr * sp * cy + sr * cp * sy,  // y
-        cr * cp * sy - sr * sp * cy,  // z
-        cr * cp * cy + sr * sp * sy   // w
-    );
+    // Called right after editor/script edits, before TransformSystem has run.
+    if (m_World) {
+        m_World->UpdateWorldTransforms();
+    }
+    const WorldPose pose = GetWorldPose(entity);
 
-    m_Impl->BodyInterface->SetPositionAndRotation(bodyID, position, rotation, EActivation::Activate);
+    m_Impl->BodyInterface->SetPositionAndRotation(bodyID, pose.Position, pose.Rotation, EActivation::Activate);
 }
 
 }
@@ -0,0 +1,30 @@
+#include "BinaryIO.h"
+#include <fstream>
+
+namespace Zgine::Internal {
+
+bool WriteFileAtomically(const std::filesystem::path& path, const void* data, size_t size, std::error_code& ec) {
+    ec.clear();
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!file) {
+            file.close();
+            std::error_code ignored;
+            std::filesystem::remove(temporary, ignored);
+            ec = std::make_error_code(std::errc::io_error);
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        return false;
+    }
+    return true;
+}
+
+} // namespace Zgine::Internal
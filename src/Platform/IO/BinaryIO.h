@@ -0,0 +1,34 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+
+namespace Zgine::Internal {
+
+// Binary cache files (cooked assets, the asset index) store their records in
+// host byte order; the engine only targets little-endian hosts.
+static_assert(std::endian::native == std::endian::little, "binary cache files assume a little-endian host");
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+/** @brief 64-bit FNV-1a of @p size bytes, continuing from @p hash (kFnvOffset to start). */
+inline uint64_t Fnv1a(uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+    return hash;
+}
+
+/**
+ * @brief Write @p size bytes beside @p path and rename them over it, so a
+ *        reader never maps or parses half a file.
+ * @return false, with nothing left behind, if the file cannot be written.
+ */
+bool WriteFileAtomically(const std::filesystem::path& path, const void* data, size_t size, std::error_code& ec);
+
+} // namespace Zgine::Internal
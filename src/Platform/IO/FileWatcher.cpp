@@ -1,5 +1,13 @@
 #include <Zgine/Platform/IO/FileWatcher.h>
+#include <Zgine/Core/Log/Log.h>
 #include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
 
 namespace Zgine {
 
@@ -12,72 +20,326 @@ namespace {
         }
         return normalized.string();
     }
+
+#if defined(__linux__)
+    // Renames cover editors that save through a temporary file.
+    constexpr uint32_t kDirectoryEvents = IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE
+                                        | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF
+                                        | IN_ONLYDIR | IN_EXCL_UNLINK;
+#endif
+}
+
+FileWatcher::FileWatcher(const FileWatcherConfig& config)
+    : m_Config(config) {
+    Open();
+}
+
+FileWatcher::~FileWatcher() {
+    Close();
+}
+
+void FileWatcher::Open() {
+#if defined(__linux__)
+    if (m_Config.ForcePolling || m_Notify >= 0) {
+        return;
+    }
+    m_Notify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_Notify < 0) {
+        ZGINE_CORE_WARN("FileWatcher: inotify unavailable (errno {}), polling instead", errno);
+    }
+#endif
+}
+
+void FileWatcher::Close() {
+#if defined(__linux__)
+    if (m_Notify >= 0) {
+        ::close(m_Notify);
+    }
+#endif
+    m_Notify = -1;
+    m_Directories.clear();
+    m_DirectoryByPath.clear();
+}
+
+void FileWatcher::SetConfig(const FileWatcherConfig& config) {
+    const bool backendChanged = config.ForcePolling != m_Config.ForcePolling;
+    m_Config = config;
+    if (!backendChanged) {
+        return;
+    }
+
+    // Closing the descriptor drops every directory watch at once.
+    Close();
+    Open();
+    m_Polled.clear();
+    for (auto& [key, record] : m_Records) {
+        record.Directory = -1;
+        Attach(key, record);
+    }
+}
+
+void FileWatcher::Attach(const std::string& key, FileRecord& record) {
+#if defined(__linux__)
+    const std::string directory = std::filesystem::path(key).parent_path().string();
+    if (m_Notify >= 0 && !directory.empty()) {
+        int watch = -1;
+        auto it = m_DirectoryByPath.find(directory);
+        if (it != m_DirectoryByPath.end()) {
+            watch = it->second;
+        } else {
+            // The kernel hands out the same descriptor for a directory reached by another path.
+            watch = ::inotify_add_watch(m_Notify, directory.c_str(), kDirectoryEvents);
+            if (watch >= 0) {
+                m_DirectoryByPath[directory] = watch;
+                m_Directories.try_emplace(watch, DirectoryWatch{ directory, 0 });
+            } else if (errno == ENOSPC && !m_WatchLimitWarned) {
+                m_WatchLimitWarned = true;
+                ZGINE_CORE_WARN("FileWatcher: inotify watch limit reached, polling the remaining paths "
+                                "(raise fs.inotify.max_user_watches)");
+            }
+        }
+        if (watch >= 0) {
+            ++m_Directories[watch].FileCount;
+            record.Directory = watch;
+            m_Polled.erase(key);
+            return;
+        }
+    }
+#endif
+    record.Directory = -1;
+    m_Polled.insert(key);
+}
+
+void FileWatcher::Detach(FileRecord& record) {
+    auto it = m_Directories.find(record.Directory);
+    record.Directory = -1;
+    if (it == m_Directories.end() || --it->second.FileCount > 0) {
+        return;
+    }
+#if defined(__linux__)
+    ::inotify_rm_watch(m_Notify, it->first);
+#endif
+    m_DirectoryByPath.erase(it->second.Path);
+    m_Directories.erase(it);
+}
+
+void FileWatcher::DropDirectory(int directory, Clock::time_point now) {
+    auto it = m_Directories.find(directory);
+    if (it == m_Directories.end()) {
+        return;
+    }
+#if defined(__linux__)
+    ::inotify_rm_watch(m_Notify, directory);
+#endif
+    m_DirectoryByPath.erase(it->second.Path);
+    m_Directories.erase(it);
+
+    // The directory went away or moved: its files are polled until they exist again.
+    for (auto& [key, record] : m_Records) {
+        if (record.Directory == directory) {
+            record.Directory = -1;
+            m_Polled.insert(key);
+            MarkPending(key, record, now);
+        }
+    }
 }
 
 void FileWatcher::Watch(const std::filesystem::path& path) {
-    std::error_code ec;
     std::string key = NormalizePath(path);
-    FileRecord record;
+    auto [it, inserted] = m_Records.try_emplace(key);
+    FileRecord& record = it->second;
+    if (!inserted) {
+        Detach(record);
+        record = FileRecord{};
+    }
+
+    // Watch before the first stat so a change in between is not lost.
+    Attach(key, record);
+    std::error_code ec;
     record.Exists = std::filesystem::exists(path, ec);
     if (record.Exists) {
         record.LastWriteTime = std::filesystem::last_write_time(path, ec);
     }
-    m_Records[key] = record;
+    record.ReportedWriteTime = record.LastWriteTime;
+    record.SeenExists = record.Exists;
 }
 
 void FileWatcher::Unwatch(const std::filesystem::path& path) {
     std::string key = NormalizePath(path);
-    m_Records.erase(key);
+    auto it = m_Records.find(key);
+    if (it == m_Records.end()) {
+        return;
+    }
+    Detach(it->second);
+    m_Polled.erase(key);
+    m_Records.erase(it);
 }
 
 void FileWatcher::Clear() {
+#if defined(__linux__)
+    for (const auto& [watch, directory] : m_Directories) {
+        ::inotify_rm_watch(m_Notify, watch);
+    }
+#endif
+    m_Directories.clear();
+    m_DirectoryByPath.clear();
     m_Records.clear();
+    m_Polled.clear();
+    m_Pending.clear();
 }
 
 void FileWatcher::SetCallback(Callback callback) {
     m_Callback = std::move(callback);
 }
 
-void FileWatcher::Poll() {
-    if (!m_Callback) {
+void FileWatcher::MarkPending(const std::string& key, FileRecord& record, Clock::time_point now) {
+    record.LastChange = now;
+    if (!record.Pending) {
+        record.Pending = true;
+        m_Pending.push_back(key);
+    }
+}
+
+void FileWatcher::ReadEvents(Clock::time_point now) {
+#if defined(__linux__)
+    if (m_Notify < 0) {
         return;
     }
 
-    for (auto& [key, record] : m_Records) {
+    alignas(inotify_event) char buffer[16 * 1024];
+    for (;;) {
+        const ssize_t length = ::read(m_Notify, buffer, sizeof(buffer));
+        if (length <= 0) {
+            return; // EAGAIN: drained
+        }
+
+        for (const char* cursor = buffer; cursor < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(cursor);
+            cursor += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // Events were lost; every notified file is checked once.
+                for (auto& [key, record] : m_Records) {
+                    if (record.Directory >= 0) {
+                        MarkPending(key, record, now);
+                    }
+                }
+                continue;
+            }
+            if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) {
+                DropDirectory(event->wd, now);
+                continue;
+            }
+            if (event->len == 0) {
+                continue;
+            }
+
+            auto directory = m_Directories.find(event->wd);
+            if (directory == m_Directories.end()) {
+                continue;
+            }
+            const std::string key = (std::filesystem::path(directory->second.Path) / event->name).string();
+            auto record = m_Records.find(key);
+            if (record != m_Records.end() && record->second.Directory == event->wd) {
+                MarkPending(key, record->second, now);
+            }
+        }
+    }
+#else
+    (void)now;
+#endif
+}
+
+void FileWatcher::PollStat(Clock::time_point now) {
+    for (const std::string& key : m_Polled) {
+        auto it = m_Records.find(key);
+        if (it == m_Records.end()) {
+            continue;
+        }
+        FileRecord& record = it->second;
         std::filesystem::path path(key);
         std::error_code ec;
-        bool exists = std::filesystem::exists(path, ec);
+        const bool exists = std::filesystem::exists(path, ec);
         if (ec) {
             continue;
         }
 
-        if (!record.Exists && exists) {
-            record.Exists = true;
-            record.LastWriteTime = std::filesystem::last_write_time(path, ec);
-            m_Callback(path, FileStatus::Created);
-            continue;
+        std::filesystem::file_time_type writeTime{};
+        if (exists) {
+            writeTime = std::filesystem::last_write_time(path, ec);
+            if (ec) {
+                continue;
+            }
         }
+        if (exists != record.SeenExists || writeTime != record.LastWriteTime) {
+            record.SeenExists = exists;
+            record.LastWriteTime = writeTime;
+            MarkPending(key, record, now);
+        }
+    }
+}
 
-        if (record.Exists && !exists) {
-            record.Exists = false;
-            m_Callback(path, FileStatus::Removed);
+void FileWatcher::Report(Clock::time_point now) {
+    std::vector<std::pair<std::filesystem::path, FileStatus>> changes;
+    for (size_t i = 0; i < m_Pending.size();) {
+        auto it = m_Records.find(m_Pending[i]);
+        if (it != m_Records.end() && it->second.Pending && now - it->second.LastChange < m_Config.Debounce) {
+            ++i;
             continue;
         }
 
-        if (!record.Exists) {
+        // Unwatched, superseded, or quiet for long enough: leaves the list either way.
+        std::string key = std::move(m_Pending[i]);
+        m_Pending[i] = std::move(m_Pending.back());
+        m_Pending.pop_back();
+        if (it == m_Records.end() || !it->second.Pending) {
             continue;
         }
 
-        auto currentWrite = std::filesystem::last_write_time(path, ec);
+        FileRecord& record = it->second;
+        record.Pending = false;
+        std::filesystem::path path(key);
+        std::error_code ec;
+        const bool exists = std::filesystem::exists(path, ec);
         if (ec) {
             continue;
         }
+        record.SeenExists = exists;
+        record.LastWriteTime = exists ? std::filesystem::last_write_time(path, ec) : std::filesystem::file_time_type{};
+
+        // Events only say something may have changed (an overflow marks every
+        // file, a chmod is IN_ATTRIB); like polling, the write time decides.
+        if (exists && !record.Exists) {
+            changes.emplace_back(std::move(path), FileStatus::Created);
+        } else if (!exists && record.Exists) {
+            changes.emplace_back(std::move(path), FileStatus::Removed);
+        } else if (exists && record.LastWriteTime != record.ReportedWriteTime) {
+            changes.emplace_back(std::move(path), FileStatus::Modified);
+        }
+        record.Exists = exists;
+        record.ReportedWriteTime = record.LastWriteTime;
 
-        if (currentWrite != record.LastWriteTime) {
-            record.LastWriteTime = currentWrite;
-            m_Callback(path, FileStatus::Modified);
+        // A file that reappeared may have brought its directory back.
+        if (exists && record.Directory < 0 && m_Notify >= 0) {
+            Attach(key, record);
         }
     }
+
+    // The callback may watch or unwatch paths.
+    for (const auto& [path, status] : changes) {
+        m_Callback(path, status);
+    }
+}
+
+void FileWatcher::Poll() {
+    if (!m_Callback) {
+        return;
+    }
+
+    const Clock::time_point now = Clock::now();
+    ReadEvents(now);
+    PollStat(now);
+    Report(now);
 }
 
 }
@@ -0,0 +1,150 @@
+#include <Zgine/Platform/IO/MappedFile.h>
+#include <Zgine/Core/Log/Log.h>
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Zgine {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_Data(std::exchange(other.m_Data, nullptr)),
+      m_Size(std::exchange(other.m_Size, 0))
+#if defined(_WIN32)
+    , m_Mapping(std::exchange(other.m_Mapping, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+#if defined(_WIN32)
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+void MappedFile::Prefetch(const void* data, size_t size) const {
+    const auto* begin = static_cast<const uint8_t*>(data);
+    if (!m_Data || size == 0 || begin < m_Data || begin + size > m_Data + m_Size) {
+        return;
+    }
+
+#if !defined(_WIN32)
+    // Start read-ahead of the whole range before touching it page by page.
+    const auto pageSize = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const uintptr_t first = reinterpret_cast<uintptr_t>(begin) & ~(pageSize - 1);
+    ::madvise(reinterpret_cast<void*>(first), reinterpret_cast<uintptr_t>(begin) + size - first, MADV_WILLNEED);
+#endif
+
+    // One read per page faults it in; the volatile sink keeps the loop.
+    volatile uint8_t sink = 0;
+    for (size_t offset = 0; offset < size; offset += 4096) {
+        sink = sink + begin[offset];
+    }
+    sink = sink + begin[size - 1];
+}
+
+#if defined(_WIN32)
+
+MappedFile MappedFile::Open(const std::filesystem::path& path) {
+    MappedFile file;
+    HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return file;
+    }
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(handle, &size) && size.QuadPart > 0) {
+        // The mapping object keeps the file open; the handle is not needed past this point.
+        HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view) {
+                file.m_Data = static_cast<const uint8_t*>(view);
+                file.m_Size = static_cast<size_t>(size.QuadPart);
+                file.m_Mapping = mapping;
+            } else {
+                CloseHandle(mapping);
+            }
+        }
+    }
+    CloseHandle(handle);
+
+    if (!file.IsOpen()) {
+        ZGINE_CORE_WARN("MappedFile: failed to map {}", path.string());
+    }
+    return file;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+        CloseHandle(m_Mapping);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Mapping = nullptr;
+}
+
+#else
+
+MappedFile MappedFile::Open(const std::filesystem::path& path) {
+    MappedFile file;
+    const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+        return file;
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        const auto size = static_cast<size_t>(status.st_size);
+        void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (view != MAP_FAILED) {
+            // Uploads read front to back; let the kernel read ahead.
+            ::madvise(view, size, MADV_SEQUENTIAL);
+            file.m_Data = static_cast<const uint8_t*>(view);
+            file.m_Size = size;
+        }
+    }
+    // The mapping holds its own reference to the file.
+    ::close(descriptor);
+
+    if (!file.IsOpen()) {
+        ZGINE_CORE_WARN("MappedFile: failed to map {}", path.string());
+    }
+    return file;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+#endif
+
+} // namespace Zgine
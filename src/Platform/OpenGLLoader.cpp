@@ -0,0 +1,12 @@
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <Platform/OpenGLLoader.h>
+
+namespace Zgine::Platform {
+
+void* GetOpenGLProcAddress(const char* name) {
+    return reinterpret_cast<void*>(glfwGetProcAddress(name));
+}
+
+} // namespace Zgine::Platform
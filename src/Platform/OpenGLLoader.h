@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Zgine::Platform {
+
+/**
+ * @brief Address of the OpenGL entry point @p name in the current context, or nullptr.
+ *
+ * For functions outside the core profile GLAD was generated for; a context
+ * must be current.
+ */
+[[nodiscard]] void* GetOpenGLProcAddress(const char* name);
+
+} // namespace Zgine::Platform
@@ -0,0 +1,84 @@
+#include "OpenGLExtensions.h"
+#include <Platform/OpenGLLoader.h>
+#include <Zgine/Core/Log/Log.h>
+#include <cstring>
+
+namespace Zgine {
+
+    namespace {
+
+        bool HasExtension(const char* name) {
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            for (GLint i = 0; i < count; ++i) {
+                const auto* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+                if (extension && std::strcmp(extension, name) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool HasVersion(GLint major, GLint minor) {
+            GLint contextMajor = 0;
+            GLint contextMinor = 0;
+            glGetIntegerv(GL_MAJOR_VERSION, &contextMajor);
+            glGetIntegerv(GL_MINOR_VERSION, &contextMinor);
+            return contextMajor > major || (contextMajor == major && contextMinor >= minor);
+        }
+
+        std::string GetString(GLenum name) {
+            const auto* value = reinterpret_cast<const char*>(glGetString(name));
+            return value ? value : "";
+        }
+
+        template<typename Fn>
+        Fn Load(const char* name) {
+            return reinterpret_cast<Fn>(Platform::GetOpenGLProcAddress(name));
+        }
+
+        OpenGLExtensions Query() {
+            OpenGLExtensions extensions;
+            extensions.DriverIdentity = GetString(GL_VENDOR) + "|" + GetString(GL_RENDERER) + "|" + GetString(GL_VERSION);
+
+            if (HasVersion(4, 1) || HasExtension("GL_ARB_get_program_binary")) {
+                GLint formats = 0;
+                glGetIntegerv(ZGINE_GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+                extensions.GetProgramBinary = Load<OpenGLExtensions::GetProgramBinaryFn>("glGetProgramBinary");
+                extensions.LoadProgramBinary = Load<OpenGLExtensions::ProgramBinaryFn>("glProgramBinary");
+                extensions.ProgramParameteri = Load<OpenGLExtensions::ProgramParameteriFn>("glProgramParameteri");
+                // Some drivers expose the extension but no format to save in.
+                extensions.ProgramBinary = formats > 0 && extensions.GetProgramBinary
+                    && extensions.LoadProgramBinary && extensions.ProgramParameteri;
+            }
+
+            OpenGLExtensions::MaxShaderCompilerThreadsFn maxCompilerThreads = nullptr;
+            if (HasExtension("GL_KHR_parallel_shader_compile")) {
+                maxCompilerThreads = Load<OpenGLExtensions::MaxShaderCompilerThreadsFn>("glMaxShaderCompilerThreadsKHR");
+            } else if (HasExtension("GL_ARB_parallel_shader_compile")) {
+                maxCompilerThreads = Load<OpenGLExtensions::MaxShaderCompilerThreadsFn>("glMaxShaderCompilerThreadsARB");
+            }
+            if (maxCompilerThreads) {
+                // 0xFFFFFFFF lets the driver pick the thread count.
+                maxCompilerThreads(0xFFFFFFFFu);
+                extensions.ParallelShaderCompile = true;
+            }
+
+            extensions.TextureCompressionS3TC = HasExtension("GL_EXT_texture_compression_s3tc");
+
+            ZGINE_CORE_INFO("OpenGL program binaries {}, parallel shader compile {}, S3TC textures {}",
+                extensions.ProgramBinary ? "supported" : "unavailable",
+                extensions.ParallelShaderCompile ? "supported" : "unavailable",
+                extensions.TextureCompressionS3TC ? "supported" : "unavailable");
+            return extensions;
+        }
+
+    }
+
+    const OpenGLExtensions& OpenGLExtensions::Get() {
+        static const OpenGLExtensions s_Extensions = Query();
+        return s_Extensions;
+    }
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <string>
+
+// Entry points and enums beyond the GL 3.3 core profile GLAD provides.
+#define ZGINE_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define ZGINE_GL_PROGRAM_BINARY_LENGTH           0x8741
+#define ZGINE_GL_NUM_PROGRAM_BINARY_FORMATS      0x87FE
+#define ZGINE_GL_COMPLETION_STATUS               0x91B1
+#define ZGINE_GL_COMPRESSED_RGBA_S3TC_DXT5       0x83F3
+#define ZGINE_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 0x8C4F
+
+namespace Zgine {
+
+    /**
+     * @brief Optional OpenGL features of the current context.
+     *
+     * Queried once, on first use, from the context current at that time; the
+     * engine runs a single GL context, so the result stays valid.
+     */
+    struct OpenGLExtensions {
+        using GetProgramBinaryFn = void (APIENTRYP)(GLuint program, GLsizei bufSize, GLsizei* length,
+                                                    GLenum* binaryFormat, void* binary);
+        using ProgramBinaryFn = void (APIENTRYP)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+        using ProgramParameteriFn = void (APIENTRYP)(GLuint program, GLenum pname, GLint value);
+        using MaxShaderCompilerThreadsFn = void (APIENTRYP)(GLuint count);
+
+        /** @brief GL 4.1 / ARB_get_program_binary with at least one binary format. */
+        bool ProgramBinary = false;
+        GetProgramBinaryFn GetProgramBinary = nullptr;
+        ProgramBinaryFn LoadProgramBinary = nullptr;
+        ProgramParameteriFn ProgramParameteri = nullptr;
+
+        /**
+         * @brief KHR/ARB_parallel_shader_compile: compiles and links run on driver
+         * threads and ZGINE_GL_COMPLETION_STATUS can be polled without blocking.
+         */
+        bool ParallelShaderCompile = false;
+
+        /** @brief EXT_texture_compression_s3tc: BC1-BC3 textures, sRGB variants from EXT_texture_sRGB. */
+        bool TextureCompressionS3TC = false;
+
+        /** @brief Vendor, renderer and version strings; changes whenever compiled binaries may. */
+        std::string DriverIdentity;
+
+        [[nodiscard]] static const OpenGLExtensions& Get();
+    };
+
+}
@@ -16,6 +16,19 @@ OpenGLFramebuffer::~OpenGLFramebuffer() {
 void OpenGLFramebuffer::Bind() {
     glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
     glViewport(0, 0, m_Spec.Width, m_Spec.Height);
+    if (IsLayered()) {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthAttachment, 0, 0);
+    }
+}
+
+void OpenGLFramebuffer::BindLayer(uint32_t layer) {
+    if (!IsLayered() || layer >= m_Spec.Layers) {
+        ZGINE_CORE_WARN("Framebuffer has no layer {}", layer);
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+    glViewport(0, 0, m_Spec.Width, m_Spec.Height);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthAttachment, 0, static_cast<GLint>(layer));
 }
 
 void OpenGLFramebuffer::Unbind() {
@@ -63,7 +76,25 @@ void OpenGLFramebuffer::Invalidate() {
     }
 
     // Depth attachment
-    if (m_Spec.DepthTexture) {
+    if (IsLayered()) {
+        // Depth texture array (shadow cascades): one layer is attached at a time
+        glGenTextures(1, &m_DepthAttachment);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthAttachment);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, m_Spec.Width, m_Spec.Height,
+                     m_Spec.Layers, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        glTexParameterfv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, borderColor);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthAttachment, 0, 0);
+
+        if (!hasColor) {
+            glDrawBuffer(GL_NONE);
+            glReadBuffer(GL_NONE);
+        }
+    } else if (m_Spec.DepthTexture) {
         // Depth as texture (for shadow maps - readable in shader)
         glGenTextures(1, &m_DepthAttachment);
         glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
@@ -98,7 +129,7 @@ void OpenGLFramebuffer::Invalidate() {
 
 void OpenGLFramebuffer::BindDepthTexture(uint32_t slot) const {
     glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
+    glBindTexture(IsLayered() ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D, m_DepthAttachment);
 }
 
 void OpenGLFramebuffer::Cleanup() {
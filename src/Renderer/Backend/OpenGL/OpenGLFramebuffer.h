@@ -12,6 +12,7 @@ public:
     void Bind() override;
     void Unbind() override;
     void Resize(uint32_t width, uint32_t height) override;
+    void BindLayer(uint32_t layer) override;
 
     uint32_t GetColorAttachmentID() const override { return m_ColorAttachment; }
     uint32_t GetDepthAttachmentID() const override { return m_DepthAttachment; }
@@ -21,6 +22,7 @@ public:
 private:
     void Invalidate();
     void Cleanup();
+    [[nodiscard]] bool IsLayered() const { return m_Spec.DepthTexture && m_Spec.Layers > 1; }
 
     FramebufferSpec m_Spec;
     uint32_t m_RendererID = 0;
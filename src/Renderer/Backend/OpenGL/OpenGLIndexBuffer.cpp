@@ -11,6 +11,13 @@ namespace Zgine {
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
     }
 
+    OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t count)
+        : m_Count(count) {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        glBufferData(GL_COPY_WRITE_BUFFER, count * sizeof(uint32_t), nullptr, GL_STATIC_DRAW);
+    }
+
     OpenGLIndexBuffer::~OpenGLIndexBuffer() {
         glDeleteBuffers(1, &m_RendererID);
     }
@@ -23,4 +30,16 @@ namespace Zgine {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
+    void OpenGLIndexBuffer::SetSubData(const uint32_t* indices, uint32_t count, uint32_t firstIndex) {
+        if (firstIndex + count > m_Count) {
+            ZGINE_CORE_ERROR("OpenGLIndexBuffer::SetSubData range [{}, {}) exceeds the buffer size {}.",
+                firstIndex, firstIndex + count, m_Count);
+            return;
+        }
+        // The element binding is vertex array state; upload through the copy
+        // target so whichever vertex array is bound keeps its index buffer.
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_RendererID);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * sizeof(uint32_t), count * sizeof(uint32_t), indices);
+    }
+
 }
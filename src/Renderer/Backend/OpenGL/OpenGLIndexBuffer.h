@@ -7,6 +7,7 @@ namespace Zgine {
     class OpenGLIndexBuffer : public IndexBuffer {
     public:
         OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
+        explicit OpenGLIndexBuffer(uint32_t count);
         virtual ~OpenGLIndexBuffer();
 
         virtual void Bind() const override;
@@ -14,6 +15,7 @@ namespace Zgine {
 
         virtual uint32_t GetCount() const override { return m_Count; }
         virtual uint32_t GetID() const override { return m_RendererID; }
+        virtual void SetSubData(const uint32_t* indices, uint32_t count, uint32_t firstIndex) override;
 
     private:
         uint32_t m_RendererID;
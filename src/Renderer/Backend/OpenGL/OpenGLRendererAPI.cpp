@@ -2,6 +2,7 @@
 #include <Zgine/Renderer/RHI/VertexArray.h>
 #include <Zgine/Renderer/RHI/IndexBuffer.h>
 #include <glad/glad.h>
+#include <cstdint>
 
 namespace Zgine {
 
@@ -34,4 +35,30 @@ namespace Zgine {
         vertexArray->Unbind();
     }
 
+    void OpenGLRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                                 uint32_t instanceCount) {
+        vertexArray->Bind();
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(instanceCount));
+        vertexArray->Unbind();
+    }
+
+    void OpenGLRendererAPI::BindVertexArray(const VertexArray* vertexArray) {
+        if (vertexArray) {
+            vertexArray->Bind();
+        } else {
+            glBindVertexArray(0);
+        }
+    }
+
+    void OpenGLRendererAPI::DrawBound(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex) {
+        const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(firstIndex) * sizeof(uint32_t));
+        if (instanceCount == 1) {
+            glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, offset, baseVertex);
+        } else {
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, offset,
+                static_cast<GLsizei>(instanceCount), baseVertex);
+        }
+    }
+
 }
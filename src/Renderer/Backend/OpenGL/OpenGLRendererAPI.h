@@ -12,6 +12,11 @@ namespace Zgine {
         virtual void Clear() override;
 
         virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+        virtual void DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                          uint32_t instanceCount) override;
+        virtual void BindVertexArray(const VertexArray* vertexArray) override;
+        virtual void DrawBound(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0,
+                               int32_t baseVertex = 0) override;
     };
 
 }
@@ -1,20 +1,77 @@
 #include "OpenGLShader.h"
+#include "OpenGLExtensions.h"
 #include <Zgine/Core/Log/Log.h>
+#include <Zgine/Renderer/RHI/ShaderCache.h>
 #include <fstream>
 #include <sstream>
 
 
 namespace Zgine {
 
+    namespace {
+
+        ShaderCache& GetProgramCache() {
+            static ShaderCache s_Cache;
+            return s_Cache;
+        }
+
+        uint32_t LoadCachedProgram(const OpenGLExtensions& gl, uint64_t key) {
+            ShaderCache::Entry entry;
+            if (!GetProgramCache().Load(key, entry)) {
+                return 0;
+            }
+
+            uint32_t program = glCreateProgram();
+            gl.LoadProgramBinary(program, static_cast<GLenum>(entry.Format), entry.Binary.data(),
+                                 static_cast<GLsizei>(entry.Binary.size()));
+
+            int linkSuccess;
+            glGetProgramiv(program, GL_LINK_STATUS, &linkSuccess);
+            if (linkSuccess == GL_FALSE) {
+                // Drivers may reject binaries at any time (e.g. after an update); rebuild it.
+                ZGINE_CORE_INFO("Cached shader program {:016x} was rejected by the driver; recompiling.", key);
+                glDeleteProgram(program);
+                GetProgramCache().Remove(key);
+                return 0;
+            }
+
+            ZGINE_CORE_TRACE("Shader program {:016x} loaded from cache.", key);
+            return program;
+        }
+
+        void StoreCachedProgram(const OpenGLExtensions& gl, uint64_t key, uint32_t program) {
+            int length = 0;
+            glGetProgramiv(program, ZGINE_GL_PROGRAM_BINARY_LENGTH, &length);
+            if (length <= 0) {
+                return;
+            }
+
+            ShaderCache::Entry entry;
+            entry.Binary.resize(static_cast<size_t>(length));
+            GLenum format = 0;
+            gl.GetProgramBinary(program, length, &length, &format, entry.Binary.data());
+            if (length <= 0) {
+                return;
+            }
+            entry.Binary.resize(static_cast<size_t>(length));
+            entry.Format = format;
+            GetProgramCache().Store(key, entry);
+        }
+
+    }
+
     OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc) {
-        m_RendererID = CreateShader(vertexSrc, fragmentSrc);
+        CreateShader(vertexSrc, fragmentSrc);
     }
 
     OpenGLShader::~OpenGLShader() {
+        if (m_VertexID != 0) glDeleteShader(m_VertexID);
+        if (m_FragmentID != 0) glDeleteShader(m_FragmentID);
         glDeleteProgram(m_RendererID);
     }
 
     void OpenGLShader::Bind() const {
+        FinishCreate();
         glUseProgram(m_RendererID);
     }
 
@@ -22,6 +79,25 @@ namespace Zgine {
         glUseProgram(0);
     }
 
+    bool OpenGLShader::IsReady() const {
+        if (!m_Pending) {
+            return true;
+        }
+
+        // Without the extension there is nothing to poll; finishing waits for
+        // the driver as the old synchronous path did.
+        if (OpenGLExtensions::Get().ParallelShaderCompile) {
+            int complete = GL_FALSE;
+            glGetProgramiv(m_RendererID, ZGINE_GL_COMPLETION_STATUS, &complete);
+            if (complete == GL_FALSE) {
+                return false;
+            }
+        }
+
+        FinishCreate();
+        return true;
+    }
+
     uint32_t OpenGLShader::CompileShader(uint32_t type, const std::string& source) {
         uint32_t id = glCreateShader(type);
         if (id == 0) {
@@ -29,10 +105,15 @@ namespace Zgine {
             return 0;
         }
 
+        // The result is checked in FinishCreate(), so the driver can compile
+        // in the background meanwhile.
         const char* src = source.c_str();
         glShaderSource(id, 1, &src, nullptr);
         glCompileShader(id);
+        return id;
+    }
 
+    bool OpenGLShader::CheckCompileStatus(uint32_t type, uint32_t id) {
         int result;
         glGetShaderiv(id, GL_COMPILE_STATUS, &result);
         if (result == GL_FALSE) {
@@ -48,89 +129,101 @@ namespace Zgine {
 
             ZGINE_CORE_ERROR("Failed to compile {0} shader!", shaderType);
             ZGINE_CORE_ERROR("{0}", message.data());
-            glDeleteShader(id);
-            return 0;
+            return false;
         }
-
-        return id;
+        return true;
     }
 
-    uint32_t OpenGLShader::CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
-        uint32_t program = glCreateProgram();
-        if (program == 0) {
-            ZGINE_CORE_ERROR("Failed to create shader program!");
-            return 0;
+    void OpenGLShader::CreateShader(const std::string& vertexShader, const std::string& fragmentShader) {
+        const OpenGLExtensions& gl = OpenGLExtensions::Get();
+        if (gl.ProgramBinary) {
+            m_CacheKey = ShaderCache::ComputeKey({ vertexShader, fragmentShader }, gl.DriverIdentity);
+            m_RendererID = LoadCachedProgram(gl, m_CacheKey);
+            if (m_RendererID != 0) {
+                return;
+            }
         }
 
-        uint32_t vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-        uint32_t fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
-
-        // Check if shader compilation failed
-        if (vs == 0 || fs == 0) {
-            ZGINE_CORE_ERROR("Shader compilation failed, cannot create program!");
-            if (vs != 0) glDeleteShader(vs);
-            if (fs != 0) glDeleteShader(fs);
-            glDeleteProgram(program);
-            return 0;
+        m_RendererID = glCreateProgram();
+        if (m_RendererID == 0) {
+            ZGINE_CORE_ERROR("Failed to create shader program!");
+            return;
         }
 
-        glAttachShader(program, vs);
-        glAttachShader(program, fs);
-        glLinkProgram(program);
+        m_VertexID = CompileShader(GL_VERTEX_SHADER, vertexShader);
+        m_FragmentID = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+        if (m_VertexID == 0 || m_FragmentID == 0) {
+            m_Pending = true;
+            FinishCreate();
+            return;
+        }
 
-        // Check for linking errors
-        int linkSuccess;
-        glGetProgramiv(program, GL_LINK_STATUS, &linkSuccess);
-        if (linkSuccess == GL_FALSE) {
-            int length;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
-            std::vector<char> message(length);
-            glGetProgramInfoLog(program, length, &length, message.data());
-            ZGINE_CORE_ERROR("Failed to link shader program!");
-            ZGINE_CORE_ERROR("{0}", message.data());
+        glAttachShader(m_RendererID, m_VertexID);
+        glAttachShader(m_RendererID, m_FragmentID);
+        if (gl.ProgramBinary) {
+            gl.ProgramParameteri(m_RendererID, ZGINE_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glLinkProgram(m_RendererID);
+        m_Pending = true;
+    }
 
-            glDeleteShader(vs);
-            glDeleteShader(fs);
-            glDeleteProgram(program);
-            return 0;
+    void OpenGLShader::FinishCreate() const {
+        if (!m_Pending) {
+            return;
         }
+        m_Pending = false;
 
-#ifndef NDEBUG
-        // Validate program only in Debug builds (has performance cost)
-        glValidateProgram(program);
+        bool compiled = m_VertexID != 0 && m_FragmentID != 0;
+        compiled = compiled && CheckCompileStatus(GL_VERTEX_SHADER, m_VertexID);
+        compiled = compiled && CheckCompileStatus(GL_FRAGMENT_SHADER, m_FragmentID);
 
-        // Check validation status (helpful for debugging)
-        int validateSuccess;
-        glGetProgramiv(program, GL_VALIDATE_STATUS, &validateSuccess);
-        if (validateSuccess == GL_FALSE) {
-            int length;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
-            if (length > 0) {
+        bool linked = false;
+        if (!compiled) {
+            ZGINE_CORE_ERROR("Shader compilation failed, cannot create program!");
+        } else {
+            // Check for linking errors
+            int linkSuccess;
+            glGetProgramiv(m_RendererID, GL_LINK_STATUS, &linkSuccess);
+            linked = linkSuccess != GL_FALSE;
+            if (!linked) {
+                int length;
+                glGetProgramiv(m_RendererID, GL_INFO_LOG_LENGTH, &length);
                 std::vector<char> message(length);
-                glGetProgramInfoLog(program, length, &length, message.data());
-                ZGINE_CORE_WARN("Shader program validation warning:");
-                ZGINE_CORE_WARN("{0}", message.data());
+                glGetProgramInfoLog(m_RendererID, length, &length, message.data());
+                ZGINE_CORE_ERROR("Failed to link shader program!");
+                ZGINE_CORE_ERROR("{0}", message.data());
             }
         }
-#endif
 
-        // Shaders are now linked into program, no longer needed
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        const OpenGLExtensions& gl = OpenGLExtensions::Get();
+        if (linked && gl.ProgramBinary) {
+            StoreCachedProgram(gl, m_CacheKey, m_RendererID);
+        }
 
-        return program;
+        // Shaders are now linked into program, no longer needed
+        if (m_VertexID != 0) glDeleteShader(m_VertexID);
+        if (m_FragmentID != 0) glDeleteShader(m_FragmentID);
+        m_VertexID = 0;
+        m_FragmentID = 0;
+
+        if (!linked) {
+            glDeleteProgram(m_RendererID);
+            m_RendererID = 0;
+        }
     }
 
     int OpenGLShader::GetUniformLocation(const std::string& name) {
-        if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
-            return m_UniformLocationCache[name];
+        FinishCreate();
+        const auto it = m_UniformLocationCache.find(name);
+        if (it != m_UniformLocationCache.end())
+            return it->second;
 
         int location = glGetUniformLocation(m_RendererID, name.c_str());
         if (location == -1) {
             ZGINE_CORE_WARN("Warning: uniform '{0}' doesn't exist!", name);
         }
 
-        m_UniformLocationCache[name] = location;
+        m_UniformLocationCache.emplace(name, location);
         return location;
     }
 
@@ -170,17 +263,27 @@ namespace Zgine {
     }
 
     void OpenGLShader::SetUniformMat3f(const std::string& name, const Math::Matrix3& matrix) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        int location = GetUniformLocation(name);
         if (location != -1) {
             glUniformMatrix3fv(location, 1, GL_FALSE, Math::ValuePtr(matrix));
         }
     }
 
     void OpenGLShader::SetUniformMat4f(const std::string& name, const Math::Matrix4& matrix) {
-        GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+        int location = GetUniformLocation(name);
         if (location != -1) {
             glUniformMatrix4fv(location, 1, GL_FALSE, Math::ValuePtr(matrix));
         }
     }
 
+    void OpenGLShader::SetUniformBlockBinding(const std::string& blockName, uint32_t binding) {
+        FinishCreate();
+        const GLuint index = glGetUniformBlockIndex(m_RendererID, blockName.c_str());
+        if (index == GL_INVALID_INDEX) {
+            ZGINE_CORE_WARN("Warning: uniform block '{0}' doesn't exist!", blockName);
+            return;
+        }
+        glUniformBlockBinding(m_RendererID, index, binding);
+    }
+
 }
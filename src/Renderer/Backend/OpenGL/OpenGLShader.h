@@ -22,14 +22,26 @@ namespace Zgine {
         virtual void SetUniformMat3f(const std::string& name, const Math::Matrix3& matrix) override;
         virtual void SetUniformMat4f(const std::string& name, const Math::Matrix4& matrix) override;
 
+        virtual void SetUniformBlockBinding(const std::string& blockName, uint32_t binding) override;
+
         virtual uint32_t GetID() const override { return m_RendererID; }
+        virtual bool IsReady() const override;
 
     private:
         uint32_t CompileShader(uint32_t type, const std::string& source);
-        uint32_t CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+        static bool CheckCompileStatus(uint32_t type, uint32_t id);
+        /** @brief Start compiling and linking; the result is collected by FinishCreate(). */
+        void CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
+        /** @brief Check the pending compile and link, waiting for them if needed. */
+        void FinishCreate() const;
         int GetUniformLocation(const std::string& name);
 
-        uint32_t m_RendererID;
+        // Mutable so that Bind() can finish a program still being built.
+        mutable uint32_t m_RendererID = 0;
+        mutable uint32_t m_VertexID = 0;
+        mutable uint32_t m_FragmentID = 0;
+        mutable bool m_Pending = false;
+        uint64_t m_CacheKey = 0;
         std::unordered_map<std::string, int> m_UniformLocationCache;
     };
 
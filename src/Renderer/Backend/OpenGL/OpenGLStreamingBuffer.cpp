@@ -0,0 +1,18 @@
+#include "OpenGLStreamingBuffer.h"
+#include <algorithm>
+
+namespace Zgine {
+
+    void UploadStreamingBuffer(GLenum target, uint32_t& capacity, const void* data, uint32_t size) {
+        if (size > capacity) {
+            // Grow geometrically so a slowly growing scene does not reallocate every frame.
+            capacity = std::max(size, capacity + capacity / 2);
+        }
+        // Orphan the old storage so the driver does not wait on draws still reading it.
+        glBufferData(target, capacity, nullptr, GL_DYNAMIC_DRAW);
+        if (size > 0) {
+            glBufferSubData(target, 0, size, data);
+        }
+    }
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+
+namespace Zgine {
+
+    /**
+     * @brief Replace the contents of the buffer bound to @p target with @p size
+     *        bytes of @p data, for buffers rewritten every frame.
+     *
+     * The storage is orphaned on every call, and grows to at least 1.5x
+     * @p capacity when @p size does not fit; @p capacity is updated to the new
+     * storage size.
+     */
+    void UploadStreamingBuffer(GLenum target, uint32_t& capacity, const void* data, uint32_t size);
+
+}
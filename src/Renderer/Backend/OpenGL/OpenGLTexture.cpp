@@ -1,4 +1,5 @@
 #include "OpenGLTexture.h"
+#include "OpenGLExtensions.h"
 #include <Zgine/Core/Log/Log.h>
 #include <glad/glad.h>
 #define STB_IMAGE_IMPLEMENTATION
@@ -63,6 +64,101 @@ namespace Zgine {
         ZGINE_CORE_INFO("Loaded embedded texture: {0} ({1}x{2})", debugName, m_Width, m_Height);
     }
 
+    OpenGLTexture::OpenGLTexture(TextureFormat format, const std::vector<TextureMip>& mips,
+                                 const TextureSettings& settings, const std::string& debugName, uint32_t firstMip)
+        : m_RendererID(0), m_FilePath(debugName), m_Width(0), m_Height(0), m_BPP(4),
+          m_FromMipChain(true), m_Format(format), m_Settings(settings) {
+        if (mips.empty() || firstMip >= mips.size() || !mips[firstMip].Data) {
+            ZGINE_CORE_ERROR("Invalid texture data for: {0}", debugName);
+            return;
+        }
+        if (format == TextureFormat::BC3 && !OpenGLExtensions::Get().TextureCompressionS3TC) {
+            ZGINE_CORE_WARN("S3TC textures are unavailable; cannot upload {0}", debugName);
+            return;
+        }
+
+        m_Width = static_cast<int>(mips.front().Width);
+        m_Height = static_cast<int>(mips.front().Height);
+        SetResidentMips(mips, firstMip);
+
+        ZGINE_CORE_INFO("Loaded cooked texture: {0} ({1}x{2}, {3} of {4} mips)", debugName, m_Width, m_Height,
+                        mips.size() - firstMip, mips.size());
+    }
+
+    bool OpenGLTexture::SetResidentMips(const std::vector<TextureMip>& mips, uint32_t firstMip) {
+        if (!m_FromMipChain || firstMip >= mips.size()) {
+            return false;
+        }
+        if (m_Format == TextureFormat::BC3 && !OpenGLExtensions::Get().TextureCompressionS3TC) {
+            return false;
+        }
+
+        // Levels keep their index in the full chain and GL_TEXTURE_BASE_LEVEL is
+        // the finest one sampled: adding mips uploads only the new levels, and
+        // dropping them uploads nothing. Storage stays mutable so a dropped level
+        // can be respecified as empty, which frees it; glTexStorage2D would hold
+        // the whole chain for the texture's lifetime.
+        const bool created = m_RendererID == 0;
+        if (created) {
+            glGenTextures(1, &m_RendererID);
+        }
+        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+
+        const GLenum internalFormat = m_Format == TextureFormat::BC3
+            ? (m_Settings.SRGB ? ZGINE_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : ZGINE_GL_COMPRESSED_RGBA_S3TC_DXT5)
+            : (m_Settings.SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+        if (created) {
+            GLenum minFilter = m_Settings.Linear ? GL_LINEAR : GL_NEAREST;
+            GLenum magFilter = m_Settings.Linear ? GL_LINEAR : GL_NEAREST;
+            if (mips.size() > 1) {
+                minFilter = m_Settings.Linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+            }
+
+            GLenum wrapMode = m_Settings.ClampToEdge ? GL_CLAMP_TO_EDGE : GL_REPEAT;
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapMode);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mips.size() - 1));
+        }
+
+        // Rows of RGBA8 and BC blocks are 4-byte multiples, which is the default unpack alignment.
+        const uint32_t uploadEnd = created ? static_cast<uint32_t>(mips.size()) : m_ResidentMip;
+        for (uint32_t level = firstMip; level < uploadEnd; ++level) {
+            const TextureMip& mip = mips[level];
+            const auto width = static_cast<GLsizei>(mip.Width);
+            const auto height = static_cast<GLsizei>(mip.Height);
+            if (m_Format == TextureFormat::BC3) {
+                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, width, height, 0,
+                                       static_cast<GLsizei>(mip.Size), mip.Data);
+            } else {
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), static_cast<GLint>(internalFormat), width,
+                             height, 0, GL_RGBA, GL_UNSIGNED_BYTE, mip.Data);
+            }
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(firstMip));
+
+        // Levels below the base level are outside the completeness check, so
+        // the dropped ones can be emptied once sampling no longer reaches them.
+        for (uint32_t level = m_ResidentMip; !created && level < firstMip; ++level) {
+            if (m_Format == TextureFormat::BC3) {
+                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, 0, 0, 0, 0, nullptr);
+            } else {
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), static_cast<GLint>(internalFormat), 0, 0, 0,
+                             GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            }
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        size_t memorySize = 0;
+        for (size_t level = firstMip; level < mips.size(); ++level) {
+            memorySize += mips[level].Size;
+        }
+        m_ResidentMip = firstMip;
+        m_MemorySize = memorySize;
+        return true;
+    }
+
     OpenGLTexture::~OpenGLTexture() {
         if (m_RendererID != 0) {
             glDeleteTextures(1, &m_RendererID);
@@ -106,8 +202,10 @@ namespace Zgine {
 
         GLint internalFormat = settings.SRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8;
         glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+        m_MemorySize = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
         if (settings.GenerateMipmaps) {
             glGenerateMipmap(GL_TEXTURE_2D);
+            m_MemorySize = m_MemorySize * 4 / 3;
         }
         glBindTexture(GL_TEXTURE_2D, 0);
     }
@@ -11,6 +11,8 @@ namespace Zgine {
         OpenGLTexture(const std::string& path, const TextureSettings& settings);
         OpenGLTexture(const unsigned char* data, int size, const std::string& debugName);
         OpenGLTexture(const unsigned char* rgbaData, int width, int height, const std::string& debugName);
+        OpenGLTexture(TextureFormat format, const std::vector<TextureMip>& mips, const TextureSettings& settings,
+                      const std::string& debugName, uint32_t firstMip = 0);
         virtual ~OpenGLTexture();
 
         virtual void Bind(uint32_t slot = 0) const override;
@@ -20,6 +22,9 @@ namespace Zgine {
         virtual uint32_t GetHeight() const override { return m_Height; }
         virtual uint32_t GetID() const override { return m_RendererID; }
         virtual const std::string& GetFilePath() const override { return m_FilePath; }
+        virtual size_t GetMemorySize() const override { return m_MemorySize; }
+        virtual uint32_t GetResidentMip() const override { return m_ResidentMip; }
+        virtual bool SetResidentMips(const std::vector<TextureMip>& mips, uint32_t firstMip) override;
 
     private:
         void CreateTexture(int width, int height, const unsigned char* data);
@@ -28,6 +33,13 @@ namespace Zgine {
         uint32_t m_RendererID;
         std::string m_FilePath;
         int m_Width, m_Height, m_BPP;
+        size_t m_MemorySize = 0;
+
+        // Only textures created from a mip chain can change their resident levels.
+        bool m_FromMipChain = false;
+        TextureFormat m_Format = TextureFormat::RGBA8;
+        TextureSettings m_Settings;
+        uint32_t m_ResidentMip = 0;
     };
 
 }
@@ -0,0 +1,69 @@
+#include "OpenGLTextureBuffer.h"
+#include "OpenGLStreamingBuffer.h"
+#include <Zgine/Core/Log/Log.h>
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace Zgine {
+
+    namespace {
+        GLenum ToGLFormat(TextureBufferFormat format) {
+            switch (format) {
+                case TextureBufferFormat::R32UI:   return GL_R32UI;
+                case TextureBufferFormat::RG32UI:  return GL_RG32UI;
+                case TextureBufferFormat::RGBA32F: return GL_RGBA32F;
+            }
+            return GL_R32UI;
+        }
+
+        uint32_t GetTexelSize(TextureBufferFormat format) {
+            switch (format) {
+                case TextureBufferFormat::R32UI:   return 4;
+                case TextureBufferFormat::RG32UI:  return 8;
+                case TextureBufferFormat::RGBA32F: return 16;
+            }
+            return 4;
+        }
+    }
+
+    OpenGLTextureBuffer::OpenGLTextureBuffer(TextureBufferFormat format, uint32_t size)
+        : m_Capacity(std::max(size, GetTexelSize(format)))
+        , m_Format(format) {
+        glGenBuffers(1, &m_BufferID);
+        glBindBuffer(GL_TEXTURE_BUFFER, m_BufferID);
+        glBufferData(GL_TEXTURE_BUFFER, m_Capacity, nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+        // The texture is a view of the buffer and follows reallocations of it.
+        glGenTextures(1, &m_TextureID);
+        glBindTexture(GL_TEXTURE_BUFFER, m_TextureID);
+        glTexBuffer(GL_TEXTURE_BUFFER, ToGLFormat(format), m_BufferID);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+        GLint maxTexels = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+        m_MaxTexels = static_cast<uint32_t>(maxTexels);
+    }
+
+    OpenGLTextureBuffer::~OpenGLTextureBuffer() {
+        glDeleteTextures(1, &m_TextureID);
+        glDeleteBuffers(1, &m_BufferID);
+    }
+
+    void OpenGLTextureBuffer::SetData(const void* data, uint32_t size) {
+        if (size / GetTexelSize(m_Format) > m_MaxTexels) {
+            ZGINE_CORE_WARN("TextureBuffer::SetData: {} texels exceed GL_MAX_TEXTURE_BUFFER_SIZE ({}), the tail is unreadable",
+                size / GetTexelSize(m_Format), m_MaxTexels);
+        }
+
+        glBindBuffer(GL_TEXTURE_BUFFER, m_BufferID);
+        UploadStreamingBuffer(GL_TEXTURE_BUFFER, m_Capacity, data, size);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    void OpenGLTextureBuffer::Bind(uint32_t slot) const {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(GL_TEXTURE_BUFFER, m_TextureID);
+    }
+
+}
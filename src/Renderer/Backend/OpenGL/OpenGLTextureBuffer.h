@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Zgine/Renderer/RHI/TextureBuffer.h>
+
+namespace Zgine {
+
+    class OpenGLTextureBuffer : public TextureBuffer {
+    public:
+        OpenGLTextureBuffer(TextureBufferFormat format, uint32_t size);
+        virtual ~OpenGLTextureBuffer();
+
+        virtual void SetData(const void* data, uint32_t size) override;
+        virtual void Bind(uint32_t slot) const override;
+
+        virtual TextureBufferFormat GetFormat() const override { return m_Format; }
+        virtual uint32_t GetCapacity() const override { return m_Capacity; }
+
+    private:
+        uint32_t m_BufferID = 0;
+        uint32_t m_TextureID = 0;
+        uint32_t m_Capacity = 0;
+        uint32_t m_MaxTexels = 0;
+        TextureBufferFormat m_Format;
+    };
+
+}
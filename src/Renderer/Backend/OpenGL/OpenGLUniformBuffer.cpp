@@ -0,0 +1,37 @@
+#include "OpenGLUniformBuffer.h"
+#include <Zgine/Core/Log/Log.h>
+#include <glad/glad.h>
+
+namespace Zgine {
+
+    OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+        : m_Size(size)
+        , m_Binding(binding) {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+        glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_RendererID);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    OpenGLUniformBuffer::~OpenGLUniformBuffer() {
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+        if (offset + size > m_Size) {
+            ZGINE_CORE_ERROR("UniformBuffer::SetData range [{}, {}) exceeds buffer size {}", offset, offset + size, m_Size);
+            return;
+        }
+
+        glBindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+        if (offset == 0 && size == m_Size) {
+            // Whole-block update: orphan so draws still reading the old contents do not stall us.
+            glBufferData(GL_UNIFORM_BUFFER, m_Size, data, GL_DYNAMIC_DRAW);
+        } else {
+            glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+        }
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+}
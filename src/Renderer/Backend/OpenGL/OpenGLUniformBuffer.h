@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Zgine/Renderer/RHI/UniformBuffer.h>
+
+namespace Zgine {
+
+    class OpenGLUniformBuffer : public UniformBuffer {
+    public:
+        OpenGLUniformBuffer(uint32_t size, uint32_t binding);
+        virtual ~OpenGLUniformBuffer();
+
+        virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+
+        virtual uint32_t GetSize() const override { return m_Size; }
+        virtual uint32_t GetBinding() const override { return m_Binding; }
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint32_t m_Size;
+        uint32_t m_Binding;
+    };
+
+}
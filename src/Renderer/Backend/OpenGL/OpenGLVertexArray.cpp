@@ -24,6 +24,14 @@ namespace {
                 return GL_INT;
             case ShaderDataType::Bool:
                 return GL_INT;
+            case ShaderDataType::UShort4:
+                return GL_UNSIGNED_SHORT;
+            case ShaderDataType::Half2:
+                return GL_HALF_FLOAT;
+            case ShaderDataType::Int1010102:
+                return GL_INT_2_10_10_10_REV;
+            case ShaderDataType::UByte4:
+                return GL_UNSIGNED_BYTE;
             case ShaderDataType::None:
                 return GL_NONE;
         }
@@ -44,6 +52,58 @@ namespace {
         }
     }
 
+    // Points consecutive attributes, starting at @p firstIndex, at the bound
+    // GL_ARRAY_BUFFER shifted by @p baseOffset bytes. Returns the next free index.
+    uint32_t SpecifyAttributes(const BufferLayout& layout, uint32_t firstIndex, uintptr_t baseOffset) {
+        const GLuint divisor = layout.IsPerInstance() ? 1 : 0;
+        const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
+        uint32_t index = firstIndex;
+
+        for (const BufferElement& element : layout) {
+            if (element.Type == ShaderDataType::Mat3 || element.Type == ShaderDataType::Mat4) {
+                const uint32_t columnCount = element.Type == ShaderDataType::Mat3 ? 3 : 4;
+                const uint32_t columnSize = columnCount * sizeof(float);
+
+                for (uint32_t column = 0; column < columnCount; ++column) {
+                    glEnableVertexAttribArray(index);
+                    glVertexAttribPointer(
+                        index,
+                        static_cast<GLint>(columnCount),
+                        GL_FLOAT,
+                        element.Normalized ? GL_TRUE : GL_FALSE,
+                        stride,
+                        reinterpret_cast<const void*>(baseOffset + element.Offset + column * columnSize));
+                    glVertexAttribDivisor(index, divisor);
+                    ++index;
+                }
+
+                continue;
+            }
+
+            glEnableVertexAttribArray(index);
+            if (IsIntegerType(element.Type)) {
+                glVertexAttribIPointer(
+                    index,
+                    static_cast<GLint>(element.GetComponentCount()),
+                    ShaderDataTypeToOpenGLBaseType(element.Type),
+                    stride,
+                    reinterpret_cast<const void*>(baseOffset + element.Offset));
+            } else {
+                glVertexAttribPointer(
+                    index,
+                    static_cast<GLint>(element.GetComponentCount()),
+                    ShaderDataTypeToOpenGLBaseType(element.Type),
+                    element.Normalized ? GL_TRUE : GL_FALSE,
+                    stride,
+                    reinterpret_cast<const void*>(baseOffset + element.Offset));
+            }
+            glVertexAttribDivisor(index, divisor);
+            ++index;
+        }
+
+        return index;
+    }
+
 } // namespace
 
     OpenGLVertexArray::OpenGLVertexArray() {
@@ -73,46 +133,7 @@ namespace {
             return;
         }
 
-        for (const BufferElement& element : layout) {
-            if (element.Type == ShaderDataType::Mat3 || element.Type == ShaderDataType::Mat4) {
-                const uint32_t columnCount = element.Type == ShaderDataType::Mat3 ? 3 : 4;
-                const uint32_t columnSize = columnCount * sizeof(float);
-
-                for (uint32_t column = 0; column < columnCount; ++column) {
-                    glEnableVertexAttribArray(m_VertexBufferIndex);
-                    glVertexAttribPointer(
-                        m_VertexBufferIndex,
-                        static_cast<GLint>(columnCount),
-                        GL_FLOAT,
-                        element.Normalized ? GL_TRUE : GL_FALSE,
-                        static_cast<GLsizei>(layout.GetStride()),
-                        reinterpret_cast<const void*>(static_cast<uintptr_t>(element.Offset + column * columnSize)));
-                    ++m_VertexBufferIndex;
-                }
-
-                continue;
-            }
-
-            glEnableVertexAttribArray(m_VertexBufferIndex);
-            if (IsIntegerType(element.Type)) {
-                glVertexAttribIPointer(
-                    m_VertexBufferIndex,
-                    static_cast<GLint>(element.GetComponentCount()),
-                    ShaderDataTypeToOpenGLBaseType(element.Type),
-                    static_cast<GLsizei>(layout.GetStride()),
-                    reinterpret_cast<const void*>(static_cast<uintptr_t>(element.Offset)));
-            } else {
-                glVertexAttribPointer(
-                    m_VertexBufferIndex,
-                    static_cast<GLint>(element.GetComponentCount()),
-                    ShaderDataTypeToOpenGLBaseType(element.Type),
-                    element.Normalized ? GL_TRUE : GL_FALSE,
-                    static_cast<GLsizei>(layout.GetStride()),
-                    reinterpret_cast<const void*>(static_cast<uintptr_t>(element.Offset)));
-            }
-            ++m_VertexBufferIndex;
-        }
-
+        m_VertexBufferIndex = SpecifyAttributes(layout, m_VertexBufferIndex, 0);
         m_VertexBuffers.push_back(vertexBuffer);
     }
 
@@ -122,4 +143,34 @@ namespace {
         m_IndexBuffer = indexBuffer;
     }
 
+    void OpenGLVertexArray::SetInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer, uint32_t firstInstance) {
+        if (instanceBuffer == m_InstanceBuffer && firstInstance == m_FirstInstance) {
+            return;
+        }
+        if (!instanceBuffer) {
+            m_InstanceBuffer.reset();
+            m_FirstInstance = 0;
+            return;
+        }
+
+        const BufferLayout& layout = instanceBuffer->GetLayout();
+        if (!layout.IsPerInstance() || m_VertexBufferIndex > kInstanceAttributeBase) {
+            if (instanceBuffer != m_InstanceBuffer) {
+                ZGINE_CORE_WARN("OpenGLVertexArray cannot use the instance buffer: {}",
+                    layout.IsPerInstance() ? "mesh attributes overlap the instance locations" : "layout is not per-instance");
+            }
+            m_InstanceBuffer = instanceBuffer;
+            m_FirstInstance = firstInstance;
+            return;
+        }
+
+        // Re-pointing the attributes emulates a base instance on GL 3.3.
+        Bind();
+        instanceBuffer->Bind();
+        SpecifyAttributes(layout, kInstanceAttributeBase,
+            static_cast<uintptr_t>(firstInstance) * layout.GetStride());
+        m_InstanceBuffer = instanceBuffer;
+        m_FirstInstance = firstInstance;
+    }
+
 }
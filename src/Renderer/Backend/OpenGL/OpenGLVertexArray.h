@@ -14,6 +14,7 @@ namespace Zgine {
 
         virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override;
         virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override;
+        virtual void SetInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer, uint32_t firstInstance = 0) override;
 
         virtual uint32_t GetID() const override { return m_RendererID; }
         virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
@@ -23,6 +24,8 @@ namespace Zgine {
         uint32_t m_VertexBufferIndex = 0;
         std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
         std::shared_ptr<IndexBuffer> m_IndexBuffer;
+        std::shared_ptr<VertexBuffer> m_InstanceBuffer;
+        uint32_t m_FirstInstance = 0;
     };
 
 }
@@ -1,4 +1,5 @@
 #include "OpenGLVertexBuffer.h"
+#include "OpenGLStreamingBuffer.h"
 #include <Zgine/Core/Log/Log.h>
 #include <glad/glad.h>
 
@@ -8,6 +9,14 @@ namespace Zgine {
         glGenBuffers(1, &m_RendererID);
         glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
         glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+        m_Capacity = size;
+    }
+
+    OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
+        glGenBuffers(1, &m_RendererID);
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+        m_Capacity = size;
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
@@ -22,4 +31,19 @@ namespace Zgine {
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
+    void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        UploadStreamingBuffer(GL_ARRAY_BUFFER, m_Capacity, data, size);
+    }
+
+    void OpenGLVertexBuffer::SetSubData(const void* data, uint32_t size, uint32_t offset) {
+        if (offset + size > m_Capacity) {
+            ZGINE_CORE_ERROR("OpenGLVertexBuffer::SetSubData range [{}, {}) exceeds the buffer size {}.",
+                offset, offset + size, m_Capacity);
+            return;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+    }
+
 }
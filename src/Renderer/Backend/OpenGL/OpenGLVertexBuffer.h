@@ -7,6 +7,7 @@ namespace Zgine {
     class OpenGLVertexBuffer : public VertexBuffer {
     public:
         OpenGLVertexBuffer(const void* data, uint32_t size);
+        explicit OpenGLVertexBuffer(uint32_t size);
         virtual ~OpenGLVertexBuffer();
 
         virtual void Bind() const override;
@@ -15,9 +16,12 @@ namespace Zgine {
         virtual uint32_t GetID() const override { return m_RendererID; }
         virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
         virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual void SetData(const void* data, uint32_t size) override;
+        virtual void SetSubData(const void* data, uint32_t size, uint32_t offset) override;
 
     private:
         uint32_t m_RendererID = 0;
+        uint32_t m_Capacity = 0;
         BufferLayout m_Layout;
     };
 
@@ -0,0 +1,50 @@
+#include <Zgine/Renderer/RHI/RecordingRendererAPI.h>
+#include <algorithm>
+
+namespace Zgine {
+
+void RecordingRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+    m_Commands.push_back({RecordedCommand::Type::SetViewport});
+}
+
+void RecordingRendererAPI::SetClearColor(const Math::Vector4& color) {
+    (void)color;
+    m_Commands.push_back({RecordedCommand::Type::SetClearColor});
+}
+
+void RecordingRendererAPI::Clear() {
+    m_Commands.push_back({RecordedCommand::Type::Clear});
+}
+
+void RecordingRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount) {
+    m_Commands.push_back({RecordedCommand::Type::DrawIndexed, vertexArray.get(), indexCount, 1});
+}
+
+void RecordingRendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                                uint32_t instanceCount) {
+    m_Commands.push_back({RecordedCommand::Type::DrawIndexedInstanced, vertexArray.get(), indexCount, instanceCount});
+}
+
+void RecordingRendererAPI::BindShader(const Shader& shader) {
+    m_Commands.push_back({RecordedCommand::Type::BindShader, &shader});
+}
+
+void RecordingRendererAPI::BindVertexArray(const VertexArray* vertexArray) {
+    m_Commands.push_back({RecordedCommand::Type::BindVertexArray, vertexArray});
+}
+
+void RecordingRendererAPI::DrawBound(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
+                                     int32_t baseVertex) {
+    m_Commands.push_back({RecordedCommand::Type::DrawBound, nullptr, indexCount, instanceCount, firstIndex, baseVertex});
+}
+
+size_t RecordingRendererAPI::CountCommands(RecordedCommand::Type type) const {
+    return static_cast<size_t>(std::count_if(m_Commands.begin(), m_Commands.end(),
+        [type](const RecordedCommand& command) { return command.Kind == type; }));
+}
+
+} // namespace Zgine
@@ -116,4 +116,11 @@ void VulkanIndexBuffer::Unbind() const {
     // Vulkan does not have global index-buffer binding state.
 }
 
+void VulkanIndexBuffer::SetSubData(const uint32_t* indices, uint32_t count, uint32_t firstIndex) {
+    (void)indices;
+    (void)count;
+    (void)firstIndex;
+    ZGINE_CORE_ERROR("VulkanIndexBuffer is device-local; partial updates are not implemented yet.");
+}
+
 } // namespace Zgine
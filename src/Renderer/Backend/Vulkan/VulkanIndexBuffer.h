@@ -16,6 +16,7 @@ public:
 
     uint32_t GetCount() const override { return m_Count; }
     uint32_t GetID() const override { return m_RendererID; }
+    void SetSubData(const uint32_t* indices, uint32_t count, uint32_t firstIndex) override;
 
     [[nodiscard]] VkBuffer GetBuffer() const { return m_Buffer; }
 
@@ -0,0 +1,105 @@
+#include "VulkanPipelineCache.h"
+
+#include <Zgine/Core/Log/Log.h>
+#include <Zgine/Platform/IO/File.h>
+
+#include <cstring>
+#include <utility>
+
+namespace Zgine {
+
+namespace {
+
+    // Layout of VkPipelineCacheHeaderVersionOne, read field by field so the
+    // blob needs no particular alignment.
+    constexpr size_t kHeaderSize = 16 + VK_UUID_SIZE;
+
+    uint32_t ReadU32(const std::vector<uint8_t>& data, size_t offset) {
+        uint32_t value = 0;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+
+} // namespace
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+    Shutdown();
+}
+
+bool VulkanPipelineCache::IsCompatible(const std::vector<uint8_t>& data, const VkPhysicalDeviceProperties& properties) {
+    if (data.size() < kHeaderSize) {
+        return false;
+    }
+    return ReadU32(data, 0) >= kHeaderSize
+        && ReadU32(data, 4) == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && ReadU32(data, 8) == properties.vendorID
+        && ReadU32(data, 12) == properties.deviceID
+        && std::memcmp(data.data() + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void VulkanPipelineCache::Init(VkDevice device, VkPhysicalDevice physicalDevice, std::string path) {
+    Shutdown();
+    m_Device = device;
+    m_Path = std::move(path);
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    std::vector<uint8_t> initialData;
+    if (File::Exists(m_Path)) {
+        initialData = File::ReadBinaryFile(m_Path);
+        if (!IsCompatible(initialData, properties)) {
+            ZGINE_CORE_INFO("Vulkan pipeline cache '{}' was written by another device or driver; starting empty.", m_Path);
+            initialData.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+    if (vkCreatePipelineCache(m_Device, &createInfo, nullptr, &m_Cache) != VK_SUCCESS) {
+        // A rejected blob is not fatal; retry without it.
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        if (vkCreatePipelineCache(m_Device, &createInfo, nullptr, &m_Cache) != VK_SUCCESS) {
+            m_Device = VK_NULL_HANDLE;
+            ZGINE_CORE_THROW_RUNTIME("Failed to create Vulkan pipeline cache.");
+        }
+        initialData.clear();
+    }
+
+    ZGINE_CORE_INFO("Vulkan pipeline cache ready ({} bytes loaded from '{}')", initialData.size(), m_Path);
+}
+
+bool VulkanPipelineCache::Save() const {
+    if (m_Cache == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_Device, m_Cache, &size, nullptr) != VK_SUCCESS || size == 0) {
+        return false;
+    }
+    std::vector<uint8_t> data(size);
+    if (vkGetPipelineCacheData(m_Device, m_Cache, &size, data.data()) != VK_SUCCESS) {
+        ZGINE_CORE_WARN("Failed to read Vulkan pipeline cache data.");
+        return false;
+    }
+    data.resize(size);
+    return File::WriteBinaryFile(m_Path, data);
+}
+
+void VulkanPipelineCache::Shutdown() {
+    if (m_Cache == VK_NULL_HANDLE) {
+        return;
+    }
+
+    Save();
+    vkDestroyPipelineCache(m_Device, m_Cache, nullptr);
+    m_Cache = VK_NULL_HANDLE;
+    m_Device = VK_NULL_HANDLE;
+}
+
+} // namespace Zgine
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Zgine {
+
+/**
+ * @brief VkPipelineCache persisted to disk between runs.
+ *
+ * Init() seeds the cache from the file when its header matches the current
+ * driver and device; anything else (missing file, other GPU, driver update)
+ * starts empty rather than risking a driver rejecting the blob. Save()
+ * writes the cache back so later runs skip most pipeline compilation.
+ */
+class VulkanPipelineCache {
+public:
+    /** @brief Default location, relative to the working directory. */
+    static constexpr const char* kDefaultPath = "cache/VulkanPipelineCache.bin";
+
+    VulkanPipelineCache() = default;
+    ~VulkanPipelineCache();
+
+    VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+    VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+    void Init(VkDevice device, VkPhysicalDevice physicalDevice, std::string path = kDefaultPath);
+    /** @brief Save and destroy the cache. */
+    void Shutdown();
+
+    /** @brief Write the cache to disk; returns false when it could not be written. */
+    bool Save() const;
+
+    [[nodiscard]] VkPipelineCache GetHandle() const noexcept { return m_Cache; }
+
+    /**
+     * @brief Whether @p data starts with a version-one pipeline cache header for this device.
+     */
+    [[nodiscard]] static bool IsCompatible(const std::vector<uint8_t>& data, const VkPhysicalDeviceProperties& properties);
+
+private:
+    VkDevice m_Device = VK_NULL_HANDLE;
+    VkPipelineCache m_Cache = VK_NULL_HANDLE;
+    std::string m_Path;
+};
+
+} // namespace Zgine
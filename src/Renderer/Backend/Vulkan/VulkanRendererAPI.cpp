@@ -1,6 +1,7 @@
 #include "VulkanRendererAPI.h"
 
 #include "VulkanContextAccess.h"
+#include "VulkanPipelineCache.h"
 
 #include <Zgine/Core/Application/Application.h>
 #include <Zgine/Core/Log/Log.h>
@@ -326,6 +327,7 @@ struct VulkanRendererAPI::VulkanContext {
     std::array<VkSemaphore, kMaxFramesInFlight> ImageAvailableSemaphores{};
     std::vector<VkSemaphore> RenderFinishedSemaphores;
     std::array<VkFence, kMaxFramesInFlight> InFlightFences{};
+    VulkanPipelineCache PipelineCache;
     QueueFamilyIndices QueueFamilies;
     Math::Vector4 ClearColor{0.1f, 0.1f, 0.1f, 1.0f};
     uint32_t CurrentFrame = 0;
@@ -487,6 +489,8 @@ void VulkanRendererAPI::Init() {
         vkAllocateCommandBuffers(m_Context->Device, &commandBufferInfo, m_Context->CommandBuffers.data()),
         "Failed to allocate Vulkan command buffers.");
 
+    m_Context->PipelineCache.Init(m_Context->Device, m_Context->PhysicalDevice);
+
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
@@ -746,6 +750,8 @@ void VulkanRendererAPI::Shutdown() {
         }
         m_Context->ImageAvailableSemaphores = {};
 
+        m_Context->PipelineCache.Shutdown();
+
         if (m_Context->CommandPool != VK_NULL_HANDLE) {
             vkDestroyCommandPool(m_Context->Device, m_Context->CommandPool, nullptr);
             m_Context->CommandPool = VK_NULL_HANDLE;
@@ -27,4 +27,10 @@ void VulkanVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& index
     m_IndexBuffer = indexBuffer;
 }
 
+void VulkanVertexArray::SetInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer, uint32_t firstInstance) {
+    // Bound as a second vertex binding when command recording supports meshes.
+    m_InstanceBuffer = instanceBuffer;
+    m_FirstInstance = firstInstance;
+}
+
 } // namespace Zgine
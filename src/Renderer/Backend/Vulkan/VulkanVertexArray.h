@@ -14,6 +14,7 @@ public:
 
     void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override;
     void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override;
+    void SetInstanceBuffer(const std::shared_ptr<VertexBuffer>& instanceBuffer, uint32_t firstInstance = 0) override;
 
     uint32_t GetID() const override { return m_RendererID; }
     const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
@@ -26,6 +27,8 @@ private:
     uint32_t m_RendererID = 0;
     std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
     std::shared_ptr<IndexBuffer> m_IndexBuffer;
+    std::shared_ptr<VertexBuffer> m_InstanceBuffer;
+    uint32_t m_FirstInstance = 0;
 };
 
 } // namespace Zgine
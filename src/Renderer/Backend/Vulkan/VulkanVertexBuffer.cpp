@@ -121,4 +121,17 @@ void VulkanVertexBuffer::Unbind() const {
     // Vulkan does not have global vertex-buffer binding state.
 }
 
+void VulkanVertexBuffer::SetData(const void* data, uint32_t size) {
+    (void)data;
+    (void)size;
+    ZGINE_CORE_ERROR("VulkanVertexBuffer is device-local; dynamic updates are not implemented yet.");
+}
+
+void VulkanVertexBuffer::SetSubData(const void* data, uint32_t size, uint32_t offset) {
+    (void)data;
+    (void)size;
+    (void)offset;
+    ZGINE_CORE_ERROR("VulkanVertexBuffer is device-local; dynamic updates are not implemented yet.");
+}
+
 } // namespace Zgine
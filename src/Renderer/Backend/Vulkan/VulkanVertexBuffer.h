@@ -17,6 +17,8 @@ public:
     uint32_t GetID() const override { return m_RendererID; }
     void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
     const BufferLayout& GetLayout() const override { return m_Layout; }
+    void SetData(const void* data, uint32_t size) override;
+    void SetSubData(const void* data, uint32_t size, uint32_t offset) override;
 
     [[nodiscard]] VkBuffer GetBuffer() const { return m_Buffer; }
     [[nodiscard]] VkDeviceSize GetSize() const { return m_Size; }
@@ -0,0 +1,291 @@
+#include <Zgine/Renderer/Culling/DynamicBVH.h>
+#include <algorithm>
+#include <cassert>
+
+namespace Zgine {
+
+namespace {
+    // A proxy whose fat box is this much larger than needed on any axis is
+    // reinserted, so objects that shrink or stop moving tighten up again.
+    constexpr float kShrinkFactor = 4.0f;
+}
+
+DynamicBVH::DynamicBVH(float margin)
+    : m_Margin(margin) {}
+
+int32_t DynamicBVH::CreateProxy(const AABB& bounds, uint32_t userData) {
+    const int32_t proxy = AllocateNode();
+    Node& node = m_Nodes[static_cast<size_t>(proxy)];
+    node.Bounds = bounds.Expanded(m_Margin);
+    node.UserData = userData;
+    node.Height = 0;
+    InsertLeaf(proxy);
+    ++m_ProxyCount;
+    return proxy;
+}
+
+void DynamicBVH::DestroyProxy(int32_t proxy) {
+    assert(proxy >= 0 && static_cast<size_t>(proxy) < m_Nodes.size());
+    assert(m_Nodes[static_cast<size_t>(proxy)].IsLeaf());
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --m_ProxyCount;
+}
+
+bool DynamicBVH::MoveProxy(int32_t proxy, const AABB& bounds) {
+    assert(proxy >= 0 && static_cast<size_t>(proxy) < m_Nodes.size());
+    Node& node = m_Nodes[static_cast<size_t>(proxy)];
+
+    const AABB fat = bounds.Expanded(m_Margin);
+    if (node.Bounds.Contains(bounds)) {
+        const AABB loosest = bounds.Expanded(m_Margin * kShrinkFactor);
+        if (loosest.Contains(node.Bounds)) {
+            return false;
+        }
+    }
+
+    RemoveLeaf(proxy);
+    m_Nodes[static_cast<size_t>(proxy)].Bounds = fat;
+    InsertLeaf(proxy);
+    return true;
+}
+
+void DynamicBVH::Clear() {
+    m_Nodes.clear();
+    m_Root = kNullNode;
+    m_FreeList = kNullNode;
+    m_ProxyCount = 0;
+}
+
+int32_t DynamicBVH::GetHeight() const {
+    return m_Root == kNullNode ? 0 : m_Nodes[static_cast<size_t>(m_Root)].Height + 1;
+}
+
+bool DynamicBVH::Validate() const {
+    if (m_Root == kNullNode) {
+        return m_ProxyCount == 0;
+    }
+    return m_Nodes[static_cast<size_t>(m_Root)].Parent == kNullNode && ValidateNode(m_Root, kNullNode);
+}
+
+bool DynamicBVH::ValidateNode(int32_t index, int32_t parent) const {
+    const Node& node = m_Nodes[static_cast<size_t>(index)];
+    if (node.Parent != parent) {
+        return false;
+    }
+    if (node.IsLeaf()) {
+        return node.Height == 0 && node.Child2 == kNullNode;
+    }
+
+    const Node& child1 = m_Nodes[static_cast<size_t>(node.Child1)];
+    const Node& child2 = m_Nodes[static_cast<size_t>(node.Child2)];
+    if (node.Height != 1 + std::max(child1.Height, child2.Height)) {
+        return false;
+    }
+    if (!node.Bounds.Contains(child1.Bounds) || !node.Bounds.Contains(child2.Bounds)) {
+        return false;
+    }
+    return ValidateNode(node.Child1, index) && ValidateNode(node.Child2, index);
+}
+
+int32_t DynamicBVH::AllocateNode() {
+    if (m_FreeList == kNullNode) {
+        m_Nodes.emplace_back();
+        return static_cast<int32_t>(m_Nodes.size() - 1);
+    }
+
+    const int32_t index = m_FreeList;
+    Node& node = m_Nodes[static_cast<size_t>(index)];
+    m_FreeList = node.Parent;
+    node = Node{};
+    return index;
+}
+
+void DynamicBVH::FreeNode(int32_t index) {
+    Node& node = m_Nodes[static_cast<size_t>(index)];
+    node.Parent = m_FreeList;
+    node.Height = -1;
+    m_FreeList = index;
+}
+
+void DynamicBVH::InsertLeaf(int32_t leaf) {
+    if (m_Root == kNullNode) {
+        m_Root = leaf;
+        m_Nodes[static_cast<size_t>(leaf)].Parent = kNullNode;
+        return;
+    }
+
+    // Descend towards the sibling that minimizes the added surface area.
+    const AABB leafBounds = m_Nodes[static_cast<size_t>(leaf)].Bounds;
+    int32_t index = m_Root;
+    while (!m_Nodes[static_cast<size_t>(index)].IsLeaf()) {
+        const Node& node = m_Nodes[static_cast<size_t>(index)];
+        const float area = node.Bounds.GetHalfArea();
+        const float combinedArea = AABB::Union(node.Bounds, leafBounds).GetHalfArea();
+
+        // Cost of making a new parent for this node and the leaf, and the
+        // minimum cost pushed down to any descendant.
+        const float cost = 2.0f * combinedArea;
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t childIndex) {
+            const Node& child = m_Nodes[static_cast<size_t>(childIndex)];
+            const float unionArea = AABB::Union(leafBounds, child.Bounds).GetHalfArea();
+            return child.IsLeaf()
+                ? unionArea + inheritanceCost
+                : unionArea - child.Bounds.GetHalfArea() + inheritanceCost;
+        };
+        const float cost1 = childCost(node.Child1);
+        const float cost2 = childCost(node.Child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = m_Nodes[static_cast<size_t>(sibling)].Parent;
+    const int32_t newParent = AllocateNode();
+    {
+        Node& parentNode = m_Nodes[static_cast<size_t>(newParent)];
+        const Node& siblingNode = m_Nodes[static_cast<size_t>(sibling)];
+        parentNode.Parent = oldParent;
+        parentNode.Bounds = AABB::Union(leafBounds, siblingNode.Bounds);
+        parentNode.Height = siblingNode.Height + 1;
+        parentNode.Child1 = sibling;
+        parentNode.Child2 = leaf;
+    }
+
+    if (oldParent != kNullNode) {
+        Node& grandParent = m_Nodes[static_cast<size_t>(oldParent)];
+        if (grandParent.Child1 == sibling) {
+            grandParent.Child1 = newParent;
+        } else {
+            grandParent.Child2 = newParent;
+        }
+    } else {
+        m_Root = newParent;
+    }
+    m_Nodes[static_cast<size_t>(sibling)].Parent = newParent;
+    m_Nodes[static_cast<size_t>(leaf)].Parent = newParent;
+
+    // Refit and rebalance up to the root.
+    index = newParent;
+    while (index != kNullNode) {
+        index = Balance(index);
+        Node& node = m_Nodes[static_cast<size_t>(index)];
+        const Node& child1 = m_Nodes[static_cast<size_t>(node.Child1)];
+        const Node& child2 = m_Nodes[static_cast<size_t>(node.Child2)];
+        node.Height = 1 + std::max(child1.Height, child2.Height);
+        node.Bounds = AABB::Union(child1.Bounds, child2.Bounds);
+        index = node.Parent;
+    }
+}
+
+void DynamicBVH::RemoveLeaf(int32_t leaf) {
+    if (leaf == m_Root) {
+        m_Root = kNullNode;
+        return;
+    }
+
+    const int32_t parent = m_Nodes[static_cast<size_t>(leaf)].Parent;
+    const Node& parentNode = m_Nodes[static_cast<size_t>(parent)];
+    const int32_t grandParent = parentNode.Parent;
+    const int32_t sibling = parentNode.Child1 == leaf ? parentNode.Child2 : parentNode.Child1;
+
+    if (grandParent == kNullNode) {
+        m_Root = sibling;
+        m_Nodes[static_cast<size_t>(sibling)].Parent = kNullNode;
+        FreeNode(parent);
+        return;
+    }
+
+    // The sibling takes the parent's place.
+    Node& grandParentNode = m_Nodes[static_cast<size_t>(grandParent)];
+    if (grandParentNode.Child1 == parent) {
+        grandParentNode.Child1 = sibling;
+    } else {
+        grandParentNode.Child2 = sibling;
+    }
+    m_Nodes[static_cast<size_t>(sibling)].Parent = grandParent;
+    FreeNode(parent);
+
+    int32_t index = grandParent;
+    while (index != kNullNode) {
+        index = Balance(index);
+        Node& node = m_Nodes[static_cast<size_t>(index)];
+        const Node& child1 = m_Nodes[static_cast<size_t>(node.Child1)];
+        const Node& child2 = m_Nodes[static_cast<size_t>(node.Child2)];
+        node.Bounds = AABB::Union(child1.Bounds, child2.Bounds);
+        node.Height = 1 + std::max(child1.Height, child2.Height);
+        index = node.Parent;
+    }
+}
+
+int32_t DynamicBVH::Balance(int32_t indexA) {
+    // Rotate the taller grandchild up when A's subtrees differ in height by
+    // more than one. Returns the index now at A's position.
+    Node& a = m_Nodes[static_cast<size_t>(indexA)];
+    if (a.IsLeaf() || a.Height < 2) {
+        return indexA;
+    }
+
+    const int32_t indexB = a.Child1;
+    const int32_t indexC = a.Child2;
+    Node& b = m_Nodes[static_cast<size_t>(indexB)];
+    Node& c = m_Nodes[static_cast<size_t>(indexC)];
+    const int32_t balance = c.Height - b.Height;
+
+    auto rotateUp = [&](int32_t indexUp, Node& up, Node& other, bool upIsChild2) -> int32_t {
+        // 'up' takes A's place; A keeps 'other' and the shorter of up's children.
+        const int32_t indexF = up.Child1;
+        const int32_t indexG = up.Child2;
+        Node& f = m_Nodes[static_cast<size_t>(indexF)];
+        Node& g = m_Nodes[static_cast<size_t>(indexG)];
+
+        up.Child1 = indexA;
+        up.Parent = a.Parent;
+        a.Parent = indexUp;
+
+        if (up.Parent != kNullNode) {
+            Node& upParent = m_Nodes[static_cast<size_t>(up.Parent)];
+            if (upParent.Child1 == indexA) {
+                upParent.Child1 = indexUp;
+            } else {
+                upParent.Child2 = indexUp;
+            }
+        } else {
+            m_Root = indexUp;
+        }
+
+        const bool keepF = f.Height > g.Height;
+        const int32_t indexKept = keepF ? indexF : indexG;
+        const int32_t indexMoved = keepF ? indexG : indexF;
+        Node& kept = keepF ? f : g;
+        Node& moved = keepF ? g : f;
+
+        up.Child2 = indexKept;
+        if (upIsChild2) {
+            a.Child2 = indexMoved;
+        } else {
+            a.Child1 = indexMoved;
+        }
+        moved.Parent = indexA;
+        a.Bounds = AABB::Union(other.Bounds, moved.Bounds);
+        up.Bounds = AABB::Union(a.Bounds, kept.Bounds);
+        a.Height = 1 + std::max(other.Height, moved.Height);
+        up.Height = 1 + std::max(a.Height, kept.Height);
+        return indexUp;
+    };
+
+    if (balance > 1) {
+        return rotateUp(indexC, c, b, true);
+    }
+    if (balance < -1) {
+        return rotateUp(indexB, b, c, false);
+    }
+    return indexA;
+}
+
+} // namespace Zgine
@@ -0,0 +1,76 @@
+#include <Zgine/Renderer/Culling/Frustum.h>
+#include <cmath>
+
+namespace Zgine {
+
+AABB AABB::Transform(const AABB& local, const Math::Matrix4& transform) {
+    // Arvo: transform the center, then widen by |M| applied to the extents.
+    const Math::Vector3 center = local.GetCenter();
+    const Math::Vector3 extents = local.GetExtents();
+
+    float worldCenter[3];
+    float worldExtents[3];
+    for (int row = 0; row < 3; ++row) {
+        worldCenter[row] = transform(row, 0) * center.x + transform(row, 1) * center.y
+                         + transform(row, 2) * center.z + transform(row, 3);
+        worldExtents[row] = std::fabs(transform(row, 0)) * extents.x + std::fabs(transform(row, 1)) * extents.y
+                          + std::fabs(transform(row, 2)) * extents.z;
+    }
+
+    return AABB(Math::Vector3(worldCenter[0] - worldExtents[0], worldCenter[1] - worldExtents[1], worldCenter[2] - worldExtents[2]),
+                Math::Vector3(worldCenter[0] + worldExtents[0], worldCenter[1] + worldExtents[1], worldCenter[2] + worldExtents[2]));
+}
+
+Frustum Frustum::FromMatrix(const Math::Matrix4& viewProjection) {
+    // Gribb-Hartmann: each clip plane is row 3 plus or minus row 0, 1 or 2.
+    const Math::Matrix4& m = viewProjection;
+    auto row = [&m](int r) { return Plane{m(r, 0), m(r, 1), m(r, 2), m(r, 3)}; };
+    const Plane r0 = row(0);
+    const Plane r1 = row(1);
+    const Plane r2 = row(2);
+    const Plane r3 = row(3);
+
+    auto combine = [](const Plane& a, const Plane& b, float sign) {
+        Plane plane{a.X + sign * b.X, a.Y + sign * b.Y, a.Z + sign * b.Z, a.W + sign * b.W};
+        const float length = std::sqrt(plane.X * plane.X + plane.Y * plane.Y + plane.Z * plane.Z);
+        if (length > 0.0f) {
+            const float inv = 1.0f / length;
+            plane.X *= inv;
+            plane.Y *= inv;
+            plane.Z *= inv;
+            plane.W *= inv;
+        }
+        return plane;
+    };
+
+    Frustum frustum;
+    frustum.m_Planes[0] = combine(r3, r0, 1.0f);  // left
+    frustum.m_Planes[1] = combine(r3, r0, -1.0f); // right
+    frustum.m_Planes[2] = combine(r3, r1, 1.0f);  // bottom
+    frustum.m_Planes[3] = combine(r3, r1, -1.0f); // top
+    frustum.m_Planes[4] = combine(r3, r2, 1.0f);  // near
+    frustum.m_Planes[5] = combine(r3, r2, -1.0f); // far
+    return frustum;
+}
+
+FrustumTest Frustum::Test(const AABB& box) const {
+    const Math::Vector3 center = box.GetCenter();
+    const Math::Vector3 extents = box.GetExtents();
+
+    FrustumTest result = FrustumTest::Inside;
+    for (const Plane& plane : m_Planes) {
+        // Signed distance of the center and the box's projected radius.
+        const float distance = plane.X * center.x + plane.Y * center.y + plane.Z * center.z + plane.W;
+        const float radius = std::fabs(plane.X) * extents.x + std::fabs(plane.Y) * extents.y
+                           + std::fabs(plane.Z) * extents.z;
+        if (distance < -radius) {
+            return FrustumTest::Outside;
+        }
+        if (distance < radius) {
+            result = FrustumTest::Intersects;
+        }
+    }
+    return result;
+}
+
+} // namespace Zgine
@@ -0,0 +1,134 @@
+#include <Zgine/Renderer/Culling/SceneCuller.h>
+#include <Zgine/World/Core/World.h>
+#include <Zgine/World/Components/Components.h>
+#include <Zgine/Resources/Core/Asset.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <World/Core/WorldRegistryAccess.h>
+
+namespace Zgine {
+
+AABB SceneCuller::GetLocalBounds(PrimitiveType type) {
+    // Every built-in primitive is modelled inside the unit cube around the
+    // origin; the plane is flat at y = 0.
+    switch (type) {
+        case PrimitiveType::Plane:
+            return AABB(Math::Vector3(-0.5f, 0.0f, -0.5f), Math::Vector3(0.5f, 0.0f, 0.5f));
+        default:
+            return AABB(Math::Vector3(-0.5f), Math::Vector3(0.5f));
+    }
+}
+
+AABB SceneCuller::GetLocalBounds(const MeshAsset& mesh) {
+    const auto& meshes = mesh.GetMeshes();
+    if (meshes.empty()) {
+        return AABB();
+    }
+    AABB bounds = meshes.front()->GetBounds();
+    for (const auto& subMesh : meshes) {
+        bounds = AABB::Union(bounds, subMesh->GetBounds());
+    }
+    return bounds;
+}
+
+size_t SceneCuller::Sync(World& world) {
+    // Transform versions are only comparable within one registry.
+    if (m_World != &world) {
+        Clear();
+        m_World = &world;
+    }
+
+    auto& registry = Internal::GetRegistry(world);
+    size_t changes = 0;
+
+    // Stamp 0 marks a record that has never been synced.
+    if (++m_SyncStamp == 0) {
+        m_SyncStamp = 1;
+    }
+
+    // Creates or moves the proxy of one entity; bounds are only computed when
+    // its transform, primitive or mesh changed.
+    auto syncEntity = [&](entt::entity entity, PrimitiveType type, const MeshAsset* mesh, auto&& getLocalBounds) {
+        const auto* worldTransform = registry.try_get<WorldTransformComponent>(entity);
+        const bool cached = worldTransform && worldTransform->IsValid();
+        const uint32_t version = cached ? worldTransform->Version : 0;
+        const uint32_t value = static_cast<uint32_t>(entity);
+
+        auto [it, inserted] = m_RecordIndex.try_emplace(value, static_cast<uint32_t>(m_Records.size()));
+        if (inserted) {
+            m_Records.push_back(Record{value});
+        }
+        Record& record = m_Records[it->second];
+        record.SyncStamp = m_SyncStamp;
+
+        // Entities without a resolved world transform are re-evaluated every frame.
+        if (!inserted && cached && record.TransformVersion == version
+            && record.Type == type && record.Mesh == mesh) {
+            return;
+        }
+
+        const Math::Matrix4 worldMatrix = cached
+            ? worldTransform->WorldMatrix
+            : registry.get<TransformComponent>(entity).GetTransform();
+        const AABB bounds = AABB::Transform(getLocalBounds(), worldMatrix);
+
+        if (record.Proxy == DynamicBVH::kNullProxy) {
+            record.Proxy = m_Tree.CreateProxy(bounds, value);
+            ++changes;
+        } else if (m_Tree.MoveProxy(record.Proxy, bounds)) {
+            ++changes;
+        }
+        record.TransformVersion = version;
+        record.Type = type;
+        record.Mesh = mesh;
+    };
+
+    auto primitives = registry.view<TransformComponent, PrimitiveComponent>();
+    for (auto entity : primitives) {
+        const PrimitiveType type = primitives.get<PrimitiveComponent>(entity).Type;
+        syncEntity(entity, type, nullptr, [type]() { return GetLocalBounds(type); });
+    }
+
+    // Meshes are tracked once loaded; primitives take precedence.
+    auto meshes = registry.view<TransformComponent, MeshComponent>(entt::exclude<PrimitiveComponent>);
+    for (auto entity : meshes) {
+        const MeshAsset* mesh = meshes.get<MeshComponent>(entity).LoadedMesh.get();
+        if (mesh) {
+            syncEntity(entity, PrimitiveType::None, mesh, [mesh]() { return GetLocalBounds(*mesh); });
+        }
+    }
+
+    // Sweep entities that were destroyed or lost their components.
+    for (size_t i = 0; i < m_Records.size();) {
+        if (m_Records[i].SyncStamp == m_SyncStamp) {
+            ++i;
+            continue;
+        }
+
+        m_Tree.DestroyProxy(m_Records[i].Proxy);
+        m_RecordIndex.erase(m_Records[i].Entity);
+        if (i + 1 != m_Records.size()) {
+            m_Records[i] = m_Records.back();
+            m_RecordIndex[m_Records[i].Entity] = static_cast<uint32_t>(i);
+        }
+        m_Records.pop_back();
+        ++changes;
+    }
+
+    return changes;
+}
+
+size_t SceneCuller::Cull(const Frustum& frustum, std::vector<uint32_t>& outEntities) const {
+    return m_Tree.Query(frustum, [&outEntities](uint32_t entity) {
+        outEntities.push_back(entity);
+    });
+}
+
+void SceneCuller::Clear() {
+    m_Tree.Clear();
+    m_Records.clear();
+    m_RecordIndex.clear();
+    m_SyncStamp = 0;
+    m_World = nullptr;
+}
+
+} // namespace Zgine
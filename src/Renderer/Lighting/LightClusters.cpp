@@ -0,0 +1,279 @@
+#include <Zgine/Renderer/Lighting/LightClusters.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Core/Math/Vector4.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Zgine {
+
+namespace {
+    constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+    // Column-major element (row, col).
+    float At(const Math::Matrix4& m, int row, int col) {
+        return m.m[col * 4 + row];
+    }
+
+    // View-space coordinate along one axis of the point at NDC @p ndc and
+    // view depth @p depth. Exact for the projections Matrix4 builds
+    // (perspective and orthographic, possibly off-center).
+    float Unproject(const Math::Matrix4& projection, int axis, float ndc, float depth) {
+        const float z = -depth;
+        const float w = At(projection, 3, 2) * z + At(projection, 3, 3);
+        return (ndc * w - At(projection, axis, 2) * z - At(projection, axis, 3)) / At(projection, axis, axis);
+    }
+
+    float AxisDistance(float value, float min, float max) {
+        return value < min ? min - value : value > max ? value - max : 0.0f;
+    }
+
+    bool SphereOverlaps(const AABB& box, const Math::Vector3& center, float radius) {
+        const float dx = AxisDistance(center.x, box.Min.x, box.Max.x);
+        const float dy = AxisDistance(center.y, box.Min.y, box.Max.y);
+        const float dz = AxisDistance(center.z, box.Min.z, box.Max.z);
+        return dx * dx + dy * dy + dz * dz <= radius * radius;
+    }
+
+    void Store(float (&out)[3], const Math::Vector3& value, float scale = 1.0f) {
+        out[0] = value.x * scale;
+        out[1] = value.y * scale;
+        out[2] = value.z * scale;
+    }
+}
+
+LightClusters::LightClusters(const ClusterGridConfig& config)
+    : m_Config(config) {
+    m_Config.TilesX = std::max(m_Config.TilesX, 1u);
+    m_Config.TilesY = std::max(m_Config.TilesY, 1u);
+    m_Config.Slices = std::max(m_Config.Slices, 1u);
+    m_Bounds.resize(GetClusterCount());
+    m_Cells.resize(GetClusterCount());
+    m_SliceOffsets.resize(m_Config.Slices);
+    m_SliceIndices.resize(m_Config.Slices);
+    m_SliceLights.resize(m_Config.Slices);
+}
+
+float LightClusters::ComputeLightRange(const Math::Vector3& color, float intensity,
+                                       float constant, float linear, float quadratic) {
+    const float peak = std::max({ color.x, color.y, color.z }) * intensity;
+    if (peak <= 0.0f) {
+        return 0.0f;
+    }
+
+    // Solve quadratic * d^2 + linear * d + constant = peak / kLightCutoff.
+    const float target = peak / kLightCutoff;
+    if (constant >= target) {
+        return 0.0f;
+    }
+
+    float range = kMaxLightRange;
+    if (quadratic > 0.0f) {
+        const float discriminant = linear * linear - 4.0f * quadratic * (constant - target);
+        range = (-linear + std::sqrt(discriminant)) / (2.0f * quadratic);
+    } else if (linear > 0.0f) {
+        range = (target - constant) / linear;
+    }
+    return std::min(range, kMaxLightRange);
+}
+
+uint32_t LightClusters::GetSlice(float depth) const {
+    if (depth <= m_SliceNear) {
+        return 0;
+    }
+    const float slice = std::floor(std::log(depth / m_SliceNear) * m_SliceScale);
+    return std::min(static_cast<uint32_t>(slice), m_Config.Slices - 1);
+}
+
+uint32_t LightClusters::FindCluster(const Math::Vector3& viewPosition) const {
+    const Math::Vector4 clip = m_Projection * Math::Vector4(viewPosition.x, viewPosition.y, viewPosition.z, 1.0f);
+    auto tile = [](float ndc, uint32_t tiles) {
+        const float t = std::floor((ndc * 0.5f + 0.5f) * static_cast<float>(tiles));
+        return static_cast<uint32_t>(std::clamp(t, 0.0f, static_cast<float>(tiles - 1)));
+    };
+    return GetClusterIndex(tile(clip.x / clip.w, m_Config.TilesX), tile(clip.y / clip.w, m_Config.TilesY),
+        GetSlice(-viewPosition.z));
+}
+
+void LightClusters::UpdateBounds(const Math::Matrix4& projection, float nearPlane, float farPlane) {
+    if (m_BoundsValid && nearPlane == m_Near && farPlane == m_Far
+        && std::memcmp(projection.m, m_Projection.m, sizeof(projection.m)) == 0) {
+        return;
+    }
+
+    m_Projection = projection;
+    m_Near = nearPlane;
+    m_Far = farPlane;
+    m_SliceNear = std::max(nearPlane, kMinClusterNear);
+    const float sliceFar = std::max(farPlane, m_SliceNear * 2.0f);
+    m_SliceScale = static_cast<float>(m_Config.Slices) / std::log(sliceFar / m_SliceNear);
+
+    const float tileWidth = 2.0f / static_cast<float>(m_Config.TilesX);
+    const float tileHeight = 2.0f / static_cast<float>(m_Config.TilesY);
+    for (uint32_t slice = 0; slice < m_Config.Slices; ++slice) {
+        // Depths outside [near, far] are clamped into the first and last slice.
+        const float depth0 = slice == 0
+            ? std::min(nearPlane, m_SliceNear)
+            : m_SliceNear * std::exp(static_cast<float>(slice) / m_SliceScale);
+        const float depth1 = slice + 1 == m_Config.Slices
+            ? sliceFar
+            : m_SliceNear * std::exp(static_cast<float>(slice + 1) / m_SliceScale);
+
+        for (uint32_t y = 0; y < m_Config.TilesY; ++y) {
+            const float ndcY0 = -1.0f + tileHeight * static_cast<float>(y);
+            for (uint32_t x = 0; x < m_Config.TilesX; ++x) {
+                const float ndcX0 = -1.0f + tileWidth * static_cast<float>(x);
+
+                // The view-space coordinates are bilinear in (ndc, depth), so
+                // the extremes are at the corners.
+                AABB bounds(Math::Vector3(kInfinity, kInfinity, -depth1), Math::Vector3(-kInfinity, -kInfinity, -depth0));
+                for (float depth : { depth0, depth1 }) {
+                    for (float ndcX : { ndcX0, ndcX0 + tileWidth }) {
+                        const float vx = Unproject(projection, 0, ndcX, depth);
+                        bounds.Min.x = std::min(bounds.Min.x, vx);
+                        bounds.Max.x = std::max(bounds.Max.x, vx);
+                    }
+                    for (float ndcY : { ndcY0, ndcY0 + tileHeight }) {
+                        const float vy = Unproject(projection, 1, ndcY, depth);
+                        bounds.Min.y = std::min(bounds.Min.y, vy);
+                        bounds.Max.y = std::max(bounds.Max.y, vy);
+                    }
+                }
+                m_Bounds[GetClusterIndex(x, y, slice)] = bounds;
+            }
+        }
+    }
+    m_BoundsValid = true;
+}
+
+void LightClusters::Build(const LightingData& lights, const Math::Matrix4& view, const Math::Matrix4& projection,
+                          float nearPlane, float farPlane, JobSystem* jobs) {
+    UpdateBounds(projection, nearPlane, farPlane);
+
+    m_Lights.clear();
+    m_Spheres.clear();
+    m_Lights.reserve(lights.points.size() + lights.spots.size());
+    m_Spheres.reserve(lights.points.size() + lights.spots.size());
+
+    // Spot lights are bounded by the sphere of their range, not their cone.
+    auto addLight = [&](const Math::Vector3& position, const Math::Vector3& color, float intensity,
+                        float constant, float linear, float quadratic) -> ClusterLight* {
+        const float range = ComputeLightRange(color, intensity, constant, linear, quadratic);
+        if (range <= 0.0f) {
+            return nullptr;
+        }
+        const Math::Vector4 center = view * Math::Vector4(position.x, position.y, position.z, 1.0f);
+        m_Spheres.push_back({ Math::Vector3(center.x, center.y, center.z), range });
+
+        ClusterLight& light = m_Lights.emplace_back(); // value-initialized: a point light
+        Store(light.Position, position);
+        Store(light.Color, color, intensity);
+        light.Range = range;
+        light.Constant = constant;
+        light.Linear = linear;
+        light.Quadratic = quadratic;
+        return &light;
+    };
+
+    for (const PointLightData& point : lights.points) {
+        addLight(point.position, point.color, point.intensity, point.constant, point.linear, point.quadratic);
+    }
+    for (const SpotLightData& spot : lights.spots) {
+        if (ClusterLight* light = addLight(spot.position, spot.color, spot.intensity,
+                                           spot.constant, spot.linear, spot.quadratic)) {
+            light->Type = 1.0f;
+            Store(light->Direction, spot.direction);
+            light->CutOff = spot.cutOff;
+            light->OuterCutOff = spot.outerCutOff;
+        }
+    }
+
+    // Every slice owns a contiguous run of clusters and its own index list,
+    // so slices fill without synchronization and are packed afterwards.
+    const uint32_t slices = m_Config.Slices;
+    if (jobs) {
+        jobs->ParallelFor(0, slices, 1, [this](uint32_t begin, uint32_t end) { FillSlices(begin, end); });
+    } else {
+        FillSlices(0, slices);
+    }
+
+    uint32_t total = 0;
+    for (uint32_t slice = 0; slice < slices; ++slice) {
+        m_SliceOffsets[slice] = total;
+        total += static_cast<uint32_t>(m_SliceIndices[slice].size());
+    }
+    m_Indices.resize(total);
+
+    if (jobs) {
+        jobs->ParallelFor(0, slices, 1, [this](uint32_t begin, uint32_t end) { PackSlices(begin, end); });
+    } else {
+        PackSlices(0, slices);
+    }
+}
+
+void LightClusters::FillSlices(uint32_t firstSlice, uint32_t lastSlice) {
+    const uint32_t lightCount = static_cast<uint32_t>(m_Spheres.size());
+    for (uint32_t slice = firstSlice; slice < lastSlice; ++slice) {
+        std::vector<uint32_t>& indices = m_SliceIndices[slice];
+        std::vector<uint32_t>& candidates = m_SliceLights[slice];
+        indices.clear();
+        candidates.clear();
+
+        // Narrow the lights down per slice, then per row of tiles, before
+        // the box test per cluster. Row candidates are appended after the
+        // slice candidates in the same scratch list.
+        const AABB& sliceBounds = m_Bounds[GetClusterIndex(0, 0, slice)];
+        for (uint32_t light = 0; light < lightCount; ++light) {
+            const Sphere& sphere = m_Spheres[light];
+            if (sphere.Center.z - sphere.Radius <= sliceBounds.Max.z && sphere.Center.z + sphere.Radius >= sliceBounds.Min.z) {
+                candidates.push_back(light);
+            }
+        }
+        const size_t sliceCandidates = candidates.size();
+
+        for (uint32_t y = 0; y < m_Config.TilesY; ++y) {
+            AABB rowBounds = m_Bounds[GetClusterIndex(0, y, slice)];
+            for (uint32_t x = 1; x < m_Config.TilesX; ++x) {
+                rowBounds = AABB::Union(rowBounds, m_Bounds[GetClusterIndex(x, y, slice)]);
+            }
+            candidates.resize(sliceCandidates);
+            for (size_t i = 0; i < sliceCandidates; ++i) {
+                const Sphere& sphere = m_Spheres[candidates[i]];
+                if (SphereOverlaps(rowBounds, sphere.Center, sphere.Radius)) {
+                    candidates.push_back(candidates[i]);
+                }
+            }
+
+            for (uint32_t x = 0; x < m_Config.TilesX; ++x) {
+                const uint32_t cluster = GetClusterIndex(x, y, slice);
+                const AABB& bounds = m_Bounds[cluster];
+                ClusterCell& cell = m_Cells[cluster];
+                cell.Offset = static_cast<uint32_t>(indices.size());
+                for (size_t i = sliceCandidates; i < candidates.size(); ++i) {
+                    const Sphere& sphere = m_Spheres[candidates[i]];
+                    if (SphereOverlaps(bounds, sphere.Center, sphere.Radius)) {
+                        indices.push_back(candidates[i]);
+                    }
+                }
+                cell.Count = static_cast<uint32_t>(indices.size()) - cell.Offset;
+            }
+        }
+    }
+}
+
+void LightClusters::PackSlices(uint32_t firstSlice, uint32_t lastSlice) {
+    const uint32_t clustersPerSlice = m_Config.TilesX * m_Config.TilesY;
+    for (uint32_t slice = firstSlice; slice < lastSlice; ++slice) {
+        const std::vector<uint32_t>& indices = m_SliceIndices[slice];
+        const uint32_t offset = m_SliceOffsets[slice];
+        std::copy(indices.begin(), indices.end(), m_Indices.begin() + offset);
+
+        ClusterCell* cells = m_Cells.data() + slice * clustersPerSlice;
+        for (uint32_t i = 0; i < clustersPerSlice; ++i) {
+            cells[i].Offset += offset;
+        }
+    }
+}
+
+} // namespace Zgine
@@ -0,0 +1,113 @@
+#include <Zgine/Renderer/Lighting/ShadowCascades.h>
+#include <Zgine/Core/Math/Vector4.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Zgine {
+
+namespace {
+    // Shadow boxes grow in these steps so float noise in the slice corners
+    // cannot change the texel size from frame to frame.
+    constexpr float kRadiusQuantum = 1.0f / 16.0f;
+
+    Math::Vector3 ToVector3(const Math::Vector4& v) {
+        return Math::Vector3(v.x / v.w, v.y / v.w, v.z / v.w);
+    }
+
+    Math::Vector3 Mix(const Math::Vector3& a, const Math::Vector3& b, float t) {
+        return Math::Vector3(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t);
+    }
+
+    float DistanceSq(const Math::Vector3& a, const Math::Vector3& b) {
+        const float dx = a.x - b.x;
+        const float dy = a.y - b.y;
+        const float dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+}
+
+float ComputeCascadeSplit(uint32_t index, uint32_t count, float nearPlane, float farPlane, float lambda) {
+    const float fraction = static_cast<float>(index + 1) / static_cast<float>(std::max(count, 1u));
+    const float uniform = nearPlane + (farPlane - nearPlane) * fraction;
+    const float logarithmic = nearPlane * std::pow(farPlane / nearPlane, fraction);
+    return uniform + (logarithmic - uniform) * std::clamp(lambda, 0.0f, 1.0f);
+}
+
+uint32_t FitShadowCascades(const ShadowCascadeSettings& settings, const Math::Matrix4& view,
+                           const Math::Matrix4& projection, float nearPlane, float farPlane,
+                           const Math::Vector3& lightDirection,
+                           std::array<ShadowCascade, kMaxShadowCascades>& out) {
+    const uint32_t count = std::clamp(settings.CascadeCount, 1u, kMaxShadowCascades);
+    const float resolution = static_cast<float>(std::max(settings.Resolution, 1u));
+    const float splitNear = std::max(nearPlane, 0.01f);
+    const float splitFar = std::max(std::min(farPlane, settings.MaxDistance), splitNear * 2.0f);
+
+    // World-space corners of the frustum at the near and far clip planes;
+    // view depth is linear along each edge, so any slice is a lerp of them.
+    const Math::Matrix4 inverseViewProjection = Math::Inverse(projection * view);
+    Math::Vector3 nearCorners[4];
+    Math::Vector3 farCorners[4];
+    for (int i = 0; i < 4; ++i) {
+        const float x = (i & 1) ? 1.0f : -1.0f;
+        const float y = (i & 2) ? 1.0f : -1.0f;
+        nearCorners[i] = ToVector3(inverseViewProjection * Math::Vector4(x, y, -1.0f, 1.0f));
+        farCorners[i] = ToVector3(inverseViewProjection * Math::Vector4(x, y, 1.0f, 1.0f));
+    }
+    auto viewDepth = [&view](const Math::Vector3& p) {
+        return -(view(2, 0) * p.x + view(2, 1) * p.y + view(2, 2) * p.z + view(2, 3));
+    };
+    const float clipNear = viewDepth(nearCorners[0]);
+    const float clipFar = viewDepth(farCorners[0]);
+
+    const Math::Vector3 direction = Math::Normalize(lightDirection);
+    const Math::Vector3 up = std::abs(direction.y) > 0.99f ? Math::Vector3(0.0f, 0.0f, 1.0f) : Math::Vector3(0.0f, 1.0f, 0.0f);
+
+    float sliceStart = splitNear;
+    for (uint32_t cascade = 0; cascade < count; ++cascade) {
+        const float sliceEnd = ComputeCascadeSplit(cascade, count, splitNear, splitFar, settings.SplitLambda);
+
+        Math::Vector3 corners[8];
+        const float t0 = (sliceStart - clipNear) / (clipFar - clipNear);
+        const float t1 = (sliceEnd - clipNear) / (clipFar - clipNear);
+        Math::Vector3 center(0.0f);
+        for (int i = 0; i < 4; ++i) {
+            corners[i] = Mix(nearCorners[i], farCorners[i], t0);
+            corners[i + 4] = Mix(nearCorners[i], farCorners[i], t1);
+        }
+        for (const Math::Vector3& corner : corners) {
+            center = center + corner;
+        }
+        center = center / 8.0f;
+
+        float radiusSq = 0.0f;
+        for (const Math::Vector3& corner : corners) {
+            radiusSq = std::max(radiusSq, DistanceSq(corner, center));
+        }
+        const float radius = std::ceil(std::sqrt(radiusSq) / kRadiusQuantum) * kRadiusQuantum;
+
+        const float pullBack = radius + settings.CasterDistance;
+        const Math::Matrix4 lightView = Math::Matrix4::LookAt(center - direction * pullBack, center, up);
+        Math::Matrix4 lightProjection = Math::Matrix4::Ortho(-radius, radius, -radius, radius, 0.0f, pullBack + radius);
+
+        // Shift the box so the world origin lands on a texel corner; with a
+        // fixed size and orientation every texel then stays put as the
+        // camera moves.
+        const Math::Vector4 origin = (lightProjection * lightView) * Math::Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+        const float halfResolution = resolution * 0.5f;
+        const float texelX = origin.x * halfResolution;
+        const float texelY = origin.y * halfResolution;
+        lightProjection(0, 3) += (std::round(texelX) - texelX) / halfResolution;
+        lightProjection(1, 3) += (std::round(texelY) - texelY) / halfResolution;
+
+        ShadowCascade& result = out[cascade];
+        result.ViewProjection = lightProjection * lightView;
+        result.Center = center;
+        result.Radius = radius;
+        result.SplitNear = sliceStart;
+        result.SplitFar = sliceEnd;
+        sliceStart = sliceEnd;
+    }
+    return count;
+}
+
+} // namespace Zgine
@@ -0,0 +1,100 @@
+#include <Zgine/Renderer/Pipeline/MeshArena.h>
+#include <Zgine/Renderer/RHI/VertexArray.h>
+#include <Zgine/Renderer/RHI/VertexBuffer.h>
+#include <Zgine/Renderer/RHI/IndexBuffer.h>
+#include <Zgine/Core/Log/Log.h>
+#include <algorithm>
+#include <utility>
+
+namespace Zgine {
+
+MeshArena::MeshArena(BufferLayout layout, uint32_t pageVertices, uint32_t pageIndices)
+    : m_Layout(std::move(layout))
+    , m_PageVertices(std::max(pageVertices, 1u))
+    , m_PageIndices(std::max(pageIndices, 1u))
+{
+}
+
+MeshArena::~MeshArena() = default;
+
+bool MeshArena::CreatePage(uint32_t vertexCapacity, uint32_t indexCapacity) {
+    Page page;
+    page.Vertices = VertexBuffer::Create(vertexCapacity * m_Layout.GetStride());
+    page.Indices = IndexBuffer::Create(indexCapacity);
+    page.Array = VertexArray::Create();
+    if (!page.Vertices || !page.Indices || !page.Array) {
+        return false;
+    }
+
+    page.Vertices->SetLayout(m_Layout);
+    page.Array->AddVertexBuffer(page.Vertices);
+    page.Array->SetIndexBuffer(page.Indices);
+    page.Array->Unbind();
+    page.VertexRanges.Reset(vertexCapacity);
+    page.IndexRanges.Reset(indexCapacity);
+    m_Pages.push_back(std::move(page));
+
+    ZGINE_CORE_TRACE("MeshArena: created page {} ({} vertices, {} indices)",
+        m_Pages.size() - 1, vertexCapacity, indexCapacity);
+    return true;
+}
+
+MeshRange MeshArena::Allocate(const void* vertices, uint32_t vertexCount,
+                              const uint32_t* indices, uint32_t indexCount) {
+    if (vertexCount == 0 || indexCount == 0) {
+        return {};
+    }
+
+    // First page with room for both ranges; otherwise open a new one.
+    for (uint32_t index = 0;; ++index) {
+        if (index == m_Pages.size()
+            && !CreatePage(std::max(vertexCount, m_PageVertices), std::max(indexCount, m_PageIndices))) {
+            ZGINE_CORE_ERROR("MeshArena: failed to create buffers for a mesh of {} vertices.", vertexCount);
+            return {};
+        }
+
+        Page& page = m_Pages[index];
+        const uint32_t baseVertex = page.VertexRanges.Allocate(vertexCount);
+        if (baseVertex == RangeAllocator::kInvalidOffset) {
+            continue;
+        }
+        const uint32_t firstIndex = page.IndexRanges.Allocate(indexCount);
+        if (firstIndex == RangeAllocator::kInvalidOffset) {
+            page.VertexRanges.Free(baseVertex, vertexCount);
+            continue;
+        }
+
+        const uint32_t stride = m_Layout.GetStride();
+        page.Vertices->SetSubData(vertices, vertexCount * stride, baseVertex * stride);
+        page.Indices->SetSubData(indices, indexCount, firstIndex);
+
+        MeshRange range;
+        range.Array = page.Array.get();
+        range.Page = index;
+        range.BaseVertex = baseVertex;
+        range.VertexCount = vertexCount;
+        range.FirstIndex = firstIndex;
+        range.IndexCount = indexCount;
+        return range;
+    }
+}
+
+void MeshArena::Free(const MeshRange& range) {
+    if (!range.IsValid() || range.Page >= m_Pages.size()) {
+        return;
+    }
+
+    Page& page = m_Pages[range.Page];
+    page.VertexRanges.Free(range.BaseVertex, range.VertexCount);
+    page.IndexRanges.Free(range.FirstIndex, range.IndexCount);
+}
+
+uint32_t MeshArena::GetVertexCount() const noexcept {
+    uint32_t count = 0;
+    for (const Page& page : m_Pages) {
+        count += page.VertexRanges.GetUsed();
+    }
+    return count;
+}
+
+} // namespace Zgine
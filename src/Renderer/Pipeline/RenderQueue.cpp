@@ -0,0 +1,118 @@
+#include <Zgine/Renderer/Pipeline/RenderQueue.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Zgine {
+
+namespace SortKey {
+
+uint32_t QuantizeDepth(float depth) {
+    if (!(depth > 0.0f)) {
+        return 0; // also catches NaN
+    }
+    uint32_t bits = 0;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    // Sign bit is zero; keep the exponent and the leading mantissa bits.
+    return bits >> (31 - kDepthBits);
+}
+
+} // namespace SortKey
+
+void SortDrawPackets(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch) {
+    const size_t count = packets.size();
+    if (count < 2) {
+        return;
+    }
+
+    // One pass builds the histograms of all eight key bytes.
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (const DrawPacket& packet : packets) {
+        for (uint32_t digit = 0; digit < 8; ++digit) {
+            ++histograms[digit][(packet.Key >> (digit * 8)) & 0xFF];
+        }
+    }
+
+    scratch.resize(count);
+    DrawPacket* source = packets.data();
+    DrawPacket* destination = scratch.data();
+    for (uint32_t digit = 0; digit < 8; ++digit) {
+        std::array<uint32_t, 256>& histogram = histograms[digit];
+
+        // Every key shares this byte: the pass would be an identity copy.
+        const uint32_t firstByte = static_cast<uint32_t>((source[0].Key >> (digit * 8)) & 0xFF);
+        if (histogram[firstByte] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram) {
+            const uint32_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t byte = static_cast<uint32_t>((source[i].Key >> (digit * 8)) & 0xFF);
+            destination[histogram[byte]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != packets.data()) {
+        packets.swap(scratch);
+    }
+}
+
+BufferLayout InstanceData::GetLayout() {
+    return BufferLayout({
+        { ShaderDataType::Mat4, "a_InstanceTransform" },
+        { ShaderDataType::Mat3, "a_InstanceNormalMatrix" },
+        { ShaderDataType::Float4, "a_InstanceMaterial" },
+        { ShaderDataType::Float4, "a_InstanceSurface" },
+    }, VertexStepRate::PerInstance);
+}
+
+void RenderQueue::Clear() {
+    m_Packets.clear();
+    m_Items.clear();
+}
+
+void RenderQueue::Reserve(size_t count) {
+    m_Packets.reserve(count);
+    m_Items.reserve(count);
+}
+
+void RenderQueue::Push(uint64_t key, const DrawItem& item) {
+    if (!item.ShaderProgram || !item.Mesh) {
+        return;
+    }
+    m_Packets.push_back(DrawPacket{key, static_cast<uint32_t>(m_Items.size())});
+    m_Items.push_back(item);
+}
+
+void RenderQueue::Sort() {
+    SortDrawPackets(m_Packets, m_Scratch);
+}
+
+void RenderQueue::Partition(uint32_t maxRanges, std::vector<PacketRange>& ranges) const {
+    ranges.clear();
+    const auto count = static_cast<uint32_t>(m_Packets.size());
+    if (count == 0) {
+        return;
+    }
+
+    const uint32_t rangeCount = std::clamp(maxRanges, 1u, count);
+    const uint32_t target = (count + rangeCount - 1) / rangeCount;
+    uint32_t begin = 0;
+    while (begin < count) {
+        // Cut after the target size, then move the cut to the end of its batch.
+        uint32_t end = std::min(begin + target, count);
+        while (end < count && IsSameBatch(m_Items[m_Packets[end - 1].Item], m_Items[m_Packets[end].Item])) {
+            ++end;
+        }
+        ranges.push_back(PacketRange{begin, end});
+        begin = end;
+    }
+}
+
+} // namespace Zgine
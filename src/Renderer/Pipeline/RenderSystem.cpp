@@ -1,5 +1,7 @@
 #include <Zgine/Renderer/Pipeline/RenderSystem.h>
 #include <Zgine/Renderer/Pipeline/TextureDefaults.h>
+#include <Zgine/Renderer/Pipeline/UniformBlocks.h>
+#include <Zgine/Renderer/Pipeline/ShaderSources.h>
 #include <Zgine/World/Core/World.h>
 #include <Zgine/World/Components/Components.h>
 #include <Zgine/World/Camera/Camera.h>
@@ -9,26 +11,247 @@
 #include <Zgine/Renderer/RHI/Shader.h>
 #include <Zgine/Renderer/RHI/Texture.h>
 #include <Zgine/Renderer/RHI/VertexArray.h>
+#include <Zgine/Renderer/RHI/VertexBuffer.h>
+#include <Zgine/Renderer/RHI/UniformBuffer.h>
+#include <Zgine/Renderer/RHI/TextureBuffer.h>
 #include <Zgine/Renderer/RHI/IndexBuffer.h>
 #include <Zgine/Renderer/RHI/Framebuffer.h>
+#include <Zgine/Renderer/Culling/Frustum.h>
 #include <Zgine/Resources/Mesh/PrimitiveMesh.h>
-#include <Zgine/Platform/IO/File.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <Zgine/Resources/Mesh/MeshArenas.h>
+#include <Zgine/Resources/Core/Asset.h>
+#include <Zgine/Resources/Core/AssetManager.h>
 #include <Zgine/Core/Math/Math.h>
 #include <Zgine/Core/Math/Matrix3.h>
 #include <Zgine/Core/Math/Matrix4.h>
 #include <World/Core/WorldRegistryAccess.h>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <exception>
+#include <limits>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace Zgine {
 
 namespace {
     static std::unique_ptr<Zgine::RendererAPI> s_RendererAPI;
+
+    // Cached hierarchy-aware matrix; entities created outside EntityManager
+    // or not yet resolved fall back to their local transform.
+    Math::Matrix4 GetWorldMatrix(const entt::registry& registry, entt::entity entity,
+                                 const TransformComponent& transform) {
+        const auto* worldTransform = registry.try_get<WorldTransformComponent>(entity);
+        if (worldTransform && worldTransform->IsValid()) {
+            return worldTransform->WorldMatrix;
+        }
+        return transform.GetTransform();
+    }
+
+    Math::Vector3 GetWorldPosition(const entt::registry& registry, entt::entity entity) {
+        const auto* worldTransform = registry.try_get<WorldTransformComponent>(entity);
+        if (worldTransform && worldTransform->IsValid()) {
+            return Math::ExtractTranslation(worldTransform->WorldMatrix);
+        }
+        return registry.get<TransformComponent>(entity).Translation;
+    }
+
+    // model * translate(offset) * scale(scale): expands quantized mesh
+    // positions (see VertexFormat) in the vertex shader's model transform.
+    Math::Matrix4 FoldDequantization(const Math::Matrix4& model, const Math::Vector3& scale,
+                                     const Math::Vector3& offset) {
+        Math::Matrix4 result = model;
+        const float axes[3] = { scale.x, scale.y, scale.z };
+        for (int column = 0; column < 3; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                result.m[column * 4 + row] = model.m[column * 4 + row] * axes[column];
+            }
+        }
+        for (int row = 0; row < 4; ++row) {
+            result.m[12 + row] = model.m[row] * offset.x + model.m[4 + row] * offset.y
+                               + model.m[8 + row] * offset.z + model.m[12 + row];
+        }
+        return result;
+    }
+
+    double ElapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Clip distances of whichever projection the camera uses.
+    std::pair<float, float> GetClipPlanes(const Camera& camera) {
+        if (camera.GetProjectionType() == Camera::ProjectionType::Perspective) {
+            return { camera.GetPerspectiveNear(), camera.GetPerspectiveFar() };
+        }
+        return { camera.GetOrthographicNear(), camera.GetOrthographicFar() };
+    }
+
+    // Instances reserved up front; the buffer grows on demand.
+    constexpr uint32_t kInitialInstanceCapacity = 1024;
+
+    // Texture units: 0-4 material maps, 5 shadow map, 6-8 light clusters.
+    constexpr uint32_t kShadowMapSlot = 5;
+    constexpr uint32_t kClusterCellsSlot = 6;
+    constexpr uint32_t kClusterIndicesSlot = 7;
+    constexpr uint32_t kClusterLightsSlot = 8;
+
+    // Light buffers reserved up front; both grow on demand.
+    constexpr uint32_t kInitialClusterLightCapacity = 256;
+    constexpr uint32_t kInitialClusterIndexCapacity = 16 * 1024;
+
+    // Everything SetupMaterialUniforms reads, so equal keys mean identical
+    // texture state. Scalar parameters travel per instance and are not part
+    // of the key, which keeps differently tinted objects in one batch.
+    // Zero-initialized, so it has no padding noise.
+    struct MaterialKey {
+        uint64_t UseFlags; // 64-bit so no padding precedes Maps
+        const Texture* Maps[5];
+
+        bool operator==(const MaterialKey& other) const {
+            return std::memcmp(this, &other, sizeof(MaterialKey)) == 0;
+        }
+    };
+
+    /** @brief Tell the streamer the pixels the material's textures cover, from a screen-height fraction. */
+    void RequestTextureMips(const MaterialKey& key, float screenSize, uint32_t viewportHeight) {
+        if (key.UseFlags == 0) {
+            return;
+        }
+        TextureStreamer& streamer = AssetManager::Get().GetTextureStreamer();
+        // Clamped: a camera inside the bounds sees an unbounded size.
+        const float pixels = std::min(screenSize, 4.0f) * static_cast<float>(viewportHeight);
+        for (const Texture* map : key.Maps) {
+            if (map) {
+                streamer.Request(map, pixels);
+            }
+        }
+    }
+
+    struct MaterialKeyHash {
+        size_t operator()(const MaterialKey& key) const {
+            // FNV-1a over the raw bytes.
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&key);
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < sizeof(MaterialKey); ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    MaterialKey MakeMaterialKey(const PBRMaterialComponent* material) {
+        MaterialKey key{};
+        if (!material) {
+            return key;
+        }
+
+        const std::pair<bool, const std::shared_ptr<Texture>*> maps[] = {
+            { material->UseAlbedoTexture, &material->AlbedoTexture },
+            { material->UseNormalTexture, &material->NormalTexture },
+            { material->UseMetallicTexture, &material->MetallicTexture },
+            { material->UseRoughnessTexture, &material->RoughnessTexture },
+            { material->UseAOTexture, &material->AOTexture },
+        };
+        for (size_t i = 0; i < 5; ++i) {
+            if (maps[i].first && *maps[i].second) {
+                key.UseFlags |= 1ull << i;
+                key.Maps[i] = maps[i].second->get();
+            }
+        }
+        return key;
+    }
+
+    void SetInstanceMaterial(InstanceData& instance, const PBRMaterialComponent* material, bool pbr) {
+        const Math::Vector3 albedo = material ? material->Albedo : Math::Vector3(0.8f, 0.8f, 0.8f);
+        instance.Material[0] = albedo.x;
+        instance.Material[1] = albedo.y;
+        instance.Material[2] = albedo.z;
+
+        if (pbr) {
+            instance.Material[3] = material ? material->Metallic : 0.0f;
+            instance.Surface[0] = material ? material->Roughness : 0.5f;
+            instance.Surface[1] = material ? material->AO : 1.0f;
+            return;
+        }
+
+        // Blinn-Phong: map roughness to a specular exponent
+        float shininess = 32.0f;
+        if (material) {
+            const float r = std::max(material->Roughness, 0.01f);
+            shininess = std::clamp(2.0f / (r * r * r * r) - 2.0f, 2.0f, 2048.0f);
+        }
+        instance.Material[3] = shininess;
+    }
+
+    // Instance upload shared by the shadow and scene passes.
+    struct InstanceHooks {
+        const std::shared_ptr<VertexBuffer>& Buffer;
+
+        void OnInstances(const InstanceData* data, uint32_t count) {
+            Buffer->SetData(data, count * static_cast<uint32_t>(sizeof(InstanceData)));
+        }
+        void OnBatch(VertexArray& mesh, uint32_t firstInstance) { mesh.SetInstanceBuffer(Buffer, firstInstance); }
+    };
 }
 
-RenderSystem::RenderSystem() {}
+struct RenderSystem::DrawTables {
+    // Arena meshes share a vertex array and differ in their index range.
+    struct MeshKey {
+        const VertexArray* Array;
+        uint32_t FirstIndex;
+
+        bool operator==(const MeshKey& other) const {
+            return Array == other.Array && FirstIndex == other.FirstIndex;
+        }
+    };
+
+    struct MeshKeyHash {
+        size_t operator()(const MeshKey& key) const {
+            return std::hash<const void*>{}(key.Array) ^ (static_cast<size_t>(key.FirstIndex) * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    std::vector<const Shader*> Shaders;
+    std::unordered_map<MeshKey, uint32_t, MeshKeyHash> Meshes;
+    std::unordered_map<MaterialKey, uint32_t, MaterialKeyHash> Materials;
+    std::vector<uint32_t> MaterialEntities; // representative entity per material id
+
+    void Clear() {
+        Shaders.clear();
+        Meshes.clear();
+        Materials.clear();
+        MaterialEntities.clear();
+    }
+
+    uint32_t GetShaderId(const Shader* shader) {
+        const auto it = std::find(Shaders.begin(), Shaders.end(), shader);
+        if (it != Shaders.end()) {
+            return static_cast<uint32_t>(it - Shaders.begin());
+        }
+        Shaders.push_back(shader);
+        return static_cast<uint32_t>(Shaders.size() - 1);
+    }
+
+    uint32_t GetMeshId(const DrawItem& item) {
+        const MeshKey key{ item.Mesh, item.FirstIndex };
+        return Meshes.try_emplace(key, static_cast<uint32_t>(Meshes.size())).first->second;
+    }
+
+    uint32_t GetMaterialId(const MaterialKey& key, uint32_t entity) {
+        const auto [it, inserted] = Materials.try_emplace(key, static_cast<uint32_t>(MaterialEntities.size()));
+        if (inserted) {
+            MaterialEntities.push_back(entity);
+        }
+        return it->second;
+    }
+};
+
+RenderSystem::RenderSystem()
+    : m_DrawTables(std::make_unique<DrawTables>()) {}
 RenderSystem::~RenderSystem() { Shutdown(); }
 
 void RenderSystem::Initialize() {
@@ -72,28 +295,39 @@ void RenderSystem::Initialize() {
     // Default textures (1x1 white, black, flat normal)
     TextureDefaults::Initialize();
 
-    // Blinn-Phong shader (Basic path)
-    std::string simpleVert = File::ReadFile("assets/shaders/Simple.vert");
-    std::string simpleFrag = File::ReadFile("assets/shaders/Simple.frag");
-    if (!simpleVert.empty() && !simpleFrag.empty()) {
-        m_SimpleShader = Shader::Create("Simple", simpleVert, simpleFrag);
+    // Sources are read on the job system; the programs then build in the
+    // background (see PollShaders), drawing with the fallback meanwhile.
+    m_ShaderBuildStart = std::chrono::steady_clock::now();
+    const std::vector<std::string> sources = ReadShaderSources({
+        "assets/shaders/Fallback.vert", "assets/shaders/Fallback.frag",
+        "assets/shaders/Simple.vert", "assets/shaders/Simple.frag",
+        "assets/shaders/PBR.vert", "assets/shaders/PBR.frag",
+        "assets/shaders/Depth.vert", "assets/shaders/Depth.frag",
+    }, m_JobSystem);
+    auto createShader = [&](const char* name, size_t index) -> std::shared_ptr<Shader> {
+        if (sources[index].empty() || sources[index + 1].empty()) {
+            return nullptr;
+        }
+        return Shader::Create(name, sources[index], sources[index + 1]);
+    };
+
+    // Fallback shader, needed for the first frame; tiny, so it is waited for.
+    m_FallbackShader = createShader("Fallback", 0);
+    if (m_FallbackShader) {
+        m_FallbackShader->SetUniformBlockBinding("Camera", UniformBinding::Camera);
     } else {
+        ZGINE_CORE_ERROR("Failed to load Fallback shaders.");
+    }
+
+    // Blinn-Phong shader (Basic path)
+    m_SimpleShader = createShader("Simple", 2);
+    if (!m_SimpleShader) {
         ZGINE_CORE_ERROR("Failed to load Simple shaders.");
     }
 
     // PBR shader (Advanced path)
-    std::string pbrVert = File::ReadFile("assets/shaders/PBR.vert");
-    std::string pbrFrag = File::ReadFile("assets/shaders/PBR.frag");
-    if (!pbrVert.empty() && !pbrFrag.empty()) {
-        m_PBRShader = Shader::Create("PBR", pbrVert, pbrFrag);
-        // Set texture sampler slots once
-        m_PBRShader->Bind();
-        m_PBRShader->SetUniform1i("u_AlbedoMap", 0);
-        m_PBRShader->SetUniform1i("u_NormalMap", 1);
-        m_PBRShader->SetUniform1i("u_MetallicMap", 2);
-        m_PBRShader->SetUniform1i("u_RoughnessMap", 3);
-        m_PBRShader->SetUniform1i("u_AOMap", 4);
-        m_PBRShader->Unbind();
+    m_PBRShader = createShader("PBR", 4);
+    if (m_PBRShader) {
         // Default to PBR path
         m_Config.Path = RenderPath::Advanced;
     } else {
@@ -102,40 +336,51 @@ void RenderSystem::Initialize() {
     }
 
     // Depth shader (shadow pass)
-    std::string depthVert = File::ReadFile("assets/shaders/Depth.vert");
-    std::string depthFrag = File::ReadFile("assets/shaders/Depth.frag");
-    if (!depthVert.empty() && !depthFrag.empty()) {
-        m_DepthShader = Shader::Create("Depth", depthVert, depthFrag);
-    } else {
+    m_DepthShader = createShader("Depth", 6);
+    if (!m_DepthShader) {
         ZGINE_CORE_WARN("Failed to load Depth shaders, shadows disabled.");
     }
+    m_ShadersPending = true;
 
-    // Shadow map FBO (depth-only, 2048x2048)
+    ZGINE_CORE_INFO("RenderSystem shaders submitted in {:.1f} ms", ElapsedMilliseconds(m_ShaderBuildStart));
+
+    // Shadow map FBO (depth-only texture array, one layer per cascade)
     if (m_DepthShader) {
+        const uint32_t shadowSize = static_cast<uint32_t>(std::clamp(m_Config.Quality.ShadowMapSize, 256, 8192));
         FramebufferSpec shadowSpec;
-        shadowSpec.Width = 2048;
-        shadowSpec.Height = 2048;
+        shadowSpec.Width = shadowSize;
+        shadowSpec.Height = shadowSize;
         shadowSpec.HDR = false;
         shadowSpec.DepthStencil = false;
         shadowSpec.DepthTexture = true;
+        shadowSpec.Layers = static_cast<uint32_t>(
+            std::clamp(m_Config.Quality.CascadeCount, 1, static_cast<int>(kMaxShadowCascades)));
         m_ShadowMapFBO = Framebuffer::Create(shadowSpec);
         m_Config.EnableShadows = true;
     }
 
-    // Set shadow map sampler slot for both shaders
-    if (m_SimpleShader) {
-        m_SimpleShader->Bind();
-        m_SimpleShader->SetUniform1i("u_ShadowMap", 5);
-        m_SimpleShader->Unbind();
-    }
-    if (m_PBRShader) {
-        m_PBRShader->Bind();
-        m_PBRShader->SetUniform1i("u_ShadowMap", 5);
-        m_PBRShader->Unbind();
+    // Camera, light and material blocks shared by the scene shaders
+    m_CameraUniforms = UniformBuffer::Create(sizeof(CameraBlock), UniformBinding::Camera);
+    m_LightUniforms = UniformBuffer::Create(sizeof(LightsBlock), UniformBinding::Lights);
+    m_MaterialUniforms = UniformBuffer::Create(sizeof(MaterialBlock), UniformBinding::Material);
+
+    // Point and spot lights, clustered on the CPU each frame
+    m_ClusterCells = TextureBuffer::Create(TextureBufferFormat::RG32UI,
+        m_LightClusters.GetClusterCount() * static_cast<uint32_t>(sizeof(ClusterCell)));
+    m_ClusterIndices = TextureBuffer::Create(TextureBufferFormat::R32UI,
+        kInitialClusterIndexCapacity * static_cast<uint32_t>(sizeof(uint32_t)));
+    m_ClusterLights = TextureBuffer::Create(TextureBufferFormat::RGBA32F,
+        kInitialClusterLightCapacity * static_cast<uint32_t>(sizeof(ClusterLight)));
+
+    // Per-instance data for instanced scene and shadow draws
+    m_InstanceBuffer = VertexBuffer::Create(kInitialInstanceCapacity * static_cast<uint32_t>(sizeof(InstanceData)));
+    if (m_InstanceBuffer) {
+        m_InstanceBuffer->SetLayout(InstanceData::GetLayout());
     }
 
     // Post-process pipeline
-    m_PostProcess.Initialize(1280, 720);
+    m_PostProcess.Initialize(1280, 720, m_JobSystem);
+    AssetManager::Get().GetTextureStreamer().SetJobSystem(m_JobSystem);
     m_Config.EnablePostProcess = true;
 
     m_Initialized = true;
@@ -152,12 +397,30 @@ void RenderSystem::Shutdown() {
         return;
     }
 
+    // Loaded meshes and textures own GPU objects; free them while the context is still alive.
+    AssetManager::Get().GetTextureStreamer().SetJobSystem(nullptr);
+    AssetManager::Get().UnloadAll();
     m_PostProcess.Shutdown();
+    m_Culler.Clear();
+    m_VisibleEntities.clear();
+    m_FailedMeshes.clear();
+    m_Queue.Clear();
+    m_InstanceBuffer.reset();
+    m_ClusterLights.reset();
+    m_ClusterIndices.reset();
+    m_ClusterCells.reset();
+    m_MaterialUniforms.reset();
+    m_LightUniforms.reset();
+    m_CameraUniforms.reset();
     m_ShadowMapFBO.reset();
     m_DepthShader.reset();
     m_PBRShader.reset();
     m_SimpleShader.reset();
+    m_FallbackShader.reset();
+    m_ReadyShaders = {};
+    m_ShadersPending = false;
     TextureDefaults::Shutdown();
+    MeshArenas::Shutdown();
     s_RendererAPI.reset();
 
     m_Initialized = false;
@@ -170,6 +433,7 @@ uint32_t RenderSystem::PostProcess(uint32_t sceneColorTexture) {
 }
 
 void RenderSystem::ResizePostProcess(uint32_t width, uint32_t height) {
+    m_ViewportHeight = height;
     if (!m_Config.EnablePostProcess) {
         return;
     }
@@ -182,48 +446,102 @@ void RenderSystem::BeginFrame() {
 
 Shader* RenderSystem::GetActiveShader() const {
     if (m_Config.Path == RenderPath::Advanced && m_PBRShader)
-        return m_PBRShader.get();
-    return m_SimpleShader.get();
+        return m_ReadyShaders.PBR ? m_PBRShader.get() : m_FallbackShader.get();
+    return m_ReadyShaders.Simple ? m_SimpleShader.get() : m_FallbackShader.get();
 }
 
-void RenderSystem::RenderShadowPass(World* world) {
-    if (!m_DepthShader || !m_ShadowMapFBO || !m_Config.EnableShadows) return;
-
-    // Compute light-space matrix from directional light
-    auto& dir = m_LightingData.directional;
-    Math::Vector3 lightDir = Math::Normalize(dir.direction);
-
-    // Orthographic projection centered at origin, covering the scene
-    float orthoSize = 20.0f;
-    Math::Matrix4 lightProjection = Math::Matrix4::Ortho(
-        -orthoSize, orthoSize, -orthoSize, orthoSize, 0.1f, 50.0f);
-
-    // Look from the opposite of light direction toward origin
-    Math::Vector3 lightPos = lightDir * (-25.0f);
-    Math::Matrix4 lightView = Math::Matrix4::LookAt(
-        lightPos, Math::Vector3(0.0f, 0.0f, 0.0f), Math::Vector3(0.0f, 1.0f, 0.0f));
+void RenderSystem::PollShaders() {
+    if (!m_ShadersPending) {
+        return;
+    }
 
-    m_LightSpaceMatrix = lightProjection * lightView;
+    // Samplers and block bindings are set once a program is ready, so setting
+    // them never waits for a compile.
+    auto poll = [](const std::shared_ptr<Shader>& shader, bool& ready) {
+        if (ready || !shader || !shader->IsReady()) {
+            return false;
+        }
+        ready = true;
+        return true;
+    };
 
-    // Render to shadow map
-    m_ShadowMapFBO->Bind();
-    s_RendererAPI->Clear();
+    if (poll(m_SimpleShader, m_ReadyShaders.Simple)) {
+        ConfigureSceneShader(*m_SimpleShader);
+    }
+    if (poll(m_PBRShader, m_ReadyShaders.PBR)) {
+        ConfigureSceneShader(*m_PBRShader);
+        m_PBRShader->Bind();
+        m_PBRShader->SetUniform1i("u_AlbedoMap", 0);
+        m_PBRShader->SetUniform1i("u_NormalMap", 1);
+        m_PBRShader->SetUniform1i("u_MetallicMap", 2);
+        m_PBRShader->SetUniform1i("u_RoughnessMap", 3);
+        m_PBRShader->SetUniform1i("u_AOMap", 4);
+        m_PBRShader->Unbind();
+        m_PBRShader->SetUniformBlockBinding("Material", UniformBinding::Material);
+    }
+    poll(m_DepthShader, m_ReadyShaders.Depth);
+
+    // Missing shaders count as done; they are never coming.
+    m_ShadersPending = (m_SimpleShader && !m_ReadyShaders.Simple) || (m_PBRShader && !m_ReadyShaders.PBR)
+        || (m_DepthShader && !m_ReadyShaders.Depth);
+    if (!m_ShadersPending) {
+        ZGINE_CORE_INFO("RenderSystem shaders ready {:.1f} ms after initialization",
+            ElapsedMilliseconds(m_ShaderBuildStart));
+    }
+}
 
-    m_DepthShader->Bind();
-    m_DepthShader->SetUniformMat4f("u_LightSpaceMatrix", m_LightSpaceMatrix);
+void RenderSystem::ConfigureSceneShader(Shader& shader) {
+    // Shadow map and light cluster sampler slots
+    shader.Bind();
+    shader.SetUniform1i("u_ShadowMap", kShadowMapSlot);
+    shader.SetUniform1i("u_ClusterCells", kClusterCellsSlot);
+    shader.SetUniform1i("u_ClusterIndices", kClusterIndicesSlot);
+    shader.SetUniform1i("u_ClusterLights", kClusterLightsSlot);
+    shader.Unbind();
+
+    shader.SetUniformBlockBinding("Camera", UniformBinding::Camera);
+    shader.SetUniformBlockBinding("Lights", UniformBinding::Lights);
+}
 
-    auto& registry = Internal::GetRegistry(*world);
-    auto view = registry.view<TransformComponent, PrimitiveComponent>();
-    for (auto entity : view) {
-        auto [transform, primitive] = view.get<TransformComponent, PrimitiveComponent>(entity);
-        PrimitiveMesh mesh = PrimitiveMeshFactory::GetMesh(primitive.Type);
-        if (!mesh.VertexArray) continue;
+void RenderSystem::RenderShadowPass(World* world, const Camera& camera) {
+    m_CascadeCount = 0;
+    if (!m_ReadyShaders.Depth || !m_ShadowMapFBO || !m_Config.EnableShadows || !m_InstanceBuffer) return;
+
+    // Fit the cascades to the camera frustum; the map has a fixed number of
+    // layers, so a larger CascadeCount set after Initialize is clamped to it.
+    const FramebufferSpec& shadowSpec = m_ShadowMapFBO->GetSpec();
+    ShadowCascadeSettings settings;
+    settings.CascadeCount = std::min(static_cast<uint32_t>(std::max(m_Config.Quality.CascadeCount, 1)), shadowSpec.Layers);
+    settings.Resolution = shadowSpec.Width;
+    settings.MaxDistance = m_Config.Quality.ShadowDistance;
+    settings.SplitLambda = m_Config.Quality.CascadeSplitLambda;
+
+    const Math::Vector3 lightDir = Math::Normalize(m_LightingData.directional.direction);
+    const auto [nearPlane, farPlane] = GetClipPlanes(camera);
+    m_CascadeCount = FitShadowCascades(settings, camera.GetView(), camera.GetProjection(),
+        nearPlane, farPlane, lightDir, m_Cascades);
+
+    struct ShadowHooks : InstanceHooks {
+        const Math::Matrix4& LightSpace;
+
+        void OnShader(Shader& shader) { shader.SetUniformMat4f("u_LightSpaceMatrix", LightSpace); }
+        void OnMaterial(Shader&, uint32_t) {}
+    };
+
+    // Each cascade culls its own casters against its light-space box and
+    // renders them into its layer of the map.
+    for (uint32_t i = 0; i < m_CascadeCount; ++i) {
+        const ShadowCascade& cascade = m_Cascades[i];
+        m_ShadowMapFBO->BindLayer(i);
+        s_RendererAPI->Clear();
 
-        Math::Matrix4 transformMat = transform.GetTransform();
-        m_DepthShader->SetUniformMat4f("u_Transform", transformMat);
+        CollectVisible(*world, cascade.ViewProjection,
+            m_FrameStats.ShadowCastersVisible, m_FrameStats.ShadowCastersCulled);
+        const Math::Vector3 lightPos = cascade.Center - lightDir * (cascade.Radius + settings.CasterDistance);
+        BuildQueue(*world, RenderPass::Shadow, m_DepthShader.get(), lightPos, lightDir);
 
-        s_RendererAPI->DrawIndexed(mesh.VertexArray, mesh.IndexBuffer->GetCount());
-        m_FrameStats.DrawCalls++;
+        ShadowHooks hooks{{m_InstanceBuffer}, cascade.ViewProjection};
+        m_Queue.Execute(*s_RendererAPI, m_FrameStats, hooks);
     }
 
     m_DepthShader->Unbind();
@@ -238,59 +556,263 @@ void RenderSystem::RenderScene(World* world, Camera* camera) {
         return;
     }
 
-    // Collect lights first (needed by shadow pass)
-    m_LightingData = LightingData{};
+    // Edit mode runs no systems, so resolve world matrices here; this is a
+    // cheap no-op when TransformSystem already ran this frame.
+    world->UpdateWorldTransforms();
+    ResolveMeshes(*world);
+    // Evicts and uploads texture mips for what the last frame drew.
+    AssetManager::Get().GetTextureStreamer().Update();
+    if (m_Config.EnableFrustumCulling) {
+        m_Culler.Sync(*world);
+    }
+
+    // Collect lights first (needed by shadow pass); the arrays are cleared
+    // rather than reset so they keep their capacity.
+    m_LightingData.points.clear();
+    m_LightingData.spots.clear();
     CollectLights(*world, m_LightingData);
 
+    PollShaders();
+
+    // Mesh LODs are chosen for the main camera in every pass, so shadow
+    // casters match what is drawn.
+    m_LodView.Eye = camera->GetPosition();
+    m_LodView.ProjectionScale = camera->GetProjection()(1, 1);
+    m_LodView.Perspective = camera->GetProjectionType() == Camera::ProjectionType::Perspective;
+
     // Shadow pass
-    RenderShadowPass(world);
+    RenderShadowPass(world, *camera);
 
     Shader* shader = GetActiveShader();
-    if (!shader) return;
-
-    shader->Bind();
+    if (!shader || !m_InstanceBuffer || !m_CameraUniforms || !m_LightUniforms || !m_MaterialUniforms) return;
+    if (!m_ClusterCells || !m_ClusterIndices || !m_ClusterLights) return;
 
-    // View-Projection
     Math::Matrix4 viewProj = camera->GetProjection() * camera->GetView();
-    shader->SetUniformMat4f("u_ViewProjection", viewProj);
 
-    // Camera position for specular
-    auto camPos = camera->GetPosition();
-    shader->SetUniform3f("u_CameraPos", camPos.x, camPos.y, camPos.z);
+    // Point and spot lights are binned into clusters for this camera.
+    UploadLightClusters(*camera);
+
+    // Frame-constant data goes up once as two uniform blocks.
+    CameraBlock cameraBlock;
+    cameraBlock.ViewProjection = viewProj;
+    const Math::Vector3& cameraPosition = camera->GetPosition();
+    cameraBlock.CameraPosition[0] = cameraPosition.x;
+    cameraBlock.CameraPosition[1] = cameraPosition.y;
+    cameraBlock.CameraPosition[2] = cameraPosition.z;
+    cameraBlock.EnableShadows = m_Config.EnableShadows && m_CascadeCount > 0 ? 1 : 0;
+    // View depth is minus the view-space z: the negated third row of the view matrix.
+    const Math::Matrix4& view = camera->GetView();
+    for (int i = 0; i < 4; ++i) {
+        cameraBlock.ViewDepth[i] = -view.m[i * 4 + 2];
+    }
+    const ClusterGridConfig& grid = m_LightClusters.GetConfig();
+    cameraBlock.ClusterDims[0] = grid.TilesX;
+    cameraBlock.ClusterDims[1] = grid.TilesY;
+    cameraBlock.ClusterDims[2] = grid.Slices;
+    cameraBlock.ClusterDepth[0] = m_LightClusters.GetSliceNear();
+    cameraBlock.ClusterDepth[1] = m_LightClusters.GetSliceScale();
+    // Unused cascades keep a split of 0, so the shaders never select them.
+    for (uint32_t i = 0; i < m_CascadeCount; ++i) {
+        cameraBlock.CascadeSplits[i] = m_Cascades[i].SplitFar;
+        cameraBlock.CascadeMatrices[i] = m_Cascades[i].ViewProjection;
+    }
+    m_CameraUniforms->SetData(&cameraBlock, sizeof(cameraBlock));
+
+    const LightsBlock lightsBlock = MakeLightsBlock(m_LightingData);
+    m_LightUniforms->SetData(&lightsBlock, sizeof(lightsBlock));
 
-    // Light uniforms
-    SetupLightUniforms(shader, m_LightingData);
+    CollectVisible(*world, viewProj, m_FrameStats.VisibleObjects, m_FrameStats.CulledObjects);
+    BuildQueue(*world, RenderPass::Opaque, shader, camera->GetPosition(), camera->GetForward());
 
-    // Shadow uniforms
-    shader->SetUniformMat4f("u_LightSpaceMatrix", m_LightSpaceMatrix);
-    shader->SetUniform1i("u_EnableShadows", m_Config.EnableShadows ? 1 : 0);
+    // Camera and lights live in uniform blocks, material texture state is
+    // uploaded once per material change, and transforms and material
+    // scalars come from the instance buffer.
+    struct SceneHooks : InstanceHooks {
+        RenderSystem& Renderer;
+        World& Scene;
 
-    // Bind shadow map to slot 5
-    if (m_ShadowMapFBO && m_Config.EnableShadows) {
-        m_ShadowMapFBO->BindDepthTexture(5);
-    }
+        void OnShader(Shader&) {
+            if (Renderer.m_ShadowMapFBO && Renderer.m_Config.EnableShadows) {
+                Renderer.m_ShadowMapFBO->BindDepthTexture(kShadowMapSlot);
+            }
+            Renderer.m_ClusterCells->Bind(kClusterCellsSlot);
+            Renderer.m_ClusterIndices->Bind(kClusterIndicesSlot);
+            Renderer.m_ClusterLights->Bind(kClusterLightsSlot);
+        }
+
+        void OnMaterial(Shader&, uint32_t material) {
+            Renderer.SetupMaterialUniforms(Scene, Renderer.m_DrawTables->MaterialEntities[material]);
+        }
+    } hooks{{m_InstanceBuffer}, *this, *world};
+    m_Queue.Execute(*s_RendererAPI, m_FrameStats, hooks);
+}
+
+void RenderSystem::BuildQueue(World& world, RenderPass pass, Shader* shader,
+                              const Math::Vector3& eye, const Math::Vector3& forward) {
+    m_Queue.Clear();
+    m_Queue.Reserve(m_VisibleEntities.size());
+    m_DrawTables->Clear();
+
+    auto& registry = Internal::GetRegistry(world);
+    const uint32_t shaderId = m_DrawTables->GetShaderId(shader);
+    for (uint32_t value : m_VisibleEntities) {
+        const entt::entity entity = Internal::ToEnTT(EntityHandle::FromValue(value));
+        const auto* primitive = registry.try_get<PrimitiveComponent>(entity);
+        const auto* meshComponent = primitive ? nullptr : registry.try_get<MeshComponent>(entity);
+        const MeshAsset* meshAsset = meshComponent ? meshComponent->LoadedMesh.get() : nullptr;
+        if (!primitive && !meshAsset) continue;
+
+        DrawItem item;
+        item.ShaderProgram = shader;
+        item.Entity = value;
+        InstanceData& instance = item.Instance;
+        instance.Transform = GetWorldMatrix(registry, entity, registry.get<TransformComponent>(entity));
+
+        // The shadow pass only writes depth, so every caster shares material 0
+        // and needs nothing but the transform.
+        const PBRMaterialComponent* material = nullptr;
+        MaterialKey materialKey{};
+        if (pass == RenderPass::Opaque) {
+            material = registry.try_get<PBRMaterialComponent>(entity);
+            materialKey = MakeMaterialKey(material);
+            item.Material = m_DrawTables->GetMaterialId(materialKey, value);
+            instance.NormalMatrix = Math::Transpose(Math::Inverse(Math::ToMatrix3(instance.Transform)));
+            SetInstanceMaterial(instance, material, m_Config.Path == RenderPath::Advanced);
+        }
+
+        const Math::Vector3 position = Math::ExtractTranslation(instance.Transform);
+        const float depth = (position.x - eye.x) * forward.x + (position.y - eye.y) * forward.y
+                          + (position.z - eye.z) * forward.z;
+        const uint32_t depthKey = SortKey::QuantizeDepth(depth);
+
+        // Largest axis scale of the transform, for the bounding-sphere radius.
+        const Math::Matrix4 transform = instance.Transform;
+        float scale = 0.0f;
+        for (int column = 0; column < 3; ++column) {
+            const float* axis = &transform.m[column * 4];
+            scale = std::max(scale, axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+        }
+        scale = std::sqrt(scale);
+
+        if (primitive) {
+            PrimitiveMesh mesh = PrimitiveMeshFactory::GetMesh(primitive->Type);
+            if (!mesh.VertexArray || !mesh.IndexBuffer) continue;
 
-    // Render entities
-    auto& registry = Internal::GetRegistry(*world);
-    auto view = registry.view<TransformComponent, PrimitiveComponent>();
-    for (auto entity : view) {
-        auto [transform, primitive] = view.get<TransformComponent, PrimitiveComponent>(entity);
-        PrimitiveMesh mesh = PrimitiveMeshFactory::GetMesh(primitive.Type);
+            // Primitives fit the unit cube around their origin.
+            RequestTextureMips(materialKey, GetScreenSize(position, 0.5f * std::sqrt(3.0f) * scale), m_ViewportHeight);
 
-        if (!mesh.VertexArray) continue;
+            item.Mesh = mesh.VertexArray.get();
+            item.IndexCount = mesh.IndexBuffer->GetCount();
+            m_Queue.Push(SortKey::Encode(pass, shaderId, item.Material, m_DrawTables->GetMeshId(item), depthKey), item);
+            continue;
+        }
+
+        // Every sub-mesh is its own draw out of the shared arena, at the LOD
+        // for its projected size; without a material component they keep
+        // their imported color.
+        float meshScreenSize = 0.0f;
+        for (const auto& subMesh : meshAsset->GetMeshes()) {
+            if (!subMesh->GetRange().IsValid()) continue;
+
+            const AABB& bounds = subMesh->GetBounds();
+            const Math::Vector3 center = bounds.GetCenter();
+            const Math::Vector3 worldCenter(
+                transform(0, 0) * center.x + transform(0, 1) * center.y + transform(0, 2) * center.z + transform(0, 3),
+                transform(1, 0) * center.x + transform(1, 1) * center.y + transform(1, 2) * center.z + transform(1, 3),
+                transform(2, 0) * center.x + transform(2, 1) * center.y + transform(2, 2) * center.z + transform(2, 3));
+            const float screenSize = GetScreenSize(worldCenter, Math::Length(bounds.GetExtents()) * scale);
+            meshScreenSize = std::max(meshScreenSize, screenSize);
+            const MeshRange range = subMesh->GetLodRange(subMesh->SelectLod(screenSize));
+
+            item.Mesh = range.Array;
+            item.IndexCount = range.IndexCount;
+            item.FirstIndex = range.FirstIndex;
+            item.BaseVertex = static_cast<int32_t>(range.BaseVertex);
+            // The normal matrix stays the one of the unscaled transform.
+            instance.Transform = FoldDequantization(transform, subMesh->GetDequantizeScale(),
+                                                    subMesh->GetDequantizeOffset());
+            if (pass == RenderPass::Opaque && !material) {
+                const Math::Vector4& color = subMesh->GetBaseColor();
+                instance.Material[0] = color.x;
+                instance.Material[1] = color.y;
+                instance.Material[2] = color.z;
+            }
+            m_Queue.Push(SortKey::Encode(pass, shaderId, item.Material, m_DrawTables->GetMeshId(item), depthKey), item);
+        }
+        // The material spans the whole mesh, so its textures need the largest sub-mesh's size.
+        RequestTextureMips(materialKey, meshScreenSize, m_ViewportHeight);
+    }
+    m_Queue.Sort();
+}
 
-        Math::Matrix4 transformMat = transform.GetTransform();
-        shader->SetUniformMat4f("u_Transform", transformMat);
+float RenderSystem::GetScreenSize(const Math::Vector3& center, float radius) const {
+    // Bounding-sphere diameter over the screen height.
+    float screenSize = radius * m_LodView.ProjectionScale;
+    if (m_LodView.Perspective) {
+        const float distance = Math::Length(center - m_LodView.Eye);
+        screenSize = distance > 0.0f ? screenSize / distance : std::numeric_limits<float>::max();
+    }
+    return screenSize;
+}
 
-        Math::Matrix3 normalMatrix = Math::Transpose(Math::Inverse(Math::ToMatrix3(transformMat)));
-        shader->SetUniformMat3f("u_NormalMatrix", normalMatrix);
+void RenderSystem::CollectVisible(World& world, const Math::Matrix4& viewProjection,
+                                  uint32_t& visibleCount, uint32_t& culledCount) {
+    m_VisibleEntities.clear();
+
+    auto& registry = Internal::GetRegistry(world);
+    if (!m_Config.EnableFrustumCulling) {
+        for (auto entity : registry.view<TransformComponent, PrimitiveComponent>()) {
+            m_VisibleEntities.push_back(static_cast<uint32_t>(entity));
+        }
+        auto meshes = registry.view<TransformComponent, MeshComponent>(entt::exclude<PrimitiveComponent>);
+        for (auto entity : meshes) {
+            if (meshes.get<MeshComponent>(entity).LoadedMesh) {
+                m_VisibleEntities.push_back(static_cast<uint32_t>(entity));
+            }
+        }
+        visibleCount += static_cast<uint32_t>(m_VisibleEntities.size());
+        return;
+    }
 
-        // Material
-        SetupMaterialUniforms(shader, *world, static_cast<uint32_t>(entity));
+    const size_t total = m_Culler.GetObjectCount();
+    m_Culler.Cull(Frustum::FromMatrix(viewProjection), m_VisibleEntities);
+    visibleCount += static_cast<uint32_t>(m_VisibleEntities.size());
+    culledCount += static_cast<uint32_t>(total - m_VisibleEntities.size());
+}
 
-        s_RendererAPI->DrawIndexed(mesh.VertexArray, mesh.IndexBuffer->GetCount());
-        m_FrameStats.DrawCalls++;
-        m_FrameStats.Triangles += mesh.IndexBuffer->GetCount() / 3;
+void RenderSystem::ResolveMeshes(World& world) {
+    auto& assets = AssetManager::Get();
+    auto& registry = Internal::GetRegistry(world);
+    for (auto entity : registry.view<MeshComponent>()) {
+        auto& mesh = registry.get<MeshComponent>(entity);
+        if (mesh.LoadedMesh && mesh.LoadedMesh->GetHandle() == mesh.MeshHandle) continue;
+
+        mesh.LoadedMesh.reset();
+        if (!mesh.MeshHandle.IsValid() || !assets.IsInitialized()) continue;
+
+        // Never blocks the frame: the entity is skipped until its mesh is uploaded.
+        // A failed mesh stays Failed until hot reload or UnloadAsset() resets it,
+        // so it is requested again only after its files changed.
+        const AssetLoadState state = assets.GetLoadState(mesh.MeshHandle);
+        if (state != AssetLoadState::Failed) {
+            m_FailedMeshes.erase(mesh.MeshHandle);
+        }
+        switch (state) {
+            case AssetLoadState::Loaded:
+                mesh.LoadedMesh = assets.LoadAsset<MeshAsset>(mesh.MeshHandle);
+                break;
+            case AssetLoadState::Failed:
+                if (m_FailedMeshes.insert(mesh.MeshHandle).second) {
+                    ZGINE_CORE_WARN("RenderSystem: mesh asset {} could not be loaded; entities using it are skipped.",
+                        mesh.MeshHandle.ToString());
+                }
+                break;
+            case AssetLoadState::Unloaded:
+                assets.LoadAssetAsync(mesh.MeshHandle);
+                break;
+            default:
+                break;
+        }
     }
 }
 
@@ -311,15 +833,14 @@ void RenderSystem::CollectLights(World& world, LightingData& lightData) {
     }
 
     // Point lights
-    lightData.numPointLights = 0;
     auto pointView = registry.view<PointLightComponent>();
+    lightData.points.reserve(pointView.size());
     for (auto entity : pointView) {
-        if (lightData.numPointLights >= 8) break;
         auto& pl = pointView.get<PointLightComponent>(entity);
-        auto& data = lightData.points[lightData.numPointLights];
+        auto& data = lightData.points.emplace_back();
 
         if (registry.all_of<TransformComponent>(entity)) {
-            data.position = registry.get<TransformComponent>(entity).Translation;
+            data.position = GetWorldPosition(registry, entity);
         } else {
             data.position = pl.Position;
         }
@@ -328,19 +849,17 @@ void RenderSystem::CollectLights(World& world, LightingData& lightData) {
         data.constant = pl.Constant;
         data.linear = pl.Linear;
         data.quadratic = pl.Quadratic;
-        lightData.numPointLights++;
     }
 
     // Spot lights
-    lightData.numSpotLights = 0;
     auto spotView = registry.view<SpotLightComponent>();
+    lightData.spots.reserve(spotView.size());
     for (auto entity : spotView) {
-        if (lightData.numSpotLights >= 8) break;
         auto& sl = spotView.get<SpotLightComponent>(entity);
-        auto& data = lightData.spots[lightData.numSpotLights];
+        auto& data = lightData.spots.emplace_back();
 
         if (registry.all_of<TransformComponent>(entity)) {
-            data.position = registry.get<TransformComponent>(entity).Translation;
+            data.position = GetWorldPosition(registry, entity);
         } else {
             data.position = sl.Position;
         }
@@ -352,135 +871,58 @@ void RenderSystem::CollectLights(World& world, LightingData& lightData) {
         data.constant = 1.0f;
         data.linear = 0.09f;
         data.quadratic = 0.032f;
-        lightData.numSpotLights++;
     }
 }
 
-void RenderSystem::SetupLightUniforms(Shader* shader, const LightingData& lightData) {
-    auto& dir = lightData.directional;
-    shader->SetUniform3f("u_DirLight.direction", dir.direction.x, dir.direction.y, dir.direction.z);
-    shader->SetUniform3f("u_DirLight.color",
-        dir.color.x * dir.intensity,
-        dir.color.y * dir.intensity,
-        dir.color.z * dir.intensity);
-
-    shader->SetUniform1i("u_NumPointLights", lightData.numPointLights);
-    for (int i = 0; i < lightData.numPointLights; i++) {
-        auto& pl = lightData.points[i];
-        std::string prefix = "u_PointLights[" + std::to_string(i) + "].";
-        shader->SetUniform3f(prefix + "position", pl.position.x, pl.position.y, pl.position.z);
-        shader->SetUniform3f(prefix + "color",
-            pl.color.x * pl.intensity, pl.color.y * pl.intensity, pl.color.z * pl.intensity);
-        shader->SetUniform1f(prefix + "constant", pl.constant);
-        shader->SetUniform1f(prefix + "linear", pl.linear);
-        shader->SetUniform1f(prefix + "quadratic", pl.quadratic);
-    }
-
-    shader->SetUniform1i("u_NumSpotLights", lightData.numSpotLights);
-    for (int i = 0; i < lightData.numSpotLights; i++) {
-        auto& sl = lightData.spots[i];
-        std::string prefix = "u_SpotLights[" + std::to_string(i) + "].";
-        shader->SetUniform3f(prefix + "position", sl.position.x, sl.position.y, sl.position.z);
-        shader->SetUniform3f(prefix + "direction", sl.direction.x, sl.direction.y, sl.direction.z);
-        shader->SetUniform3f(prefix + "color",
-            sl.color.x * sl.intensity, sl.color.y * sl.intensity, sl.color.z * sl.intensity);
-        shader->SetUniform1f(prefix + "cutOff", sl.cutOff);
-        shader->SetUniform1f(prefix + "outerCutOff", sl.outerCutOff);
-        shader->SetUniform1f(prefix + "constant", sl.constant);
-        shader->SetUniform1f(prefix + "linear", sl.linear);
-        shader->SetUniform1f(prefix + "quadratic", sl.quadratic);
-    }
-}
-
-void RenderSystem::SetupMaterialUniforms(Shader* shader, World& world, uint32_t entity) {
-    auto& registry = Internal::GetRegistry(world);
-    auto entityID = Internal::ToEnTT(EntityHandle::FromValue(entity));
-    bool isPBR = (m_Config.Path == RenderPath::Advanced);
-
-    if (registry.all_of<PBRMaterialComponent>(entityID)) {
-        auto& mat = registry.get<PBRMaterialComponent>(entityID);
-
-        if (isPBR) {
-            // PBR path: set scalar uniforms
-            shader->SetUniform3f("u_Albedo", mat.Albedo.x, mat.Albedo.y, mat.Albedo.z);
-            shader->SetUniform1f("u_Metallic", mat.Metallic);
-            shader->SetUniform1f("u_Roughness", mat.Roughness);
-            shader->SetUniform1f("u_AO", mat.AO);
-
-            // Albedo texture (slot 0)
-            if (mat.UseAlbedoTexture && mat.AlbedoTexture) {
-                mat.AlbedoTexture->Bind(0);
-                shader->SetUniform1i("u_UseAlbedoMap", 1);
-            } else {
-                TextureDefaults::White()->Bind(0);
-                shader->SetUniform1i("u_UseAlbedoMap", 0);
-            }
+void RenderSystem::UploadLightClusters(const Camera& camera) {
+    const auto [nearPlane, farPlane] = GetClipPlanes(camera);
+    m_LightClusters.Build(m_LightingData, camera.GetView(), camera.GetProjection(), nearPlane, farPlane, m_JobSystem);
 
-            // Normal map (slot 1)
-            if (mat.UseNormalTexture && mat.NormalTexture) {
-                mat.NormalTexture->Bind(1);
-                shader->SetUniform1i("u_UseNormalMap", 1);
-            } else {
-                TextureDefaults::FlatNormal()->Bind(1);
-                shader->SetUniform1i("u_UseNormalMap", 0);
-            }
+    const auto& cells = m_LightClusters.GetCells();
+    const auto& indices = m_LightClusters.GetLightIndices();
+    const auto& lights = m_LightClusters.GetLights();
+    m_ClusterCells->SetData(cells.data(), static_cast<uint32_t>(cells.size() * sizeof(ClusterCell)));
+    m_ClusterIndices->SetData(indices.data(), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)));
+    m_ClusterLights->SetData(lights.data(), static_cast<uint32_t>(lights.size() * sizeof(ClusterLight)));
 
-            // Metallic map (slot 2)
-            if (mat.UseMetallicTexture && mat.MetallicTexture) {
-                mat.MetallicTexture->Bind(2);
-                shader->SetUniform1i("u_UseMetallicMap", 1);
-            } else {
-                TextureDefaults::Black()->Bind(2);
-                shader->SetUniform1i("u_UseMetallicMap", 0);
-            }
+    m_FrameStats.Lights = static_cast<uint32_t>(lights.size());
+    m_FrameStats.LightClusterEntries = static_cast<uint32_t>(indices.size());
+}
 
-            // Roughness map (slot 3)
-            if (mat.UseRoughnessTexture && mat.RoughnessTexture) {
-                mat.RoughnessTexture->Bind(3);
-                shader->SetUniform1i("u_UseRoughnessMap", 1);
-            } else {
-                TextureDefaults::White()->Bind(3);
-                shader->SetUniform1i("u_UseRoughnessMap", 0);
-            }
+void RenderSystem::SetupMaterialUniforms(World& world, uint32_t entity) {
+    // Scalar parameters are per-instance attributes (SetInstanceMaterial);
+    // only the PBR texture state is shared by a material.
+    if (m_Config.Path != RenderPath::Advanced) {
+        return;
+    }
 
-            // AO map (slot 4)
-            if (mat.UseAOTexture && mat.AOTexture) {
-                mat.AOTexture->Bind(4);
-                shader->SetUniform1i("u_UseAOMap", 1);
-            } else {
-                TextureDefaults::White()->Bind(4);
-                shader->SetUniform1i("u_UseAOMap", 0);
-            }
-        } else {
-            // Blinn-Phong path: u_Color + u_Shininess
-            shader->SetUniform3f("u_Color", mat.Albedo.x, mat.Albedo.y, mat.Albedo.z);
-            float r = std::max(mat.Roughness, 0.01f);
-            float shininess = 2.0f / (r * r * r * r) - 2.0f;
-            shininess = std::clamp(shininess, 2.0f, 2048.0f);
-            shader->SetUniform1f("u_Shininess", shininess);
-        }
-    } else {
-        // No material component — defaults
-        if (isPBR) {
-            shader->SetUniform3f("u_Albedo", 0.8f, 0.8f, 0.8f);
-            shader->SetUniform1f("u_Metallic", 0.0f);
-            shader->SetUniform1f("u_Roughness", 0.5f);
-            shader->SetUniform1f("u_AO", 1.0f);
-            TextureDefaults::White()->Bind(0);
-            shader->SetUniform1i("u_UseAlbedoMap", 0);
-            TextureDefaults::FlatNormal()->Bind(1);
-            shader->SetUniform1i("u_UseNormalMap", 0);
-            TextureDefaults::Black()->Bind(2);
-            shader->SetUniform1i("u_UseMetallicMap", 0);
-            TextureDefaults::White()->Bind(3);
-            shader->SetUniform1i("u_UseRoughnessMap", 0);
-            TextureDefaults::White()->Bind(4);
-            shader->SetUniform1i("u_UseAOMap", 0);
-        } else {
-            shader->SetUniform3f("u_Color", 0.8f, 0.8f, 0.8f);
-            shader->SetUniform1f("u_Shininess", 32.0f);
+    auto& registry = Internal::GetRegistry(world);
+    auto entityID = Internal::ToEnTT(EntityHandle::FromValue(entity));
+    const auto* mat = registry.try_get<PBRMaterialComponent>(entityID);
+
+    // Bind the material's map to @p slot, or @p fallback when it has none.
+    auto bindMap = [](bool use, const std::shared_ptr<Texture>* texture, uint32_t slot,
+                      const std::shared_ptr<Texture>& fallback) -> int32_t {
+        if (use && texture && *texture) {
+            (*texture)->Bind(slot);
+            return 1;
         }
-    }
+        fallback->Bind(slot);
+        return 0;
+    };
+
+    MaterialBlock block;
+    block.UseAlbedoMap = bindMap(mat && mat->UseAlbedoTexture, mat ? &mat->AlbedoTexture : nullptr, 0,
+        TextureDefaults::White());
+    block.UseNormalMap = bindMap(mat && mat->UseNormalTexture, mat ? &mat->NormalTexture : nullptr, 1,
+        TextureDefaults::FlatNormal());
+    block.UseMetallicMap = bindMap(mat && mat->UseMetallicTexture, mat ? &mat->MetallicTexture : nullptr, 2,
+        TextureDefaults::Black());
+    block.UseRoughnessMap = bindMap(mat && mat->UseRoughnessTexture, mat ? &mat->RoughnessTexture : nullptr, 3,
+        TextureDefaults::White());
+    block.UseAOMap = bindMap(mat && mat->UseAOTexture, mat ? &mat->AOTexture : nullptr, 4,
+        TextureDefaults::White());
+    m_MaterialUniforms->SetData(&block, sizeof(block));
 }
 
 } // namespace Zgine
@@ -0,0 +1,48 @@
+#include <Zgine/Renderer/Pipeline/ShaderSources.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Platform/IO/File.h>
+
+namespace Zgine {
+
+std::string PreprocessShaderSource(std::string source) {
+    size_t read = 0;
+    if (source.size() >= 3 && source.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        read = 3;
+    }
+
+    // Compact in place; the text only ever shrinks.
+    size_t write = 0;
+    for (; read < source.size(); ++read) {
+        const char c = source[read];
+        if (c == '\r') {
+            if (read + 1 < source.size() && source[read + 1] == '\n') {
+                continue;
+            }
+            source[write++] = '\n';
+            continue;
+        }
+        source[write++] = c;
+    }
+    source.resize(write);
+    return source;
+}
+
+std::vector<std::string> ReadShaderSources(std::initializer_list<std::string_view> paths, JobSystem* jobs) {
+    std::vector<std::string> sources(paths.size());
+    const std::string_view* files = paths.begin();
+    auto read = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t index = begin; index < end; ++index) {
+            sources[index] = PreprocessShaderSource(File::ReadFile(files[index]));
+        }
+    };
+
+    const auto count = static_cast<uint32_t>(paths.size());
+    if (jobs && count > 1) {
+        jobs->ParallelFor(0, count, 1, read);
+    } else {
+        read(0, count);
+    }
+    return sources;
+}
+
+} // namespace Zgine
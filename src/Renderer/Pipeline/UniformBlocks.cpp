@@ -0,0 +1,22 @@
+#include <Zgine/Renderer/Pipeline/UniformBlocks.h>
+
+namespace Zgine {
+
+namespace {
+    void Store(float (&out)[3], const Math::Vector3& value, float scale = 1.0f) {
+        out[0] = value.x * scale;
+        out[1] = value.y * scale;
+        out[2] = value.z * scale;
+    }
+}
+
+LightsBlock MakeLightsBlock(const LightingData& lights) {
+    LightsBlock block{};
+
+    Store(block.Directional.Direction, lights.directional.direction);
+    Store(block.Directional.Color, lights.directional.color, lights.directional.intensity);
+
+    return block;
+}
+
+} // namespace Zgine
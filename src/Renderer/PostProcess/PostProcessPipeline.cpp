@@ -1,7 +1,7 @@
 #include <Zgine/Renderer/PostProcess/PostProcessPipeline.h>
+#include <Zgine/Renderer/Pipeline/ShaderSources.h>
 #include <Zgine/Renderer/RHI/Shader.h>
 #include <Zgine/Renderer/RHI/Framebuffer.h>
-#include <Zgine/Platform/IO/File.h>
 #include <Zgine/Core/Log/Log.h>
 #include <glad/glad.h>
 
@@ -22,6 +22,7 @@ void PostProcessPipeline::Shutdown() {
     m_BrightPassShader.reset();
     m_BlurShader.reset();
     m_CompositeShader.reset();
+    m_ShadersReady = false;
     m_OutputFBO.reset();
     m_BrightPassFBO.reset();
     m_PingFBO.reset();
@@ -29,39 +30,31 @@ void PostProcessPipeline::Shutdown() {
     m_Initialized = false;
 }
 
-void PostProcessPipeline::Initialize(uint32_t width, uint32_t height) {
+void PostProcessPipeline::Initialize(uint32_t width, uint32_t height, JobSystem* jobs) {
     m_Width = width;
     m_Height = height;
 
     CreateFullscreenQuad();
 
-    // Load shaders
-    std::string screenVert = File::ReadFile("assets/shaders/postprocess/Screen.vert");
-
-    std::string brightFrag = File::ReadFile("assets/shaders/postprocess/BrightPass.frag");
-    if (!screenVert.empty() && !brightFrag.empty()) {
-        m_BrightPassShader = Shader::Create("BrightPass", screenVert, brightFrag);
-        m_BrightPassShader->Bind();
-        m_BrightPassShader->SetUniform1i("u_SceneTexture", 0);
-        m_BrightPassShader->Unbind();
+    // Load shaders; they build in the background and Process() passes the
+    // scene through until all three are ready.
+    const std::vector<std::string> sources = ReadShaderSources({
+        "assets/shaders/postprocess/Screen.vert",
+        "assets/shaders/postprocess/BrightPass.frag",
+        "assets/shaders/postprocess/GaussianBlur.frag",
+        "assets/shaders/postprocess/Composite.frag",
+    }, jobs);
+    const std::string& screenVert = sources[0];
+    if (!screenVert.empty() && !sources[1].empty()) {
+        m_BrightPassShader = Shader::Create("BrightPass", screenVert, sources[1]);
     }
-
-    std::string blurFrag = File::ReadFile("assets/shaders/postprocess/GaussianBlur.frag");
-    if (!screenVert.empty() && !blurFrag.empty()) {
-        m_BlurShader = Shader::Create("GaussianBlur", screenVert, blurFrag);
-        m_BlurShader->Bind();
-        m_BlurShader->SetUniform1i("u_Image", 0);
-        m_BlurShader->Unbind();
+    if (!screenVert.empty() && !sources[2].empty()) {
+        m_BlurShader = Shader::Create("GaussianBlur", screenVert, sources[2]);
     }
-
-    std::string compositeFrag = File::ReadFile("assets/shaders/postprocess/Composite.frag");
-    if (!screenVert.empty() && !compositeFrag.empty()) {
-        m_CompositeShader = Shader::Create("Composite", screenVert, compositeFrag);
-        m_CompositeShader->Bind();
-        m_CompositeShader->SetUniform1i("u_SceneTexture", 0);
-        m_CompositeShader->SetUniform1i("u_BloomTexture", 1);
-        m_CompositeShader->Unbind();
+    if (!screenVert.empty() && !sources[3].empty()) {
+        m_CompositeShader = Shader::Create("Composite", screenVert, sources[3]);
     }
+    m_ShadersReady = false;
 
     if (!m_BrightPassShader || !m_BlurShader || !m_CompositeShader) {
         ZGINE_CORE_ERROR("Failed to load post-process shaders.");
@@ -146,8 +139,28 @@ void PostProcessPipeline::DrawFullscreenQuad() {
     glBindVertexArray(0);
 }
 
+bool PostProcessPipeline::PollShaders() {
+    if (m_ShadersReady) {
+        return true;
+    }
+    if (!m_BrightPassShader->IsReady() || !m_BlurShader->IsReady() || !m_CompositeShader->IsReady()) {
+        return false;
+    }
+
+    m_BrightPassShader->Bind();
+    m_BrightPassShader->SetUniform1i("u_SceneTexture", 0);
+    m_BlurShader->Bind();
+    m_BlurShader->SetUniform1i("u_Image", 0);
+    m_CompositeShader->Bind();
+    m_CompositeShader->SetUniform1i("u_SceneTexture", 0);
+    m_CompositeShader->SetUniform1i("u_BloomTexture", 1);
+    m_CompositeShader->Unbind();
+    m_ShadersReady = true;
+    return true;
+}
+
 uint32_t PostProcessPipeline::Process(uint32_t sceneColorTexture) {
-    if (!m_Initialized) return sceneColorTexture;
+    if (!m_Initialized || !PollShaders()) return sceneColorTexture;
 
     glDisable(GL_DEPTH_TEST);
 
@@ -31,4 +31,16 @@ namespace Zgine {
         return nullptr;
     }
 
+    std::shared_ptr<IndexBuffer> IndexBuffer::Create(uint32_t count) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    return nullptr;
+            case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLIndexBuffer>(count);
+            case RendererAPI::API::DirectX12:
+            case RendererAPI::API::Vulkan:
+                RendererAPI::ReportUnavailableBackend("Dynamic IndexBuffer");
+                return nullptr;
+        }
+        return nullptr;
+    }
+
 }
@@ -1,4 +1,6 @@
 #include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <Zgine/Renderer/RHI/Shader.h>
+#include <Zgine/Renderer/RHI/VertexArray.h>
 #include <Zgine/Core/Log/Log.h>
 #include <Renderer/Backend/OpenGL/OpenGLRendererAPI.h>
 #if ZGINE_HAS_VULKAN
@@ -93,6 +95,32 @@ namespace Zgine {
         return API::OpenGL;
     }
 
+    void RendererAPI::BindShader(const Shader& shader) {
+        shader.Bind();
+    }
+
+    void RendererAPI::BindVertexArray(const VertexArray* vertexArray) {
+        if (vertexArray) {
+            vertexArray->Bind();
+        }
+    }
+
+    void RendererAPI::DrawIndexedInstanced(const std::shared_ptr<VertexArray>& vertexArray, uint32_t indexCount,
+                                           uint32_t instanceCount) {
+        (void)vertexArray;
+        (void)indexCount;
+        (void)instanceCount;
+        ReportUnavailableBackend("RendererAPI::DrawIndexedInstanced");
+    }
+
+    void RendererAPI::DrawBound(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t baseVertex) {
+        (void)indexCount;
+        (void)instanceCount;
+        (void)firstIndex;
+        (void)baseVertex;
+        ReportUnavailableBackend("RendererAPI::DrawBound");
+    }
+
     void RendererAPI::ReportUnavailableBackend(std::string_view resourceType) {
         ZGINE_CORE_ERROR("{} is not implemented for renderer backend '{}'.",
             resourceType, ToString(s_API));
@@ -0,0 +1,138 @@
+#include <Zgine/Renderer/RHI/ShaderCache.h>
+#include <Zgine/Core/Log/Log.h>
+
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
+namespace Zgine {
+
+namespace {
+
+    constexpr uint32_t kMagic = 0x4353475Au; // "ZGSC"
+    constexpr uint32_t kVersion = 1;
+
+    struct EntryHeader {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t Key;
+        uint32_t Format;
+        uint32_t Size;
+        uint64_t Checksum;
+    };
+
+    constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+    constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    uint64_t Fnv1a(uint64_t hash, const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * kFnvPrime;
+        }
+        return hash;
+    }
+
+    uint64_t HashString(uint64_t hash, std::string_view text) {
+        // Length first, so moving text between two strings changes the key.
+        const uint64_t length = text.size();
+        hash = Fnv1a(hash, &length, sizeof(length));
+        return Fnv1a(hash, text.data(), text.size());
+    }
+
+} // namespace
+
+ShaderCache::ShaderCache(std::filesystem::path directory)
+    : m_Directory(std::move(directory))
+{
+}
+
+uint64_t ShaderCache::ComputeKey(std::initializer_list<std::string_view> sources, std::string_view driverIdentity) {
+    uint64_t hash = Fnv1a(kFnvOffset, &kVersion, sizeof(kVersion));
+    hash = HashString(hash, driverIdentity);
+    for (std::string_view source : sources) {
+        hash = HashString(hash, source);
+    }
+    return hash;
+}
+
+std::filesystem::path ShaderCache::GetEntryPath(uint64_t key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return m_Directory / name;
+}
+
+bool ShaderCache::Load(uint64_t key, Entry& entry) {
+    std::ifstream file(GetEntryPath(key), std::ios::binary);
+    if (!file) {
+        ++m_Misses;
+        return false;
+    }
+
+    EntryHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.Magic != kMagic || header.Version != kVersion || header.Key != key) {
+        ++m_Misses;
+        return false;
+    }
+
+    std::vector<uint8_t> binary(header.Size);
+    file.read(reinterpret_cast<char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+    if (!file || Fnv1a(kFnvOffset, binary.data(), binary.size()) != header.Checksum) {
+        ZGINE_CORE_WARN("Shader cache entry '{}' is corrupt; ignoring it.", GetEntryPath(key).string());
+        ++m_Misses;
+        return false;
+    }
+
+    entry.Format = header.Format;
+    entry.Binary = std::move(binary);
+    ++m_Hits;
+    return true;
+}
+
+bool ShaderCache::Store(uint64_t key, const Entry& entry) {
+    std::error_code ec;
+    std::filesystem::create_directories(m_Directory, ec);
+    if (ec) {
+        ZGINE_CORE_WARN("Failed to create shader cache directory '{}': {}", m_Directory.string(), ec.message());
+        return false;
+    }
+
+    EntryHeader header{};
+    header.Magic = kMagic;
+    header.Version = kVersion;
+    header.Key = key;
+    header.Format = entry.Format;
+    header.Size = static_cast<uint32_t>(entry.Binary.size());
+    header.Checksum = Fnv1a(kFnvOffset, entry.Binary.data(), entry.Binary.size());
+
+    // Write beside the entry and rename, so a reader never sees half a file.
+    const std::filesystem::path path = GetEntryPath(key);
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entry.Binary.data()), static_cast<std::streamsize>(entry.Binary.size()));
+        if (!file) {
+            file.close();
+            std::filesystem::remove(temporary, ec);
+            ZGINE_CORE_WARN("Failed to write shader cache entry '{}'.", path.string());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        ZGINE_CORE_WARN("Failed to write shader cache entry '{}'.", path.string());
+        return false;
+    }
+    return true;
+}
+
+void ShaderCache::Remove(uint64_t key) {
+    std::error_code ec;
+    std::filesystem::remove(GetEntryPath(key), ec);
+}
+
+} // namespace Zgine
@@ -52,4 +52,18 @@ namespace Zgine {
         return nullptr;
     }
 
+    std::shared_ptr<Texture> Texture::Create(TextureFormat format, const std::vector<TextureMip>& mips,
+                                             const TextureSettings& settings, const std::string& debugName,
+                                             uint32_t firstMip) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    return nullptr;
+            case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTexture>(format, mips, settings, debugName, firstMip);
+            case RendererAPI::API::DirectX12:
+            case RendererAPI::API::Vulkan:
+                RendererAPI::ReportUnavailableBackend("Texture");
+                return nullptr;
+        }
+        return nullptr;
+    }
+
 }
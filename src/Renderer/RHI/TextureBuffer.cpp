@@ -0,0 +1,19 @@
+#include <Zgine/Renderer/RHI/TextureBuffer.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <Renderer/Backend/OpenGL/OpenGLTextureBuffer.h>
+
+namespace Zgine {
+
+    std::shared_ptr<TextureBuffer> TextureBuffer::Create(TextureBufferFormat format, uint32_t size) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    return nullptr;
+            case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLTextureBuffer>(format, size);
+            case RendererAPI::API::DirectX12:
+            case RendererAPI::API::Vulkan:
+                RendererAPI::ReportUnavailableBackend("TextureBuffer");
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+}
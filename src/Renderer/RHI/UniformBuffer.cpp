@@ -0,0 +1,19 @@
+#include <Zgine/Renderer/RHI/UniformBuffer.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <Renderer/Backend/OpenGL/OpenGLUniformBuffer.h>
+
+namespace Zgine {
+
+    std::shared_ptr<UniformBuffer> UniformBuffer::Create(uint32_t size, uint32_t binding) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    return nullptr;
+            case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLUniformBuffer>(size, binding);
+            case RendererAPI::API::DirectX12:
+            case RendererAPI::API::Vulkan:
+                RendererAPI::ReportUnavailableBackend("UniformBuffer");
+                return nullptr;
+        }
+        return nullptr;
+    }
+
+}
@@ -31,4 +31,16 @@ namespace Zgine {
         return nullptr;
     }
 
+    std::shared_ptr<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    return nullptr;
+            case RendererAPI::API::OpenGL:  return std::make_shared<OpenGLVertexBuffer>(size);
+            case RendererAPI::API::DirectX12:
+            case RendererAPI::API::Vulkan:
+                RendererAPI::ReportUnavailableBackend("Dynamic VertexBuffer");
+                return nullptr;
+        }
+        return nullptr;
+    }
+
 }
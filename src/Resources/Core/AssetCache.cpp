@@ -0,0 +1,343 @@
+#include <Zgine/Resources/Core/AssetCache.h>
+#include <Zgine/Core/Memory/MemoryPool.h>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <new>
+
+namespace Zgine {
+
+namespace {
+    size_t GetTypeIndex(AssetType type) {
+        const auto index = static_cast<size_t>(type);
+        return index < kAssetTypeCount ? index : 0;
+    }
+
+    // UUID hashes are not guaranteed to vary in their low bits.
+    uint64_t MixHash(uint64_t value) {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        return value;
+    }
+}
+
+AssetCache::AssetCache(const AssetCacheConfig& config) {
+    Configure(config);
+}
+
+AssetCache::~AssetCache() {
+    Clear();
+}
+
+void AssetCache::Configure(const AssetCacheConfig& config) {
+    Clear();
+    m_Config = config;
+
+    const size_t shardCount = std::bit_ceil(std::max<size_t>(m_Config.ShardCount, 1));
+    const size_t poolSize = m_Config.EntryPoolSize > 0 ? std::max<size_t>(m_Config.EntryPoolSize / shardCount, 1) : 0;
+    m_Shards.clear();
+    for (size_t i = 0; i < shardCount; ++i) {
+        auto shard = std::make_unique<Shard>();
+        if (poolSize > 0) {
+            shard->Pool = std::make_unique<MemoryPool>(sizeof(Entry), poolSize);
+        }
+        m_Shards.push_back(std::move(shard));
+    }
+    m_ShardMask = shardCount - 1;
+
+    m_Clock = 0;
+    m_Evictions = 0;
+    for (size_t i = 0; i < kAssetTypeCount; ++i) {
+        m_Hits[i] = 0;
+        m_Misses[i] = 0;
+    }
+}
+
+AssetCache::Shard& AssetCache::GetShard(AssetHandle handle) const {
+    return *m_Shards[MixHash(std::hash<AssetHandle>{}(handle)) & m_ShardMask];
+}
+
+bool AssetCache::IsOverBudget() const {
+    return m_CpuBytes.load(std::memory_order_relaxed) > m_Config.CpuBudgetBytes
+        || m_GpuBytes.load(std::memory_order_relaxed) > m_Config.GpuBudgetBytes;
+}
+
+void AssetCache::Link(Shard& shard, Entry* entry) {
+    entry->Prev = nullptr;
+    entry->Next = shard.Head;
+    if (shard.Head) {
+        shard.Head->Prev = entry;
+    }
+    shard.Head = entry;
+    if (!shard.Tail) {
+        shard.Tail = entry;
+    }
+}
+
+void AssetCache::Unlink(Shard& shard, Entry* entry) {
+    if (entry->Prev) {
+        entry->Prev->Next = entry->Next;
+    } else {
+        shard.Head = entry->Next;
+    }
+    if (entry->Next) {
+        entry->Next->Prev = entry->Prev;
+    } else {
+        shard.Tail = entry->Prev;
+    }
+    entry->Prev = nullptr;
+    entry->Next = nullptr;
+}
+
+void AssetCache::Retain(Shard& shard, Entry* entry) {
+    Link(shard, entry);
+    m_EntryCount.fetch_add(1, std::memory_order_relaxed);
+    m_CpuBytes.fetch_add(entry->CpuBytes, std::memory_order_relaxed);
+    m_GpuBytes.fetch_add(entry->GpuBytes, std::memory_order_relaxed);
+}
+
+void AssetCache::Drop(Shard& shard, Entry* entry) {
+    Unlink(shard, entry);
+    m_EntryCount.fetch_sub(1, std::memory_order_relaxed);
+    m_CpuBytes.fetch_sub(entry->CpuBytes, std::memory_order_relaxed);
+    m_GpuBytes.fetch_sub(entry->GpuBytes, std::memory_order_relaxed);
+}
+
+void AssetCache::Evict(Shard& shard, Entry* entry) {
+    Drop(shard, entry);
+    m_Evictions.fetch_add(1, std::memory_order_relaxed);
+    // Held only by the cache, the count cannot rise: Find() needs this lock.
+    // Either way the reference is dropped later, on the main thread.
+    const bool inUse = entry->Strong.use_count() > 1;
+    Defer(std::move(entry->Strong));
+    if (!inUse) {
+        shard.Entries.erase(entry->Handle);
+        Destroy(shard, entry);
+    }
+}
+
+void AssetCache::Defer(std::shared_ptr<Asset> asset) {
+    if (!asset) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_ReleaseMutex);
+    m_Released.push_back(std::move(asset));
+}
+
+AssetCache::Entry* AssetCache::Allocate(Shard& shard) {
+    void* memory = shard.Pool ? shard.Pool->Allocate() : ::operator new(sizeof(Entry));
+    return new (memory) Entry();
+}
+
+void AssetCache::Destroy(Shard& shard, Entry* entry) {
+    entry->~Entry();
+    if (shard.Pool) {
+        shard.Pool->Deallocate(entry);
+    } else {
+        ::operator delete(entry);
+    }
+}
+
+std::shared_ptr<Asset> AssetCache::Find(AssetHandle handle) {
+    if (m_Shards.empty()) {
+        return nullptr;
+    }
+
+    Shard& shard = GetShard(handle);
+    std::shared_ptr<Asset> asset;
+    bool revived = false;
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        auto it = shard.Entries.find(handle);
+        if (it == shard.Entries.end()) {
+            return nullptr;
+        }
+
+        Entry* entry = it->second;
+        if (entry->Strong) {
+            asset = entry->Strong;
+            Unlink(shard, entry);
+            Link(shard, entry);
+        } else {
+            asset = entry->Weak.lock();
+            if (!asset) {
+                shard.Entries.erase(it);
+                Destroy(shard, entry);
+                return nullptr;
+            }
+            entry->Strong = asset;
+            Retain(shard, entry);
+            revived = true;
+        }
+        entry->LastAccess = m_Clock.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    m_Hits[GetTypeIndex(asset->GetType())].fetch_add(1, std::memory_order_relaxed);
+    if (revived) {
+        EnforceBudget();
+    }
+    return asset;
+}
+
+bool AssetCache::Contains(AssetHandle handle) const {
+    if (m_Shards.empty()) {
+        return false;
+    }
+    Shard& shard = GetShard(handle);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Entries.find(handle);
+    return it != shard.Entries.end() && (it->second->Strong || !it->second->Weak.expired());
+}
+
+bool AssetCache::IsInUse(AssetHandle handle) const {
+    if (m_Shards.empty()) {
+        return false;
+    }
+    Shard& shard = GetShard(handle);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Entries.find(handle);
+    if (it == shard.Entries.end()) {
+        return false;
+    }
+    const Entry* entry = it->second;
+    return entry->Strong ? entry->Strong.use_count() > 1 : !entry->Weak.expired();
+}
+
+void AssetCache::RecordMiss(AssetType type) {
+    m_Misses[GetTypeIndex(type)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void AssetCache::Insert(const std::shared_ptr<Asset>& asset) {
+    if (!asset || m_Shards.empty()) {
+        return;
+    }
+
+    Shard& shard = GetShard(asset->GetHandle());
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        Entry*& entry = shard.Entries[asset->GetHandle()];
+        if (!entry) {
+            entry = Allocate(shard);
+            entry->Handle = asset->GetHandle();
+        } else if (entry->Strong) {
+            Drop(shard, entry);
+            Defer(std::move(entry->Strong));
+        }
+        entry->Strong = asset;
+        entry->Weak = asset;
+        entry->CpuBytes = asset->GetSizeBytes();
+        entry->GpuBytes = asset->GetGpuSizeBytes();
+        entry->LastAccess = m_Clock.fetch_add(1, std::memory_order_relaxed) + 1;
+        Retain(shard, entry);
+    }
+    EnforceBudget();
+}
+
+void AssetCache::EnforceBudget() {
+    while (IsOverBudget()) {
+        // Each shard's tail is its least recently used entry; the oldest tail is the global one.
+        Shard* oldest = nullptr;
+        uint64_t oldestAccess = std::numeric_limits<uint64_t>::max();
+        for (const auto& shard : m_Shards) {
+            std::lock_guard<std::mutex> lock(shard->Mutex);
+            if (shard->Tail && shard->Tail->LastAccess < oldestAccess) {
+                oldest = shard.get();
+                oldestAccess = shard->Tail->LastAccess;
+            }
+        }
+        if (!oldest) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(oldest->Mutex);
+        // Touched or evicted meanwhile: look again.
+        if (oldest->Tail && oldest->Tail->LastAccess == oldestAccess) {
+            Evict(*oldest, oldest->Tail);
+        }
+    }
+}
+
+bool AssetCache::Remove(AssetHandle handle) {
+    if (m_Shards.empty()) {
+        return false;
+    }
+    Shard& shard = GetShard(handle);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Entries.find(handle);
+    if (it == shard.Entries.end()) {
+        return false;
+    }
+    Entry* entry = it->second;
+    if (entry->Strong) {
+        Drop(shard, entry);
+        Defer(std::move(entry->Strong));
+    }
+    shard.Entries.erase(it);
+    Destroy(shard, entry);
+    return true;
+}
+
+size_t AssetCache::ReleaseEvicted() {
+    std::vector<std::shared_ptr<Asset>> released;
+    {
+        std::lock_guard<std::mutex> lock(m_ReleaseMutex);
+        released.swap(m_Released);
+    }
+    // Destructors run here, outside every cache lock.
+    const size_t count = released.size();
+    released.clear();
+    return count;
+}
+
+void AssetCache::Trim() {
+    EnforceBudget();
+    for (const auto& shard : m_Shards) {
+        std::lock_guard<std::mutex> lock(shard->Mutex);
+        for (auto it = shard->Entries.begin(); it != shard->Entries.end();) {
+            Entry* entry = it->second;
+            if (!entry->Strong && entry->Weak.expired()) {
+                it = shard->Entries.erase(it);
+                Destroy(*shard, entry);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void AssetCache::Clear() {
+    for (const auto& shard : m_Shards) {
+        std::lock_guard<std::mutex> lock(shard->Mutex);
+        for (auto& [handle, entry] : shard->Entries) {
+            if (entry->Strong) {
+                Drop(*shard, entry);
+            }
+            Destroy(*shard, entry);
+        }
+        shard->Entries.clear();
+        shard->Head = nullptr;
+        shard->Tail = nullptr;
+    }
+    ReleaseEvicted();
+}
+
+AssetCache::Stats AssetCache::GetStats() const {
+    Stats stats;
+    stats.EntryCount = m_EntryCount.load(std::memory_order_relaxed);
+    stats.CpuBytes = m_CpuBytes.load(std::memory_order_relaxed);
+    stats.GpuBytes = m_GpuBytes.load(std::memory_order_relaxed);
+    stats.Evictions = m_Evictions.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_ReleaseMutex);
+        stats.PendingReleases = m_Released.size();
+    }
+    for (size_t i = 0; i < kAssetTypeCount; ++i) {
+        stats.Types[i].Hits = m_Hits[i].load(std::memory_order_relaxed);
+        stats.Types[i].Misses = m_Misses[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+} // namespace Zgine
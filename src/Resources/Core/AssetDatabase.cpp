@@ -1,7 +1,15 @@
 #include <Zgine/Resources/Core/AssetDatabase.h>
+#include <Zgine/Resources/Core/AssetIndex.h>
+#include <Zgine/Resources/Import/AssetCooker.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <utility>
 
 namespace Zgine {
 
@@ -11,6 +19,123 @@ namespace {
         return path.generic_string();
     }
 
+    int64_t GetTicks(std::filesystem::file_time_type time) {
+        return static_cast<int64_t>(time.time_since_epoch().count());
+    }
+
+    // A directory entry found by the walk, relative to the assets root; only
+    // the stat fields of Stats are filled in.
+    struct ScannedFile {
+        std::filesystem::path RelativePath;
+        bool IsDirectory = false;
+        bool IsSymlink = false;
+        AssetIndexEntry Stats;
+    };
+
+    struct DirectoryWalk {
+        std::filesystem::path Root;
+        JobSystem* Jobs = nullptr;
+        JobCounter Counter;
+        std::mutex Mutex;
+        std::vector<ScannedFile> Files;
+    };
+
+    // Lists one directory and pairs its files with their .meta files, then
+    // walks the subdirectories, each as its own job when there is a JobSystem.
+    void WalkDirectory(DirectoryWalk& walk, const std::filesystem::path& relative) {
+        const std::string indexTemporary = std::string(AssetIndex::kFileName) + ".tmp";
+        std::vector<ScannedFile> files;
+        std::vector<std::filesystem::path> subdirectories;
+        std::unordered_map<std::string, std::pair<int64_t, uint64_t>> metaStats;
+
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(walk.Root / relative, ec), end; !ec && it != end; it.increment(ec)) {
+            const std::filesystem::directory_entry& entry = *it;
+            const std::filesystem::path name = entry.path().filename();
+            std::error_code entryError;
+
+            ScannedFile file;
+            file.RelativePath = relative / name;
+            file.IsSymlink = entry.is_symlink(entryError);
+            if (entry.is_directory(entryError)) {
+                file.IsDirectory = true;
+                // Like recursive_directory_iterator, symlinked directories are listed but not entered.
+                if (!file.IsSymlink) {
+                    subdirectories.push_back(file.RelativePath);
+                }
+                files.push_back(std::move(file));
+                continue;
+            }
+            if (!entry.is_regular_file(entryError)) {
+                continue;
+            }
+
+            const std::filesystem::path extension = name.extension();
+            if (extension == AssetCooker::kExtension || name == AssetIndex::kFileName || name == indexTemporary) {
+                continue;
+            }
+            const auto writeTime = entry.last_write_time(entryError);
+            const auto size = entry.file_size(entryError);
+            if (entryError) {
+                continue;
+            }
+            if (extension == ".meta") {
+                metaStats[name.stem().string()] = { GetTicks(writeTime), size };
+                continue;
+            }
+            file.Stats.SourceWriteTime = GetTicks(writeTime);
+            file.Stats.SourceSize = size;
+            files.push_back(std::move(file));
+        }
+
+        for (ScannedFile& file : files) {
+            auto meta = metaStats.find(file.RelativePath.filename().string());
+            if (!file.IsDirectory && meta != metaStats.end()) {
+                file.Stats.HasMetaFile = true;
+                file.Stats.MetaWriteTime = meta->second.first;
+                file.Stats.MetaSize = meta->second.second;
+            }
+        }
+
+        for (const std::filesystem::path& subdirectory : subdirectories) {
+            if (walk.Jobs) {
+                walk.Jobs->Run([&walk, subdirectory]() { WalkDirectory(walk, subdirectory); }, &walk.Counter);
+            } else {
+                WalkDirectory(walk, subdirectory);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(walk.Mutex);
+        walk.Files.insert(walk.Files.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+    }
+
+    std::optional<AssetMetadata> ParseMetadata(const std::string& text) {
+        const nlohmann::json data = nlohmann::json::parse(text, nullptr, false);
+        if (data.is_discarded()) {
+            return std::nullopt;
+        }
+        try {
+            return AssetMetadata::Deserialize(data);
+        } catch (...) {
+            return std::nullopt;
+        }
+    }
+
+    template <typename Body>
+    void ForEachIndex(JobSystem* jobs, size_t count, const Body& body) {
+        if (jobs) {
+            jobs->ParallelFor(0, static_cast<uint32_t>(count), 64, [&body](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i) {
+                    body(i);
+                }
+            });
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+        }
+    }
+
 } // namespace
 
 void AssetDatabase::Scan(const AssetDatabaseConfig& config) {
@@ -24,63 +149,131 @@ void AssetDatabase::Scan(const AssetDatabaseConfig& config) {
         return;
     }
 
-    std::vector<AssetRecord> records;
-    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_AssetsRoot, ec)) {
-        if (ec) {
-            break;
-        }
-
-        const std::filesystem::path sourcePath = entry.path();
-        if (entry.is_directory(ec)) {
-            if (!config.IncludeDirectories) {
-                continue;
-            }
-
-            AssetRecord record;
-            record.Type = AssetType::Folder;
-            record.SourcePath = NormalizeAbsolutePath(sourcePath);
-            record.RelativePath = NormalizeRelativePath(m_AssetsRoot, record.SourcePath);
-            record.IsDirectory = true;
-            records.push_back(std::move(record));
+    DirectoryWalk walk;
+    walk.Root = m_AssetsRoot;
+    walk.Jobs = m_Jobs;
+    WalkDirectory(walk, {});
+    if (m_Jobs) {
+        m_Jobs->Wait(walk.Counter);
+    }
+    std::vector<ScannedFile>& files = walk.Files;
+
+    const std::filesystem::path indexPath = config.IndexPath.empty()
+        ? m_AssetsRoot / AssetIndex::kFileName
+        : config.IndexPath;
+    AssetIndex index;
+    const bool indexLoaded = config.UseIndex && index.Load(indexPath);
+
+    // Files whose stats match the index keep its entry, parsed metadata
+    // included; the rest read their .meta.
+    std::vector<std::string> keys(files.size());
+    std::vector<AssetIndexEntry> entries(files.size());
+    std::vector<size_t> reads;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (files[i].IsDirectory) {
             continue;
         }
-
-        if (!entry.is_regular_file(ec)) {
-            continue;
+        ++m_ScanStats.FileCount;
+        keys[i] = files[i].RelativePath.generic_string();
+        entries[i] = files[i].Stats;
+        const AssetIndexEntry* previous = index.Find(keys[i]);
+        if (previous && previous->HasSameStats(entries[i])) {
+            entries[i] = *previous;
+            ++m_ScanStats.IndexHits;
+        } else if (entries[i].HasMetaFile) {
+            reads.push_back(i);
         }
-
-        if (sourcePath.extension() == ".meta") {
-            continue;
+    }
+    m_ScanStats.MetadataReads = reads.size();
+
+    std::atomic<size_t> metadataParses = 0;
+    ForEachIndex(m_Jobs, reads.size(), [&](size_t read) {
+        const size_t i = reads[read];
+        std::ifstream file(GetMetaPath(m_AssetsRoot / files[i].RelativePath), std::ios::binary);
+        std::ostringstream text;
+        text << file.rdbuf();
+        const std::string metadataText = text.str();
+
+        AssetIndexEntry& entry = entries[i];
+        entry.MetaHash = AssetIndex::HashText(metadataText);
+        const AssetIndexEntry* previous = index.Find(keys[i]);
+        if (previous && previous->HasMetaFile && previous->MetaHash == entry.MetaHash) {
+            // Touched but not changed, as after a checkout.
+            entry.Metadata = previous->Metadata;
+            return;
         }
+        metadataParses.fetch_add(1, std::memory_order_relaxed);
+        entry.Metadata = ParseMetadata(metadataText);
+    });
+    m_ScanStats.MetadataParses = metadataParses.load(std::memory_order_relaxed);
 
-        AssetType type = AssetTypeFromPath(sourcePath);
-        if (type == AssetType::Unknown && !config.IncludeUnknownFiles) {
-            continue;
+    std::vector<AssetRecord> records;
+    records.reserve(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        const ScannedFile& file = files[i];
+        AssetType type = AssetType::Folder;
+        if (file.IsDirectory) {
+            if (!config.IncludeDirectories) {
+                continue;
+            }
+        } else {
+            type = AssetTypeFromPath(file.RelativePath);
+            if (type == AssetType::Unknown && !config.IncludeUnknownFiles) {
+                continue;
+            }
         }
 
         AssetRecord record;
         record.Type = type;
-        record.SourcePath = NormalizeAbsolutePath(sourcePath);
-        record.RelativePath = NormalizeRelativePath(m_AssetsRoot, record.SourcePath);
+        record.IsDirectory = file.IsDirectory;
+        // The root is canonical already; only links need resolving.
+        if (file.IsSymlink) {
+            record.SourcePath = NormalizeAbsolutePath(m_AssetsRoot / file.RelativePath);
+            record.RelativePath = NormalizeRelativePath(m_AssetsRoot, record.SourcePath);
+        } else {
+            record.SourcePath = (m_AssetsRoot / file.RelativePath).lexically_normal();
+            record.RelativePath = file.RelativePath.lexically_normal();
+        }
 
-        if (auto metadata = LoadMetadata(GetMetaPath(sourcePath))) {
-            record.Handle = metadata->Handle;
-            record.Type = metadata->Type == AssetType::Unknown ? record.Type : metadata->Type;
+        const AssetIndexEntry& entry = entries[i];
+        if (!file.IsDirectory && entry.Metadata) {
+            record.Handle = entry.Metadata->Handle;
+            record.Type = entry.Metadata->Type == AssetType::Unknown ? record.Type : entry.Metadata->Type;
             record.HasMetadata = true;
+            if (config.LoadMetadata) {
+                record.Metadata = entry.Metadata;
+            }
         }
-
         records.push_back(std::move(record));
     }
 
-    std::sort(records.begin(), records.end(), [](const AssetRecord& left, const AssetRecord& right) {
-        if (left.RelativePath == right.RelativePath) {
-            return static_cast<uint8_t>(left.Type) < static_cast<uint8_t>(right.Type);
+    // Keys are built once; converting inside the comparator dominated large scans.
+    std::vector<std::pair<std::string, size_t>> order;
+    order.reserve(records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        order.emplace_back(PathSortKey(records[i].RelativePath), i);
+    }
+    std::sort(order.begin(), order.end(), [&records](const auto& left, const auto& right) {
+        if (left.first == right.first) {
+            return static_cast<uint8_t>(records[left.second].Type) < static_cast<uint8_t>(records[right.second].Type);
         }
-        return PathSortKey(left.RelativePath) < PathSortKey(right.RelativePath);
+        return left.first < right.first;
     });
 
-    for (AssetRecord& record : records) {
-        AddRecord(std::move(record));
+    for (const auto& [key, i] : order) {
+        AddRecord(std::move(records[i]));
+    }
+
+    // Rewritten only when a file was added, changed or removed.
+    const size_t fileCount = m_ScanStats.FileCount;
+    if (config.UseIndex && (!indexLoaded || m_ScanStats.IndexHits != fileCount || index.GetSize() != fileCount)) {
+        AssetIndex updated;
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (!files[i].IsDirectory) {
+                updated.Set(std::move(keys[i]), std::move(entries[i]));
+            }
+        }
+        m_ScanStats.IndexSaved = updated.Save(indexPath);
     }
 }
 
@@ -90,6 +283,7 @@ void AssetDatabase::Clear() {
     m_PathToRecord.clear();
     m_HandleToRecord.clear();
     m_Scanned = false;
+    m_ScanStats = ScanStats{};
 }
 
 const AssetRecord* AssetDatabase::GetRecordByPath(const std::filesystem::path& path) const {
@@ -148,21 +342,6 @@ std::filesystem::path AssetDatabase::GetMetaPath(const std::filesystem::path& so
     return sourcePath.string() + ".meta";
 }
 
-std::optional<AssetMetadata> AssetDatabase::LoadMetadata(const std::filesystem::path& metaPath) {
-    std::ifstream file(metaPath);
-    if (!file.is_open()) {
-        return std::nullopt;
-    }
-
-    try {
-        nlohmann::json data;
-        file >> data;
-        return AssetMetadata::Deserialize(data);
-    } catch (...) {
-        return std::nullopt;
-    }
-}
-
 std::string AssetDatabase::MakePathKey(const std::filesystem::path& path) const {
     const std::filesystem::path absolutePath = path.is_absolute()
         ? path
@@ -172,8 +351,9 @@ std::string AssetDatabase::MakePathKey(const std::filesystem::path& path) const
 
 void AssetDatabase::AddRecord(AssetRecord record) {
     const size_t index = m_Records.size();
-    const std::string sourceKey = NormalizeAbsolutePath(record.SourcePath).generic_string();
-    const std::string relativeKey = MakePathKey(record.RelativePath);
+    // Scan() hands over normalized paths, so the keys need no filesystem calls.
+    const std::string sourceKey = record.SourcePath.generic_string();
+    const std::string relativeKey = (m_AssetsRoot / record.RelativePath).lexically_normal().generic_string();
 
     m_Records.push_back(std::move(record));
     m_PathToRecord[sourceKey] = index;
@@ -0,0 +1,234 @@
+#include <Zgine/Resources/Core/AssetIndex.h>
+#include <Zgine/Core/Log/Log.h>
+#include <Zgine/Platform/IO/MappedFile.h>
+#include <Platform/IO/BinaryIO.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Zgine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4941475Au; // "ZGAI"
+
+// Entries follow the header, each an EntryRecord, its path and, with
+// HasMetadata, the parsed .meta fields written by WriteMetadata.
+struct FileHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Count;
+    uint32_t Reserved;
+};
+static_assert(sizeof(FileHeader) == 16, "FileHeader is part of the file format");
+
+struct EntryRecord {
+    int64_t SourceWriteTime;
+    uint64_t SourceSize;
+    int64_t MetaWriteTime;
+    uint64_t MetaSize;
+    uint64_t MetaHash;
+    uint32_t HasMetaFile;
+    uint32_t PathLength;
+    uint32_t HasMetadata;
+    uint32_t Reserved;
+};
+static_assert(sizeof(EntryRecord) == 56, "EntryRecord is part of the file format");
+
+// These are stored as is. A changed settings struct changes the file format:
+// bump AssetIndex::kVersion with it.
+static_assert(std::is_trivially_copyable_v<TextureImportSettings> && sizeof(TextureImportSettings) == 5,
+              "TextureImportSettings is part of the index format");
+static_assert(std::is_trivially_copyable_v<MeshImportSettings> && sizeof(MeshImportSettings) == 32,
+              "MeshImportSettings is part of the index format");
+static_assert(std::is_trivially_copyable_v<AudioImportSettings> && sizeof(AudioImportSettings) == 1,
+              "AudioImportSettings is part of the index format");
+
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+    bool Read(void* target, size_t size) {
+        if (size > m_Size - m_Offset) {
+            return false;
+        }
+        std::memcpy(target, m_Data + m_Offset, size);
+        m_Offset += size;
+        return true;
+    }
+
+    bool ReadString(std::string& target, size_t size) {
+        if (size > m_Size - m_Offset) {
+            return false;
+        }
+        target.assign(reinterpret_cast<const char*>(m_Data + m_Offset), size);
+        m_Offset += size;
+        return true;
+    }
+
+    /** @brief A string written by AppendString: its length, then its bytes. */
+    bool ReadString(std::string& target) {
+        uint32_t length = 0;
+        return Read(&length, sizeof(length)) && ReadString(target, length);
+    }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Offset = 0;
+};
+
+void Append(std::vector<uint8_t>& bytes, const void* data, size_t size) {
+    const auto* begin = static_cast<const uint8_t*>(data);
+    bytes.insert(bytes.end(), begin, begin + size);
+}
+
+void AppendString(std::vector<uint8_t>& bytes, std::string_view text) {
+    const auto length = static_cast<uint32_t>(text.size());
+    Append(bytes, &length, sizeof(length));
+    Append(bytes, text.data(), text.size());
+}
+
+void WriteMetadata(std::vector<uint8_t>& bytes, const AssetMetadata& metadata) {
+    const uint32_t header[3] = { metadata.Version, static_cast<uint32_t>(metadata.Type),
+                                 static_cast<uint32_t>(metadata.Dependencies.size()) };
+    Append(bytes, header, sizeof(header));
+    AppendString(bytes, metadata.Handle.IsValid() ? metadata.Handle.ToString() : std::string());
+    AppendString(bytes, metadata.SourcePath.string());
+    AppendString(bytes, metadata.ImportedPath.string());
+    for (const AssetHandle& dependency : metadata.Dependencies) {
+        AppendString(bytes, dependency.ToString());
+    }
+
+    const AssetImportSettings& settings = metadata.ImportSettings;
+    Append(bytes, &settings.Texture, sizeof(settings.Texture));
+    Append(bytes, &settings.Mesh, sizeof(settings.Mesh));
+    Append(bytes, &settings.Audio, sizeof(settings.Audio));
+    AppendString(bytes, settings.Shader.VertexPath);
+    AppendString(bytes, settings.Shader.FragmentPath);
+    const uint8_t optimize = settings.Shader.Optimize ? 1 : 0;
+    Append(bytes, &optimize, sizeof(optimize));
+}
+
+bool ReadMetadata(Reader& reader, AssetMetadata& metadata) {
+    uint32_t header[3] = {};
+    std::string handle;
+    std::string sourcePath;
+    std::string importedPath;
+    if (!reader.Read(header, sizeof(header)) || !reader.ReadString(handle) || !reader.ReadString(sourcePath)
+        || !reader.ReadString(importedPath)) {
+        return false;
+    }
+    metadata.Version = header[0];
+    metadata.Type = static_cast<AssetType>(header[1]);
+    if (!handle.empty()) {
+        metadata.Handle = AssetHandle::FromString(handle);
+    }
+    metadata.SourcePath = sourcePath;
+    metadata.ImportedPath = importedPath;
+
+    metadata.Dependencies.reserve(std::min<size_t>(header[2], 1024));
+    for (uint32_t i = 0; i < header[2]; ++i) {
+        if (!reader.ReadString(handle)) {
+            return false;
+        }
+        metadata.Dependencies.push_back(AssetHandle::FromString(handle));
+    }
+
+    AssetImportSettings& settings = metadata.ImportSettings;
+    uint8_t optimize = 0;
+    if (!reader.Read(&settings.Texture, sizeof(settings.Texture)) || !reader.Read(&settings.Mesh, sizeof(settings.Mesh))
+        || !reader.Read(&settings.Audio, sizeof(settings.Audio)) || !reader.ReadString(settings.Shader.VertexPath)
+        || !reader.ReadString(settings.Shader.FragmentPath) || !reader.Read(&optimize, sizeof(optimize))) {
+        return false;
+    }
+    settings.Shader.Optimize = optimize != 0;
+    return static_cast<uint8_t>(settings.Mesh.Format) <= static_cast<uint8_t>(VertexFormat::QuantizedColor);
+}
+
+} // namespace
+
+bool AssetIndex::Load(const std::filesystem::path& path) {
+    m_Entries.clear();
+    MappedFile file = MappedFile::Open(path);
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    Reader reader(file.GetData(), file.GetSize());
+    FileHeader header{};
+    if (!reader.Read(&header, sizeof(header)) || header.Magic != kMagic || header.Version != kVersion) {
+        return false;
+    }
+
+    m_Entries.reserve(std::min<size_t>(header.Count, file.GetSize() / sizeof(EntryRecord)));
+    for (uint32_t i = 0; i < header.Count; ++i) {
+        EntryRecord record{};
+        std::string relativePath;
+        AssetIndexEntry entry;
+        bool valid = reader.Read(&record, sizeof(record)) && reader.ReadString(relativePath, record.PathLength);
+        if (valid && record.HasMetadata != 0) {
+            valid = ReadMetadata(reader, entry.Metadata.emplace());
+        }
+        if (!valid) {
+            ZGINE_CORE_WARN("AssetIndex: {} is truncated, rescanning", path.string());
+            m_Entries.clear();
+            return false;
+        }
+
+        entry.SourceWriteTime = record.SourceWriteTime;
+        entry.SourceSize = record.SourceSize;
+        entry.HasMetaFile = record.HasMetaFile != 0;
+        entry.MetaWriteTime = record.MetaWriteTime;
+        entry.MetaSize = record.MetaSize;
+        entry.MetaHash = record.MetaHash;
+        m_Entries.emplace(std::move(relativePath), std::move(entry));
+    }
+    return true;
+}
+
+bool AssetIndex::Save(const std::filesystem::path& path) const {
+    std::vector<uint8_t> bytes;
+    const FileHeader header{ kMagic, kVersion, static_cast<uint32_t>(m_Entries.size()), 0 };
+    Append(bytes, &header, sizeof(header));
+
+    for (const auto& [relativePath, entry] : m_Entries) {
+        EntryRecord record{};
+        record.SourceWriteTime = entry.SourceWriteTime;
+        record.SourceSize = entry.SourceSize;
+        record.MetaWriteTime = entry.MetaWriteTime;
+        record.MetaSize = entry.MetaSize;
+        record.MetaHash = entry.MetaHash;
+        record.HasMetaFile = entry.HasMetaFile ? 1u : 0u;
+        record.PathLength = static_cast<uint32_t>(relativePath.size());
+        record.HasMetadata = entry.Metadata ? 1u : 0u;
+        Append(bytes, &record, sizeof(record));
+        Append(bytes, relativePath.data(), relativePath.size());
+        if (entry.Metadata) {
+            WriteMetadata(bytes, *entry.Metadata);
+        }
+    }
+
+    std::error_code ec;
+    if (!Internal::WriteFileAtomically(path, bytes.data(), bytes.size(), ec)) {
+        ZGINE_CORE_WARN("AssetIndex: failed to write {} ({})", path.string(), ec.message());
+        return false;
+    }
+    return true;
+}
+
+const AssetIndexEntry* AssetIndex::Find(std::string_view relativePath) const {
+    auto it = m_Entries.find(std::string(relativePath));
+    return it != m_Entries.end() ? &it->second : nullptr;
+}
+
+void AssetIndex::Set(std::string relativePath, AssetIndexEntry entry) {
+    m_Entries[std::move(relativePath)] = std::move(entry);
+}
+
+uint64_t AssetIndex::HashText(std::string_view text) {
+    return Internal::Fnv1a(Internal::kFnvOffset, text.data(), text.size());
+}
+
+} // namespace Zgine
@@ -1,70 +1,164 @@
 #include <Zgine/Resources/Core/AssetManager.h>
+#include <Zgine/Resources/Core/AssetDatabase.h>
 #include <Zgine/Core/Log/Log.h>
 #include <Zgine/Core/Foundation/Macro.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <limits>
 
 namespace Zgine {
 
-AssetManager& AssetManager::Get() {
-    static AssetManager instance;
-    return instance;
+struct AssetLoadGroup::State {
+    mutable std::mutex Mutex;
+    std::condition_variable Finished;
+    std::vector<AssetHandle> Handles;
+    std::unordered_map<AssetHandle, size_t> Index;
+    std::vector<std::vector<size_t>> Dependents;
+    std::vector<size_t> Remaining; // unfinished dependencies
+    std::vector<std::shared_ptr<Asset>> Assets;
+    size_t Completed = 0;
+    size_t Failed = 0;
+};
+
+size_t AssetLoadGroup::GetTotal() const {
+    if (!m_State) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Handles.size();
 }
 
-void AssetManager::CacheEntryDeleter::operator()(CacheEntry* entry) const {
-    if (!entry) {
-        return;
+size_t AssetLoadGroup::GetCompleted() const {
+    if (!m_State) {
+        return 0;
     }
-    entry->~CacheEntry();
-    if (Pool) {
-        Pool->Deallocate(entry);
-    } else {
-        ::operator delete(entry);
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Completed;
+}
+
+size_t AssetLoadGroup::GetFailed() const {
+    if (!m_State) {
+        return 0;
     }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Failed;
 }
 
-void AssetManager::Initialize(const AssetManagerConfig& config) {
-    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+float AssetLoadGroup::GetProgress() const {
+    if (!m_State) {
+        return 1.0f;
+    }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    if (m_State->Handles.empty()) {
+        return 1.0f;
+    }
+    return static_cast<float>(m_State->Completed) / static_cast<float>(m_State->Handles.size());
+}
 
-    m_Config = config;
-    m_Metadata.clear();
-    m_PathToHandle.clear();
-    m_Cache.clear();
-    m_DirtyAssets.clear();
-    m_CurrentCacheBytes = 0;
-    m_AccessCounter = 0;
+bool AssetLoadGroup::IsDone() const {
+    if (!m_State) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Completed == m_State->Handles.size();
+}
 
-    if (m_Config.CacheEntryPoolSize > 0) {
-        m_CacheEntryPool = std::make_unique<MemoryPool>(sizeof(CacheEntry), m_Config.CacheEntryPoolSize);
-    } else {
-        m_CacheEntryPool.reset();
+std::shared_ptr<Asset> AssetLoadGroup::GetAsset(AssetHandle handle) const {
+    if (!m_State) {
+        return nullptr;
     }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    auto it = m_State->Index.find(handle);
+    return it != m_State->Index.end() ? m_State->Assets[it->second] : nullptr;
+}
 
-    RegisterImporters();
+AssetManager& AssetManager::Get() {
+    static AssetManager instance;
+    return instance;
+}
 
-    m_FileWatcher.SetCallback([this](const std::filesystem::path& path, FileStatus status) {
-        OnFileChanged(path, status);
-    });
+void AssetManager::Initialize(const AssetManagerConfig& config) {
+    CancelLoads();
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+        m_Config = config;
+        m_MainThread = std::this_thread::get_id();
+        m_Metadata.clear();
+        m_PathToHandle.clear();
+        m_Cache.Configure(m_Config.Cache);
+        m_DirtyAssets.clear();
+        m_HasDirtyAssets = false;
+        m_TextureStreamer.Clear();
+        m_TextureStreamer.SetConfig(m_Config.TextureStreaming);
+
+        RegisterImporters();
+
+        m_FileWatcher.SetConfig(m_Config.FileWatching);
+        m_FileWatcher.SetCallback([this](const std::filesystem::path& path, FileStatus status) {
+            OnFileChanged(path, status);
+        });
 
-    m_Initialized = true;
+        m_Initialized = true;
+    }
     ScanAssets();
 }
 
 void AssetManager::Shutdown() {
+    UnloadAll();
     std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 
     m_FileWatcher.Clear();
     m_Importers.clear();
-    m_Cache.clear();
     m_Metadata.clear();
     m_PathToHandle.clear();
     m_DirtyAssets.clear();
-    m_CacheEntryPool.reset();
-    m_CurrentCacheBytes = 0;
-    m_AccessCounter = 0;
+    m_HasDirtyAssets = false;
     m_Initialized = false;
 }
 
+void AssetManager::CancelLoads() {
+    // Running loads finish first: they take the lock to complete.
+    if (m_Jobs) {
+        m_Jobs->Wait(m_LoadCounter);
+    }
+
+    std::vector<PendingLoadPtr> cancelled;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        for (auto& [handle, load] : m_PendingLoads) {
+            cancelled.push_back(std::move(load));
+        }
+        m_PendingLoads.clear();
+        m_UploadQueue.clear();
+        m_FailedLoads.clear();
+    }
+    for (const PendingLoadPtr& load : cancelled) {
+        for (auto& waiter : load->Waiters) {
+            waiter(nullptr);
+        }
+    }
+}
+
+void AssetManager::SetJobSystem(JobSystem* jobs) {
+    if (m_Jobs) {
+        m_Jobs->Wait(m_LoadCounter);
+        m_Jobs->SetOwnerWork(nullptr);
+    }
+    if (jobs) {
+        // A job may block on an upload, so the main thread finishes uploads
+        // while it waits on jobs, one per turn so queued jobs still run.
+        jobs->SetOwnerWork([this]() {
+            return std::this_thread::get_id() == m_MainThread && ProcessUploads(0.0f);
+        });
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    m_Jobs = jobs;
+}
+
 bool AssetManager::IsInitialized() const {
     std::lock_guard<std::recursive_mutex> lock(m_Mutex);
     return m_Initialized;
@@ -78,20 +172,6 @@ void AssetManager::RegisterImporters() {
     m_Importers[AssetType::Shader] = std::make_unique<ShaderImporter>();
 }
 
-AssetManager::CacheEntryPtr AssetManager::CreateCacheEntry(const std::shared_ptr<Asset>& asset) {
-    CacheEntry* entry = nullptr;
-    if (m_CacheEntryPool) {
-        entry = static_cast<CacheEntry*>(m_CacheEntryPool->Allocate());
-    } else {
-        entry = static_cast<CacheEntry*>(::operator new(sizeof(CacheEntry)));
-    }
-    new (entry) CacheEntry();
-    entry->AssetData = asset;
-    entry->SizeBytes = asset ? asset->GetSizeBytes() : 0;
-    entry->LastAccess = ++m_AccessCounter;
-    return CacheEntryPtr(entry, CacheEntryDeleter{m_CacheEntryPool.get()});
-}
-
 std::string AssetManager::NormalizePath(const std::filesystem::path& path) const {
     std::error_code ec;
     auto normalized = std::filesystem::weakly_canonical(path, ec);
@@ -141,37 +221,41 @@ void AssetManager::WatchAssetPaths(const AssetMetadata& metadata) {
 }
 
 void AssetManager::ScanAssets() {
-    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    AssetDatabase database;
+    AssetDatabaseConfig config;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        if (!m_Initialized) {
+            return;
+        }
 
-    if (!m_Initialized) {
-        return;
+        std::error_code ec;
+        if (!std::filesystem::exists(m_Config.AssetsRoot, ec)) {
+            ZGINE_CORE_WARN("AssetManager: assets root not found: {}", m_Config.AssetsRoot.string());
+            return;
+        }
+        database.SetJobSystem(m_Jobs);
+        config.AssetsRoot = m_Config.AssetsRoot;
     }
 
-    std::error_code ec;
-    if (!std::filesystem::exists(m_Config.AssetsRoot, ec)) {
-        ZGINE_CORE_WARN("AssetManager: assets root not found: {}", m_Config.AssetsRoot.string());
+    // The walk and .meta parsing run on jobs, outside the lock: a thread that
+    // waits on them may pick up a load that needs it.
+    config.IncludeDirectories = false;
+    config.IncludeUnknownFiles = false;
+    config.LoadMetadata = true;
+    database.Scan(config);
+
+    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+    if (!m_Initialized) {
         return;
     }
-
-    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_Config.AssetsRoot, ec)) {
-        if (ec) {
-            continue;
-        }
-        if (!entry.is_regular_file()) {
-            continue;
+    for (const AssetRecord& record : database.GetRecords()) {
+        // The path as a directory walk from the configured root spells it, which is what .meta files record.
+        const std::filesystem::path path = m_Config.AssetsRoot / record.RelativePath;
+        std::string normalized = record.SourcePath.string();
+        if (m_PathToHandle.find(normalized) == m_PathToHandle.end()) {
+            AddAsset(path, std::move(normalized), AssetTypeFromPath(path), record.Metadata);
         }
-
-        const auto& path = entry.path();
-        if (path.extension() == ".meta") {
-            continue;
-        }
-
-        AssetType type = AssetTypeFromPath(path);
-        if (type == AssetType::Unknown) {
-            continue;
-        }
-
-        RegisterAsset(path, type);
     }
 }
 
@@ -195,9 +279,12 @@ AssetHandle AssetManager::RegisterAsset(const std::filesystem::path& assetPath,
         return AssetHandle();
     }
 
+    return AddAsset(assetPath, std::move(normalized), type, LoadMetadata(GetMetaPath(assetPath)));
+}
+
+AssetHandle AssetManager::AddAsset(const std::filesystem::path& assetPath, std::string normalized, AssetType type,
+                                   std::optional<AssetMetadata> loaded) {
     AssetMetadata metadata;
-    auto metaPath = GetMetaPath(assetPath);
-    auto loaded = LoadMetadata(metaPath);
     if (loaded) {
         metadata = *loaded;
         metadata.Type = type;
@@ -211,10 +298,14 @@ AssetHandle AssetManager::RegisterAsset(const std::filesystem::path& assetPath,
         metadata.SourcePath = assetPath;
     }
 
-    SaveMetadata(metadata);
+    // Rewriting an unchanged .meta would touch every file on each scan and wake the file watcher.
+    if (!loaded || loaded->Handle != metadata.Handle || loaded->Type != metadata.Type
+        || loaded->SourcePath != metadata.SourcePath) {
+        SaveMetadata(metadata);
+    }
 
     m_Metadata[metadata.Handle] = metadata;
-    m_PathToHandle[normalized] = metadata.Handle;
+    m_PathToHandle[std::move(normalized)] = metadata.Handle;
     WatchAssetPaths(metadata);
 
     return metadata.Handle;
@@ -302,120 +393,416 @@ AssetImportResult AssetManager::ImportAssetInternal(AssetMetadata& metadata) {
     return result;
 }
 
-std::shared_ptr<Asset> AssetManager::LoadAssetInternal(AssetHandle handle) {
+std::shared_ptr<Asset> AssetManager::FindCachedLocked(AssetHandle handle) {
+    if (m_DirtyAssets.find(handle) != m_DirtyAssets.end()) {
+        UnloadAsset(handle);
+        m_DirtyAssets.erase(handle);
+        m_HasDirtyAssets = !m_DirtyAssets.empty();
+    }
+
+    if (auto cached = m_Cache.Find(handle)) {
+        return cached;
+    }
+    auto metaIt = m_Metadata.find(handle);
+    if (metaIt != m_Metadata.end()) {
+        m_Cache.RecordMiss(metaIt->second.Type);
+    }
+    return nullptr;
+}
+
+AssetManager::PendingLoadPtr AssetManager::CreateLoadLocked(AssetHandle handle) {
     auto metaIt = m_Metadata.find(handle);
     if (metaIt == m_Metadata.end()) {
         return nullptr;
     }
+    auto importerIt = m_Importers.find(metaIt->second.Type);
+    if (importerIt == m_Importers.end()) {
+        ZGINE_CORE_WARN("AssetManager: no importer for type {}", AssetTypeToString(metaIt->second.Type));
+        m_FailedLoads.insert(handle);
+        return nullptr;
+    }
+
+    auto load = std::make_shared<PendingLoad>();
+    load->Metadata = metaIt->second;
+    load->Importer = importerIt->second.get();
+    m_PendingLoads[handle] = load;
+    m_FailedLoads.erase(handle);
+    return load;
+}
 
-    auto cacheIt = m_Cache.find(handle);
-    if (cacheIt != m_Cache.end() && cacheIt->second && cacheIt->second->AssetData) {
-        cacheIt->second->LastAccess = ++m_AccessCounter;
-        return cacheIt->second->AssetData;
+void AssetManager::RunPrepare(const PendingLoadPtr& load) {
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        load->State = AssetLoadState::Loading;
     }
 
-    AssetMetadata& metadata = metaIt->second;
-    AssetImportResult result = ImportAssetInternal(metadata);
-    if (!result.AssetData) {
-        return nullptr;
+    AssetImportContext context;
+    context.Manager = this;
+    load->Payload = load->Importer->Prepare(load->Metadata, context);
+
+    if (load->Importer->UploadsToGpu()) {
+        JobSystem* jobs = nullptr;
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            load->State = AssetLoadState::Uploading;
+            m_UploadQueue.push_back(load);
+            jobs = m_Jobs;
+        }
+        if (jobs) {
+            jobs->NotifyOwner();
+        }
+        return;
     }
+    CompleteLoad(load, load->Importer->Finalize(load->Metadata, std::move(load->Payload), context));
+}
+
+std::shared_ptr<Asset> AssetManager::CompleteLoad(const PendingLoadPtr& load, AssetImportResult result) {
+    const AssetHandle handle = load->Metadata.Handle;
+    std::vector<LoadCallback> waiters;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 
-    CacheEntryPtr entry = CreateCacheEntry(result.AssetData);
-    m_CurrentCacheBytes += entry->SizeBytes;
-    m_Cache[handle] = std::move(entry);
-    TrimCache();
-    return m_Cache[handle]->AssetData;
+        auto pendingIt = m_PendingLoads.find(handle);
+        if (pendingIt != m_PendingLoads.end() && pendingIt->second == load) {
+            m_PendingLoads.erase(pendingIt);
+        }
+        waiters.swap(load->Waiters);
+
+        if (result.AssetData) {
+            auto metaIt = m_Metadata.find(handle);
+            if (metaIt != m_Metadata.end() && result.Dependencies != metaIt->second.Dependencies) {
+                metaIt->second.Dependencies = result.Dependencies;
+                SaveMetadata(metaIt->second);
+            }
+
+            m_Cache.Insert(result.AssetData);
+        } else {
+            m_FailedLoads.insert(handle);
+        }
+    }
+
+    for (auto& waiter : waiters) {
+        waiter(result.AssetData);
+    }
+    return result.AssetData;
 }
 
-std::shared_ptr<Asset> AssetManager::LoadAsset(AssetHandle handle) {
-    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+bool AssetManager::ProcessUploads(float budgetMs) {
+    const auto start = std::chrono::steady_clock::now();
+    bool processed = false;
+    for (;;) {
+        PendingLoadPtr load;
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+            if (m_UploadQueue.empty()) {
+                break;
+            }
+            load = std::move(m_UploadQueue.front());
+            m_UploadQueue.pop_front();
+        }
 
-    if (!m_Initialized || !handle.IsValid()) {
-        return nullptr;
+        AssetImportContext context;
+        context.Manager = this;
+        CompleteLoad(load, load->Importer->Finalize(load->Metadata, std::move(load->Payload), context));
+        processed = true;
+
+        const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) {
+            break;
+        }
     }
+    return processed;
+}
 
-    if (m_DirtyAssets.find(handle) != m_DirtyAssets.end()) {
-        UnloadAsset(handle);
-        m_DirtyAssets.erase(handle);
+void AssetManager::DrainUploadsUntil(const std::function<bool()>& ready) {
+    // The upload waited for may sit behind others, and nobody else drains the queue.
+    while (!ready()) {
+        if (!ProcessUploads(std::numeric_limits<float>::max())) {
+            std::this_thread::yield();
+        }
     }
+}
 
-    return LoadAssetInternal(handle);
+std::shared_ptr<Asset> AssetManager::Await(std::future<std::shared_ptr<Asset>> future) {
+    // Elsewhere the main thread finishes the upload: in Update(), or in
+    // JobSystem::Wait() if it is waiting on this thread's job.
+    if (std::this_thread::get_id() == m_MainThread) {
+        DrainUploadsUntil([&future]() {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+    }
+    return future.get();
 }
 
-std::future<std::shared_ptr<Asset>> AssetManager::LoadAssetAsync(AssetHandle handle) {
-    AssetType type = AssetType::Unknown;
+std::shared_ptr<Asset> AssetManager::LoadAsset(AssetHandle handle) {
+    if (!m_HasDirtyAssets.load(std::memory_order_acquire)) {
+        if (auto cached = m_Cache.Find(handle)) {
+            return cached;
+        }
+    }
+
+    PendingLoadPtr load;
+    std::future<std::shared_ptr<Asset>> joined;
     {
         std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
         if (!m_Initialized || !handle.IsValid()) {
-            return std::async(std::launch::deferred, []() { return std::shared_ptr<Asset>(); });
+            return nullptr;
+        }
+        if (auto cached = FindCachedLocked(handle)) {
+            return cached;
         }
 
-        auto metadataIt = m_Metadata.find(handle);
-        if (metadataIt == m_Metadata.end()) {
-            return std::async(std::launch::deferred, []() { return std::shared_ptr<Asset>(); });
+        auto pendingIt = m_PendingLoads.find(handle);
+        if (pendingIt != m_PendingLoads.end()) {
+            auto promise = std::make_shared<std::promise<std::shared_ptr<Asset>>>();
+            joined = promise->get_future();
+            pendingIt->second->Waiters.push_back([promise](const std::shared_ptr<Asset>& asset) {
+                promise->set_value(asset);
+            });
+        } else {
+            load = CreateLoadLocked(handle);
+            if (!load) {
+                return nullptr;
+            }
+            load->State = AssetLoadState::Loading;
         }
-        type = metadataIt->second.Type;
     }
 
-    if (!IsThreadSafeAsset(type)) {
-        return std::async(std::launch::deferred, [this, handle]() { return LoadAsset(handle); });
+    if (!load) {
+        return Await(std::move(joined));
     }
-
-    return std::async(std::launch::async, [this, handle]() { return LoadAsset(handle); });
+    AssetImportContext context;
+    context.Manager = this;
+    return CompleteLoad(load, load->Importer->Import(load->Metadata, context));
 }
 
-void AssetManager::UnloadAsset(AssetHandle handle) {
-    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+void AssetManager::RequestLoad(AssetHandle handle, LoadCallback callback) {
+    if (!m_HasDirtyAssets.load(std::memory_order_acquire)) {
+        if (auto cached = m_Cache.Find(handle)) {
+            callback(cached);
+            return;
+        }
+    }
 
-    auto it = m_Cache.find(handle);
-    if (it == m_Cache.end()) {
-        return;
+    PendingLoadPtr load;
+    std::shared_ptr<Asset> ready;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+        if (m_Initialized && handle.IsValid()) {
+            ready = FindCachedLocked(handle);
+            if (!ready) {
+                auto pendingIt = m_PendingLoads.find(handle);
+                if (pendingIt != m_PendingLoads.end()) {
+                    pendingIt->second->Waiters.push_back(std::move(callback));
+                    return;
+                }
+                load = CreateLoadLocked(handle);
+            }
+        }
+        if (load) {
+            load->Waiters.push_back(std::move(callback));
+            if (m_Jobs) {
+                m_Jobs->Run([this, load]() { RunPrepare(load); }, &m_LoadCounter);
+                return;
+            }
+        }
     }
 
-    if (it->second && it->second->AssetData && it->second->AssetData.use_count() > 1) {
-        return;
+    if (load) {
+        RunPrepare(load);
+    } else {
+        callback(ready);
     }
+}
 
-    m_CurrentCacheBytes = (m_CurrentCacheBytes >= it->second->SizeBytes)
-        ? (m_CurrentCacheBytes - it->second->SizeBytes)
-        : 0;
-    m_Cache.erase(it);
+std::future<std::shared_ptr<Asset>> AssetManager::LoadAssetAsync(AssetHandle handle) {
+    auto promise = std::make_shared<std::promise<std::shared_ptr<Asset>>>();
+    std::future<std::shared_ptr<Asset>> future = promise->get_future();
+    RequestLoad(handle, [promise](const std::shared_ptr<Asset>& asset) {
+        promise->set_value(asset);
+    });
+    return future;
 }
 
-void AssetManager::TrimCache() {
-    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+std::shared_ptr<Asset> AssetManager::WaitForAsset(AssetHandle handle) {
+    return Await(LoadAssetAsync(handle));
+}
 
-    if (m_CurrentCacheBytes <= m_Config.MaxCacheSizeBytes) {
-        return;
+AssetLoadGroup AssetManager::LoadAssetsAsync(std::span<const AssetHandle> handles) {
+    auto group = std::make_shared<AssetLoadGroup::State>();
+    std::vector<size_t> leaves;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+        auto add = [&group](AssetHandle handle) {
+            auto [it, inserted] = group->Index.try_emplace(handle, group->Handles.size());
+            if (inserted) {
+                group->Handles.push_back(handle);
+                group->Dependents.emplace_back();
+                group->Remaining.push_back(0);
+            }
+            return it->second;
+        };
+        for (const AssetHandle& handle : handles) {
+            if (handle.IsValid()) {
+                add(handle);
+            }
+        }
+        // Handles grows while it is walked: breadth first over the recorded dependencies.
+        for (size_t index = 0; index < group->Handles.size(); ++index) {
+            auto metaIt = m_Metadata.find(group->Handles[index]);
+            if (metaIt == m_Metadata.end()) {
+                continue;
+            }
+            for (const AssetHandle& dependency : metaIt->second.Dependencies) {
+                if (!dependency.IsValid() || dependency == group->Handles[index]) {
+                    continue;
+                }
+                const size_t dependencyIndex = add(dependency);
+                group->Dependents[dependencyIndex].push_back(index);
+                ++group->Remaining[index];
+            }
+        }
+        group->Assets.resize(group->Handles.size());
+
+        // Kahn's algorithm: whatever never runs out of dependencies sits on a cycle.
+        std::vector<size_t> remaining = group->Remaining;
+        std::vector<size_t> order;
+        order.reserve(remaining.size());
+        for (size_t index = 0; index < remaining.size(); ++index) {
+            if (remaining[index] == 0) {
+                order.push_back(index);
+            }
+        }
+        for (size_t cursor = 0; cursor < order.size(); ++cursor) {
+            for (size_t dependent : group->Dependents[order[cursor]]) {
+                if (--remaining[dependent] == 0) {
+                    order.push_back(dependent);
+                }
+            }
+        }
+        for (size_t index = 0; index < remaining.size(); ++index) {
+            if (remaining[index] != 0) {
+                ZGINE_CORE_WARN("AssetManager: dependency cycle through {}; loading it without waiting",
+                    group->Handles[index].ToString());
+                group->Remaining[index] = 0;
+            }
+        }
+        for (size_t index = 0; index < group->Remaining.size(); ++index) {
+            if (group->Remaining[index] == 0) {
+                leaves.push_back(index);
+            }
+        }
     }
 
-    std::vector<std::pair<AssetHandle, uint64_t>> entries;
-    entries.reserve(m_Cache.size());
-    for (const auto& [handle, entry] : m_Cache) {
-        if (!entry) {
-            continue;
+    AssetLoadGroup result;
+    result.m_State = group;
+    for (size_t index : leaves) {
+        StartGroupLoad(group, index);
+    }
+    return result;
+}
+
+void AssetManager::StartGroupLoad(const std::shared_ptr<AssetLoadGroup::State>& group, size_t index) {
+    RequestLoad(group->Handles[index], [this, group, index](const std::shared_ptr<Asset>& asset) {
+        std::vector<size_t> ready;
+        {
+            std::lock_guard<std::mutex> lock(group->Mutex);
+            group->Assets[index] = asset;
+            ++group->Completed;
+            if (!asset) {
+                ++group->Failed;
+            }
+            // Members of a cycle were started early and are already at zero.
+            for (size_t dependent : group->Dependents[index]) {
+                if (group->Remaining[dependent] > 0 && --group->Remaining[dependent] == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+            if (group->Completed == group->Handles.size()) {
+                group->Finished.notify_all();
+            }
+        }
+        for (size_t next : ready) {
+            StartGroupLoad(group, next);
         }
-        entries.emplace_back(handle, entry->LastAccess);
+    });
+}
+
+bool AssetManager::WaitForAssets(const AssetLoadGroup& group) {
+    if (!group.m_State) {
+        return true;
     }
+    if (std::this_thread::get_id() == m_MainThread) {
+        DrainUploadsUntil([&group]() { return group.IsDone(); });
+    } else {
+        AssetLoadGroup::State& state = *group.m_State;
+        std::unique_lock<std::mutex> lock(state.Mutex);
+        state.Finished.wait(lock, [&state]() { return state.Completed == state.Handles.size(); });
+    }
+    return group.GetFailed() == 0;
+}
 
-    std::sort(entries.begin(), entries.end(),
-              [](const auto& a, const auto& b) { return a.second < b.second; });
+AssetLoadState AssetManager::GetLoadState(AssetHandle handle) const {
+    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 
-    for (const auto& [handle, access] : entries) {
-        ZGINE_UNUSED(access);
-        if (m_CurrentCacheBytes <= m_Config.MaxCacheSizeBytes) {
-            break;
+    auto pendingIt = m_PendingLoads.find(handle);
+    if (pendingIt != m_PendingLoads.end()) {
+        return pendingIt->second->State;
+    }
+    if (m_Cache.Contains(handle)) {
+        return AssetLoadState::Loaded;
+    }
+    return m_FailedLoads.contains(handle) ? AssetLoadState::Failed : AssetLoadState::Unloaded;
+}
+
+size_t AssetManager::CookAssets() {
+    std::vector<AssetMetadata> assets;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+        if (!m_Initialized) {
+            return 0;
         }
-        auto it = m_Cache.find(handle);
-        if (it == m_Cache.end() || !it->second || !it->second->AssetData) {
-            continue;
+        assets.reserve(m_Metadata.size());
+        for (const auto& [handle, metadata] : m_Metadata) {
+            assets.push_back(metadata);
         }
-        if (it->second->AssetData.use_count() > 1) {
-            continue;
+    }
+
+    // Cooking reads and writes files only, so loads are not held up meanwhile.
+    size_t cooked = 0;
+    for (const AssetMetadata& metadata : assets) {
+        auto importerIt = m_Importers.find(metadata.Type);
+        if (importerIt != m_Importers.end() && importerIt->second->Cook(metadata)) {
+            ++cooked;
         }
-        m_CurrentCacheBytes -= it->second->SizeBytes;
-        m_Cache.erase(it);
     }
+    ZGINE_CORE_INFO("AssetManager: {} of {} assets cooked", cooked, assets.size());
+    return cooked;
+}
+
+void AssetManager::UnloadAsset(AssetHandle handle) {
+    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+    m_FailedLoads.erase(handle);
+    if (m_Cache.IsInUse(handle)) {
+        return;
+    }
+    m_Cache.Remove(handle);
+}
+
+void AssetManager::UnloadAll() {
+    CancelLoads();
+    std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+    m_Cache.Clear();
+    m_TextureStreamer.Clear();
+}
+
+void AssetManager::TrimCache() {
+    m_Cache.Trim();
 }
 
 void AssetManager::OnFileChanged(const std::filesystem::path& path, FileStatus status) {
@@ -460,9 +847,17 @@ void AssetManager::MarkDirty(AssetHandle handle) {
         return;
     }
     m_DirtyAssets.insert(handle);
+    m_HasDirtyAssets = true;
 }
 
 void AssetManager::Update() {
+    if (!IsInitialized()) {
+        return;
+    }
+    ProcessUploads(m_Config.UploadBudgetMs);
+    // Loads on workers evict too; the GPU objects of what they evicted are freed here.
+    m_Cache.ReleaseEvicted();
+
     std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 
     if (!m_Initialized || !m_HotReloadEnabled) {
@@ -477,42 +872,22 @@ void AssetManager::Update() {
 
     std::unordered_set<AssetHandle> pending = std::move(m_DirtyAssets);
     m_DirtyAssets.clear();
+    m_HasDirtyAssets = false;
 
     for (const auto& handle : pending) {
         auto metaIt = m_Metadata.find(handle);
         if (metaIt == m_Metadata.end()) {
             continue;
         }
-        auto cacheIt = m_Cache.find(handle);
-        if (cacheIt == m_Cache.end() || !cacheIt->second || !cacheIt->second->AssetData) {
-            continue;
-        }
-        if (cacheIt->second->AssetData.use_count() > 1) {
+        // A changed file may load now; whoever gave up on it sees Unloaded again.
+        m_FailedLoads.erase(handle);
+        if (!m_Cache.Contains(handle) || m_Cache.IsInUse(handle)) {
             continue;
         }
         AssetImportResult result = ImportAssetInternal(metaIt->second);
-        if (!result.AssetData) {
-            continue;
+        if (result.AssetData) {
+            m_Cache.Insert(result.AssetData);
         }
-        m_CurrentCacheBytes = (m_CurrentCacheBytes >= cacheIt->second->SizeBytes)
-            ? (m_CurrentCacheBytes - cacheIt->second->SizeBytes)
-            : 0;
-        cacheIt->second->AssetData = result.AssetData;
-        cacheIt->second->SizeBytes = result.AssetData->GetSizeBytes();
-        cacheIt->second->LastAccess = ++m_AccessCounter;
-        m_CurrentCacheBytes += cacheIt->second->SizeBytes;
-    }
-
-    TrimCache();
-}
-
-bool AssetManager::IsThreadSafeAsset(AssetType type) const {
-    switch (type) {
-        case AssetType::Texture:
-        case AssetType::Shader:
-            return false;
-        default:
-            return true;
     }
 }
 
@@ -0,0 +1,33 @@
+#include <Zgine/Resources/Core/AssetManager.h>
+#include <Zgine/World/Core/World.h>
+#include <Zgine/World/Components/Components.h>
+#include <World/Core/WorldRegistryAccess.h>
+#include <vector>
+
+namespace Zgine {
+
+// Apart from AssetManager.cpp so the manager itself does not depend on the ECS.
+AssetLoadGroup AssetManager::Prefetch(const World& world) {
+    const auto& registry = Internal::GetRegistry(world);
+    std::vector<AssetHandle> handles;
+
+    for (auto entity : registry.view<MeshComponent>()) {
+        handles.push_back(registry.get<MeshComponent>(entity).MeshHandle);
+    }
+    for (auto entity : registry.view<PBRMaterialComponent>()) {
+        const auto& material = registry.get<PBRMaterialComponent>(entity);
+        handles.push_back(material.AlbedoTextureHandle);
+        handles.push_back(material.NormalTextureHandle);
+        handles.push_back(material.MetallicTextureHandle);
+        handles.push_back(material.RoughnessTextureHandle);
+        handles.push_back(material.AOTextureHandle);
+    }
+    for (auto entity : registry.view<AudioSourceComponent>()) {
+        handles.push_back(registry.get<AudioSourceComponent>(entity).AssetRef);
+    }
+
+    // Invalid handles are skipped and duplicates merged by LoadAssetsAsync().
+    return LoadAssetsAsync(handles);
+}
+
+} // namespace Zgine
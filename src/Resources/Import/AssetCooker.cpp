@@ -0,0 +1,583 @@
+#include <Zgine/Resources/Import/AssetCooker.h>
+#include <Zgine/Core/Log/Log.h>
+#include <Platform/IO/BinaryIO.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace Zgine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4B43475Au; // "ZGCK"
+
+enum class BlobType : uint32_t {
+    Mesh = 1,
+    Texture = 2
+};
+
+// The record table follows the header directly, so the header stays a
+// multiple of 16 bytes.
+struct FileHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t Settings;  // CookKey
+    uint64_t SourceSize;
+    int64_t SourceWriteTime;
+    uint64_t SourceHash;
+    uint32_t Type;    // BlobType
+    uint32_t Format;  // TextureFormat for textures, unused for meshes
+    uint32_t Count;   // records in the table
+    uint32_t Reserved[3];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader is part of the file format");
+
+struct MeshRecord {
+    uint32_t Format;  // VertexFormat
+    uint32_t VertexCount;
+    uint32_t IndexCount;
+    uint32_t LodCount;
+    float BoundsMin[3];
+    float BoundsMax[3];
+    float BaseColor[4];
+    uint64_t VertexOffset;
+    uint64_t IndexOffset;
+    uint64_t LodOffset;  // LodCount MeshLod entries
+};
+static_assert(sizeof(MeshRecord) == 80, "MeshRecord is part of the file format");
+static_assert(sizeof(MeshLod) == 16, "MeshLod is stored as is");
+
+struct MipRecord {
+    uint32_t Width;
+    uint32_t Height;
+    uint64_t Offset;
+    uint64_t Size;
+};
+static_assert(sizeof(MipRecord) == 24, "MipRecord is part of the file format");
+
+using Internal::Fnv1a;
+using Internal::kFnvOffset;
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+uint64_t Rotl(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @brief Hash of a whole source file. Four independent multiply lanes over
+ *        8-byte words keep it near memory speed on large models and images,
+ *        where byte-wise FNV-1a would dominate the load.
+ */
+uint64_t HashBytes(uint64_t seed, const uint8_t* data, size_t size) {
+    uint64_t lanes[4] = { seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1 };
+    size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32) {
+        for (int lane = 0; lane < 4; ++lane) {
+            uint64_t word = 0;
+            std::memcpy(&word, data + offset + lane * 8, sizeof(word));
+            lanes[lane] = Rotl(lanes[lane] + word * kPrime2, 31) * kPrime1;
+        }
+    }
+
+    uint64_t hash = Rotl(lanes[0], 1) + Rotl(lanes[1], 7) + Rotl(lanes[2], 12) + Rotl(lanes[3], 18);
+    hash = Fnv1a(hash, data + offset, size - offset);
+    const uint64_t length = size;
+    hash = Fnv1a(hash, &length, sizeof(length));
+
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+// Big streams start on a page so the mapping can be handed to the GPU page by
+// page; small ones are only aligned for their element type, to not pad every
+// tiny mesh or tail mip out to a page.
+size_t GetStreamAlignment(size_t size) {
+    return size >= AssetCooker::kPageAlignment ? AssetCooker::kPageAlignment : 16;
+}
+
+class BlobWriter {
+public:
+    size_t Append(const void* data, size_t size, size_t alignment) {
+        const size_t offset = (m_Bytes.size() + alignment - 1) / alignment * alignment;
+        m_Bytes.resize(offset + size);
+        if (size > 0) {
+            std::memcpy(m_Bytes.data() + offset, data, size);
+        }
+        return offset;
+    }
+
+    void Write(size_t offset, const void* data, size_t size) {
+        std::memcpy(m_Bytes.data() + offset, data, size);
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& GetBytes() const { return m_Bytes; }
+
+private:
+    std::vector<uint8_t> m_Bytes;
+};
+
+bool WriteCookedFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) {
+    std::error_code ec;
+    if (!Internal::WriteFileAtomically(path, bytes.data(), bytes.size(), ec)) {
+        ZGINE_CORE_WARN("AssetCooker: failed to write {} ({})", path.string(), ec.message());
+        return false;
+    }
+    return true;
+}
+
+FileHeader MakeHeader(const CookKey& key, BlobType type) {
+    FileHeader header{};
+    header.Magic = kMagic;
+    header.Version = AssetCooker::kVersion;
+    header.Settings = key.Settings;
+    header.SourceSize = key.SourceSize;
+    header.SourceWriteTime = key.SourceWriteTime;
+    header.SourceHash = key.SourceHash;
+    header.Type = static_cast<uint32_t>(type);
+    return header;
+}
+
+/** @brief Whether @p header was cooked from the source @p key describes; hashes the source only if its stats moved. */
+bool IsFresh(const FileHeader& header, const CookKey& key, const std::filesystem::path& sourcePath) {
+    if (header.Settings != key.Settings) {
+        return false;
+    }
+    if (header.SourceSize == key.SourceSize && header.SourceWriteTime == key.SourceWriteTime) {
+        return true;
+    }
+    return header.SourceSize == key.SourceSize && !sourcePath.empty()
+        && header.SourceHash == AssetCooker::HashSource(sourcePath);
+}
+
+/** @brief Header and record table of a mapped file, or nullptr when they do not check out. */
+const uint8_t* ReadTable(const MappedFile& file, const CookKey& key, const std::filesystem::path& sourcePath,
+                         BlobType type, size_t recordSize, FileHeader& header) {
+    if (!file.IsOpen() || file.GetSize() < sizeof(FileHeader)) {
+        return nullptr;
+    }
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    if (header.Magic != kMagic || header.Version != AssetCooker::kVersion ||
+        header.Type != static_cast<uint32_t>(type) || !IsFresh(header, key, sourcePath)) {
+        return nullptr;
+    }
+    if (header.Count > (file.GetSize() - sizeof(FileHeader)) / recordSize) {
+        return nullptr;
+    }
+    return file.GetData() + sizeof(FileHeader);
+}
+
+bool InRange(const MappedFile& file, uint64_t offset, uint64_t size, size_t alignment) {
+    return offset % alignment == 0 && offset <= file.GetSize() && size <= file.GetSize() - offset;
+}
+
+// sRGB transfer tables for mip filtering: 8-bit encoded to linear, and
+// 12-bit linear back to 8-bit encoded.
+constexpr size_t kLinearSteps = 4096;
+
+const std::array<float, 256>& GetSrgbToLinear() {
+    static const std::array<float, 256> s_Table = [] {
+        std::array<float, 256> table{};
+        for (size_t i = 0; i < table.size(); ++i) {
+            const float encoded = static_cast<float>(i) / 255.0f;
+            table[i] = encoded <= 0.04045f ? encoded / 12.92f : std::pow((encoded + 0.055f) / 1.055f, 2.4f);
+        }
+        return table;
+    }();
+    return s_Table;
+}
+
+const std::array<uint8_t, kLinearSteps>& GetLinearToSrgb() {
+    static const std::array<uint8_t, kLinearSteps> s_Table = [] {
+        std::array<uint8_t, kLinearSteps> table{};
+        for (size_t i = 0; i < table.size(); ++i) {
+            const float linear = static_cast<float>(i) / static_cast<float>(kLinearSteps - 1);
+            const float encoded = linear <= 0.0031308f ? linear * 12.92f
+                                                       : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+            table[i] = static_cast<uint8_t>(std::lround(std::clamp(encoded, 0.0f, 1.0f) * 255.0f));
+        }
+        return table;
+    }();
+    return s_Table;
+}
+
+uint16_t To565(const int color[3]) {
+    const auto r = static_cast<uint16_t>((color[0] * 31 + 127) / 255);
+    const auto g = static_cast<uint16_t>((color[1] * 63 + 127) / 255);
+    const auto b = static_cast<uint16_t>((color[2] * 31 + 127) / 255);
+    return static_cast<uint16_t>(r << 11 | g << 5 | b);
+}
+
+std::array<int, 3> From565(uint16_t color) {
+    const int r = (color >> 11) & 31;
+    const int g = (color >> 5) & 63;
+    const int b = color & 31;
+    return { r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2 };
+}
+
+/** @brief BC1 color half of a BC3 block: bounding-box endpoints, nearest of four colors per texel. */
+void EncodeColorBlock(const uint8_t texels[16][4], uint8_t* out) {
+    int minimum[3] = { 255, 255, 255 };
+    int maximum[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            minimum[c] = std::min<int>(minimum[c], texels[i][c]);
+            maximum[c] = std::max<int>(maximum[c], texels[i][c]);
+        }
+    }
+    // Pull the endpoints in by 1/16 of the range; the box corners are rarely hit exactly.
+    for (int c = 0; c < 3; ++c) {
+        const int inset = (maximum[c] - minimum[c]) >> 4;
+        minimum[c] += inset;
+        maximum[c] -= inset;
+    }
+
+    uint16_t color0 = To565(maximum);
+    uint16_t color1 = To565(minimum);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        // color0 > color1 selects the four-color mode.
+        const std::array<int, 3> end0 = From565(color0);
+        const std::array<int, 3> end1 = From565(color1);
+        std::array<std::array<int, 3>, 4> palette{};
+        for (int c = 0; c < 3; ++c) {
+            palette[0][c] = end0[c];
+            palette[1][c] = end1[c];
+            palette[2][c] = (2 * end0[c] + end1[c] + 1) / 3;
+            palette[3][c] = (end0[c] + 2 * end1[c] + 1) / 3;
+        }
+        for (int i = 0; i < 16; ++i) {
+            uint32_t best = 0;
+            int bestDistance = std::numeric_limits<int>::max();
+            for (uint32_t entry = 0; entry < 4; ++entry) {
+                int distance = 0;
+                for (int c = 0; c < 3; ++c) {
+                    const int delta = texels[i][c] - palette[entry][c];
+                    distance += delta * delta;
+                }
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = entry;
+                }
+            }
+            indices |= best << (2 * i);
+        }
+    }
+
+    std::memcpy(out, &color0, sizeof(color0));
+    std::memcpy(out + 2, &color1, sizeof(color1));
+    std::memcpy(out + 4, &indices, sizeof(indices));
+}
+
+/** @brief Alpha half of a BC3 block: min/max endpoints with the eight-value ramp. */
+void EncodeAlphaBlock(const uint8_t texels[16][4], uint8_t* out) {
+    int minimum = 255;
+    int maximum = 0;
+    for (int i = 0; i < 16; ++i) {
+        minimum = std::min<int>(minimum, texels[i][3]);
+        maximum = std::max<int>(maximum, texels[i][3]);
+    }
+
+    uint64_t indices = 0;
+    if (maximum != minimum) {
+        // alpha0 > alpha1 selects the eight-value mode.
+        std::array<int, 8> palette{};
+        palette[0] = maximum;
+        palette[1] = minimum;
+        for (int step = 1; step < 7; ++step) {
+            palette[step + 1] = ((7 - step) * maximum + step * minimum + 3) / 7;
+        }
+        for (int i = 0; i < 16; ++i) {
+            uint64_t best = 0;
+            int bestDistance = std::numeric_limits<int>::max();
+            for (uint64_t entry = 0; entry < 8; ++entry) {
+                const int distance = std::abs(texels[i][3] - palette[entry]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = entry;
+                }
+            }
+            indices |= best << (3 * i);
+        }
+    }
+
+    out[0] = static_cast<uint8_t>(maximum);
+    out[1] = static_cast<uint8_t>(minimum);
+    for (int byte = 0; byte < 6; ++byte) {
+        out[2 + byte] = static_cast<uint8_t>(indices >> (8 * byte));
+    }
+}
+
+} // namespace
+
+std::filesystem::path AssetCooker::GetCookedPath(const std::filesystem::path& sourcePath) {
+    return sourcePath.string() + kExtension;
+}
+
+std::optional<CookKey> AssetCooker::GetKey(const std::filesystem::path& sourcePath, std::string_view settings) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(sourcePath, ec);
+    const auto writeTime = std::filesystem::last_write_time(sourcePath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    CookKey key;
+    key.Settings = Fnv1a(kFnvOffset, &kVersion, sizeof(kVersion));
+    const uint64_t length = settings.size();
+    key.Settings = Fnv1a(key.Settings, &length, sizeof(length));
+    key.Settings = Fnv1a(key.Settings, settings.data(), settings.size());
+    key.SourceSize = size;
+    key.SourceWriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return key;
+}
+
+uint64_t AssetCooker::HashSource(const std::filesystem::path& sourcePath) {
+    const MappedFile source = MappedFile::Open(sourcePath);
+    if (!source.IsOpen()) {
+        return 0;
+    }
+    const uint64_t hash = HashBytes(kFnvOffset, source.GetData(), source.GetSize());
+    // 0 is reserved for "no source".
+    return hash != 0 ? hash : 1;
+}
+
+bool AssetCooker::WriteMesh(const std::filesystem::path& path, const CookKey& key,
+                            const std::vector<EncodedMeshData>& meshes) {
+    FileHeader header = MakeHeader(key, BlobType::Mesh);
+    header.Count = static_cast<uint32_t>(meshes.size());
+
+    BlobWriter writer;
+    writer.Append(&header, sizeof(header), 16);
+    std::vector<MeshRecord> records(meshes.size());
+    const size_t tableOffset = writer.Append(records.data(), records.size() * sizeof(MeshRecord), 16);
+
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const EncodedMeshData& mesh = meshes[i];
+        MeshRecord& record = records[i];
+        record.Format = static_cast<uint32_t>(mesh.Format);
+        record.VertexCount = mesh.VertexCount;
+        record.IndexCount = mesh.IndexCount;
+        record.LodCount = static_cast<uint32_t>(mesh.Lods.size());
+        const Math::Vector3& minimum = mesh.Bounds.Min;
+        const Math::Vector3& maximum = mesh.Bounds.Max;
+        const Math::Vector4& color = mesh.BaseColor;
+        record.BoundsMin[0] = minimum.x; record.BoundsMin[1] = minimum.y; record.BoundsMin[2] = minimum.z;
+        record.BoundsMax[0] = maximum.x; record.BoundsMax[1] = maximum.y; record.BoundsMax[2] = maximum.z;
+        record.BaseColor[0] = color.x; record.BaseColor[1] = color.y; record.BaseColor[2] = color.z; record.BaseColor[3] = color.w;
+
+        const size_t vertexBytes = static_cast<size_t>(mesh.VertexCount) * GetVertexStride(mesh.Format);
+        const size_t indexBytes = static_cast<size_t>(mesh.IndexCount) * sizeof(uint32_t);
+        const size_t lodBytes = mesh.Lods.size() * sizeof(MeshLod);
+        record.VertexOffset = writer.Append(mesh.Vertices, vertexBytes, GetStreamAlignment(vertexBytes));
+        record.IndexOffset = writer.Append(mesh.Indices, indexBytes, GetStreamAlignment(indexBytes));
+        record.LodOffset = writer.Append(mesh.Lods.data(), lodBytes, 16);
+    }
+    writer.Write(tableOffset, records.data(), records.size() * sizeof(MeshRecord));
+
+    return WriteCookedFile(path, writer.GetBytes());
+}
+
+bool AssetCooker::WriteTexture(const std::filesystem::path& path, const CookKey& key, TextureFormat format,
+                               const std::vector<TextureMip>& mips) {
+    FileHeader header = MakeHeader(key, BlobType::Texture);
+    header.Format = static_cast<uint32_t>(format);
+    header.Count = static_cast<uint32_t>(mips.size());
+
+    BlobWriter writer;
+    writer.Append(&header, sizeof(header), 16);
+    std::vector<MipRecord> records(mips.size());
+    const size_t tableOffset = writer.Append(records.data(), records.size() * sizeof(MipRecord), 16);
+
+    for (size_t level = 0; level < mips.size(); ++level) {
+        const TextureMip& mip = mips[level];
+        records[level].Width = mip.Width;
+        records[level].Height = mip.Height;
+        records[level].Size = mip.Size;
+        records[level].Offset = writer.Append(mip.Data, mip.Size, GetStreamAlignment(mip.Size));
+    }
+    writer.Write(tableOffset, records.data(), records.size() * sizeof(MipRecord));
+
+    return WriteCookedFile(path, writer.GetBytes());
+}
+
+std::vector<std::vector<uint8_t>> AssetCooker::BuildMipChain(const uint8_t* rgba, uint32_t width, uint32_t height,
+                                                             bool srgb) {
+    std::vector<std::vector<uint8_t>> levels;
+    if (!rgba || width == 0 || height == 0) {
+        return levels;
+    }
+    levels.emplace_back(rgba, rgba + static_cast<size_t>(width) * height * 4);
+
+    const std::array<float, 256>& toLinear = GetSrgbToLinear();
+    const std::array<uint8_t, kLinearSteps>& toSrgb = GetLinearToSrgb();
+    while (width > 1 || height > 1) {
+        const uint32_t nextWidth = std::max(width / 2, 1u);
+        const uint32_t nextHeight = std::max(height / 2, 1u);
+        const std::vector<uint8_t>& source = levels.back();
+        std::vector<uint8_t> next(static_cast<size_t>(nextWidth) * nextHeight * 4);
+
+        for (uint32_t y = 0; y < nextHeight; ++y) {
+            // A dimension already at 1 repeats its only row or column.
+            const size_t row0 = static_cast<size_t>(std::min(y * 2, height - 1)) * width;
+            const size_t row1 = static_cast<size_t>(std::min(y * 2 + 1, height - 1)) * width;
+            for (uint32_t x = 0; x < nextWidth; ++x) {
+                const size_t column0 = std::min(x * 2, width - 1);
+                const size_t column1 = std::min(x * 2 + 1, width - 1);
+                const uint8_t* texels[4] = {
+                    &source[(row0 + column0) * 4], &source[(row0 + column1) * 4],
+                    &source[(row1 + column0) * 4], &source[(row1 + column1) * 4],
+                };
+                uint8_t* out = &next[(static_cast<size_t>(y) * nextWidth + x) * 4];
+                for (int c = 0; c < 4; ++c) {
+                    if (srgb && c < 3) {
+                        const float linear = (toLinear[texels[0][c]] + toLinear[texels[1][c]] +
+                                              toLinear[texels[2][c]] + toLinear[texels[3][c]]) * 0.25f;
+                        out[c] = toSrgb[static_cast<size_t>(std::lround(linear * (kLinearSteps - 1)))];
+                    } else {
+                        out[c] = static_cast<uint8_t>((texels[0][c] + texels[1][c] + texels[2][c] + texels[3][c] + 2) / 4);
+                    }
+                }
+            }
+        }
+
+        levels.push_back(std::move(next));
+        width = nextWidth;
+        height = nextHeight;
+    }
+    return levels;
+}
+
+size_t AssetCooker::GetMipSize(TextureFormat format, uint32_t width, uint32_t height) {
+    if (format == TextureFormat::BC3) {
+        return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * 16;
+    }
+    return static_cast<size_t>(width) * height * 4;
+}
+
+std::vector<uint8_t> AssetCooker::CompressBC3(const uint8_t* rgba, uint32_t width, uint32_t height) {
+    std::vector<uint8_t> blocks(GetMipSize(TextureFormat::BC3, width, height));
+    const uint32_t blocksWide = (width + 3) / 4;
+    const uint32_t blocksHigh = (height + 3) / 4;
+
+    uint8_t texels[16][4];
+    for (uint32_t blockY = 0; blockY < blocksHigh; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+            // Edge blocks of odd-sized levels repeat the last row and column.
+            for (uint32_t i = 0; i < 16; ++i) {
+                const uint32_t x = std::min(blockX * 4 + i % 4, width - 1);
+                const uint32_t y = std::min(blockY * 4 + i / 4, height - 1);
+                std::memcpy(texels[i], rgba + (static_cast<size_t>(y) * width + x) * 4, 4);
+            }
+            uint8_t* out = blocks.data() + (static_cast<size_t>(blockY) * blocksWide + blockX) * 16;
+            EncodeAlphaBlock(texels, out);
+            EncodeColorBlock(texels, out + 8);
+        }
+    }
+    return blocks;
+}
+
+std::optional<CookedMesh> CookedMesh::Open(const std::filesystem::path& path, const CookKey& key,
+                                           const std::filesystem::path& sourcePath) {
+    CookedMesh cooked;
+    cooked.m_File = MappedFile::Open(path);
+
+    FileHeader header{};
+    const uint8_t* table = ReadTable(cooked.m_File, key, sourcePath, BlobType::Mesh, sizeof(MeshRecord), header);
+    if (!table) {
+        return std::nullopt;
+    }
+
+    cooked.m_Meshes.reserve(header.Count);
+    for (uint32_t i = 0; i < header.Count; ++i) {
+        MeshRecord record{};
+        std::memcpy(&record, table + static_cast<size_t>(i) * sizeof(MeshRecord), sizeof(record));
+        if (record.Format > static_cast<uint32_t>(VertexFormat::QuantizedColor)) {
+            return std::nullopt;
+        }
+
+        EncodedMeshData mesh;
+        mesh.Format = static_cast<VertexFormat>(record.Format);
+        const uint64_t vertexBytes = static_cast<uint64_t>(record.VertexCount) * GetVertexStride(mesh.Format);
+        const uint64_t indexBytes = static_cast<uint64_t>(record.IndexCount) * sizeof(uint32_t);
+        const uint64_t lodBytes = static_cast<uint64_t>(record.LodCount) * sizeof(MeshLod);
+        if (!InRange(cooked.m_File, record.VertexOffset, vertexBytes, 4) ||
+            !InRange(cooked.m_File, record.IndexOffset, indexBytes, alignof(uint32_t)) ||
+            !InRange(cooked.m_File, record.LodOffset, lodBytes, 1)) {
+            ZGINE_CORE_WARN("AssetCooker: {} is malformed; cooking it again.", path.string());
+            return std::nullopt;
+        }
+
+        const uint8_t* data = cooked.m_File.GetData();
+        mesh.Vertices = data + record.VertexOffset;
+        mesh.VertexCount = record.VertexCount;
+        mesh.Indices = reinterpret_cast<const uint32_t*>(data + record.IndexOffset);
+        mesh.IndexCount = record.IndexCount;
+        mesh.Bounds = AABB(Math::Vector3(record.BoundsMin[0], record.BoundsMin[1], record.BoundsMin[2]),
+                           Math::Vector3(record.BoundsMax[0], record.BoundsMax[1], record.BoundsMax[2]));
+        mesh.BaseColor = Math::Vector4(record.BaseColor[0], record.BaseColor[1], record.BaseColor[2], record.BaseColor[3]);
+        mesh.Lods.resize(record.LodCount);
+        if (lodBytes > 0) {
+            std::memcpy(mesh.Lods.data(), data + record.LodOffset, lodBytes);
+        }
+        for (const MeshLod& lod : mesh.Lods) {
+            if (lod.FirstIndex > record.IndexCount || lod.IndexCount > record.IndexCount - lod.FirstIndex) {
+                return std::nullopt;
+            }
+        }
+        cooked.m_Meshes.push_back(std::move(mesh));
+    }
+    return cooked;
+}
+
+std::optional<CookedTexture> CookedTexture::Open(const std::filesystem::path& path, const CookKey& key,
+                                                 const std::filesystem::path& sourcePath) {
+    CookedTexture cooked;
+    cooked.m_File = MappedFile::Open(path);
+
+    FileHeader header{};
+    const uint8_t* table = ReadTable(cooked.m_File, key, sourcePath, BlobType::Texture, sizeof(MipRecord), header);
+    if (!table || header.Count == 0 || header.Format > static_cast<uint32_t>(TextureFormat::BC3)) {
+        return std::nullopt;
+    }
+
+    cooked.m_Format = static_cast<TextureFormat>(header.Format);
+    cooked.m_Mips.reserve(header.Count);
+    for (uint32_t level = 0; level < header.Count; ++level) {
+        MipRecord record{};
+        std::memcpy(&record, table + static_cast<size_t>(level) * sizeof(MipRecord), sizeof(record));
+        if (record.Width == 0 || record.Height == 0 ||
+            record.Size != AssetCooker::GetMipSize(cooked.m_Format, record.Width, record.Height) ||
+            !InRange(cooked.m_File, record.Offset, record.Size, 4)) {
+            ZGINE_CORE_WARN("AssetCooker: {} is malformed; cooking it again.", path.string());
+            return std::nullopt;
+        }
+
+        TextureMip mip;
+        mip.Width = record.Width;
+        mip.Height = record.Height;
+        mip.Data = cooked.m_File.GetData() + record.Offset;
+        mip.Size = static_cast<size_t>(record.Size);
+        cooked.m_Mips.push_back(mip);
+    }
+    return cooked;
+}
+
+void CookedTexture::Prefetch(uint32_t firstMip, uint32_t endMip) const {
+    endMip = std::min(endMip, static_cast<uint32_t>(m_Mips.size()));
+    for (uint32_t level = firstMip; level < endMip; ++level) {
+        m_File.Prefetch(m_Mips[level].Data, m_Mips[level].Size);
+    }
+}
+
+} // namespace Zgine
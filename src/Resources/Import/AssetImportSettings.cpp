@@ -18,6 +18,16 @@ namespace {
         data["Triangulate"] = settings.Triangulate;
         data["FlipUVs"] = settings.FlipUVs;
         data["CalcTangents"] = settings.CalcTangents;
+        data["WeldVertices"] = settings.WeldVertices;
+        data["OptimizeVertexCache"] = settings.OptimizeVertexCache;
+        data["OptimizeOverdraw"] = settings.OptimizeOverdraw;
+        data["OverdrawThreshold"] = settings.OverdrawThreshold;
+        data["LodCount"] = settings.LodCount;
+        data["LodReduction"] = settings.LodReduction;
+        data["LodMaxError"] = settings.LodMaxError;
+        data["LodScreenSize"] = settings.LodScreenSize;
+        data["VertexFormat"] = VertexFormatToString(settings.Format);
+        data["KeepVertexColors"] = settings.KeepVertexColors;
         return data;
     }
 
@@ -47,6 +57,16 @@ namespace {
         if (data.contains("Triangulate")) settings.Triangulate = data["Triangulate"].get<bool>();
         if (data.contains("FlipUVs")) settings.FlipUVs = data["FlipUVs"].get<bool>();
         if (data.contains("CalcTangents")) settings.CalcTangents = data["CalcTangents"].get<bool>();
+        if (data.contains("WeldVertices")) settings.WeldVertices = data["WeldVertices"].get<bool>();
+        if (data.contains("OptimizeVertexCache")) settings.OptimizeVertexCache = data["OptimizeVertexCache"].get<bool>();
+        if (data.contains("OptimizeOverdraw")) settings.OptimizeOverdraw = data["OptimizeOverdraw"].get<bool>();
+        if (data.contains("OverdrawThreshold")) settings.OverdrawThreshold = data["OverdrawThreshold"].get<float>();
+        if (data.contains("LodCount")) settings.LodCount = data["LodCount"].get<uint32_t>();
+        if (data.contains("LodReduction")) settings.LodReduction = data["LodReduction"].get<float>();
+        if (data.contains("LodMaxError")) settings.LodMaxError = data["LodMaxError"].get<float>();
+        if (data.contains("LodScreenSize")) settings.LodScreenSize = data["LodScreenSize"].get<float>();
+        if (data.contains("VertexFormat")) settings.Format = VertexFormatFromString(data["VertexFormat"].get<std::string>());
+        if (data.contains("KeepVertexColors")) settings.KeepVertexColors = data["KeepVertexColors"].get<bool>();
     }
 
     void DeserializeAudio(const nlohmann::json& data, AudioImportSettings& settings) {
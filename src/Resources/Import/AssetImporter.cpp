@@ -1,4 +1,5 @@
 #include <Zgine/Resources/Import/AssetImporter.h>
+#include <Zgine/Resources/Import/AssetCooker.h>
 #include <Zgine/Resources/Core/AssetManager.h>
 #include <Zgine/Platform/IO/File.h>
 #include <Zgine/Core/Log/Log.h>
@@ -6,9 +7,12 @@
 #include <Zgine/Renderer/RHI/Texture.h>
 #include <Zgine/Renderer/RHI/Shader.h>
 #include <Zgine/Resources/Mesh/MeshLoader.h>
+#include <stb_image.h>
 #include <filesystem>
 #include <unordered_set>
+#include <algorithm>
 #include <cctype>
+#include <optional>
 
 namespace Zgine {
 
@@ -19,15 +23,170 @@ namespace {
             if (!mesh) {
                 continue;
             }
-            total += mesh->GetVertexCount() * sizeof(Vertex);
-            total += mesh->GetIndexCount() * sizeof(unsigned int);
+            total += mesh->GetMemorySize();
         }
         return total;
     }
+
+    size_t CalculateTextureSize(const std::vector<TextureMip>& mips) {
+        size_t total = 0;
+        for (const TextureMip& mip : mips) {
+            total += mip.Size;
+        }
+        return total;
+    }
+
+    std::optional<CookKey> GetCookKey(const AssetMetadata& metadata, AssetType type) {
+        return AssetCooker::GetKey(metadata.SourcePath, metadata.ImportSettings.Serialize(type).dump());
+    }
+
+    TextureSettings GetTextureSettings(const TextureImportSettings& importSettings) {
+        TextureSettings settings;
+        settings.GenerateMipmaps = importSettings.GenerateMipmaps;
+        settings.SRGB = importSettings.SRGB;
+        settings.ClampToEdge = importSettings.ClampToEdge;
+        settings.Linear = importSettings.Linear;
+        return settings;
+    }
+
+    /** @brief Decode the source image, build its mips and compress them as the settings ask. */
+    bool CookTextureFile(const AssetMetadata& metadata, CookKey key) {
+        // Hashed before the source is read, so a write during the cook leaves the file stale.
+        key.SourceHash = AssetCooker::HashSource(metadata.SourcePath);
+        if (key.SourceHash == 0) {
+            return false;
+        }
+
+        const TextureImportSettings& settings = metadata.ImportSettings.Texture;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        // Same orientation as OpenGLTexture loads the source with.
+        stbi_set_flip_vertically_on_load(1);
+        stbi_uc* pixels = stbi_load(metadata.SourcePath.string().c_str(), &width, &height, &channels, 4);
+        if (!pixels) {
+            ZGINE_CORE_ERROR("TextureImporter: failed to decode {}", metadata.SourcePath.string());
+            return false;
+        }
+
+        std::vector<std::vector<uint8_t>> levels;
+        if (settings.GenerateMipmaps) {
+            levels = AssetCooker::BuildMipChain(pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                                                settings.SRGB);
+        } else {
+            levels.emplace_back(pixels, pixels + static_cast<size_t>(width) * static_cast<size_t>(height) * 4u);
+        }
+        stbi_image_free(pixels);
+
+        const TextureFormat format = settings.Compress ? TextureFormat::BC3 : TextureFormat::RGBA8;
+        std::vector<TextureMip> mips;
+        mips.reserve(levels.size());
+        for (size_t level = 0; level < levels.size(); ++level) {
+            TextureMip mip;
+            mip.Width = std::max(static_cast<uint32_t>(width) >> level, 1u);
+            mip.Height = std::max(static_cast<uint32_t>(height) >> level, 1u);
+            if (format == TextureFormat::BC3) {
+                levels[level] = AssetCooker::CompressBC3(levels[level].data(), mip.Width, mip.Height);
+            }
+            mip.Data = levels[level].data();
+            mip.Size = levels[level].size();
+            mips.push_back(mip);
+        }
+
+        return AssetCooker::WriteTexture(AssetCooker::GetCookedPath(metadata.SourcePath), key, format, mips);
+    }
+
+    /** @brief Import through Assimp, optimize and encode the vertices as MeshLoader::LoadModel() would. */
+    bool CookMeshFile(const AssetMetadata& metadata, CookKey key) {
+        key.SourceHash = AssetCooker::HashSource(metadata.SourcePath);
+        if (key.SourceHash == 0) {
+            return false;
+        }
+
+        const MeshImportSettings& settings = metadata.ImportSettings.Mesh;
+        const std::vector<MeshData> sources = MeshLoader::LoadModelData(metadata.SourcePath.string(), settings);
+        if (sources.empty()) {
+            ZGINE_CORE_ERROR("MeshImporter: failed to load {}", metadata.SourcePath.string());
+            return false;
+        }
+
+        std::vector<std::vector<uint8_t>> vertices;
+        std::vector<EncodedMeshData> meshes;
+        vertices.reserve(sources.size());
+        meshes.reserve(sources.size());
+        for (const MeshData& source : sources) {
+            EncodedMeshData mesh;
+            mesh.Format = MeshLoader::ChooseVertexFormat(source, settings);
+            mesh.Bounds = VertexQuantization::ComputeBounds(source.Vertices);
+            vertices.push_back(VertexQuantization::EncodeVertices(source.Vertices, mesh.Format, mesh.Bounds));
+            mesh.Vertices = vertices.back().data();
+            mesh.VertexCount = static_cast<uint32_t>(source.Vertices.size());
+            mesh.Indices = source.Indices.data();
+            mesh.IndexCount = static_cast<uint32_t>(source.Indices.size());
+            mesh.BaseColor = source.BaseColor;
+            mesh.Lods = source.Lods;
+            meshes.push_back(std::move(mesh));
+        }
+
+        return AssetCooker::WriteMesh(AssetCooker::GetCookedPath(metadata.SourcePath), key, meshes);
+    }
+    struct TexturePayload final : AssetPayload {
+        std::optional<CookedTexture> Cooked;
+    };
+
+    struct MeshPayload final : AssetPayload {
+        std::optional<CookedMesh> Cooked;
+        std::vector<MeshData> Sources; // the import itself when the cooked file cannot be written
+    };
+
+    struct AudioPayload final : AssetPayload {
+        size_t SizeBytes = 0;
+    };
+
+    struct ShaderPayload final : AssetPayload {
+        std::string VertexSource;
+        std::string FragmentSource;
+        std::vector<AssetHandle> Dependencies;
+    };
+
+    /** @brief Payload of the importer's own type; Prepare() and Finalize() always pair up. */
+    template <typename T>
+    T* GetPayload(const std::unique_ptr<AssetPayload>& payload) {
+        return static_cast<T*>(payload.get());
+    }
 }
 
-AssetImportResult TextureImporter::Import(const AssetMetadata& metadata, AssetImportContext& context) {
-    ZGINE_UNUSED(context);
+AssetImportResult AssetImporter::Import(const AssetMetadata& metadata, AssetImportContext& context) {
+    return Finalize(metadata, Prepare(metadata, context), context);
+}
+
+std::unique_ptr<AssetPayload> TextureImporter::Prepare(const AssetMetadata& metadata, AssetImportContext& context) {
+    if (metadata.SourcePath.empty()) {
+        return nullptr;
+    }
+
+    auto payload = std::make_unique<TexturePayload>();
+    const std::filesystem::path cookedPath = AssetCooker::GetCookedPath(metadata.SourcePath);
+    if (const std::optional<CookKey> key = GetCookKey(metadata, AssetType::Texture)) {
+        payload->Cooked = CookedTexture::Open(cookedPath, *key, metadata.SourcePath);
+        if (!payload->Cooked && CookTextureFile(metadata, *key)) {
+            payload->Cooked = CookedTexture::Open(cookedPath, *key);
+        }
+    }
+    if (payload->Cooked) {
+        // Fault in the levels the upload reads here rather than on the main thread.
+        const auto& mips = payload->Cooked->GetMips();
+        const TextureStreamer* streamer = context.Manager ? &context.Manager->GetTextureStreamer() : nullptr;
+        const uint32_t firstMip = streamer && streamer->GetConfig().Enabled
+            ? TextureStreamer::GetTailMip(mips, streamer->GetConfig().TailSize)
+            : 0;
+        payload->Cooked->Prefetch(firstMip, static_cast<uint32_t>(mips.size()));
+    }
+    return payload;
+}
+
+AssetImportResult TextureImporter::Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                                            AssetImportContext& context) {
     AssetImportResult result;
 
     if (metadata.SourcePath.empty()) {
@@ -35,25 +194,80 @@ AssetImportResult TextureImporter::Import(const AssetMetadata& metadata, AssetIm
         return result;
     }
 
-    TextureSettings settings;
-    settings.GenerateMipmaps = metadata.ImportSettings.Texture.GenerateMipmaps;
-    settings.SRGB = metadata.ImportSettings.Texture.SRGB;
-    settings.ClampToEdge = metadata.ImportSettings.Texture.ClampToEdge;
-    settings.Linear = metadata.ImportSettings.Texture.Linear;
+    const TextureSettings settings = GetTextureSettings(metadata.ImportSettings.Texture);
+    TexturePayload* prepared = GetPayload<TexturePayload>(payload);
 
-    auto texture = Texture::Create(metadata.SourcePath.string(), settings);
+    std::shared_ptr<Texture> texture;
+    size_t sizeBytes = 0;
+    if (prepared && prepared->Cooked) {
+        std::optional<CookedTexture>& cooked = prepared->Cooked;
+        // Streamed textures start with their mip tail; the streamer keeps the
+        // mapping open and uploads the higher levels when the renderer needs them.
+        TextureStreamer* streamer = context.Manager ? &context.Manager->GetTextureStreamer() : nullptr;
+        if (streamer && streamer->GetConfig().Enabled) {
+            auto source = std::make_shared<const CookedTexture>(std::move(*cooked));
+            const uint32_t tailMip = TextureStreamer::GetTailMip(source->GetMips(), streamer->GetConfig().TailSize);
+            texture = Texture::Create(source->GetFormat(), source->GetMips(), settings,
+                                      metadata.SourcePath.string(), tailMip);
+            if (texture && texture->GetID() != 0) {
+                streamer->Register(texture, source);
+            }
+            sizeBytes = CalculateTextureSize(source->GetMips());
+        } else {
+            texture = Texture::Create(cooked->GetFormat(), cooked->GetMips(), settings, metadata.SourcePath.string());
+            sizeBytes = CalculateTextureSize(cooked->GetMips());
+        }
+    }
+    if (!texture || texture->GetID() == 0) {
+        // Cooking failed or the backend cannot take the cooked format: decode the source directly.
+        texture = Texture::Create(metadata.SourcePath.string(), settings);
+        if (texture) {
+            sizeBytes = static_cast<size_t>(texture->GetWidth()) * static_cast<size_t>(texture->GetHeight()) * 4u;
+        }
+    }
     if (!texture || texture->GetID() == 0) {
         ZGINE_CORE_ERROR("TextureImporter: failed to load {}", metadata.SourcePath.string());
         return result;
     }
 
-    size_t sizeBytes = static_cast<size_t>(texture->GetWidth()) *
-                       static_cast<size_t>(texture->GetHeight()) * 4u;
     result.AssetData = std::make_shared<TextureAsset>(metadata.Handle, texture, sizeBytes);
     return result;
 }
 
-AssetImportResult MeshImporter::Import(const AssetMetadata& metadata, AssetImportContext& context) {
+bool TextureImporter::Cook(const AssetMetadata& metadata) {
+    const std::optional<CookKey> key = GetCookKey(metadata, AssetType::Texture);
+    if (!key) {
+        return false;
+    }
+    return CookedTexture::Open(AssetCooker::GetCookedPath(metadata.SourcePath), *key, metadata.SourcePath).has_value() ||
+           CookTextureFile(metadata, *key);
+}
+
+std::unique_ptr<AssetPayload> MeshImporter::Prepare(const AssetMetadata& metadata, AssetImportContext& context) {
+    ZGINE_UNUSED(context);
+    if (metadata.SourcePath.empty()) {
+        return nullptr;
+    }
+
+    auto payload = std::make_unique<MeshPayload>();
+    const std::filesystem::path cookedPath = AssetCooker::GetCookedPath(metadata.SourcePath);
+    if (const std::optional<CookKey> key = GetCookKey(metadata, AssetType::Mesh)) {
+        payload->Cooked = CookedMesh::Open(cookedPath, *key, metadata.SourcePath);
+        if (!payload->Cooked && CookMeshFile(metadata, *key)) {
+            payload->Cooked = CookedMesh::Open(cookedPath, *key);
+        }
+    }
+    if (payload->Cooked) {
+        payload->Cooked->Prefetch();
+    } else {
+        payload->Sources = MeshLoader::LoadModelData(metadata.SourcePath.string(), metadata.ImportSettings.Mesh);
+    }
+    return payload;
+}
+
+AssetImportResult MeshImporter::Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                                         AssetImportContext& context) {
+    ZGINE_UNUSED(context);
     AssetImportResult result;
 
     if (metadata.SourcePath.empty()) {
@@ -61,7 +275,20 @@ AssetImportResult MeshImporter::Import(const AssetMetadata& metadata, AssetImpor
         return result;
     }
 
-    auto meshes = MeshLoader::LoadModel(metadata.SourcePath.string(), metadata.ImportSettings.Mesh);
+    std::vector<std::shared_ptr<Mesh>> meshes;
+    if (MeshPayload* prepared = GetPayload<MeshPayload>(payload)) {
+        if (prepared->Cooked) {
+            // Straight from the mapping to the arena; nothing is parsed or converted.
+            for (const EncodedMeshData& mesh : prepared->Cooked->GetMeshes()) {
+                meshes.push_back(std::make_shared<Mesh>(mesh));
+            }
+        } else {
+            for (const MeshData& data : prepared->Sources) {
+                meshes.push_back(std::make_shared<Mesh>(
+                    data, MeshLoader::ChooseVertexFormat(data, metadata.ImportSettings.Mesh)));
+            }
+        }
+    }
     if (meshes.empty()) {
         ZGINE_CORE_ERROR("MeshImporter: failed to load {}", metadata.SourcePath.string());
         return result;
@@ -76,7 +303,27 @@ AssetImportResult MeshImporter::Import(const AssetMetadata& metadata, AssetImpor
     return result;
 }
 
-AssetImportResult AudioImporter::Import(const AssetMetadata& metadata, AssetImportContext& context) {
+bool MeshImporter::Cook(const AssetMetadata& metadata) {
+    const std::optional<CookKey> key = GetCookKey(metadata, AssetType::Mesh);
+    if (!key) {
+        return false;
+    }
+    return CookedMesh::Open(AssetCooker::GetCookedPath(metadata.SourcePath), *key, metadata.SourcePath).has_value() ||
+           CookMeshFile(metadata, *key);
+}
+
+std::unique_ptr<AssetPayload> AudioImporter::Prepare(const AssetMetadata& metadata, AssetImportContext& context) {
+    ZGINE_UNUSED(context);
+    auto payload = std::make_unique<AudioPayload>();
+    std::error_code ec;
+    if (!metadata.SourcePath.empty() && std::filesystem::exists(metadata.SourcePath, ec)) {
+        payload->SizeBytes = static_cast<size_t>(std::filesystem::file_size(metadata.SourcePath, ec));
+    }
+    return payload;
+}
+
+AssetImportResult AudioImporter::Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                                          AssetImportContext& context) {
     ZGINE_UNUSED(context);
     AssetImportResult result;
     if (metadata.SourcePath.empty()) {
@@ -84,20 +331,15 @@ AssetImportResult AudioImporter::Import(const AssetMetadata& metadata, AssetImpo
         return result;
     }
 
-    std::error_code ec;
-    size_t sizeBytes = 0;
-    if (std::filesystem::exists(metadata.SourcePath, ec)) {
-        sizeBytes = static_cast<size_t>(std::filesystem::file_size(metadata.SourcePath, ec));
-    }
+    const AudioPayload* prepared = GetPayload<AudioPayload>(payload);
+    const size_t sizeBytes = prepared ? prepared->SizeBytes : 0;
     result.AssetData = std::make_shared<AudioAsset>(metadata.Handle, metadata.SourcePath.string(), sizeBytes);
     return result;
 }
 
-AssetImportResult ShaderImporter::Import(const AssetMetadata& metadata, AssetImportContext& context) {
-    AssetImportResult result;
+std::unique_ptr<AssetPayload> ShaderImporter::Prepare(const AssetMetadata& metadata, AssetImportContext& context) {
     if (metadata.SourcePath.empty()) {
-        ZGINE_CORE_WARN("ShaderImporter: missing source path");
-        return result;
+        return nullptr;
     }
 
     ShaderImportSettings settings = metadata.ImportSettings.Shader;
@@ -116,32 +358,50 @@ AssetImportResult ShaderImporter::Import(const AssetMetadata& metadata, AssetImp
             settings.VertexPath = source.replace_extension(".vert").string();
         } else {
             ZGINE_CORE_WARN("ShaderImporter: cannot infer shader pair for {}", metadata.SourcePath.string());
-            return result;
+            return nullptr;
         }
     }
 
-    std::string vertexSrc = File::ReadFile(settings.VertexPath);
-    std::string fragmentSrc = File::ReadFile(settings.FragmentPath);
-    if (vertexSrc.empty() || fragmentSrc.empty()) {
-        ZGINE_CORE_ERROR("ShaderImporter: failed to read shader sources for {}", metadata.SourcePath.string());
-        return result;
-    }
-
-    std::string shaderName = metadata.SourcePath.stem().string();
-    auto shader = Shader::Create(shaderName, vertexSrc, fragmentSrc);
-    size_t sizeBytes = vertexSrc.size() + fragmentSrc.size();
-    result.AssetData = std::make_shared<ShaderAsset>(metadata.Handle, shader, sizeBytes);
+    auto payload = std::make_unique<ShaderPayload>();
+    payload->VertexSource = File::ReadFile(settings.VertexPath);
+    payload->FragmentSource = File::ReadFile(settings.FragmentPath);
 
     if (context.Manager) {
         AssetHandle vertexHandle = context.Manager->GetHandleFromPath(settings.VertexPath);
         if (vertexHandle.IsValid()) {
-            result.Dependencies.push_back(vertexHandle);
+            payload->Dependencies.push_back(vertexHandle);
         }
         AssetHandle fragmentHandle = context.Manager->GetHandleFromPath(settings.FragmentPath);
         if (fragmentHandle.IsValid()) {
-            result.Dependencies.push_back(fragmentHandle);
+            payload->Dependencies.push_back(fragmentHandle);
         }
     }
+    return payload;
+}
+
+AssetImportResult ShaderImporter::Finalize(const AssetMetadata& metadata, std::unique_ptr<AssetPayload> payload,
+                                           AssetImportContext& context) {
+    ZGINE_UNUSED(context);
+    AssetImportResult result;
+    if (metadata.SourcePath.empty()) {
+        ZGINE_CORE_WARN("ShaderImporter: missing source path");
+        return result;
+    }
+
+    ShaderPayload* prepared = GetPayload<ShaderPayload>(payload);
+    if (!prepared) {
+        return result;
+    }
+    if (prepared->VertexSource.empty() || prepared->FragmentSource.empty()) {
+        ZGINE_CORE_ERROR("ShaderImporter: failed to read shader sources for {}", metadata.SourcePath.string());
+        return result;
+    }
+
+    std::string shaderName = metadata.SourcePath.stem().string();
+    auto shader = Shader::Create(shaderName, prepared->VertexSource, prepared->FragmentSource);
+    size_t sizeBytes = prepared->VertexSource.size() + prepared->FragmentSource.size();
+    result.AssetData = std::make_shared<ShaderAsset>(metadata.Handle, shader, sizeBytes);
+    result.Dependencies = std::move(prepared->Dependencies);
 
     return result;
 }
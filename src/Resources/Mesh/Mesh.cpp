@@ -1,88 +1,95 @@
 #include <Zgine/Resources/Mesh/Mesh.h>
+#include <Zgine/Resources/Mesh/MeshArenas.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
 #include <Zgine/Core/Log/Log.h>
-#include <glad/glad.h>
+#include <algorithm>
 
 namespace Zgine {
 
-Mesh::Mesh(const MeshData& data)
-    : m_Vertices(data.Vertices),
-      m_Indices(data.Indices),
-      m_BaseColor(data.BaseColor) {
-    SetupMesh();
-}
+// Uploaded as is, so Vertex must match GetVertexLayout(VertexFormat::Float) byte for byte.
+static_assert(sizeof(Vertex) == 12 * sizeof(float), "Vertex must stay tightly packed");
 
-Mesh::~Mesh() {
-    if (m_VAO != 0) {
-        glDeleteVertexArrays(1, &m_VAO);
-        glDeleteBuffers(1, &m_VBO);
-        glDeleteBuffers(1, &m_EBO);
+Mesh::Mesh(const MeshData& data, VertexFormat format)
+    : m_Format(format),
+      m_VertexCount(static_cast<unsigned int>(data.Vertices.size())),
+      m_IndexCount(static_cast<unsigned int>(data.Indices.size())),
+      m_BaseColor(data.BaseColor) {
+    m_Lods = data.Lods;
+    if (m_Lods.empty()) {
+        m_Lods.push_back({ 0, m_IndexCount, 0.0f, 0.0f });
     }
-}
-
-void Mesh::Bind() const {
-    glBindVertexArray(m_VAO);
-}
-
-void Mesh::Unbind() const {
-    glBindVertexArray(0);
-}
 
-void Mesh::SetupMesh() {
-    // Create and bind VAO
-    glGenVertexArrays(1, &m_VAO);
-    glGenBuffers(1, &m_VBO);
-    glGenBuffers(1, &m_EBO);
+    m_Bounds = VertexQuantization::ComputeBounds(data.Vertices);
+    m_DequantizeScale = VertexQuantization::GetDequantizeScale(m_Format, m_Bounds);
+    m_DequantizeOffset = VertexQuantization::GetDequantizeOffset(m_Format, m_Bounds);
 
-    glBindVertexArray(m_VAO);
-
-    // 创建顶点缓冲区数据(位置 + 法线 + 纹理坐标 + 颜色)
-    std::vector<float> vertexData;
-    for (const auto& vertex : m_Vertices) {
-        vertexData.push_back(vertex.Position.x);
-        vertexData.push_back(vertex.Position.y);
-        vertexData.push_back(vertex.Position.z);
-        vertexData.push_back(vertex.Normal.x);
-        vertexData.push_back(vertex.Normal.y);
-        vertexData.push_back(vertex.Normal.z);
-        vertexData.push_back(vertex.TexCoords.x);
-        vertexData.push_back(vertex.TexCoords.y);
-        vertexData.push_back(vertex.Color.r);
-        vertexData.push_back(vertex.Color.g);
-        vertexData.push_back(vertex.Color.b);
-        vertexData.push_back(vertex.Color.w);
+    // Headless runs (tools, tests) keep the metadata without touching the GPU.
+    if (RendererAPI::GetAPI() == RendererAPI::API::None || m_VertexCount == 0 || m_IndexCount == 0) {
+        return;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertexData.size() * sizeof(float), vertexData.data(), GL_STATIC_DRAW);
+    if (m_Format == VertexFormat::Float) {
+        Upload(data.Vertices.data(), data.Indices.data());
+    } else {
+        const std::vector<uint8_t> encoded = VertexQuantization::EncodeVertices(data.Vertices, m_Format, m_Bounds);
+        Upload(encoded.data(), data.Indices.data());
+    }
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Indices.size() * sizeof(unsigned int), m_Indices.data(), GL_STATIC_DRAW);
+Mesh::Mesh(const EncodedMeshData& data)
+    : m_Bounds(data.Bounds),
+      m_Lods(data.Lods),
+      m_Format(data.Format),
+      m_VertexCount(data.VertexCount),
+      m_IndexCount(data.IndexCount),
+      m_BaseColor(data.BaseColor) {
+    if (m_Lods.empty()) {
+        m_Lods.push_back({ 0, m_IndexCount, 0.0f, 0.0f });
+    }
 
-    // 手动设置顶点属性(位置+法线+纹理坐标+颜色布局)
-    // 位置属性(layout 0)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 12 * sizeof(float), (void*)0);
+    m_DequantizeScale = VertexQuantization::GetDequantizeScale(m_Format, m_Bounds);
+    m_DequantizeOffset = VertexQuantization::GetDequantizeOffset(m_Format, m_Bounds);
 
-    // 法线属性(layout 1)
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 12 * sizeof(float), (void*)(3 * sizeof(float)));
+    if (RendererAPI::GetAPI() == RendererAPI::API::None || m_VertexCount == 0 || m_IndexCount == 0) {
+        return;
+    }
+    Upload(data.Vertices, data.Indices);
+}
 
-    // 纹理坐标属性(layout 2)
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 12 * sizeof(float), (void*)(6 * sizeof(float)));
+Mesh::~Mesh() {
+    if (m_Arena) {
+        m_Arena->Free(m_Range);
+    }
+}
 
-    // 颜色属性(layout 3)
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, 12 * sizeof(float), (void*)(8 * sizeof(float)));
+void Mesh::Upload(const void* vertices, const uint32_t* indices) {
+    m_Arena = MeshArenas::Get(m_Format);
+    m_Range = m_Arena->Allocate(vertices, m_VertexCount, indices, m_IndexCount);
+    if (!m_Range.IsValid()) {
+        ZGINE_CORE_WARN("Mesh: failed to upload {} vertices; it will not be drawn.", m_VertexCount);
+    }
+}
 
-    glBindVertexArray(0);
+MeshRange Mesh::GetLodRange(uint32_t lod) const {
+    const MeshLod& level = m_Lods[std::min<size_t>(lod, m_Lods.size() - 1)];
+    MeshRange range = m_Range;
+    range.FirstIndex += level.FirstIndex;
+    range.IndexCount = level.IndexCount;
+    return range;
 }
 
-void Mesh::Draw() const {
-    // 绘制网格
-    glBindVertexArray(m_VAO);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_Indices.size()), GL_UNSIGNED_INT, nullptr);
-    glBindVertexArray(0);
+uint32_t Mesh::SelectLod(float screenSize) const {
+    for (uint32_t lod = 0; lod + 1 < m_Lods.size(); ++lod) {
+        if (screenSize >= m_Lods[lod].ScreenSize) {
+            return lod;
+        }
+    }
+    return static_cast<uint32_t>(m_Lods.size() - 1);
 }
 
+size_t Mesh::GetMemorySize() const {
+    return static_cast<size_t>(m_VertexCount) * GetVertexStride(m_Format)
+         + static_cast<size_t>(m_IndexCount) * sizeof(uint32_t);
 }
+
+} // namespace Zgine
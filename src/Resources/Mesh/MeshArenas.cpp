@@ -0,0 +1,21 @@
+#include <Zgine/Resources/Mesh/MeshArenas.h>
+
+namespace Zgine {
+
+std::array<std::shared_ptr<MeshArena>, 3> MeshArenas::s_Arenas;
+
+void MeshArenas::Shutdown() {
+    for (auto& arena : s_Arenas) {
+        arena.reset();
+    }
+}
+
+const std::shared_ptr<MeshArena>& MeshArenas::Get(VertexFormat format) {
+    std::shared_ptr<MeshArena>& arena = s_Arenas[static_cast<size_t>(format)];
+    if (!arena) {
+        arena = std::make_shared<MeshArena>(GetVertexLayout(format));
+    }
+    return arena;
+}
+
+} // namespace Zgine
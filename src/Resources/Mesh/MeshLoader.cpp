@@ -1,4 +1,5 @@
 #include <Zgine/Resources/Mesh/MeshLoader.h>
+#include <Zgine/Resources/Mesh/MeshOptimizer.h>
 #include <Zgine/Renderer/RHI/Texture.h>
 #include <Zgine/Core/Log/Log.h>
 #include <Zgine/Core/Foundation/Macro.h>
@@ -8,6 +9,7 @@
 #include <assimp/texture.h>
 #include <assimp/postprocess.h>
 #include <filesystem>
+#include <utility>
 
 namespace Zgine {
 
@@ -48,6 +50,14 @@ std::shared_ptr<Texture> LoadEmbeddedTexture(const aiTexture* texture, const std
 std::vector<std::shared_ptr<Mesh>> MeshLoader::LoadModel(const std::string& path,
                                                          const MeshImportSettings& settings) {
     std::vector<std::shared_ptr<Mesh>> meshes;
+    for (const MeshData& data : LoadModelData(path, settings)) {
+        meshes.push_back(std::make_shared<Mesh>(data, ChooseVertexFormat(data, settings)));
+    }
+    return meshes;
+}
+
+std::vector<MeshData> MeshLoader::LoadModelData(const std::string& path, const MeshImportSettings& settings) {
+    std::vector<MeshData> meshes;
 
     Assimp::Importer importer;
     unsigned int flags = 0;
@@ -74,7 +84,7 @@ std::vector<std::shared_ptr<Mesh>> MeshLoader::LoadModel(const std::string& path
         directory = ".";
     }
 
-    ProcessNode(World->mRootNode, World, directory, meshes);
+    ProcessNode(World->mRootNode, World, directory, settings, meshes);
     return meshes;
 }
 
@@ -87,70 +97,81 @@ std::shared_ptr<Mesh> MeshLoader::LoadMesh(const std::string& path,
     return meshes[0]; // 返回第一个网�?
 }
 
-void MeshLoader::ProcessNode(const aiNode* node, const aiScene* World,
-                             const std::string& directory, std::vector<std::shared_ptr<Mesh>>& meshes) {
+VertexFormat MeshLoader::ChooseVertexFormat(const MeshData& data, const MeshImportSettings& settings) {
+    if (settings.Format == VertexFormat::Float) {
+        return VertexFormat::Float;
+    }
+    return data.HasColors && settings.KeepVertexColors ? VertexFormat::QuantizedColor : VertexFormat::Quantized;
+}
+
+void MeshLoader::ProcessNode(const aiNode* node, const aiScene* World, const std::string& directory,
+                             const MeshImportSettings& settings, std::vector<MeshData>& meshes) {
     // 处理当前节点的所有网�?
     for (unsigned int i = 0; i < node->mNumMeshes; i++) {
         aiMesh* mesh = World->mMeshes[node->mMeshes[i]];
         MeshData meshData = ProcessMesh(mesh, World, directory);
-        meshes.push_back(std::make_shared<Mesh>(meshData));
+        OptimizeMesh(meshData, settings);
+        meshes.push_back(std::move(meshData));
     }
 
     // 递归处理子节�?
     for (unsigned int i = 0; i < node->mNumChildren; i++) {
-        ProcessNode(node->mChildren[i], World, directory, meshes);
+        ProcessNode(node->mChildren[i], World, directory, settings, meshes);
     }
 }
 
 MeshData MeshLoader::ProcessMesh(const aiMesh* mesh, const aiScene* World, const std::string& directory) {
     ZGINE_UNUSED(directory);
     MeshData data;
+    const unsigned int vertexCount = mesh->mNumVertices;
 
-    // 处理顶点
-    for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
-        Vertex vertex;
-
-        // 位置
-        vertex.Position.x = mesh->mVertices[i].x;
-        vertex.Position.y = mesh->mVertices[i].y;
-        vertex.Position.z = mesh->mVertices[i].z;
+    // 处理顶点: size once, then copy one Assimp stream at a time so each
+    // loop reads a single array and the presence checks stay out of it.
+    data.Vertices.resize(vertexCount);
+    for (unsigned int i = 0; i < vertexCount; i++) {
+        data.Vertices[i].Position = { mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z };
+    }
 
-        // 法线
-        if (mesh->mNormals) {
-            vertex.Normal.x = mesh->mNormals[i].x;
-            vertex.Normal.y = mesh->mNormals[i].y;
-            vertex.Normal.z = mesh->mNormals[i].z;
-        } else {
+    // 法线
+    if (mesh->mNormals) {
+        for (unsigned int i = 0; i < vertexCount; i++) {
+            data.Vertices[i].Normal = { mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z };
+        }
+    } else {
+        for (Vertex& vertex : data.Vertices) {
             vertex.Normal = Math::Vector3(0.0f);
         }
+    }
 
-        // 纹理坐标
-        if (mesh->mTextureCoords[0]) {
-            vertex.TexCoords.x = mesh->mTextureCoords[0][i].x;
-            vertex.TexCoords.y = mesh->mTextureCoords[0][i].y;
-        } else {
+    // 纹理坐标
+    if (mesh->mTextureCoords[0]) {
+        for (unsigned int i = 0; i < vertexCount; i++) {
+            data.Vertices[i].TexCoords = { mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y };
+        }
+    } else {
+        for (Vertex& vertex : data.Vertices) {
             vertex.TexCoords = Math::Vector2(0.0f);
         }
+    }
 
-        // 顶点颜色
-        if (mesh->mColors[0]) {
-            vertex.Color.r = mesh->mColors[0][i].r;
-            vertex.Color.g = mesh->mColors[0][i].g;
-            vertex.Color.b = mesh->mColors[0][i].b;
-            vertex.Color.a = mesh->mColors[0][i].a;
-        } else {
+    // 顶点颜色
+    data.HasColors = mesh->mColors[0] != nullptr;
+    if (data.HasColors) {
+        for (unsigned int i = 0; i < vertexCount; i++) {
+            const aiColor4D& color = mesh->mColors[0][i];
+            data.Vertices[i].Color = { color.r, color.g, color.b, color.a };
+        }
+    } else {
+        for (Vertex& vertex : data.Vertices) {
             vertex.Color = Math::Vector4(1.0f);
         }
-
-        data.Vertices.push_back(vertex);
     }
 
     // 处理索引
+    data.Indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3);
     for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
-        for (unsigned int j = 0; j < face.mNumIndices; j++) {
-            data.Indices.push_back(face.mIndices[j]);
-        }
+        const aiFace& face = mesh->mFaces[i];
+        data.Indices.insert(data.Indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
     }
 
     // 处理材质
@@ -168,6 +189,44 @@ MeshData MeshLoader::ProcessMesh(const aiMesh* mesh, const aiScene* World, const
     return data;
 }
 
+void MeshLoader::OptimizeMesh(MeshData& data, const MeshImportSettings& settings) {
+    // Everything below works on triangle lists only.
+    if (data.Indices.empty() || data.Indices.size() % 3 != 0) {
+        return;
+    }
+
+    const size_t originalVertices = data.Vertices.size();
+    const float acmrBefore = MeshOptimizer::AnalyzeVertexCache(data.Indices.data(), data.Indices.size(),
+                                                                data.Vertices.size());
+    if (settings.WeldVertices) {
+        MeshOptimizer::WeldVertices(data);
+    }
+    if (settings.LodCount > 1) {
+        MeshOptimizer::BuildLodChain(data, settings.LodCount, settings.LodReduction, settings.LodMaxError,
+                                     settings.LodScreenSize);
+    }
+
+    std::vector<MeshLod> lods = data.Lods;
+    if (lods.empty()) {
+        lods.push_back({ 0, static_cast<uint32_t>(data.Indices.size()), 0.0f, 0.0f });
+    }
+    for (const MeshLod& lod : lods) {
+        unsigned int* indices = data.Indices.data() + lod.FirstIndex;
+        if (settings.OptimizeVertexCache) {
+            MeshOptimizer::OptimizeVertexCache(indices, lod.IndexCount, data.Vertices.size());
+        }
+        if (settings.OptimizeOverdraw) {
+            MeshOptimizer::OptimizeOverdraw(indices, lod.IndexCount, data.Vertices, settings.OverdrawThreshold);
+        }
+    }
+    MeshOptimizer::OptimizeVertexFetch(data);
+
+    const float acmrAfter = MeshOptimizer::AnalyzeVertexCache(data.Indices.data(), lods.front().IndexCount,
+                                                               data.Vertices.size());
+    ZGINE_CORE_TRACE("MeshLoader: {} -> {} vertices, ACMR {:.2f} -> {:.2f}, {} LOD(s)",
+        originalVertices, data.Vertices.size(), acmrBefore, acmrAfter, lods.size());
+}
+
 std::vector<std::shared_ptr<Texture>> MeshLoader::LoadMaterialTextures(const aiMaterial* mat,
                                                                        const aiScene* World,
                                                                        int type, const std::string& typeName,
@@ -0,0 +1,637 @@
+#include <Zgine/Resources/Mesh/MeshOptimizer.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Zgine {
+namespace MeshOptimizer {
+
+namespace {
+
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+// ---- Shared helpers ---------------------------------------------------
+
+struct VertexHash {
+    size_t operator()(const Vertex* vertex) const {
+        // FNV-1a over the raw bytes; equal vertices are bit-identical.
+        const auto* bytes = reinterpret_cast<const unsigned char*>(vertex);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < sizeof(Vertex); ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+struct VertexEqual {
+    bool operator()(const Vertex* a, const Vertex* b) const {
+        return std::memcmp(a, b, sizeof(Vertex)) == 0;
+    }
+};
+
+// Triangles around each vertex, as a CSR list: Triangles[Offsets[v], Offsets[v + 1]).
+struct Adjacency {
+    std::vector<uint32_t> Offsets;
+    std::vector<uint32_t> Triangles;
+};
+
+void BuildAdjacency(const unsigned int* indices, size_t indexCount, size_t vertexCount, Adjacency& adjacency) {
+    adjacency.Offsets.assign(vertexCount + 1, 0);
+    for (size_t i = 0; i < indexCount; ++i) {
+        ++adjacency.Offsets[indices[i] + 1];
+    }
+    std::partial_sum(adjacency.Offsets.begin(), adjacency.Offsets.end(), adjacency.Offsets.begin());
+
+    adjacency.Triangles.resize(indexCount);
+    std::vector<uint32_t> cursor(adjacency.Offsets.begin(), adjacency.Offsets.end() - 1);
+    for (size_t i = 0; i < indexCount; ++i) {
+        adjacency.Triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+}
+
+struct Float3 {
+    float x, y, z;
+};
+
+Float3 ToFloat3(const Math::Vector3& v) { return { v.x, v.y, v.z }; }
+Float3 Sub(const Float3& a, const Float3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+Float3 Cross(const Float3& a, const Float3& b) {
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+Float3 TriangleNormal(const Float3& a, const Float3& b, const Float3& c) {
+    return Cross(Sub(b, a), Sub(c, a)); // length is twice the area
+}
+
+// ---- Vertex cache (Forsyth) -------------------------------------------
+
+// The scoring models a 32-entry LRU cache; orders that are good for it
+// are good for the smaller FIFO caches of real hardware as well.
+constexpr uint32_t kScoringCacheSize = 32;
+
+float VertexScore(int cachePosition, uint32_t remainingTriangles) {
+    if (remainingTriangles == 0) {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // The last triangle's vertices: fixed score, so strips are not favoured.
+            score = 0.75f;
+        } else {
+            const float scale = 1.0f / static_cast<float>(kScoringCacheSize - 3);
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, 1.5f);
+        }
+    }
+    // Boost vertices with few triangles left, so they are finished off.
+    return score + 2.0f / std::sqrt(static_cast<float>(remainingTriangles));
+}
+
+// ---- Simplification -----------------------------------------------------
+
+// Symmetric 4x4 error quadric of planes, with the summed weight.
+struct Quadric {
+    double A00 = 0, A01 = 0, A02 = 0, A03 = 0;
+    double A11 = 0, A12 = 0, A13 = 0;
+    double A22 = 0, A23 = 0;
+    double A33 = 0;
+    double Weight = 0;
+
+    void AddPlane(double a, double b, double c, double d, double weight) {
+        A00 += weight * a * a; A01 += weight * a * b; A02 += weight * a * c; A03 += weight * a * d;
+        A11 += weight * b * b; A12 += weight * b * c; A13 += weight * b * d;
+        A22 += weight * c * c; A23 += weight * c * d;
+        A33 += weight * d * d;
+        Weight += weight;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        A00 += other.A00; A01 += other.A01; A02 += other.A02; A03 += other.A03;
+        A11 += other.A11; A12 += other.A12; A13 += other.A13;
+        A22 += other.A22; A23 += other.A23;
+        A33 += other.A33;
+        Weight += other.Weight;
+        return *this;
+    }
+
+    // Weighted mean squared distance of @p p to the planes.
+    [[nodiscard]] double Error(const Float3& p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        const double error = A00 * x * x + 2.0 * A01 * x * y + 2.0 * A02 * x * z + 2.0 * A03 * x
+                           + A11 * y * y + 2.0 * A12 * y * z + 2.0 * A13 * y
+                           + A22 * z * z + 2.0 * A23 * z
+                           + A33;
+        return Weight > 0.0 ? std::max(error, 0.0) / Weight : 0.0;
+    }
+};
+
+struct Collapse {
+    uint32_t From;
+    uint32_t To;
+    double Cost;
+};
+
+uint64_t EdgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32 | b) : (static_cast<uint64_t>(b) << 32 | a);
+}
+
+void RemoveDegenerateTriangles(std::vector<unsigned int>& indices) {
+    size_t write = 0;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const unsigned int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if (a == b || b == c || c == a) {
+            continue;
+        }
+        indices[write++] = a;
+        indices[write++] = b;
+        indices[write++] = c;
+    }
+    indices.resize(write);
+}
+
+} // namespace
+
+uint32_t WeldVertices(MeshData& data) {
+    const size_t vertexCount = data.Vertices.size();
+    std::unordered_map<const Vertex*, uint32_t, VertexHash, VertexEqual> unique;
+    unique.reserve(vertexCount);
+
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<Vertex> welded;
+    welded.reserve(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        const auto [it, inserted] = unique.try_emplace(&data.Vertices[i], static_cast<uint32_t>(welded.size()));
+        if (inserted) {
+            welded.push_back(data.Vertices[i]);
+        }
+        remap[i] = it->second;
+    }
+
+    for (unsigned int& index : data.Indices) {
+        index = remap[index];
+    }
+    const auto removed = static_cast<uint32_t>(vertexCount - welded.size());
+    data.Vertices = std::move(welded);
+    return removed;
+}
+
+void OptimizeVertexCache(unsigned int* indices, size_t indexCount, size_t vertexCount) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+
+    const std::vector<unsigned int> source(indices, indices + triangleCount * 3);
+    Adjacency adjacency;
+    BuildAdjacency(source.data(), source.size(), vertexCount, adjacency);
+
+    // Each vertex's live triangles are the first Remaining entries of its list.
+    std::vector<uint32_t> remaining(vertexCount);
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        remaining[v] = adjacency.Offsets[v + 1] - adjacency.Offsets[v];
+        vertexScore[v] = VertexScore(-1, remaining[v]);
+    }
+
+    std::vector<float> triangleScore(triangleCount);
+    std::vector<bool> emitted(triangleCount, false);
+    size_t best = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScore[t] = vertexScore[source[t * 3]] + vertexScore[source[t * 3 + 1]] + vertexScore[source[t * 3 + 2]];
+        if (triangleScore[t] > triangleScore[best]) {
+            best = t;
+        }
+    }
+
+    uint32_t cache[kScoringCacheSize + 3];
+    size_t cacheCount = 0;
+    size_t scan = 0; // fallback when nothing in the cache has triangles left
+    size_t output = 0;
+
+    for (size_t step = 0; step < triangleCount; ++step) {
+        if (best == kNone) {
+            while (emitted[scan]) {
+                ++scan;
+            }
+            best = scan;
+        }
+
+        const unsigned int* triangle = &source[best * 3];
+        indices[output++] = triangle[0];
+        indices[output++] = triangle[1];
+        indices[output++] = triangle[2];
+        emitted[best] = true;
+
+        for (size_t k = 0; k < 3; ++k) {
+            const unsigned int v = triangle[k];
+            uint32_t* begin = &adjacency.Triangles[adjacency.Offsets[v]];
+            uint32_t* end = begin + remaining[v];
+            uint32_t* found = std::find(begin, end, static_cast<uint32_t>(best));
+            if (found != end) {
+                std::swap(*found, *(end - 1));
+                --remaining[v];
+            }
+        }
+
+        // The triangle's vertices move to the front; the rest shift back.
+        uint32_t next[kScoringCacheSize + 3];
+        size_t nextCount = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            if (std::find(next, next + nextCount, triangle[k]) == next + nextCount) {
+                next[nextCount++] = triangle[k];
+            }
+        }
+        for (size_t i = 0; i < cacheCount; ++i) {
+            if (std::find(next, next + nextCount, cache[i]) == next + nextCount) {
+                next[nextCount++] = cache[i];
+            }
+        }
+
+        for (size_t i = 0; i < nextCount; ++i) {
+            const uint32_t v = next[i];
+            cachePosition[v] = i < kScoringCacheSize ? static_cast<int>(i) : -1;
+            vertexScore[v] = VertexScore(cachePosition[v], remaining[v]);
+        }
+
+        // Only triangles around (previously) cached vertices changed score.
+        best = kNone;
+        float bestScore = -1.0f;
+        for (size_t i = 0; i < nextCount; ++i) {
+            const uint32_t v = next[i];
+            const uint32_t* live = &adjacency.Triangles[adjacency.Offsets[v]];
+            for (uint32_t j = 0; j < remaining[v]; ++j) {
+                const uint32_t t = live[j];
+                const float score = vertexScore[source[t * 3]] + vertexScore[source[t * 3 + 1]]
+                                  + vertexScore[source[t * 3 + 2]];
+                triangleScore[t] = score;
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = t;
+                }
+            }
+        }
+
+        cacheCount = std::min<size_t>(nextCount, kScoringCacheSize);
+        std::copy(next, next + cacheCount, cache);
+    }
+}
+
+float AnalyzeVertexCache(const unsigned int* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return 0.0f;
+    }
+
+    // FIFO by timestamp: a vertex is cached while fewer than cacheSize misses happened since its own.
+    std::vector<uint32_t> stamp(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    size_t misses = 0;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        const unsigned int v = indices[i];
+        if (time - stamp[v] > cacheSize) {
+            stamp[v] = time++;
+            ++misses;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+void OptimizeOverdraw(unsigned int* indices, size_t indexCount, const std::vector<Vertex>& vertices, float threshold) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+
+    // Cache misses of every triangle in the current (cache-optimized) order.
+    std::vector<uint8_t> misses(triangleCount);
+    {
+        std::vector<uint32_t> stamp(vertices.size(), 0);
+        uint32_t time = kVertexCacheSize + 1;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (size_t k = 0; k < 3; ++k) {
+                const unsigned int v = indices[t * 3 + k];
+                if (time - stamp[v] > kVertexCacheSize) {
+                    stamp[v] = time++;
+                    ++misses[t];
+                }
+            }
+        }
+    }
+
+    // Hard boundaries where the cache starts over anyway (all three vertices
+    // missed), then soft ones inside each hard cluster wherever the part so
+    // far is within the threshold of the cluster's own miss ratio.
+    std::vector<size_t> clusters;
+    for (size_t begin = 0; begin < triangleCount;) {
+        size_t end = begin + 1;
+        while (end < triangleCount && misses[end] < 3) {
+            ++end;
+        }
+
+        size_t clusterMisses = 0;
+        for (size_t t = begin; t < end; ++t) {
+            clusterMisses += misses[t];
+        }
+        const float limit = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+        size_t start = begin;
+        size_t partMisses = 0;
+        for (size_t t = begin; t < end; ++t) {
+            partMisses += misses[t];
+            if (static_cast<float>(partMisses) <= limit * static_cast<float>(t + 1 - start)) {
+                clusters.push_back(start);
+                start = t + 1;
+                partMisses = 0;
+            }
+        }
+        if (start < end) {
+            clusters.push_back(start);
+        }
+        begin = end;
+    }
+    if (clusters.size() < 2) {
+        return;
+    }
+
+    // Sort clusters so the ones facing away from the centre draw first.
+    struct ClusterInfo {
+        size_t Begin, End;
+        Float3 Centroid{ 0, 0, 0 };
+        Float3 Normal{ 0, 0, 0 };
+        float Area = 0.0f;
+        float Key = 0.0f;
+    };
+    std::vector<ClusterInfo> infos(clusters.size());
+    Float3 meshCentroid{ 0, 0, 0 };
+    float meshArea = 0.0f;
+    for (size_t c = 0; c < clusters.size(); ++c) {
+        ClusterInfo& info = infos[c];
+        info.Begin = clusters[c];
+        info.End = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+        for (size_t t = info.Begin; t < info.End; ++t) {
+            const Float3 a = ToFloat3(vertices[indices[t * 3]].Position);
+            const Float3 b = ToFloat3(vertices[indices[t * 3 + 1]].Position);
+            const Float3 c3 = ToFloat3(vertices[indices[t * 3 + 2]].Position);
+            const Float3 normal = TriangleNormal(a, b, c3);
+            const float area = std::sqrt(Dot(normal, normal));
+            info.Centroid.x += (a.x + b.x + c3.x) * area;
+            info.Centroid.y += (a.y + b.y + c3.y) * area;
+            info.Centroid.z += (a.z + b.z + c3.z) * area;
+            info.Normal.x += normal.x;
+            info.Normal.y += normal.y;
+            info.Normal.z += normal.z;
+            info.Area += area;
+        }
+        meshCentroid.x += info.Centroid.x;
+        meshCentroid.y += info.Centroid.y;
+        meshCentroid.z += info.Centroid.z;
+        meshArea += info.Area;
+        if (info.Area > 0.0f) {
+            const float scale = 1.0f / (3.0f * info.Area);
+            info.Centroid = { info.Centroid.x * scale, info.Centroid.y * scale, info.Centroid.z * scale };
+        }
+    }
+    if (meshArea > 0.0f) {
+        const float scale = 1.0f / (3.0f * meshArea);
+        meshCentroid = { meshCentroid.x * scale, meshCentroid.y * scale, meshCentroid.z * scale };
+    }
+    for (ClusterInfo& info : infos) {
+        const float length = std::sqrt(Dot(info.Normal, info.Normal));
+        if (length > 0.0f) {
+            info.Key = Dot(Sub(info.Centroid, meshCentroid), info.Normal) / length;
+        }
+    }
+    std::stable_sort(infos.begin(), infos.end(), [](const ClusterInfo& a, const ClusterInfo& b) {
+        return a.Key > b.Key;
+    });
+
+    const std::vector<unsigned int> source(indices, indices + triangleCount * 3);
+    size_t output = 0;
+    for (const ClusterInfo& info : infos) {
+        for (size_t i = info.Begin * 3; i < info.End * 3; ++i) {
+            indices[output++] = source[i];
+        }
+    }
+}
+
+void OptimizeVertexFetch(MeshData& data) {
+    std::vector<uint32_t> remap(data.Vertices.size(), kNone);
+    uint32_t next = 0;
+    for (unsigned int& index : data.Indices) {
+        if (remap[index] == kNone) {
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+
+    std::vector<Vertex> ordered(next);
+    for (size_t v = 0; v < data.Vertices.size(); ++v) {
+        if (remap[v] != kNone) {
+            ordered[remap[v]] = data.Vertices[v];
+        }
+    }
+    data.Vertices = std::move(ordered);
+}
+
+std::vector<unsigned int> Simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                                   size_t targetIndexCount, float maxError, float* outError) {
+    std::vector<unsigned int> result(indices.begin(), indices.begin() + indices.size() / 3 * 3);
+    RemoveDegenerateTriangles(result);
+    if (outError) {
+        *outError = 0.0f;
+    }
+    if (result.size() <= targetIndexCount || vertices.empty()) {
+        return result;
+    }
+
+    const size_t vertexCount = vertices.size();
+    std::vector<Float3> positions(vertexCount);
+    Float3 minimum = ToFloat3(vertices[0].Position);
+    Float3 maximum = minimum;
+    for (size_t v = 0; v < vertexCount; ++v) {
+        positions[v] = ToFloat3(vertices[v].Position);
+        minimum = { std::min(minimum.x, positions[v].x), std::min(minimum.y, positions[v].y), std::min(minimum.z, positions[v].z) };
+        maximum = { std::max(maximum.x, positions[v].x), std::max(maximum.y, positions[v].y), std::max(maximum.z, positions[v].z) };
+    }
+    double extent = std::max({ maximum.x - minimum.x, maximum.y - minimum.y, maximum.z - minimum.z });
+    if (extent <= 0.0) {
+        extent = 1.0;
+    }
+    const double limit = static_cast<double>(maxError) * extent;
+    const double limitSquared = limit * limit;
+
+    // Area-weighted plane quadrics, and border vertices (on an edge with
+    // anything but two triangles), which stay where they are.
+    std::vector<Quadric> quadrics(vertexCount);
+    std::unordered_map<uint64_t, uint32_t> edgeUse;
+    edgeUse.reserve(result.size());
+    for (size_t i = 0; i < result.size(); i += 3) {
+        const unsigned int tri[3] = { result[i], result[i + 1], result[i + 2] };
+        const Float3 normal = TriangleNormal(positions[tri[0]], positions[tri[1]], positions[tri[2]]);
+        const double length = std::sqrt(static_cast<double>(Dot(normal, normal)));
+        if (length > 0.0) {
+            const double a = normal.x / length, b = normal.y / length, c = normal.z / length;
+            const double d = -(a * positions[tri[0]].x + b * positions[tri[0]].y + c * positions[tri[0]].z);
+            for (unsigned int v : tri) {
+                quadrics[v].AddPlane(a, b, c, d, length * 0.5);
+            }
+        }
+        for (size_t k = 0; k < 3; ++k) {
+            ++edgeUse[EdgeKey(tri[k], tri[(k + 1) % 3])];
+        }
+    }
+    std::vector<bool> locked(vertexCount, false);
+    for (const auto& [key, count] : edgeUse) {
+        if (count != 2) {
+            locked[static_cast<uint32_t>(key >> 32)] = true;
+            locked[static_cast<uint32_t>(key)] = true;
+        }
+    }
+
+    double worstError = 0.0;
+    Adjacency adjacency;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> target(vertexCount);
+    std::vector<bool> touched(vertexCount);
+
+    while (result.size() > targetIndexCount) {
+        BuildAdjacency(result.data(), result.size(), vertexCount, adjacency);
+
+        collapses.clear();
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t a = result[i + k];
+                const uint32_t b = result[i + (k + 1) % 3];
+                // Each interior edge shows up once per side; take the side where a < b.
+                // Border edges, seen from one side only, have both ends locked anyway.
+                if (a > b) {
+                    continue;
+                }
+                for (const auto& [from, to] : { std::pair{ a, b }, std::pair{ b, a } }) {
+                    if (locked[from]) {
+                        continue;
+                    }
+                    Quadric merged = quadrics[from];
+                    merged += quadrics[to];
+                    collapses.push_back({ from, to, merged.Error(positions[to]) });
+                }
+            }
+        }
+        if (collapses.empty()) {
+            break;
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.Cost < b.Cost;
+        });
+
+        std::iota(target.begin(), target.end(), 0u);
+        std::fill(touched.begin(), touched.end(), false);
+        const size_t trianglesToRemove = (result.size() - targetIndexCount + 2) / 3;
+        size_t removed = 0;
+        size_t applied = 0;
+
+        for (const Collapse& collapse : collapses) {
+            if (collapse.Cost > limitSquared || removed >= trianglesToRemove) {
+                break;
+            }
+            if (touched[collapse.From] || touched[collapse.To]) {
+                continue;
+            }
+
+            // Moving From onto To must not flip any triangle that survives.
+            bool flips = false;
+            size_t degenerate = 0;
+            for (uint32_t j = adjacency.Offsets[collapse.From]; j < adjacency.Offsets[collapse.From + 1]; ++j) {
+                const unsigned int* tri = &result[adjacency.Triangles[j] * 3];
+                if (tri[0] == collapse.To || tri[1] == collapse.To || tri[2] == collapse.To) {
+                    ++degenerate;
+                    continue;
+                }
+                Float3 moved[3];
+                for (size_t k = 0; k < 3; ++k) {
+                    moved[k] = positions[tri[k] == collapse.From ? collapse.To : tri[k]];
+                }
+                const Float3 before = TriangleNormal(positions[tri[0]], positions[tri[1]], positions[tri[2]]);
+                const Float3 after = TriangleNormal(moved[0], moved[1], moved[2]);
+                if (Dot(before, after) <= 0.0f) {
+                    flips = true;
+                    break;
+                }
+            }
+            if (flips) {
+                continue;
+            }
+
+            target[collapse.From] = collapse.To;
+            quadrics[collapse.To] += quadrics[collapse.From];
+            // Freeze the neighbourhood so the flip checks of this pass stay valid.
+            for (uint32_t j = adjacency.Offsets[collapse.From]; j < adjacency.Offsets[collapse.From + 1]; ++j) {
+                const unsigned int* tri = &result[adjacency.Triangles[j] * 3];
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = true;
+            }
+            touched[collapse.To] = true;
+            worstError = std::max(worstError, collapse.Cost);
+            removed += degenerate;
+            ++applied;
+        }
+        if (applied == 0) {
+            break;
+        }
+
+        for (unsigned int& index : result) {
+            index = target[index];
+        }
+        RemoveDegenerateTriangles(result);
+    }
+
+    if (outError) {
+        *outError = static_cast<float>(std::sqrt(worstError) / extent);
+    }
+    return result;
+}
+
+void BuildLodChain(MeshData& data, uint32_t lodCount, float reduction, float maxError, float screenSize) {
+    data.Lods.clear();
+    data.Lods.push_back({ 0, static_cast<uint32_t>(data.Indices.size()), 0.0f, 0.0f });
+    reduction = std::clamp(reduction, 0.05f, 0.95f);
+
+    const std::vector<unsigned int> source = data.Indices;
+    size_t previous = source.size();
+    for (uint32_t level = 1; level < lodCount; ++level) {
+        const size_t targetCount = static_cast<size_t>(static_cast<float>(previous) * reduction) / 3 * 3;
+        if (targetCount < 3) {
+            break;
+        }
+
+        // Simplify from the full mesh each time, so errors do not compound.
+        float error = 0.0f;
+        std::vector<unsigned int> lod = Simplify(data.Vertices, source, targetCount, maxError, &error);
+        if (lod.empty() || lod.size() * 10 > previous * 9) {
+            break; // the error limit stopped it; another level would barely differ
+        }
+
+        data.Lods.push_back({ static_cast<uint32_t>(data.Indices.size()), static_cast<uint32_t>(lod.size()), 0.0f, error });
+        data.Indices.insert(data.Indices.end(), lod.begin(), lod.end());
+        previous = lod.size();
+    }
+
+    const float step = std::sqrt(reduction);
+    float size = screenSize;
+    for (size_t i = 0; i + 1 < data.Lods.size(); ++i) {
+        data.Lods[i].ScreenSize = size;
+        size *= step;
+    }
+    data.Lods.back().ScreenSize = 0.0f;
+}
+
+} // namespace MeshOptimizer
+
+} // namespace Zgine
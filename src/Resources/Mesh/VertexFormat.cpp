@@ -0,0 +1,224 @@
+#include <Zgine/Resources/Mesh/VertexFormat.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Zgine {
+
+namespace {
+
+// Matches GetVertexLayout(VertexFormat::Quantized).
+struct QuantizedVertex {
+    uint16_t Position[4]; // unorm16 in the mesh bounds; w unused
+    uint32_t Normal;      // snorm 10:10:10:2
+    uint16_t TexCoord[2]; // half
+};
+static_assert(sizeof(QuantizedVertex) == 16, "QuantizedVertex must stay tightly packed");
+
+// Matches GetVertexLayout(VertexFormat::QuantizedColor).
+struct QuantizedColorVertex {
+    QuantizedVertex Base;
+    uint8_t Color[4];     // unorm8 RGBA
+};
+static_assert(sizeof(QuantizedColorVertex) == 20, "QuantizedColorVertex must stay tightly packed");
+
+uint16_t QuantizeUnorm16(float value, float minimum, float extent) {
+    if (extent <= 0.0f) {
+        return 0;
+    }
+    const float unit = std::clamp((value - minimum) / extent, 0.0f, 1.0f);
+    return static_cast<uint16_t>(std::lround(unit * 65535.0f));
+}
+
+uint8_t QuantizeUnorm8(float value) {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+QuantizedVertex Quantize(const Vertex& vertex, const AABB& bounds) {
+    QuantizedVertex out{};
+    out.Position[0] = QuantizeUnorm16(vertex.Position.x, bounds.Min.x, bounds.Max.x - bounds.Min.x);
+    out.Position[1] = QuantizeUnorm16(vertex.Position.y, bounds.Min.y, bounds.Max.y - bounds.Min.y);
+    out.Position[2] = QuantizeUnorm16(vertex.Position.z, bounds.Min.z, bounds.Max.z - bounds.Min.z);
+    out.Normal = VertexQuantization::PackSnorm1010102(vertex.Normal);
+    out.TexCoord[0] = VertexQuantization::FloatToHalf(vertex.TexCoords.x);
+    out.TexCoord[1] = VertexQuantization::FloatToHalf(vertex.TexCoords.y);
+    return out;
+}
+
+} // namespace
+
+const char* VertexFormatToString(VertexFormat format) {
+    switch (format) {
+        case VertexFormat::Float: return "Float";
+        case VertexFormat::Quantized: return "Quantized";
+        case VertexFormat::QuantizedColor: return "QuantizedColor";
+    }
+    return "Float";
+}
+
+VertexFormat VertexFormatFromString(const std::string& value) {
+    if (value == "Quantized") return VertexFormat::Quantized;
+    if (value == "QuantizedColor") return VertexFormat::QuantizedColor;
+    return VertexFormat::Float;
+}
+
+BufferLayout GetVertexLayout(VertexFormat format) {
+    switch (format) {
+        case VertexFormat::Quantized:
+            return {
+                { ShaderDataType::UShort4, "a_Position", true },
+                { ShaderDataType::Int1010102, "a_Normal", true },
+                { ShaderDataType::Half2, "a_TexCoord" },
+            };
+        case VertexFormat::QuantizedColor:
+            return {
+                { ShaderDataType::UShort4, "a_Position", true },
+                { ShaderDataType::Int1010102, "a_Normal", true },
+                { ShaderDataType::Half2, "a_TexCoord" },
+                { ShaderDataType::UByte4, "a_Color", true },
+            };
+        case VertexFormat::Float:
+            break;
+    }
+    return {
+        { ShaderDataType::Float3, "a_Position" },
+        { ShaderDataType::Float3, "a_Normal" },
+        { ShaderDataType::Float2, "a_TexCoord" },
+        { ShaderDataType::Float4, "a_Color" },
+    };
+}
+
+uint32_t GetVertexStride(VertexFormat format) {
+    switch (format) {
+        case VertexFormat::Quantized: return sizeof(QuantizedVertex);
+        case VertexFormat::QuantizedColor: return sizeof(QuantizedColorVertex);
+        case VertexFormat::Float: break;
+    }
+    return sizeof(Vertex);
+}
+
+namespace VertexQuantization {
+
+uint16_t FloatToHalf(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u) {
+        // Infinity stays infinity, NaN stays a (quiet) NaN.
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x0200u : 0u));
+    }
+    if (magnitude >= 0x477FF000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u); // rounds to 65520 or more
+    }
+    if (magnitude < 0x38800000u) {
+        // Below the smallest normal half: a multiple of 2^-24.
+        float absolute = 0.0f;
+        std::memcpy(&absolute, &magnitude, sizeof(absolute));
+        return static_cast<uint16_t>(sign | static_cast<uint16_t>(std::nearbyint(absolute * 16777216.0f)));
+    }
+
+    // Rebias the exponent and round the mantissa to nearest even.
+    uint32_t half = magnitude - 0x38000000u;
+    half += 0x0FFFu + ((half >> 13) & 1u);
+    return static_cast<uint16_t>(sign | (half >> 13));
+}
+
+float HalfToFloat(uint16_t value) {
+    const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1Fu;
+    const uint32_t mantissa = value & 0x03FFu;
+
+    if (exponent == 0) {
+        const float subnormal = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -subnormal : subnormal;
+    }
+
+    uint32_t bits = sign | (mantissa << 13);
+    bits |= exponent == 0x1Fu ? 0x7F800000u : (exponent + 112u) << 23;
+    float result = 0.0f;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+uint32_t PackSnorm1010102(const Math::Vector3& value) {
+    const auto pack = [](float component) {
+        const long quantized = std::lround(std::clamp(component, -1.0f, 1.0f) * 511.0f);
+        return static_cast<uint32_t>(quantized) & 0x3FFu;
+    };
+    return pack(value.x) | pack(value.y) << 10 | pack(value.z) << 20;
+}
+
+Math::Vector3 UnpackSnorm1010102(uint32_t packed) {
+    const auto unpack = [packed](int shift) {
+        // Move the field to the top and shift back down to sign-extend it.
+        const auto field = static_cast<int32_t>(packed << (22 - shift)) >> 22;
+        return std::max(static_cast<float>(field) / 511.0f, -1.0f);
+    };
+    return Math::Vector3(unpack(0), unpack(10), unpack(20));
+}
+
+Math::Vector3 GetDequantizeScale(VertexFormat format, const AABB& bounds) {
+    if (format == VertexFormat::Float) {
+        return Math::Vector3(1.0f);
+    }
+    return Math::Vector3(bounds.Max.x - bounds.Min.x, bounds.Max.y - bounds.Min.y, bounds.Max.z - bounds.Min.z);
+}
+
+Math::Vector3 GetDequantizeOffset(VertexFormat format, const AABB& bounds) {
+    return format == VertexFormat::Float ? Math::Vector3(0.0f) : bounds.Min;
+}
+
+AABB ComputeBounds(const std::vector<Vertex>& vertices) {
+    if (vertices.empty()) {
+        return AABB();
+    }
+    AABB bounds(vertices.front().Position, vertices.front().Position);
+    for (const Vertex& vertex : vertices) {
+        bounds.Min = Math::Vector3(std::min(bounds.Min.x, vertex.Position.x),
+            std::min(bounds.Min.y, vertex.Position.y), std::min(bounds.Min.z, vertex.Position.z));
+        bounds.Max = Math::Vector3(std::max(bounds.Max.x, vertex.Position.x),
+            std::max(bounds.Max.y, vertex.Position.y), std::max(bounds.Max.z, vertex.Position.z));
+    }
+    return bounds;
+}
+
+std::vector<uint8_t> EncodeVertices(const std::vector<Vertex>& vertices, VertexFormat format, const AABB& bounds) {
+    const uint32_t stride = GetVertexStride(format);
+    std::vector<uint8_t> bytes(vertices.size() * stride);
+    uint8_t* out = bytes.data();
+
+    switch (format) {
+        case VertexFormat::Float:
+            if (!vertices.empty()) {
+                std::memcpy(out, vertices.data(), bytes.size());
+            }
+            break;
+        case VertexFormat::Quantized:
+            for (const Vertex& vertex : vertices) {
+                const QuantizedVertex quantized = Quantize(vertex, bounds);
+                std::memcpy(out, &quantized, sizeof(quantized));
+                out += stride;
+            }
+            break;
+        case VertexFormat::QuantizedColor:
+            for (const Vertex& vertex : vertices) {
+                QuantizedColorVertex quantized{};
+                quantized.Base = Quantize(vertex, bounds);
+                quantized.Color[0] = QuantizeUnorm8(vertex.Color.x);
+                quantized.Color[1] = QuantizeUnorm8(vertex.Color.y);
+                quantized.Color[2] = QuantizeUnorm8(vertex.Color.z);
+                quantized.Color[3] = QuantizeUnorm8(vertex.Color.w);
+                std::memcpy(out, &quantized, sizeof(quantized));
+                out += stride;
+            }
+            break;
+    }
+    return bytes;
+}
+
+} // namespace VertexQuantization
+
+} // namespace Zgine
@@ -0,0 +1,255 @@
+#include <Zgine/Resources/Texture/TextureStreamer.h>
+#include <Zgine/Resources/Import/AssetCooker.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace Zgine {
+
+namespace {
+    size_t GetLevelBytes(const std::vector<TextureMip>& mips, uint32_t firstMip, uint32_t endMip) {
+        size_t total = 0;
+        for (uint32_t level = firstMip; level < endMip && level < mips.size(); ++level) {
+            total += mips[level].Size;
+        }
+        return total;
+    }
+}
+
+TextureStreamer::TextureStreamer(const TextureStreamerConfig& config)
+    : m_Config(config) {
+}
+
+TextureStreamer::~TextureStreamer() {
+    WaitForLoads();
+}
+
+void TextureStreamer::SetConfig(const TextureStreamerConfig& config) {
+    m_Config = config;
+}
+
+void TextureStreamer::SetJobSystem(JobSystem* jobs) {
+    WaitForLoads();
+    m_Jobs = jobs;
+}
+
+void TextureStreamer::WaitForLoads() {
+    if (m_Jobs) {
+        m_Jobs->Wait(m_LoadCounter);
+    }
+}
+
+void TextureStreamer::Register(const std::shared_ptr<Texture>& texture, std::shared_ptr<const CookedTexture> source) {
+    if (!texture || !source || source->GetMips().empty()) {
+        return;
+    }
+
+    Entry entry;
+    entry.TextureRef = texture;
+    entry.Source = std::move(source);
+    entry.TailMip = GetTailMip(entry.Source->GetMips(), m_Config.TailSize);
+    entry.RequestedMip = entry.TailMip;
+
+    std::lock_guard<std::mutex> lock(m_RegisterMutex);
+    m_Registrations.push_back(std::move(entry));
+}
+
+void TextureStreamer::AcceptRegistrations() {
+    std::vector<Entry> registrations;
+    {
+        std::lock_guard<std::mutex> lock(m_RegisterMutex);
+        registrations.swap(m_Registrations);
+    }
+    for (Entry& entry : registrations) {
+        // A texture destroyed before its first Update() is never tracked; one
+        // reusing the address of a destroyed texture replaces its entry.
+        if (auto texture = entry.TextureRef.lock()) {
+            m_Entries[texture.get()] = std::move(entry);
+        }
+    }
+}
+
+void TextureStreamer::Request(const Texture* texture, float screenPixels) {
+    auto it = m_Entries.find(texture);
+    if (it == m_Entries.end() || it->second.TextureRef.expired()) {
+        return;
+    }
+
+    Entry& entry = it->second;
+    const TextureMip& top = entry.Source->GetMips().front();
+    const uint32_t mip = std::min(GetDesiredMip(top.Width, top.Height, screenPixels), entry.TailMip);
+    if (!entry.Requested || entry.LastRequestFrame != m_Frame) {
+        entry.RequestedMip = mip;
+    } else {
+        entry.RequestedMip = std::min(entry.RequestedMip, mip);
+    }
+    entry.Requested = true;
+    entry.LastRequestFrame = m_Frame;
+}
+
+void TextureStreamer::StartLoad(Entry& entry, uint32_t firstMip) {
+    auto load = std::make_shared<Load>();
+    load->Source = entry.Source;
+    load->FirstMip = firstMip;
+    if (auto texture = entry.TextureRef.lock()) {
+        load->EndMip = texture->GetResidentMip();
+    }
+    entry.PendingLoad = load;
+
+    // The job owns the mapping through the load, so it may outlive the texture.
+    auto run = [load]() {
+        load->Source->Prefetch(load->FirstMip, load->EndMip);
+        load->Done.store(true, std::memory_order_release);
+    };
+    if (m_Jobs) {
+        m_Jobs->Run(std::move(run), &m_LoadCounter);
+    } else {
+        run();
+    }
+}
+
+void TextureStreamer::Update() {
+    AcceptRegistrations();
+    ++m_Frame;
+    m_Stats = Stats{};
+
+    struct Candidate {
+        Entry* Streamed = nullptr;
+        std::shared_ptr<Texture> Target;
+        uint32_t Mip = 0;        // finest level to keep
+        uint64_t LastUsed = 0;   // 0: not requested within RetainFrames
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(m_Entries.size());
+
+    size_t wantedBytes = 0;
+    for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+        std::shared_ptr<Texture> texture = it->second.TextureRef.lock();
+        if (!texture) {
+            it = m_Entries.erase(it);
+            continue;
+        }
+        Entry& entry = it->second;
+        const bool recent = entry.Requested && m_Frame - entry.LastRequestFrame <= m_Config.RetainFrames;
+        Candidate candidate;
+        candidate.Streamed = &entry;
+        candidate.Target = std::move(texture);
+        candidate.Mip = recent ? std::min(entry.RequestedMip, entry.TailMip) : entry.TailMip;
+        candidate.LastUsed = recent ? entry.LastRequestFrame : 0;
+        wantedBytes += GetLevelBytes(entry.Source->GetMips(), candidate.Mip, entry.TailMip);
+        candidates.push_back(std::move(candidate));
+        ++it;
+    }
+
+    // Tails are always resident and counted against the budget first; the
+    // high mips of the least recently requested textures go until the rest fits.
+    size_t tailBytes = 0;
+    for (const Candidate& candidate : candidates) {
+        const auto& mips = candidate.Streamed->Source->GetMips();
+        tailBytes += GetLevelBytes(mips, candidate.Streamed->TailMip, static_cast<uint32_t>(mips.size()));
+    }
+    if (tailBytes + wantedBytes > m_Config.GpuBudgetBytes) {
+        std::vector<Candidate*> order;
+        order.reserve(candidates.size());
+        for (Candidate& candidate : candidates) {
+            order.push_back(&candidate);
+        }
+        std::stable_sort(order.begin(), order.end(), [](const Candidate* a, const Candidate* b) {
+            return a->LastUsed < b->LastUsed;
+        });
+        for (Candidate* candidate : order) {
+            const auto& mips = candidate->Streamed->Source->GetMips();
+            while (tailBytes + wantedBytes > m_Config.GpuBudgetBytes && candidate->Mip < candidate->Streamed->TailMip) {
+                wantedBytes -= mips[candidate->Mip].Size;
+                ++candidate->Mip;
+            }
+        }
+    }
+
+    // Evict at once, which uploads nothing; upgrades start a load, or finish one that is done.
+    std::vector<Candidate*> ready;
+    for (Candidate& candidate : candidates) {
+        Entry& entry = *candidate.Streamed;
+        const auto& mips = entry.Source->GetMips();
+        const uint32_t resident = candidate.Target->GetResidentMip();
+        if (candidate.Mip > resident) {
+            if (candidate.Target->SetResidentMips(mips, candidate.Mip)) {
+                m_Stats.EvictedBytes += GetLevelBytes(mips, resident, candidate.Mip);
+            }
+        } else if (candidate.Mip < resident) {
+            if (!entry.PendingLoad) {
+                StartLoad(entry, candidate.Mip);
+            }
+            if (entry.PendingLoad->Done.load(std::memory_order_acquire)) {
+                ready.push_back(&candidate);
+            }
+        } else {
+            entry.PendingLoad.reset();
+        }
+    }
+
+    // Most recently requested first; the first upload always goes through.
+    std::sort(ready.begin(), ready.end(), [](const Candidate* a, const Candidate* b) {
+        return a->LastUsed > b->LastUsed;
+    });
+    for (Candidate* candidate : ready) {
+        Entry& entry = *candidate->Streamed;
+        const auto& mips = entry.Source->GetMips();
+        const uint32_t first = std::max(entry.PendingLoad->FirstMip, candidate->Mip);
+        const size_t bytes = GetLevelBytes(mips, first, candidate->Target->GetResidentMip());
+        if (m_Stats.UploadedBytes > 0 && m_Stats.UploadedBytes + bytes > m_Config.UploadBytesPerFrame) {
+            continue;
+        }
+        if (first < candidate->Target->GetResidentMip() && candidate->Target->SetResidentMips(mips, first)) {
+            m_Stats.UploadedBytes += bytes;
+        }
+        entry.PendingLoad.reset();
+    }
+
+    for (const Candidate& candidate : candidates) {
+        const auto& mips = candidate.Streamed->Source->GetMips();
+        m_Stats.ResidentBytes += GetLevelBytes(mips, candidate.Target->GetResidentMip(),
+                                               static_cast<uint32_t>(mips.size()));
+        if (candidate.Streamed->PendingLoad) {
+            ++m_Stats.PendingLoads;
+        }
+    }
+    m_Stats.TextureCount = candidates.size();
+}
+
+void TextureStreamer::Clear() {
+    WaitForLoads();
+    m_Entries.clear();
+    m_Stats = Stats{};
+    std::lock_guard<std::mutex> lock(m_RegisterMutex);
+    m_Registrations.clear();
+}
+
+TextureStreamer::Stats TextureStreamer::GetStats() const {
+    return m_Stats;
+}
+
+uint32_t TextureStreamer::GetTailMip(const std::vector<TextureMip>& mips, uint32_t tailSize) {
+    for (uint32_t level = 0; level < mips.size(); ++level) {
+        if (mips[level].Width <= tailSize && mips[level].Height <= tailSize) {
+            return level;
+        }
+    }
+    return mips.empty() ? 0 : static_cast<uint32_t>(mips.size() - 1);
+}
+
+uint32_t TextureStreamer::GetDesiredMip(uint32_t width, uint32_t height, float screenPixels) {
+    if (!(screenPixels >= 1.0f)) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    // Level n has (size >> n) texels across; the coarsest one with at least a texel per pixel.
+    const float texels = static_cast<float>(std::max(width, height));
+    if (texels <= screenPixels) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::floor(std::log2(texels / screenPixels)));
+}
+
+} // namespace Zgine
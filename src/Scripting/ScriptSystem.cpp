@@ -353,6 +353,17 @@ void ScriptSystem::Update(World* World, float deltaTime) {
     }
 }
 
+void ScriptSystem::DescribeAccess(SystemPhase phase, SystemAccess& access) const {
+    // Lua callbacks can reach any component and call into the physics and
+    // audio systems, so script updates never overlap another system. There
+    // is no FixedUpdate.
+    if (phase == SystemPhase::Update) {
+        access.SetExclusive();
+    } else {
+        access.SetNoAccess();
+    }
+}
+
 bool ScriptSystem::LoadScript(Entity entity) {
     if (!entity.HasComponent<ScriptComponent>()) {
         return false;
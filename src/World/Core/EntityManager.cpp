@@ -23,6 +23,7 @@ EntityHandle EntityManager::Create(const std::string& name) {
     registry.emplace<IDComponent>(handle);
     registry.emplace<TagComponent>(handle, name.empty() ? "Entity" : name);
     registry.emplace<TransformComponent>(handle);
+    registry.emplace<WorldTransformComponent>(handle);
     registry.emplace<RelationshipComponent>(handle);
 
     // Notify listeners
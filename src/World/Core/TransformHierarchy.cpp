@@ -0,0 +1,148 @@
+#include "TransformHierarchy.h"
+#include <Zgine/World/Components/Core/RelationshipComponent.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include "WorldRegistryAccess.h"
+#include <algorithm>
+
+namespace Zgine {
+
+namespace {
+    // Below this many nodes a parallel walk costs more than it saves.
+    constexpr size_t kParallelNodeThreshold = 1024;
+
+    bool IsHierarchyNode(const entt::registry& registry, entt::entity entity) {
+        return registry.valid(entity) && registry.all_of<TransformComponent, WorldTransformComponent>(entity);
+    }
+
+    bool IsHierarchyRoot(const entt::registry& registry, entt::entity entity) {
+        const auto* relationship = registry.try_get<RelationshipComponent>(entity);
+        if (!relationship || !relationship->Parent) {
+            return true;
+        }
+        // Parents without transforms do not contribute to the world matrix.
+        return !IsHierarchyNode(registry, Internal::ToEnTT(relationship->Parent));
+    }
+
+    bool LocalChanged(const TransformComponent& local, const WorldTransformComponent& world) {
+        return !(local.Translation == world.CachedTranslation)
+            || !(local.Rotation == world.CachedRotation)
+            || !(local.Scale == world.CachedScale);
+    }
+}
+
+void TransformHierarchy::OnStructureChanged(entt::registry& registry, entt::entity entity) noexcept {
+    (void)registry;
+    (void)entity;
+    m_StructureDirty = true;
+}
+
+size_t TransformHierarchy::Update(entt::registry& registry, JobSystem* jobs) {
+    if (m_StructureDirty) {
+        Rebuild(registry);
+    }
+
+    // Fetched once: storage lookups may not run concurrently with pool creation.
+    auto& locals = registry.storage<TransformComponent>();
+    auto& worlds = registry.storage<WorldTransformComponent>();
+
+    const uint32_t rootCount = static_cast<uint32_t>(GetRootCount());
+    size_t updated = 0;
+    if (!jobs || rootCount < 2 || m_Nodes.size() < kParallelNodeThreshold) {
+        updated = UpdateRange(locals, worlds, 0, m_Nodes.size());
+    } else {
+        // Roots are uneven in size; a few chunks per thread lets stealing balance them.
+        const uint32_t chunks = (jobs->GetThreadCount() + 1) * 4;
+        const uint32_t grain = std::max(1u, rootCount / chunks);
+        updated = jobs->ParallelReduce<size_t>(0, rootCount, grain, 0,
+            [&](uint32_t firstRoot, uint32_t lastRoot) {
+                return UpdateRange(locals, worlds, m_RootStarts[firstRoot], m_RootStarts[lastRoot]);
+            },
+            [](size_t a, size_t b) { return a + b; });
+    }
+
+    m_ForceRecompute = false;
+    return updated;
+}
+
+void TransformHierarchy::Rebuild(entt::registry& registry) {
+    m_Nodes.clear();
+    m_RootStarts.clear();
+
+    auto view = registry.view<TransformComponent, WorldTransformComponent>();
+    for (entt::entity root : view) {
+        if (!IsHierarchyRoot(registry, root)) {
+            continue;
+        }
+
+        m_RootStarts.push_back(static_cast<uint32_t>(m_Nodes.size()));
+        m_Nodes.push_back(Node{root, kNoParent});
+
+        // Children are emitted when their parent is expanded, so parents
+        // always precede children and the whole subtree stays contiguous.
+        // The stack holds node indices whose children are still pending.
+        m_Stack.clear();
+        m_Stack.push_back(static_cast<uint32_t>(m_Nodes.size() - 1));
+        while (!m_Stack.empty()) {
+            const uint32_t parentIndex = m_Stack.back();
+            m_Stack.pop_back();
+
+            const auto* relationship = registry.try_get<RelationshipComponent>(m_Nodes[parentIndex].Entity);
+            if (!relationship) {
+                continue;
+            }
+
+            for (EntityHandle childHandle : relationship->Children) {
+                const entt::entity child = Internal::ToEnTT(childHandle);
+                if (!IsHierarchyNode(registry, child)) {
+                    continue;
+                }
+                m_Nodes.push_back(Node{child, parentIndex});
+                m_Stack.push_back(static_cast<uint32_t>(m_Nodes.size() - 1));
+            }
+        }
+    }
+    m_RootStarts.push_back(static_cast<uint32_t>(m_Nodes.size()));
+
+    m_Dirty.assign(m_Nodes.size(), 0);
+    m_StructureDirty = false;
+    // Reparented entities keep their local TRS, so only a full pass catches them.
+    m_ForceRecompute = true;
+}
+
+size_t TransformHierarchy::UpdateRange(entt::storage_for_t<TransformComponent>& locals,
+                                       entt::storage_for_t<WorldTransformComponent>& worlds,
+                                       size_t begin, size_t end) {
+    size_t updated = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const Node& node = m_Nodes[i];
+        const TransformComponent& local = locals.get(node.Entity);
+        WorldTransformComponent& world = worlds.get(node.Entity);
+
+        bool dirty = m_ForceRecompute || !world.IsValid();
+        if (LocalChanged(local, world)) {
+            world.CachedTranslation = local.Translation;
+            world.CachedRotation = local.Rotation;
+            world.CachedScale = local.Scale;
+            dirty = true;
+        }
+        if (dirty) {
+            world.LocalMatrix = local.GetTransform();
+        }
+        if (node.Parent != kNoParent && m_Dirty[node.Parent]) {
+            dirty = true;
+        }
+
+        if (dirty) {
+            world.WorldMatrix = node.Parent != kNoParent
+                ? worlds.get(m_Nodes[node.Parent].Entity).WorldMatrix * world.LocalMatrix
+                : world.LocalMatrix;
+            // Skip 0 on wrap-around: it means "never resolved".
+            world.Version = world.Version == UINT32_MAX ? 1 : world.Version + 1;
+            ++updated;
+        }
+        m_Dirty[i] = dirty ? 1 : 0;
+    }
+    return updated;
+}
+
+} // namespace Zgine
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Zgine/World/Components/Core/TransformComponent.h>
+#include <Zgine/World/Components/Core/WorldTransformComponent.h>
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zgine {
+
+class JobSystem;
+
+/**
+ * @brief Topologically sorted transform hierarchy of one World
+ *
+ * Entities with TransformComponent and WorldTransformComponent are stored
+ * parents-first, one contiguous range per root, so propagation is a single
+ * linear walk. The order is rebuilt
+ * only after a structural change (entity/component created or destroyed,
+ * reparenting); independent root ranges are updated in parallel.
+ *
+ * Owned by World::Storage. Not thread-safe: one Update at a time.
+ */
+class TransformHierarchy {
+public:
+    /**
+     * @brief Request a rebuild of the sorted order before the next Update.
+     */
+    void MarkStructureDirty() noexcept { m_StructureDirty = true; }
+
+    // EnTT signal listener: construction/destruction of hierarchy components.
+    void OnStructureChanged(entt::registry& registry, entt::entity entity) noexcept;
+
+    /**
+     * @brief Recompute world matrices of dirty subtrees.
+     * @return Number of entities whose WorldMatrix changed.
+     */
+    size_t Update(entt::registry& registry, JobSystem* jobs);
+
+    [[nodiscard]] size_t GetNodeCount() const noexcept { return m_Nodes.size(); }
+    [[nodiscard]] size_t GetRootCount() const noexcept { return m_RootStarts.empty() ? 0 : m_RootStarts.size() - 1; }
+
+private:
+    static constexpr uint32_t kNoParent = UINT32_MAX;
+
+    struct Node {
+        entt::entity Entity = entt::null;
+        uint32_t Parent = kNoParent;
+    };
+
+    void Rebuild(entt::registry& registry);
+    size_t UpdateRange(entt::storage_for_t<TransformComponent>& locals,
+                       entt::storage_for_t<WorldTransformComponent>& worlds,
+                       size_t begin, size_t end);
+
+    std::vector<Node> m_Nodes;
+    // Root r owns nodes [m_RootStarts[r], m_RootStarts[r + 1]).
+    std::vector<uint32_t> m_RootStarts;
+    // Per-node "world matrix changed this update" flags; byte-sized so
+    // parallel root ranges never share a bit.
+    std::vector<uint8_t> m_Dirty;
+    std::vector<uint32_t> m_Stack;
+    bool m_StructureDirty = true;
+    bool m_ForceRecompute = true;
+};
+
+} // namespace Zgine
@@ -58,6 +58,11 @@ namespace {
         return false;
     }
 
+    template <typename... Components>
+    void CreateComponentStorage(entt::registry& registry) {
+        (static_cast<void>(registry.storage<Components>()), ...);
+    }
+
     void ResetRuntimeOnlyComponentState(Entity entity) {
         if (entity.HasComponent<CameraComponent>()) {
             auto& camera = entity.GetComponent<CameraComponent>();
@@ -139,6 +144,27 @@ World::World()
     : m_Storage(std::make_unique<Storage>())
     , m_EntityManager(std::make_unique<EntityManager>(*this))
 {
+    // Views create missing pools on first use, which mutates the registry.
+    // Creating every pool up front keeps views read-only for the registry
+    // itself, so systems scheduled in parallel can iterate disjoint pools.
+    CreateComponentStorage<
+        IDComponent, TagComponent, TransformComponent, RelationshipComponent,
+        CameraComponent, PrimitiveComponent, SpriteRendererComponent, ColorComponent,
+        MeshComponent, PBRMaterialComponent, DirectionalLightComponent, PointLightComponent,
+        SpotLightComponent, RigidbodyComponent, BoxColliderComponent, CircleColliderComponent,
+        AudioSourceComponent, AudioListenerComponent, ScriptComponent,
+        WorldTransformComponent>(m_Storage->Registry);
+
+    // Any hierarchy component appearing or disappearing invalidates the
+    // sorted transform order; reparenting is reported by SetParent.
+    auto& registry = m_Storage->Registry;
+    auto& transforms = m_Storage->Transforms;
+    registry.on_construct<TransformComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
+    registry.on_destroy<TransformComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
+    registry.on_construct<WorldTransformComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
+    registry.on_destroy<WorldTransformComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
+    registry.on_construct<RelationshipComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
+    registry.on_destroy<RelationshipComponent>().connect<&TransformHierarchy::OnStructureChanged>(transforms);
 }
 
 World::~World() {
@@ -264,6 +290,8 @@ void World::SetParent(Entity child, Entity parent) {
     } else {
         childRel.Parent = EntityHandle();
     }
+
+    m_Storage->Transforms.MarkStructureDirty();
 }
 
 void World::ClearParent(Entity child) {
@@ -339,6 +367,10 @@ std::unique_ptr<World> World::CloneForRuntime() const {
     return clone;
 }
 
+size_t World::UpdateWorldTransforms(JobSystem* jobs) {
+    return m_Storage->Transforms.Update(m_Storage->Registry, jobs);
+}
+
 void World::OnUpdate(float deltaTime) {
     m_SystemManager.UpdateAll(this, deltaTime);
 }
@@ -390,6 +422,7 @@ void World::RemoveComponent(EntityHandle handle) {
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(IDComponent);
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(TagComponent);
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(TransformComponent);
+ZGINE_INSTANTIATE_COMPONENT_ACCESS(WorldTransformComponent);
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(RelationshipComponent);
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(CameraComponent);
 ZGINE_INSTANTIATE_COMPONENT_ACCESS(PrimitiveComponent);
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <Zgine/World/Core/World.h>
+#include "TransformHierarchy.h"
 #include <entt/entt.hpp>
 
 namespace Zgine {
 
 struct World::Storage {
     entt::registry Registry;
+    TransformHierarchy Transforms;
 };
 
 namespace Internal {
@@ -0,0 +1,47 @@
+#include <Zgine/World/Systems/SystemAccess.h>
+#include <algorithm>
+
+namespace Zgine {
+
+namespace {
+    bool Intersects(const std::vector<std::type_index>& a, const std::vector<std::type_index>& b) {
+        auto itA = a.begin();
+        auto itB = b.begin();
+        while (itA != a.end() && itB != b.end()) {
+            if (*itA < *itB) {
+                ++itA;
+            } else if (*itB < *itA) {
+                ++itB;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool SystemAccess::ConflictsWith(const SystemAccess& other) const {
+    if (m_Exclusive || other.m_Exclusive) {
+        return true;
+    }
+
+    return Intersects(m_Writes, other.m_Writes)
+        || Intersects(m_Writes, other.m_Reads)
+        || Intersects(m_Reads, other.m_Writes);
+}
+
+void SystemAccess::Clear() {
+    m_Reads.clear();
+    m_Writes.clear();
+    m_Exclusive = false;
+    m_Declared = false;
+}
+
+void SystemAccess::Insert(std::vector<std::type_index>& set, std::type_index type) {
+    auto it = std::lower_bound(set.begin(), set.end(), type);
+    if (it == set.end() || *it != type) {
+        set.insert(it, type);
+    }
+}
+
+} // namespace Zgine
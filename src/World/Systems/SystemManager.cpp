@@ -1,14 +1,27 @@
 #include <Zgine/World/Systems/SystemManager.h>
 #include <Zgine/Core/Log/Log.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <algorithm>
+#include <chrono>
 #include <limits>
 
 namespace Zgine {
 
+namespace {
+    void InvokeSystem(ISystem* system, SystemPhase phase, World* World, float deltaTime) {
+        if (phase == SystemPhase::Update) {
+            system->Update(World, deltaTime);
+        } else {
+            system->FixedUpdate(World, deltaTime);
+        }
+    }
+}
+
 void SystemManager::InitializeAll() {
-    SortSystemsByPriority();
+    EnsureSchedule();
 
-    auto allSystems = GetAllSystems();
-    for (ISystem* system : allSystems) {
+    for (const DispatchEntry& entry : m_Dispatch) {
+        ISystem* system = entry.System;
         if (system && system->IsEnabled() && !m_InitializedSystems.contains(system)) {
             ZGINE_CORE_INFO("Initializing system: {}", system->GetName());
             system->Initialize();
@@ -18,16 +31,8 @@ void SystemManager::InitializeAll() {
 }
 
 void SystemManager::UpdateAll(World* World, float deltaTime) {
-    if (!m_Sorted) {
-        SortSystemsByPriority();
-    }
-
-    auto allSystems = GetAllSystems();
-    for (ISystem* system : allSystems) {
-        if (system && system->IsEnabled()) {
-            system->Update(World, deltaTime);
-        }
-    }
+    EnsureSchedule();
+    RunPhase(SystemPhase::Update, m_UpdateSchedule, World, deltaTime);
 }
 
 void SystemManager::StartScene(World* World) {
@@ -44,15 +49,13 @@ void SystemManager::StartScene(World* World) {
         StopScene();
     }
 
-    if (!m_Sorted) {
-        SortSystemsByPriority();
-    }
+    EnsureSchedule();
 
     m_ActiveScene = World;
     m_SceneRunning = true;
 
-    auto allSystems = GetAllSystems();
-    for (ISystem* system : allSystems) {
+    for (const DispatchEntry& entry : m_Dispatch) {
+        ISystem* system = entry.System;
         if (system && system->IsEnabled()) {
             ZGINE_CORE_INFO("Starting scene for system: {}", system->GetName());
             system->OnSceneStart(World);
@@ -67,9 +70,9 @@ void SystemManager::StopScene() {
         return;
     }
 
-    auto allSystems = GetAllSystems();
-    for (auto it = allSystems.rbegin(); it != allSystems.rend(); ++it) {
-        StopSystemScene(*it);
+    EnsureSchedule();
+    for (auto it = m_Dispatch.rbegin(); it != m_Dispatch.rend(); ++it) {
+        StopSystemScene(it->System);
     }
 
     m_SceneStartedSystems.clear();
@@ -78,25 +81,17 @@ void SystemManager::StopScene() {
 }
 
 void SystemManager::FixedUpdateAll(World* World, float fixedDeltaTime) {
-    if (!m_Sorted) {
-        SortSystemsByPriority();
-    }
-
-    auto allSystems = GetAllSystems();
-    for (ISystem* system : allSystems) {
-        if (system && system->IsEnabled()) {
-            system->FixedUpdate(World, fixedDeltaTime);
-        }
-    }
+    EnsureSchedule();
+    RunPhase(SystemPhase::FixedUpdate, m_FixedUpdateSchedule, World, fixedDeltaTime);
 }
 
 void SystemManager::ShutdownAll() {
     StopScene();
 
     // Shutdown in reverse order
-    auto allSystems = GetAllSystems();
-    for (auto it = allSystems.rbegin(); it != allSystems.rend(); ++it) {
-        ShutdownSystem(*it);
+    EnsureSchedule();
+    for (auto it = m_Dispatch.rbegin(); it != m_Dispatch.rend(); ++it) {
+        ShutdownSystem(it->System);
     }
 
     m_InitializedSystems.clear();
@@ -111,50 +106,56 @@ void SystemManager::Clear() {
     m_InitializedSystems.clear();
     m_SceneStartedSystems.clear();
     m_NextRegistrationOrder = 0;
-    m_Sorted = false;
+    m_Dispatch.clear();
+    m_Timings.clear();
+    m_UpdateSchedule.Graph.Clear();
+    m_FixedUpdateSchedule.Graph.Clear();
+    m_ScheduleDirty = true;
     m_ActiveScene = nullptr;
     m_SceneRunning = false;
 }
 
-void SystemManager::SortSystemsByPriority() {
-    // Sort owned systems
-    std::stable_sort(m_Systems.begin(), m_Systems.end(),
-        [this](const std::unique_ptr<ISystem>& a, const std::unique_ptr<ISystem>& b) {
-            if (a->GetPriority() != b->GetPriority()) {
-                return a->GetPriority() < b->GetPriority();
-            }
-            return m_RegistrationOrder[a.get()] < m_RegistrationOrder[b.get()];
-        });
+const JobGraph& SystemManager::GetSchedule(SystemPhase phase) {
+    EnsureSchedule();
+    return phase == SystemPhase::Update ? m_UpdateSchedule.Graph : m_FixedUpdateSchedule.Graph;
+}
 
-    // Sort external systems
-    std::stable_sort(m_ExternalSystems.begin(), m_ExternalSystems.end(),
-        [this](ISystem* a, ISystem* b) {
-            if (a->GetPriority() != b->GetPriority()) {
-                return a->GetPriority() < b->GetPriority();
+void SystemManager::ResetSystemTimings() {
+    for (SystemTiming& timing : m_Timings) {
+        timing = SystemTiming{timing.Name, timing.Priority};
+    }
+}
+
+void SystemManager::EnsureSchedule() {
+    if (!m_ScheduleDirty) {
+        // One pass over the flat table: enabling, disabling or re-prioritizing
+        // a system invalidates the cached order without any notification.
+        for (const DispatchEntry& entry : m_Dispatch) {
+            if (entry.System->IsEnabled() != entry.Enabled || entry.System->GetPriority() != entry.Priority) {
+                m_ScheduleDirty = true;
+                break;
             }
-            return m_RegistrationOrder[a] < m_RegistrationOrder[b];
-        });
+        }
+    }
 
-    m_Sorted = true;
+    if (m_ScheduleDirty) {
+        RebuildSchedule();
+    }
 }
 
-std::vector<ISystem*> SystemManager::GetAllSystems() {
-    std::vector<ISystem*> allSystems;
-    allSystems.reserve(m_Systems.size() + m_ExternalSystems.size());
-
-    // Add owned systems
+void SystemManager::RebuildSchedule() {
+    std::vector<ISystem*> ordered;
+    ordered.reserve(m_Systems.size() + m_ExternalSystems.size());
     for (auto& system : m_Systems) {
-        allSystems.push_back(system.get());
+        ordered.push_back(system.get());
     }
-
-    // Add external systems
     for (auto* system : m_ExternalSystems) {
-        allSystems.push_back(system);
+        ordered.push_back(system);
     }
 
-    // Sort the final execution list globally. Owned and external systems must
-    // interleave by priority; registration order is the stable tie-breaker.
-    std::stable_sort(allSystems.begin(), allSystems.end(),
+    // Owned and external systems must interleave by priority; registration
+    // order is the stable tie-breaker.
+    std::stable_sort(ordered.begin(), ordered.end(),
         [this](ISystem* a, ISystem* b) {
             if (a->GetPriority() != b->GetPriority()) {
                 return a->GetPriority() < b->GetPriority();
@@ -171,7 +172,139 @@ std::vector<ISystem*> SystemManager::GetAllSystems() {
             return aOrder < bOrder;
         });
 
-    return allSystems;
+    // Keep accumulated counters of systems that survive the rebuild.
+    std::unordered_map<ISystem*, SystemTiming> previousTimings;
+    previousTimings.reserve(m_Dispatch.size());
+    for (size_t i = 0; i < m_Dispatch.size(); ++i) {
+        previousTimings.emplace(m_Dispatch[i].System, m_Timings[i]);
+    }
+
+    m_Dispatch.clear();
+    m_Timings.clear();
+    m_Dispatch.reserve(ordered.size());
+    m_Timings.reserve(ordered.size());
+    for (ISystem* system : ordered) {
+        m_Dispatch.push_back(DispatchEntry{system, system->GetPriority(), system->IsEnabled()});
+
+        auto previous = previousTimings.find(system);
+        SystemTiming timing = previous != previousTimings.end() ? previous->second : SystemTiming{};
+        timing.Name = system->GetName();
+        timing.Priority = system->GetPriority();
+        m_Timings.push_back(timing);
+    }
+
+    BuildPhaseSchedule(SystemPhase::Update, m_UpdateSchedule);
+    BuildPhaseSchedule(SystemPhase::FixedUpdate, m_FixedUpdateSchedule);
+    m_ScheduleDirty = false;
+}
+
+void SystemManager::BuildPhaseSchedule(SystemPhase phase, PhaseSchedule& schedule) {
+    // Disabled systems get no node, so they do not act as barriers.
+    std::vector<size_t> enabled;
+    enabled.reserve(m_Dispatch.size());
+    for (size_t i = 0; i < m_Dispatch.size(); ++i) {
+        if (m_Dispatch[i].Enabled) {
+            enabled.push_back(i);
+        }
+    }
+
+    const size_t count = enabled.size();
+    std::vector<SystemAccess> access(count);
+    for (size_t node = 0; node < count; ++node) {
+        m_Dispatch[enabled[node]].System->DescribeAccess(phase, access[node]);
+        // An override that skipped this phase said nothing, not "touches nothing".
+        if (!access[node].IsDeclared()) {
+            access[node].SetExclusive();
+        }
+    }
+
+    schedule.Graph.Clear();
+    schedule.HasConcurrency = false;
+
+    for (size_t index : enabled) {
+        const char* name = m_Dispatch[index].System->GetName();
+        if (phase == SystemPhase::Update) {
+            schedule.Graph.AddNode(name, [this, index] { DispatchSystem(SystemPhase::Update, index); });
+        } else {
+            schedule.Graph.AddNode(name, [this, index] { DispatchSystem(SystemPhase::FixedUpdate, index); });
+        }
+    }
+
+    // A system waits for every earlier system it conflicts with. Node ids
+    // follow priority order, so edges only point forward and cannot cycle.
+    for (size_t later = 1; later < count; ++later) {
+        for (size_t earlier = 0; earlier < later; ++earlier) {
+            if (access[earlier].ConflictsWith(access[later])) {
+                schedule.Graph.AddEdge(static_cast<JobNodeId>(earlier), static_cast<JobNodeId>(later));
+            } else if (earlier + 1 == later) {
+                // Neighbours without an edge have no path between them either.
+                schedule.HasConcurrency = true;
+            }
+        }
+    }
+
+    if (!schedule.Graph.Compile()) {
+        ZGINE_CORE_ERROR("SystemManager: failed to compile the system schedule.");
+    }
+}
+
+void SystemManager::RunPhase(SystemPhase phase, PhaseSchedule& schedule, World* World, float deltaTime) {
+    m_PhaseWorld = World;
+    m_PhaseDeltaTime = deltaTime;
+
+    if (m_JobSystem && schedule.HasConcurrency) {
+        schedule.Graph.Execute(*m_JobSystem);
+    } else if (!m_TimingEnabled) {
+        // Enabled is asked at call time: an earlier system may toggle a later one.
+        for (const DispatchEntry& entry : m_Dispatch) {
+            if (entry.System->IsEnabled()) {
+                InvokeSystem(entry.System, phase, World, deltaTime);
+            }
+        }
+    } else {
+        // Serial systems are back to back: each end timestamp is the next start.
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < m_Dispatch.size(); ++i) {
+            if (!m_Dispatch[i].System->IsEnabled()) {
+                continue;
+            }
+            InvokeSystem(m_Dispatch[i].System, phase, World, deltaTime);
+            const auto end = std::chrono::steady_clock::now();
+            RecordTiming(phase, i, std::chrono::duration<double, std::milli>(end - start).count());
+            start = end;
+        }
+    }
+
+    m_PhaseWorld = nullptr;
+}
+
+void SystemManager::DispatchSystem(SystemPhase phase, size_t index) {
+    ISystem* system = m_Dispatch[index].System;
+    if (!system->IsEnabled()) {
+        return;
+    }
+    if (!m_TimingEnabled) {
+        InvokeSystem(system, phase, m_PhaseWorld, m_PhaseDeltaTime);
+        return;
+    }
+
+    // Each system owns its timing row, so concurrent nodes never share one.
+    const auto start = std::chrono::steady_clock::now();
+    InvokeSystem(system, phase, m_PhaseWorld, m_PhaseDeltaTime);
+    RecordTiming(phase, index, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+void SystemManager::RecordTiming(SystemPhase phase, size_t index, double elapsedMs) {
+    SystemTiming& timing = m_Timings[index];
+    if (phase == SystemPhase::Update) {
+        timing.LastUpdateMs = elapsedMs;
+        timing.TotalUpdateMs += elapsedMs;
+        ++timing.UpdateCount;
+    } else {
+        timing.LastFixedUpdateMs = elapsedMs;
+        timing.TotalFixedUpdateMs += elapsedMs;
+        ++timing.FixedUpdateCount;
+    }
 }
 
 void SystemManager::StopSystemScene(ISystem* system) {
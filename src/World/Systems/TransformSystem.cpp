@@ -0,0 +1,24 @@
+#include <Zgine/World/Systems/TransformSystem.h>
+#include <Zgine/World/Core/World.h>
+#include <Zgine/World/Components/Core/RelationshipComponent.h>
+#include <Zgine/World/Components/Core/TransformComponent.h>
+#include <Zgine/World/Components/Core/WorldTransformComponent.h>
+
+namespace Zgine {
+
+void TransformSystem::Update(World* World, float deltaTime) {
+    (void)deltaTime;
+    m_LastUpdatedCount = World ? World->UpdateWorldTransforms(m_JobSystem) : 0;
+}
+
+void TransformSystem::DescribeAccess(SystemPhase phase, SystemAccess& access) const {
+    // Only the Update pass resolves hierarchies; FixedUpdate does nothing.
+    if (phase == SystemPhase::Update) {
+        access.Read<TransformComponent, RelationshipComponent>()
+              .Write<WorldTransformComponent>();
+    } else {
+        access.SetNoAccess();
+    }
+}
+
+} // namespace Zgine
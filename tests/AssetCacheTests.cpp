@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <Zgine/Resources/Core/AssetCache.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Zgine;
+
+namespace {
+
+class FakeAsset final : public Asset {
+public:
+    FakeAsset(AssetHandle handle, AssetType type, size_t cpuBytes, size_t gpuBytes)
+        : Asset(handle), m_Type(type), m_CpuBytes(cpuBytes), m_GpuBytes(gpuBytes) {}
+
+    AssetType GetType() const override { return m_Type; }
+    size_t GetSizeBytes() const override { return m_CpuBytes; }
+    size_t GetGpuSizeBytes() const override { return m_GpuBytes; }
+
+private:
+    AssetType m_Type;
+    size_t m_CpuBytes;
+    size_t m_GpuBytes;
+};
+
+// Records the thread its destructor ran on, as a GPU resource would care about.
+class ThreadBoundAsset final : public Asset {
+public:
+    ThreadBoundAsset(size_t cpuBytes, std::thread::id* destroyedOn)
+        : Asset(AssetHandle::New()), m_CpuBytes(cpuBytes), m_DestroyedOn(destroyedOn) {}
+    ~ThreadBoundAsset() override { *m_DestroyedOn = std::this_thread::get_id(); }
+
+    AssetType GetType() const override { return AssetType::Texture; }
+    size_t GetSizeBytes() const override { return m_CpuBytes; }
+
+private:
+    size_t m_CpuBytes;
+    std::thread::id* m_DestroyedOn;
+};
+
+std::shared_ptr<Asset> MakeAsset(AssetType type, size_t cpuBytes, size_t gpuBytes = 0,
+                                 AssetHandle handle = AssetHandle::New()) {
+    return std::make_shared<FakeAsset>(handle, type, cpuBytes, gpuBytes);
+}
+
+} // namespace
+
+TEST(AssetCacheTest, EvictsTheLeastRecentlyUsedAcrossShards) {
+    AssetCacheConfig config;
+    config.CpuBudgetBytes = 300;
+    config.ShardCount = 4;
+    AssetCache cache(config);
+
+    std::vector<AssetHandle> handles;
+    for (int i = 0; i < 3; ++i) {
+        auto asset = MakeAsset(AssetType::Audio, 100);
+        handles.push_back(asset->GetHandle());
+        cache.Insert(asset);
+    }
+    EXPECT_EQ(cache.GetStats().CpuBytes, 300u);
+
+    // Touching the oldest makes the second the eviction candidate.
+    EXPECT_NE(cache.Find(handles[0]), nullptr);
+    cache.Insert(MakeAsset(AssetType::Audio, 100));
+    EXPECT_TRUE(cache.Contains(handles[0]));
+    EXPECT_FALSE(cache.Contains(handles[1]));
+    EXPECT_TRUE(cache.Contains(handles[2]));
+
+    const AssetCache::Stats stats = cache.GetStats();
+    EXPECT_EQ(stats.EntryCount, 3u);
+    EXPECT_EQ(stats.CpuBytes, 300u);
+    EXPECT_EQ(stats.Evictions, 1u);
+    EXPECT_EQ(stats.Get(AssetType::Audio).Hits, 1u);
+}
+
+TEST(AssetCacheTest, CpuAndGpuBudgetsAreSeparate) {
+    AssetCacheConfig config;
+    config.CpuBudgetBytes = 100;
+    config.GpuBudgetBytes = 1000;
+    AssetCache cache(config);
+
+    auto texture = MakeAsset(AssetType::Texture, 0, 800);
+    auto audio = MakeAsset(AssetType::Audio, 100);
+    cache.Insert(texture);
+    cache.Insert(audio);
+    const AssetHandle textureHandle = texture->GetHandle();
+    const AssetHandle audioHandle = audio->GetHandle();
+    texture.reset();
+    audio.reset();
+
+    EXPECT_EQ(cache.GetStats().CpuBytes, 100u);
+    EXPECT_EQ(cache.GetStats().GpuBytes, 800u);
+
+    // Over the GPU budget only: the least recently used asset goes.
+    cache.Insert(MakeAsset(AssetType::Mesh, 0, 400));
+    EXPECT_FALSE(cache.Contains(textureHandle));
+    EXPECT_TRUE(cache.Contains(audioHandle));
+    EXPECT_EQ(cache.GetStats().GpuBytes, 400u);
+    EXPECT_EQ(cache.GetStats().CpuBytes, 100u);
+}
+
+TEST(AssetCacheTest, AssetsInUseLeaveTheBudgetButStayFindable) {
+    AssetCacheConfig config;
+    config.CpuBudgetBytes = 100;
+    AssetCache cache(config);
+
+    auto held = MakeAsset(AssetType::Mesh, 100);
+    cache.Insert(held);
+    EXPECT_TRUE(cache.IsInUse(held->GetHandle()));
+
+    // The held asset is evicted rather than keeping the cache over budget.
+    auto other = MakeAsset(AssetType::Mesh, 100);
+    const AssetHandle otherHandle = other->GetHandle();
+    cache.Insert(other);
+    other.reset();
+    EXPECT_EQ(cache.GetStats().CpuBytes, 100u);
+    EXPECT_EQ(cache.GetStats().EntryCount, 1u);
+    EXPECT_TRUE(cache.Contains(held->GetHandle()));
+
+    // Found again as the same object, which pushes the unused one out.
+    EXPECT_EQ(cache.Find(held->GetHandle()), held);
+    EXPECT_FALSE(cache.Contains(otherHandle));
+    EXPECT_EQ(cache.GetStats().CpuBytes, 100u);
+
+    // Once released and evicted, Trim() forgets it.
+    const AssetHandle heldHandle = held->GetHandle();
+    cache.Insert(MakeAsset(AssetType::Mesh, 100));
+    EXPECT_TRUE(cache.Contains(heldHandle));
+    held.reset();
+    // The evicted reference waits for the main thread.
+    EXPECT_TRUE(cache.Contains(heldHandle));
+    EXPECT_EQ(cache.ReleaseEvicted(), 3u);
+    EXPECT_FALSE(cache.Contains(heldHandle));
+    cache.Trim();
+    EXPECT_EQ(cache.Find(heldHandle), nullptr);
+    EXPECT_FALSE(cache.Remove(heldHandle));
+}
+
+TEST(AssetCacheTest, EvictionOnAWorkerDestroysOnTheMainThread) {
+    AssetCacheConfig config;
+    config.CpuBudgetBytes = 100;
+    AssetCache cache(config);
+
+    std::thread::id destroyedOn;
+    cache.Insert(std::make_shared<ThreadBoundAsset>(100, &destroyedOn));
+
+    // A load finishing on a worker inserts and evicts the unused texture.
+    std::thread worker([&cache]() { cache.Insert(MakeAsset(AssetType::Audio, 100)); });
+    worker.join();
+    EXPECT_EQ(cache.GetStats().Evictions, 1u);
+    EXPECT_EQ(cache.GetStats().PendingReleases, 1u);
+    EXPECT_EQ(destroyedOn, std::thread::id());
+
+    EXPECT_EQ(cache.ReleaseEvicted(), 1u);
+    EXPECT_EQ(destroyedOn, std::this_thread::get_id());
+    EXPECT_EQ(cache.GetStats().PendingReleases, 0u);
+}
+
+TEST(AssetCacheTest, CountsHitsAndMissesPerType) {
+    AssetCache cache;
+    auto shader = MakeAsset(AssetType::Shader, 0, 10);
+    cache.Insert(shader);
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(cache.Find(shader->GetHandle()), shader);
+    }
+    EXPECT_EQ(cache.Find(AssetHandle::New()), nullptr);
+    cache.RecordMiss(AssetType::Texture);
+    cache.RecordMiss(AssetType::Texture);
+
+    const AssetCache::Stats stats = cache.GetStats();
+    EXPECT_EQ(stats.Get(AssetType::Shader).Hits, 3u);
+    EXPECT_EQ(stats.Get(AssetType::Shader).Misses, 0u);
+    EXPECT_EQ(stats.Get(AssetType::Texture).Misses, 2u);
+
+    EXPECT_TRUE(cache.Remove(shader->GetHandle()));
+    EXPECT_FALSE(cache.Contains(shader->GetHandle()));
+    EXPECT_EQ(cache.GetStats().GpuBytes, 0u);
+}
+
+TEST(AssetCacheTest, ConcurrentLookupsAndInsertsStayWithinBudget) {
+    AssetCacheConfig config;
+    config.CpuBudgetBytes = 64 * 100;
+    config.ShardCount = 8;
+    config.EntryPoolSize = 32;
+    AssetCache cache(config);
+
+    constexpr int kThreads = 4;
+    constexpr int kAssetsPerThread = 500;
+    // UUID::New() shares one generator, so the handles are made up front.
+    std::vector<std::vector<AssetHandle>> handles(kThreads);
+    for (auto& mine : handles) {
+        for (int i = 0; i < kAssetsPerThread; ++i) {
+            mine.push_back(AssetHandle::New());
+        }
+    }
+
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&cache, &found, &mine = handles[t]]() {
+            for (int i = 0; i < kAssetsPerThread; ++i) {
+                cache.Insert(MakeAsset(AssetType::Texture, 100, 0, mine[i]));
+                if (cache.Find(mine[static_cast<size_t>(i) / 2])) {
+                    found.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const AssetCache::Stats stats = cache.GetStats();
+    EXPECT_LE(stats.CpuBytes, config.CpuBudgetBytes);
+    EXPECT_EQ(stats.CpuBytes, stats.EntryCount * 100);
+    EXPECT_EQ(stats.Get(AssetType::Texture).Hits, static_cast<uint64_t>(found.load()));
+    EXPECT_GT(found.load(), 0);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().EntryCount, 0u);
+    EXPECT_EQ(cache.GetStats().CpuBytes, 0u);
+}
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+#include <Zgine/Resources/Import/AssetCooker.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Zgine;
+
+namespace {
+
+class AssetCookerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+        m_Directory = std::filesystem::temp_directory_path() / ("zgine-cooker-test-" + std::to_string(unique));
+        std::filesystem::create_directories(m_Directory);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Directory, ec);
+    }
+
+    static void WriteBytes(const std::filesystem::path& path, const std::string& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::filesystem::path m_Directory;
+};
+
+bool IsPageAligned(const void* pointer) {
+    return reinterpret_cast<uintptr_t>(pointer) % AssetCooker::kPageAlignment == 0;
+}
+
+} // namespace
+
+TEST_F(AssetCookerTest, KeyFollowsSourceStatsAndSettings) {
+    const std::filesystem::path source = m_Directory / "model.obj";
+    WriteBytes(source, std::string(1000, 'v'));
+
+    EXPECT_EQ(AssetCooker::GetCookedPath(source), m_Directory / "model.obj.cooked");
+
+    const std::optional<CookKey> key = AssetCooker::GetKey(source, "{\"LodCount\":4}");
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(key->SourceSize, 1000u);
+    EXPECT_EQ(key->SourceHash, 0u);
+    EXPECT_EQ(AssetCooker::GetKey(source, "{\"LodCount\":4}")->Settings, key->Settings);
+    EXPECT_NE(AssetCooker::GetKey(source, "{\"LodCount\":3}")->Settings, key->Settings);
+    EXPECT_FALSE(AssetCooker::GetKey(m_Directory / "missing.obj", "{}").has_value());
+
+    // One byte changed in the middle of the word-hashed part.
+    const uint64_t hash = AssetCooker::HashSource(source);
+    EXPECT_NE(hash, 0u);
+    std::string edited(1000, 'v');
+    edited[500] = 'w';
+    WriteBytes(source, edited);
+    EXPECT_NE(AssetCooker::HashSource(source), hash);
+    EXPECT_EQ(AssetCooker::HashSource(m_Directory / "missing.obj"), 0u);
+}
+
+TEST_F(AssetCookerTest, SourceBytesAreHashedOnlyWhenItsStatsMoved) {
+    const std::filesystem::path source = m_Directory / "model.obj";
+    WriteBytes(source, std::string(1000, 'v'));
+    CookKey key = *AssetCooker::GetKey(source, "{}");
+    key.SourceHash = AssetCooker::HashSource(source);
+
+    const std::vector<uint8_t> vertices(3 * GetVertexStride(VertexFormat::Float), 1);
+    const std::vector<uint32_t> indices = { 0, 1, 2 };
+    std::vector<EncodedMeshData> meshes(1);
+    meshes[0].Vertices = vertices.data();
+    meshes[0].VertexCount = 3;
+    meshes[0].Indices = indices.data();
+    meshes[0].IndexCount = 3;
+    const std::filesystem::path path = AssetCooker::GetCookedPath(source);
+    ASSERT_TRUE(AssetCooker::WriteMesh(path, key, meshes));
+
+    // Same stats: fresh without the source path, so its bytes are not read.
+    EXPECT_TRUE(CookedMesh::Open(path, *AssetCooker::GetKey(source, "{}")).has_value());
+
+    // Touched: the bytes decide.
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(source) + std::chrono::seconds(1));
+    const CookKey touched = *AssetCooker::GetKey(source, "{}");
+    EXPECT_FALSE(CookedMesh::Open(path, touched).has_value());
+    EXPECT_TRUE(CookedMesh::Open(path, touched, source).has_value());
+
+    // Edited in place, same size: stale.
+    std::string edited(1000, 'v');
+    edited[10] = 'w';
+    WriteBytes(source, edited);
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(source) + std::chrono::seconds(2));
+    EXPECT_FALSE(CookedMesh::Open(path, *AssetCooker::GetKey(source, "{}"), source).has_value());
+}
+
+TEST_F(AssetCookerTest, MeshRoundTripsWithPageAlignedStreams) {
+    // 512 quantized vertices fill two pages; the second mesh is too small to be padded to one.
+    std::vector<uint8_t> bigVertices(512 * GetVertexStride(VertexFormat::Quantized));
+    for (size_t i = 0; i < bigVertices.size(); ++i) {
+        bigVertices[i] = static_cast<uint8_t>(i * 7);
+    }
+    std::vector<uint32_t> bigIndices(3000);
+    for (size_t i = 0; i < bigIndices.size(); ++i) {
+        bigIndices[i] = static_cast<uint32_t>(i % 512);
+    }
+    std::vector<uint8_t> smallVertices(3 * GetVertexStride(VertexFormat::Float), 0x5A);
+    const std::vector<uint32_t> smallIndices = { 0, 1, 2 };
+
+    std::vector<EncodedMeshData> meshes(2);
+    meshes[0].Format = VertexFormat::Quantized;
+    meshes[0].Vertices = bigVertices.data();
+    meshes[0].VertexCount = 512;
+    meshes[0].Indices = bigIndices.data();
+    meshes[0].IndexCount = static_cast<uint32_t>(bigIndices.size());
+    meshes[0].Bounds = AABB(Math::Vector3(-1.0f, -2.0f, -3.0f), Math::Vector3(4.0f, 5.0f, 6.0f));
+    meshes[0].BaseColor = Math::Vector4(0.5f, 0.25f, 1.0f, 1.0f);
+    meshes[0].Lods = { { 0, 1800, 0.3f, 0.0f }, { 1800, 1200, 0.0f, 0.01f } };
+    meshes[1].Format = VertexFormat::Float;
+    meshes[1].Vertices = smallVertices.data();
+    meshes[1].VertexCount = 3;
+    meshes[1].Indices = smallIndices.data();
+    meshes[1].IndexCount = 3;
+
+    const std::filesystem::path path = m_Directory / "model.obj.cooked";
+    const CookKey key{ 42, 1000, 1, 0 };
+    ASSERT_TRUE(AssetCooker::WriteMesh(path, key, meshes));
+
+    std::optional<CookedMesh> cooked = CookedMesh::Open(path, key);
+    ASSERT_TRUE(cooked.has_value());
+    ASSERT_EQ(cooked->GetMeshes().size(), 2u);
+
+    const EncodedMeshData& big = cooked->GetMeshes()[0];
+    EXPECT_EQ(big.Format, VertexFormat::Quantized);
+    ASSERT_EQ(big.VertexCount, 512u);
+    ASSERT_EQ(big.IndexCount, bigIndices.size());
+    EXPECT_TRUE(IsPageAligned(big.Vertices));
+    EXPECT_TRUE(IsPageAligned(big.Indices));
+    EXPECT_EQ(std::memcmp(big.Vertices, bigVertices.data(), bigVertices.size()), 0);
+    EXPECT_EQ(std::memcmp(big.Indices, bigIndices.data(), bigIndices.size() * sizeof(uint32_t)), 0);
+    EXPECT_FLOAT_EQ(big.Bounds.Min.y, -2.0f);
+    EXPECT_FLOAT_EQ(big.Bounds.Max.z, 6.0f);
+    EXPECT_FLOAT_EQ(big.BaseColor.y, 0.25f);
+    ASSERT_EQ(big.Lods.size(), 2u);
+    EXPECT_EQ(big.Lods[1].FirstIndex, 1800u);
+    EXPECT_FLOAT_EQ(big.Lods[1].Error, 0.01f);
+
+    const EncodedMeshData& small = cooked->GetMeshes()[1];
+    EXPECT_EQ(small.Format, VertexFormat::Float);
+    EXPECT_EQ(std::memcmp(small.Vertices, smallVertices.data(), smallVertices.size()), 0);
+    EXPECT_EQ(small.Indices[2], 2u);
+    EXPECT_TRUE(small.Lods.empty());
+
+    // Both streams of the small mesh fit in the page after the big index stream.
+    EXPECT_LE(std::filesystem::file_size(path), 6 * AssetCooker::kPageAlignment);
+}
+
+TEST_F(AssetCookerTest, StaleAndDamagedFilesAreRejected) {
+    const std::vector<uint8_t> vertices(64 * GetVertexStride(VertexFormat::Float), 1);
+    const std::vector<uint32_t> indices(96, 0);
+    std::vector<EncodedMeshData> meshes(1);
+    meshes[0].Vertices = vertices.data();
+    meshes[0].VertexCount = 64;
+    meshes[0].Indices = indices.data();
+    meshes[0].IndexCount = 96;
+
+    const std::filesystem::path path = m_Directory / "model.obj.cooked";
+    const CookKey key{ 7, 1000, 1, 0 };
+    ASSERT_TRUE(AssetCooker::WriteMesh(path, key, meshes));
+    EXPECT_TRUE(CookedMesh::Open(path, key).has_value());
+    EXPECT_FALSE(CookedMesh::Open(path, { 8, 1000, 1, 0 }).has_value());
+    EXPECT_FALSE(CookedMesh::Open(path, { 7, 1000, 2, 0 }).has_value());
+    EXPECT_FALSE(CookedTexture::Open(path, key).has_value());
+    EXPECT_FALSE(CookedMesh::Open(m_Directory / "missing.cooked", key).has_value());
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(CookedMesh::Open(path, key).has_value());
+
+    WriteBytes(path, "not a cooked file");
+    EXPECT_FALSE(CookedMesh::Open(path, key).has_value());
+}
+
+TEST_F(AssetCookerTest, TexturesCookToMipChainsAndBC3Blocks) {
+    // 6x3 gradient: the chain halves (rounding down) to 3x1 and 1x1.
+    std::vector<uint8_t> rgba(6 * 3 * 4);
+    for (size_t i = 0; i < rgba.size(); ++i) {
+        rgba[i] = static_cast<uint8_t>(i * 3);
+    }
+    const auto levels = AssetCooker::BuildMipChain(rgba.data(), 6, 3, false);
+    ASSERT_EQ(levels.size(), 3u);
+    EXPECT_EQ(levels[0], rgba);
+    EXPECT_EQ(levels[1].size(), 3u * 1u * 4u);
+    EXPECT_EQ(levels[2].size(), 4u);
+    // Texel (0, 0) of level 1 averages texels (0, 0), (1, 0), (0, 1) and (1, 1).
+    EXPECT_EQ(levels[1][0], (rgba[0] + rgba[4] + rgba[24] + rgba[28] + 2) / 4);
+
+    // sRGB averages in linear light: black and white make a lighter grey than 128.
+    const uint8_t checker[16] = { 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255 };
+    const auto srgb = AssetCooker::BuildMipChain(checker, 2, 2, true);
+    ASSERT_EQ(srgb.size(), 2u);
+    EXPECT_NEAR(srgb[1][0], 188, 1);
+    EXPECT_EQ(srgb[1][3], 255);
+
+    // A flat 5x5 image is 2x2 blocks; every block is exact.
+    const uint8_t color[4] = { 255, 0, 255, 128 };
+    std::vector<uint8_t> flat(5 * 5 * 4);
+    for (size_t i = 0; i < flat.size(); ++i) {
+        flat[i] = color[i % 4];
+    }
+    const std::vector<uint8_t> blocks = AssetCooker::CompressBC3(flat.data(), 5, 5);
+    ASSERT_EQ(blocks.size(), AssetCooker::GetMipSize(TextureFormat::BC3, 5, 5));
+    ASSERT_EQ(blocks.size(), 4u * 16u);
+    for (size_t block = 0; block < 4; ++block) {
+        const uint8_t* data = &blocks[block * 16];
+        EXPECT_EQ(data[0], 128);  // alpha endpoints
+        EXPECT_EQ(data[1], 128);
+        uint16_t color0 = 0;
+        std::memcpy(&color0, data + 8, sizeof(color0));
+        EXPECT_EQ(color0, 0xF81Fu); // magenta in 5:6:5
+        uint32_t indices = 0;
+        std::memcpy(&indices, data + 12, sizeof(indices));
+        EXPECT_EQ(indices, 0u);
+    }
+
+    std::vector<TextureMip> mips;
+    for (size_t level = 0; level < levels.size(); ++level) {
+        const auto width = std::max(6u >> level, 1u);
+        const auto height = std::max(3u >> level, 1u);
+        mips.push_back({ width, height, levels[level].data(), levels[level].size() });
+    }
+    const std::filesystem::path path = m_Directory / "albedo.png.cooked";
+    const CookKey key{ 99, 1000, 1, 0 };
+    ASSERT_TRUE(AssetCooker::WriteTexture(path, key, TextureFormat::RGBA8, mips));
+
+    std::optional<CookedTexture> cooked = CookedTexture::Open(path, key);
+    ASSERT_TRUE(cooked.has_value());
+    EXPECT_EQ(cooked->GetFormat(), TextureFormat::RGBA8);
+    ASSERT_EQ(cooked->GetMips().size(), 3u);
+    EXPECT_EQ(cooked->GetMips()[1].Width, 3u);
+    EXPECT_EQ(cooked->GetMips()[1].Height, 1u);
+    EXPECT_EQ(std::memcmp(cooked->GetMips()[1].Data, levels[1].data(), levels[1].size()), 0);
+    EXPECT_FALSE(CookedMesh::Open(path, key).has_value());
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <Zgine/Resources/Core/AssetDatabase.h>
+#include <Zgine/Resources/Core/AssetIndex.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 
 #include <chrono>
 #include <filesystem>
@@ -45,8 +47,11 @@ protected:
         metadata.Handle = handle;
         metadata.Type = type;
         metadata.SourcePath = sourcePath;
+        WriteMetadata(metadata);
+    }
 
-        std::ofstream file(sourcePath.string() + ".meta", std::ios::trunc);
+    void WriteMetadata(const Zgine::AssetMetadata& metadata) const {
+        std::ofstream file(metadata.SourcePath.string() + ".meta", std::ios::trunc);
         file << metadata.Serialize().dump(4);
     }
 
@@ -159,3 +164,132 @@ TEST_F(AssetDatabaseTest, MissingRootScansToEmptyDatabase) {
     EXPECT_TRUE(database.GetRecords().empty());
     EXPECT_EQ(database.GetRecordByPath("anything.png"), nullptr);
 }
+
+TEST_F(AssetDatabaseTest, UnchangedFilesComeFromThePersistentIndex) {
+    const auto texturePath = WriteFile("Textures/albedo.png", "texture");
+    const auto meshPath = WriteFile("Models/cube.glb", "mesh");
+    WriteFile("Notes/readme.txt", "notes");
+    const Zgine::AssetHandle textureHandle = Zgine::AssetHandle::New();
+    WriteMetadata(texturePath, textureHandle, Zgine::AssetType::Texture);
+    WriteMetadata(meshPath, Zgine::AssetHandle::New(), Zgine::AssetType::Mesh);
+
+    Zgine::AssetDatabase database;
+    database.Scan({ .AssetsRoot = m_Root });
+    EXPECT_EQ(database.GetScanStats().FileCount, 3u);
+    EXPECT_EQ(database.GetScanStats().MetadataReads, 2u);
+    EXPECT_TRUE(database.GetScanStats().IndexSaved);
+    EXPECT_TRUE(std::filesystem::exists(m_Root / Zgine::AssetIndex::kFileName));
+    EXPECT_EQ(database.GetRecordByPath(Zgine::AssetIndex::kFileName), nullptr);
+
+    // Nothing changed: no .meta is opened and the index is not rewritten.
+    Zgine::AssetDatabase reopened;
+    reopened.Scan({ .AssetsRoot = m_Root });
+    EXPECT_EQ(reopened.GetScanStats().IndexHits, 3u);
+    EXPECT_EQ(reopened.GetScanStats().MetadataReads, 0u);
+    EXPECT_FALSE(reopened.GetScanStats().IndexSaved);
+    ASSERT_NE(reopened.GetRecordByHandle(textureHandle), nullptr);
+    EXPECT_EQ(reopened.GetRecordByHandle(textureHandle)->RelativePath.generic_string(), "Textures/albedo.png");
+
+    // A changed .meta is read again, a removed file leaves the index.
+    const Zgine::AssetHandle replaced = Zgine::AssetHandle::New();
+    WriteMetadata(texturePath, replaced, Zgine::AssetType::Texture);
+    const std::filesystem::path metaPath = texturePath.string() + ".meta";
+    std::filesystem::last_write_time(metaPath, std::filesystem::last_write_time(metaPath) + std::chrono::seconds(1));
+    std::filesystem::remove(m_Root / "Notes/readme.txt");
+
+    reopened.Scan({ .AssetsRoot = m_Root });
+    EXPECT_EQ(reopened.GetScanStats().FileCount, 2u);
+    EXPECT_EQ(reopened.GetScanStats().IndexHits, 1u);
+    EXPECT_EQ(reopened.GetScanStats().MetadataReads, 1u);
+    EXPECT_TRUE(reopened.GetScanStats().IndexSaved);
+    EXPECT_EQ(reopened.GetRecordByHandle(textureHandle), nullptr);
+    ASSERT_NE(reopened.GetRecordByHandle(replaced), nullptr);
+
+    // A damaged index is rebuilt from the files.
+    std::ofstream(m_Root / Zgine::AssetIndex::kFileName, std::ios::trunc) << "not an index";
+    reopened.Scan({ .AssetsRoot = m_Root });
+    EXPECT_EQ(reopened.GetScanStats().IndexHits, 0u);
+    EXPECT_EQ(reopened.GetScanStats().MetadataReads, 2u);
+    EXPECT_NE(reopened.GetRecordByHandle(replaced), nullptr);
+}
+
+TEST_F(AssetDatabaseTest, IndexedMetadataIsNotParsedAgain) {
+    Zgine::AssetMetadata metadata;
+    metadata.Handle = Zgine::AssetHandle::New();
+    metadata.Type = Zgine::AssetType::Mesh;
+    metadata.SourcePath = WriteFile("Models/rock.glb", "mesh");
+    metadata.ImportedPath = "Imported/rock.zgcooked";
+    metadata.Dependencies = { Zgine::AssetHandle::New(), Zgine::AssetHandle::New() };
+    metadata.ImportSettings.Mesh.LodCount = 2;
+    metadata.ImportSettings.Mesh.LodReduction = 0.25f;
+    metadata.ImportSettings.Mesh.Format = Zgine::VertexFormat::QuantizedColor;
+    metadata.ImportSettings.Texture.SRGB = false;
+    WriteMetadata(metadata);
+    const std::string expected = metadata.Serialize().dump();
+
+    Zgine::AssetDatabaseConfig config;
+    config.AssetsRoot = m_Root;
+    config.LoadMetadata = true;
+    Zgine::AssetDatabase database;
+    database.Scan(config);
+    EXPECT_EQ(database.GetScanStats().MetadataParses, 1u);
+
+    // Unchanged: every field comes back from the index.
+    Zgine::AssetDatabase reopened;
+    reopened.Scan(config);
+    EXPECT_EQ(reopened.GetScanStats().MetadataReads, 0u);
+    EXPECT_EQ(reopened.GetScanStats().MetadataParses, 0u);
+    const Zgine::AssetRecord* record = reopened.GetRecordByHandle(metadata.Handle);
+    ASSERT_NE(record, nullptr);
+    ASSERT_TRUE(record->Metadata.has_value());
+    EXPECT_EQ(record->Metadata->Serialize().dump(), expected);
+
+    // Touched but unchanged: read and hashed, still not parsed.
+    const std::filesystem::path metaPath = metadata.SourcePath.string() + ".meta";
+    std::filesystem::last_write_time(metaPath, std::filesystem::last_write_time(metaPath) + std::chrono::seconds(1));
+    reopened.Scan(config);
+    EXPECT_EQ(reopened.GetScanStats().MetadataReads, 1u);
+    EXPECT_EQ(reopened.GetScanStats().MetadataParses, 0u);
+    record = reopened.GetRecordByHandle(metadata.Handle);
+    ASSERT_NE(record, nullptr);
+    ASSERT_TRUE(record->Metadata.has_value());
+    EXPECT_EQ(record->Metadata->Serialize().dump(), expected);
+}
+
+TEST_F(AssetDatabaseTest, ParallelScanMatchesTheSerialScan) {
+    for (int i = 0; i < 40; ++i) {
+        const std::string name = std::to_string(i);
+        const auto path = WriteFile(std::filesystem::path(i % 2 ? "Textures" : "Models") / (name + (i % 2 ? ".png" : ".obj")), name);
+        if (i % 3 == 0) {
+            WriteMetadata(path, Zgine::AssetHandle::New(), i % 2 ? Zgine::AssetType::Texture : Zgine::AssetType::Mesh);
+        }
+    }
+    std::filesystem::create_directories(m_Root / "Textures" / "Nested" / "Deeper");
+    WriteFile("Textures/Nested/Deeper/leaf.png", "leaf");
+
+    Zgine::AssetDatabaseConfig config;
+    config.AssetsRoot = m_Root;
+    config.LoadMetadata = true;
+    config.UseIndex = false;
+
+    Zgine::AssetDatabase serial;
+    serial.Scan(config);
+
+    Zgine::JobSystem jobs(4);
+    Zgine::AssetDatabase parallel;
+    parallel.SetJobSystem(&jobs);
+    parallel.Scan(config);
+
+    ASSERT_EQ(parallel.GetRecords().size(), serial.GetRecords().size());
+    for (size_t i = 0; i < serial.GetRecords().size(); ++i) {
+        const Zgine::AssetRecord& expected = serial.GetRecords()[i];
+        const Zgine::AssetRecord& actual = parallel.GetRecords()[i];
+        EXPECT_EQ(actual.RelativePath, expected.RelativePath);
+        EXPECT_EQ(actual.Type, expected.Type);
+        EXPECT_EQ(actual.Handle, expected.Handle);
+        EXPECT_EQ(actual.HasMetadata, actual.Metadata.has_value());
+        EXPECT_EQ(actual.Metadata.has_value(), expected.Metadata.has_value());
+    }
+    EXPECT_NE(parallel.GetRecordByPath("Textures/Nested/Deeper/leaf.png"), nullptr);
+    EXPECT_FALSE(std::filesystem::exists(m_Root / Zgine::AssetIndex::kFileName));
+}
@@ -1,10 +1,17 @@
 #include <gtest/gtest.h>
 
 #include <Zgine/Resources/Core/AssetManager.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -23,7 +30,7 @@ protected:
 
         Zgine::AssetManagerConfig config;
         config.AssetsRoot = m_Root;
-        config.MaxCacheSizeBytes = 1024 * 1024;
+        config.Cache.CpuBudgetBytes = 1024 * 1024;
 
         auto& manager = Zgine::AssetManager::Get();
         manager.Shutdown();
@@ -32,11 +39,32 @@ protected:
 
     void TearDown() override {
         Zgine::AssetManager::Get().Shutdown();
+        Zgine::AssetManager::Get().SetJobSystem(nullptr);
+        m_Jobs.reset();
 
         std::error_code ec;
         std::filesystem::remove_all(m_Root, ec);
     }
 
+    // An audio asset whose .meta records @p dependencies, as an importer would have.
+    Zgine::AssetHandle RegisterWithDependencies(std::string_view name, std::vector<Zgine::AssetHandle> dependencies) const {
+        const auto path = WriteAudioAsset(name, "RIFF....WAVEfmt ");
+        Zgine::AssetMetadata metadata;
+        metadata.Handle = Zgine::AssetHandle::New();
+        metadata.Type = Zgine::AssetType::Audio;
+        metadata.SourcePath = path;
+        metadata.Dependencies = std::move(dependencies);
+        std::ofstream(path.string() + ".meta") << metadata.Serialize().dump(4);
+        return Zgine::AssetManager::Get().RegisterAsset(path, Zgine::AssetType::Audio);
+    }
+
+    // Owned by the fixture so the manager lets go of it before it is destroyed.
+    Zgine::JobSystem& UseJobSystem(uint32_t threadCount) {
+        m_Jobs = std::make_unique<Zgine::JobSystem>(threadCount);
+        Zgine::AssetManager::Get().SetJobSystem(m_Jobs.get());
+        return *m_Jobs;
+    }
+
     std::filesystem::path WriteAudioAsset(std::string_view name, std::string_view bytes) const {
         const auto path = m_Root / name;
         std::ofstream stream(path, std::ios::binary);
@@ -47,6 +75,7 @@ protected:
 
 private:
     std::filesystem::path m_Root;
+    std::unique_ptr<Zgine::JobSystem> m_Jobs;
 };
 
 } // namespace
@@ -85,3 +114,199 @@ TEST_F(AssetManagerTest, InvalidAsyncLoadReturnsNullAsset) {
     auto future = Zgine::AssetManager::Get().LoadAssetAsync(Zgine::AssetHandle());
     EXPECT_EQ(future.get(), nullptr);
 }
+
+TEST_F(AssetManagerTest, AsyncLoadsOnJobsCoalesceAndReportState) {
+    auto& manager = Zgine::AssetManager::Get();
+    UseJobSystem(4);
+
+    std::vector<Zgine::AssetHandle> handles;
+    for (int i = 0; i < 4; ++i) {
+        const auto path = WriteAudioAsset("clip" + std::to_string(i) + ".wav", "RIFF....WAVEfmt ");
+        handles.push_back(manager.RegisterAsset(path, Zgine::AssetType::Audio));
+        ASSERT_TRUE(handles.back().IsValid());
+        EXPECT_EQ(manager.GetLoadState(handles.back()), Zgine::AssetLoadState::Unloaded);
+    }
+
+    // Every handle requested from several places at once: one load each.
+    std::vector<std::future<std::shared_ptr<Zgine::Asset>>> futures;
+    for (int round = 0; round < 8; ++round) {
+        for (const auto& handle : handles) {
+            futures.push_back(manager.LoadAssetAsync(handle));
+        }
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        auto asset = futures[i].get();
+        ASSERT_NE(asset, nullptr);
+        EXPECT_EQ(asset->GetHandle(), handles[i % handles.size()]);
+        EXPECT_EQ(asset, manager.LoadAsset(asset->GetHandle()));
+    }
+    for (const auto& handle : handles) {
+        EXPECT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Loaded);
+    }
+
+    manager.UnloadAsset(handles[0]);
+    EXPECT_EQ(manager.GetLoadState(handles[0]), Zgine::AssetLoadState::Unloaded);
+    auto reloaded = manager.WaitForAsset(handles[0]);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_EQ(manager.GetLoadState(handles[0]), Zgine::AssetLoadState::Loaded);
+
+    // One miss per load started; the LoadAsset() calls above were hits.
+    const auto stats = manager.GetCache().GetStats().Get(Zgine::AssetType::Audio);
+    EXPECT_GE(stats.Misses, handles.size() + 1);
+    EXPECT_GE(stats.Hits, futures.size());
+}
+
+TEST_F(AssetManagerTest, GpuAssetsWaitForTheMainThreadUploadQueue) {
+    auto& manager = Zgine::AssetManager::Get();
+    UseJobSystem(2);
+
+    // A vertex stage without its fragment stage: read on a worker, rejected when finalized.
+    const auto path = WriteAudioAsset("lonely.vert", "void main() {}");
+    const Zgine::AssetHandle handle = manager.RegisterAsset(path, Zgine::AssetType::Shader);
+    ASSERT_TRUE(handle.IsValid());
+
+    auto future = manager.LoadAssetAsync(handle);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (manager.GetLoadState(handle) != Zgine::AssetLoadState::Uploading
+           && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Uploading);
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    manager.Update();
+    EXPECT_EQ(future.get(), nullptr);
+    EXPECT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Failed);
+
+    // The blocking paths drain the queue themselves and retry failed loads.
+    EXPECT_EQ(manager.WaitForAsset(handle), nullptr);
+    EXPECT_EQ(manager.LoadAsset(handle), nullptr);
+    EXPECT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Failed);
+
+    // Unloading forgets the failure, so callers that stopped requesting it retry.
+    manager.UnloadAsset(handle);
+    EXPECT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Unloaded);
+}
+
+TEST_F(AssetManagerTest, JobsJoiningAPendingUploadDoNotDeadlockTheMainThread) {
+    auto& manager = Zgine::AssetManager::Get();
+    Zgine::JobSystem& jobs = UseJobSystem(2);
+
+    const auto path = WriteAudioAsset("lonely.vert", "void main() {}");
+    const Zgine::AssetHandle handle = manager.RegisterAsset(path, Zgine::AssetType::Shader);
+    ASSERT_TRUE(handle.IsValid());
+
+    auto future = manager.LoadAssetAsync(handle);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (manager.GetLoadState(handle) != Zgine::AssetLoadState::Uploading
+           && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Uploading);
+
+    // A system job loads the asset whose upload only the main thread can finish,
+    // while the main thread waits for that job.
+    std::atomic<bool> started{false};
+    std::atomic<bool> onWorker{false};
+    std::shared_ptr<Zgine::Asset> loaded;
+    Zgine::JobCounter counter;
+    const std::thread::id mainThread = std::this_thread::get_id();
+    jobs.Run([&]() {
+        started = true;
+        onWorker = std::this_thread::get_id() != mainThread;
+        loaded = manager.LoadAsset(handle);
+    }, &counter);
+    while (!started && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(onWorker);
+    EXPECT_EQ(loaded, nullptr);
+    EXPECT_EQ(future.get(), nullptr);
+    EXPECT_EQ(manager.GetLoadState(handle), Zgine::AssetLoadState::Failed);
+}
+
+TEST_F(AssetManagerTest, BatchLoadsFollowRecordedDependencies) {
+    auto& manager = Zgine::AssetManager::Get();
+    UseJobSystem(4);
+
+    const auto leafA = RegisterWithDependencies("leaf-a.wav", {});
+    const auto leafB = RegisterWithDependencies("leaf-b.wav", {});
+    const auto missing = Zgine::AssetHandle::New();
+    const auto middle = RegisterWithDependencies("middle.wav", { leafA, leafB });
+    const auto root = RegisterWithDependencies("root.wav", { middle, leafA, missing });
+    ASSERT_TRUE(root.IsValid());
+
+    const std::vector<Zgine::AssetHandle> request = { root, root, Zgine::AssetHandle() };
+    Zgine::AssetLoadGroup group = manager.LoadAssetsAsync(request);
+    EXPECT_EQ(group.GetTotal(), 5u);
+
+    // The unregistered dependency fails; the rest still loads.
+    EXPECT_FALSE(manager.WaitForAssets(group));
+    EXPECT_TRUE(group.IsDone());
+    EXPECT_EQ(group.GetCompleted(), 5u);
+    EXPECT_EQ(group.GetFailed(), 1u);
+    EXPECT_FLOAT_EQ(group.GetProgress(), 1.0f);
+    EXPECT_EQ(group.GetAsset(missing), nullptr);
+    for (const auto& handle : { leafA, leafB, middle, root }) {
+        auto asset = group.GetAsset(handle);
+        ASSERT_NE(asset, nullptr);
+        EXPECT_EQ(asset, manager.LoadAsset(handle));
+    }
+
+    Zgine::AssetLoadGroup empty = manager.LoadAssetsAsync({});
+    EXPECT_TRUE(empty.IsDone());
+    EXPECT_TRUE(manager.WaitForAssets(empty));
+}
+
+TEST_F(AssetManagerTest, BatchLoadsBreakDependencyCycles) {
+    auto& manager = Zgine::AssetManager::Get();
+    const auto first = Zgine::AssetHandle::New();
+    const auto second = RegisterWithDependencies("second.wav", { first });
+
+    // Registered under the handle the other one already points at.
+    const auto path = WriteAudioAsset("first.wav", "RIFF....WAVEfmt ");
+    Zgine::AssetMetadata metadata;
+    metadata.Handle = first;
+    metadata.Type = Zgine::AssetType::Audio;
+    metadata.SourcePath = path;
+    metadata.Dependencies = { second };
+    std::ofstream(path.string() + ".meta") << metadata.Serialize().dump(4);
+    ASSERT_EQ(manager.RegisterAsset(path, Zgine::AssetType::Audio), first);
+
+    const std::vector<Zgine::AssetHandle> request = { first };
+    Zgine::AssetLoadGroup group = manager.LoadAssetsAsync(request);
+    EXPECT_TRUE(manager.WaitForAssets(group));
+    EXPECT_EQ(group.GetTotal(), 2u);
+    EXPECT_NE(group.GetAsset(first), nullptr);
+    EXPECT_NE(group.GetAsset(second), nullptr);
+}
+
+TEST_F(AssetManagerTest, ScanLeavesUnchangedMetadataAlone) {
+    auto& manager = Zgine::AssetManager::Get();
+    const auto kept = WriteAudioAsset("kept.wav", "RIFF....WAVEfmt ");
+    const auto fresh = WriteAudioAsset("fresh.wav", "RIFF....WAVEfmt ");
+
+    Zgine::AssetMetadata metadata;
+    metadata.Handle = Zgine::AssetHandle::New();
+    metadata.Type = Zgine::AssetType::Audio;
+    metadata.SourcePath = kept;
+    const std::string text = metadata.Serialize().dump(); // not the layout SaveMetadata writes
+    const auto metaPath = kept.string() + ".meta";
+    std::ofstream(metaPath) << text;
+    const auto writeTime = std::filesystem::last_write_time(metaPath) - std::chrono::hours(1);
+    std::filesystem::last_write_time(metaPath, writeTime);
+
+    UseJobSystem(2);
+    manager.ScanAssets();
+
+    EXPECT_EQ(manager.GetHandleFromPath(kept), metadata.Handle);
+    EXPECT_EQ(std::filesystem::last_write_time(metaPath), writeTime);
+    std::ifstream stream(metaPath);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(stream), {}), text);
+
+    // An asset without one still gets its .meta.
+    EXPECT_TRUE(manager.GetHandleFromPath(fresh).IsValid());
+    EXPECT_TRUE(std::filesystem::exists(fresh.string() + ".meta"));
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <Zgine/Renderer/Culling/Bounds.h>
+#include <Zgine/Renderer/Culling/DynamicBVH.h>
+#include <Zgine/Renderer/Culling/Frustum.h>
+#include <Zgine/Renderer/Culling/SceneCuller.h>
+#include <Zgine/World/Core/World.h>
+#include <Zgine/World/Core/Entity.h>
+#include <Zgine/World/Components/Components.h>
+#include <Zgine/Core/Math/Math.h>
+#include <Zgine/Core/Math/Matrix4.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Zgine::AABB;
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+
+AABB Box(const Vector3& center, float halfSize) {
+    return AABB(Vector3(center.x - halfSize, center.y - halfSize, center.z - halfSize),
+                Vector3(center.x + halfSize, center.y + halfSize, center.z + halfSize));
+}
+
+// Camera at the origin looking down -Z.
+Zgine::Frustum MakeCameraFrustum() {
+    const Matrix4 projection = Matrix4::Perspective(Zgine::Math::DegToRad(60.0f), 1.0f, 0.1f, 100.0f);
+    const Matrix4 view = Matrix4::LookAt(Vector3(0.0f), Vector3(0.0f, 0.0f, -1.0f), Vector3(0.0f, 1.0f, 0.0f));
+    return Zgine::Frustum::FromMatrix(projection * view);
+}
+
+std::vector<uint32_t> Sorted(std::vector<uint32_t> values) {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+} // namespace
+
+TEST(CullingTest, TransformedBoundsEncloseRotatedBox) {
+    const AABB unit(Vector3(-0.5f), Vector3(0.5f));
+    const Matrix4 transform = Matrix4::Translation(Vector3(10.0f, 0.0f, 0.0f))
+                            * Matrix4::Rotation(Zgine::Math::DegToRad(45.0f), Vector3(0.0f, 1.0f, 0.0f))
+                            * Matrix4::Scale(Vector3(2.0f));
+
+    const AABB world = AABB::Transform(unit, transform);
+    const float halfDiagonal = std::sqrt(2.0f); // 2 * 0.5 * sqrt(2)
+    EXPECT_NEAR(world.Min.x, 10.0f - halfDiagonal, 1e-4f);
+    EXPECT_NEAR(world.Max.x, 10.0f + halfDiagonal, 1e-4f);
+    EXPECT_NEAR(world.Min.y, -1.0f, 1e-4f);
+    EXPECT_NEAR(world.Max.y, 1.0f, 1e-4f);
+    EXPECT_NEAR(world.Min.z, -halfDiagonal, 1e-4f);
+    EXPECT_NEAR(world.Max.z, halfDiagonal, 1e-4f);
+}
+
+TEST(CullingTest, FrustumClassifiesBoxes) {
+    const Zgine::Frustum frustum = MakeCameraFrustum();
+
+    EXPECT_EQ(frustum.Test(Box(Vector3(0.0f, 0.0f, -10.0f), 1.0f)), Zgine::FrustumTest::Inside);
+    EXPECT_EQ(frustum.Test(Box(Vector3(0.0f, 0.0f, 10.0f), 1.0f)), Zgine::FrustumTest::Outside);    // behind
+    EXPECT_EQ(frustum.Test(Box(Vector3(0.0f, 0.0f, -200.0f), 1.0f)), Zgine::FrustumTest::Outside);  // past far
+    EXPECT_EQ(frustum.Test(Box(Vector3(50.0f, 0.0f, -10.0f), 1.0f)), Zgine::FrustumTest::Outside);  // right
+    EXPECT_EQ(frustum.Test(Box(Vector3(0.0f, 0.0f, -100.0f), 1.0f)), Zgine::FrustumTest::Intersects);
+
+    const Zgine::Frustum ortho = Zgine::Frustum::FromMatrix(Matrix4::Ortho(-5.0f, 5.0f, -5.0f, 5.0f, -5.0f, 5.0f));
+    EXPECT_EQ(ortho.Test(Box(Vector3(0.0f), 1.0f)), Zgine::FrustumTest::Inside);
+    EXPECT_EQ(ortho.Test(Box(Vector3(5.0f, 0.0f, 0.0f), 1.0f)), Zgine::FrustumTest::Intersects);
+    EXPECT_EQ(ortho.Test(Box(Vector3(0.0f, -7.0f, 0.0f), 1.0f)), Zgine::FrustumTest::Outside);
+}
+
+TEST(CullingTest, BVHQueryMatchesBruteForce) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+    std::uniform_real_distribution<float> size(0.1f, 3.0f);
+
+    Zgine::DynamicBVH tree(0.0f);
+    std::vector<AABB> boxes;
+    std::vector<int32_t> proxies;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        boxes.push_back(Box(Vector3(position(rng), position(rng), position(rng)), size(rng)));
+        proxies.push_back(tree.CreateProxy(boxes.back(), i));
+    }
+    ASSERT_TRUE(tree.Validate());
+    EXPECT_EQ(tree.GetProxyCount(), boxes.size());
+    EXPECT_LT(tree.GetHeight(), 40); // balanced, not a list
+
+    auto check = [&] {
+        const Zgine::Frustum frustum = MakeCameraFrustum();
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < boxes.size(); ++i) {
+            if (proxies[i] != Zgine::DynamicBVH::kNullProxy && frustum.Intersects(boxes[i])) {
+                expected.push_back(i);
+            }
+        }
+        std::vector<uint32_t> actual;
+        tree.Query(frustum, [&actual](uint32_t id) { actual.push_back(id); });
+        EXPECT_EQ(Sorted(actual), expected);
+    };
+    check();
+
+    // Move half of the boxes and remove a quarter, then re-check.
+    for (uint32_t i = 0; i < boxes.size(); i += 2) {
+        boxes[i] = Box(Vector3(position(rng), position(rng), position(rng)), size(rng));
+        tree.MoveProxy(proxies[i], boxes[i]);
+    }
+    for (uint32_t i = 1; i < boxes.size(); i += 4) {
+        tree.DestroyProxy(proxies[i]);
+        proxies[i] = Zgine::DynamicBVH::kNullProxy;
+    }
+    ASSERT_TRUE(tree.Validate());
+    check();
+}
+
+TEST(CullingTest, BVHMarginAbsorbsSmallMoves) {
+    Zgine::DynamicBVH tree(0.5f);
+    const int32_t proxy = tree.CreateProxy(Box(Vector3(0.0f), 1.0f), 7);
+
+    EXPECT_FALSE(tree.MoveProxy(proxy, Box(Vector3(0.25f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_TRUE(tree.MoveProxy(proxy, Box(Vector3(5.0f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_TRUE(tree.GetFatBounds(proxy).Contains(Box(Vector3(5.0f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_EQ(tree.GetUserData(proxy), 7u);
+
+    std::vector<uint32_t> hits;
+    tree.Query(Box(Vector3(5.0f, 0.0f, 0.0f), 0.1f), [&hits](uint32_t id) { hits.push_back(id); });
+    EXPECT_EQ(hits, std::vector<uint32_t>{7u});
+    tree.DestroyProxy(proxy);
+    EXPECT_EQ(tree.GetHeight(), 0);
+    EXPECT_TRUE(tree.Validate());
+}
+
+TEST(CullingTest, SceneCullerTracksWorldChanges) {
+    Zgine::World world;
+    Zgine::Entity visible = world.CreateEntity("Visible");
+    visible.AddComponent<Zgine::PrimitiveComponent>(Zgine::PrimitiveType::Cube);
+    visible.GetComponent<Zgine::TransformComponent>().Translation = Vector3(0.0f, 0.0f, -10.0f);
+
+    Zgine::Entity hidden = world.CreateEntity("Hidden");
+    hidden.AddComponent<Zgine::PrimitiveComponent>(Zgine::PrimitiveType::Sphere);
+    hidden.GetComponent<Zgine::TransformComponent>().Translation = Vector3(0.0f, 0.0f, 10.0f);
+
+    Zgine::SceneCuller culler;
+    world.UpdateWorldTransforms();
+    EXPECT_EQ(culler.Sync(world), 2u);
+    EXPECT_EQ(culler.Sync(world), 0u); // nothing changed
+
+    const Zgine::Frustum frustum = MakeCameraFrustum();
+    std::vector<uint32_t> entities;
+    EXPECT_EQ(culler.Cull(frustum, entities), 1u);
+    EXPECT_EQ(entities, std::vector<uint32_t>{visible.GetHandle().GetValue()});
+
+    hidden.GetComponent<Zgine::TransformComponent>().Translation = Vector3(0.0f, 0.0f, -20.0f);
+    world.UpdateWorldTransforms();
+    EXPECT_EQ(culler.Sync(world), 1u);
+    entities.clear();
+    EXPECT_EQ(culler.Cull(frustum, entities), 2u);
+
+    world.DestroyEntity(visible);
+    EXPECT_EQ(culler.Sync(world), 1u);
+    EXPECT_EQ(culler.GetObjectCount(), 1u);
+    EXPECT_TRUE(culler.GetTree().Validate());
+}
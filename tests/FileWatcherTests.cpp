@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <Zgine/Platform/IO/FileWatcher.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Zgine;
+
+namespace {
+
+using Change = std::pair<std::string, FileStatus>;
+
+#if defined(__linux__)
+constexpr bool kHasNotifications = true;
+#else
+constexpr bool kHasNotifications = false;
+#endif
+
+// Runs once per backend: notified (inotify where available) and stat-polled.
+class FileWatcherTest : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override {
+        const auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+        m_Directory = std::filesystem::temp_directory_path() / ("zgine-watcher-test-" + std::to_string(unique));
+        std::filesystem::create_directories(m_Directory);
+
+        FileWatcherConfig config;
+        config.Debounce = std::chrono::milliseconds(50);
+        config.ForcePolling = GetParam();
+        m_Watcher.SetConfig(config);
+        m_Watcher.SetCallback([this](const std::filesystem::path& path, FileStatus status) {
+            m_Changes.emplace_back(path.filename().string(), status);
+        });
+    }
+
+    void TearDown() override {
+        m_Watcher.Clear();
+        std::error_code ec;
+        std::filesystem::remove_all(m_Directory, ec);
+    }
+
+    bool IsNotified() const { return kHasNotifications && !GetParam(); }
+
+    static void Write(const std::filesystem::path& path, const std::string& text) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+    }
+
+    // Polls until a change arrives, then long enough to catch any that follow.
+    std::vector<Change> Collect(std::chrono::milliseconds timeout = std::chrono::seconds(3)) {
+        m_Changes.clear();
+        const auto start = std::chrono::steady_clock::now();
+        auto quietSince = start;
+        size_t seen = 0;
+        while (std::chrono::steady_clock::now() - start < timeout) {
+            m_Watcher.Poll();
+            const auto now = std::chrono::steady_clock::now();
+            if (m_Changes.size() != seen) {
+                seen = m_Changes.size();
+                quietSince = now;
+            } else if (seen > 0 && now - quietSince > std::chrono::milliseconds(200)) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return std::move(m_Changes);
+    }
+
+    std::filesystem::path m_Directory;
+    FileWatcher m_Watcher;
+    std::vector<Change> m_Changes;
+};
+
+} // namespace
+
+TEST_P(FileWatcherTest, ReportsCreationModificationAndRemoval) {
+    const std::filesystem::path path = m_Directory / "texture.png";
+    m_Watcher.Watch(path);
+    m_Watcher.Watch(m_Directory / "unrelated.png");
+    EXPECT_EQ(m_Watcher.GetPolledCount(), IsNotified() ? 0u : 2u);
+
+    Write(path, "a");
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "texture.png", FileStatus::Created } }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20)); // a distinct write time for polling
+    Write(path, "bb");
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "texture.png", FileStatus::Modified } }));
+
+    std::filesystem::remove(path);
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "texture.png", FileStatus::Removed } }));
+}
+
+TEST_P(FileWatcherTest, SaveBurstsReportOnce) {
+    const std::filesystem::path path = m_Directory / "scene.json";
+    Write(path, "0");
+    m_Watcher.Watch(path);
+
+    for (int i = 1; i <= 5; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        Write(path, std::string(static_cast<size_t>(i), 'x'));
+        m_Watcher.Poll(); // within the debounce time: nothing yet
+    }
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "scene.json", FileStatus::Modified } }));
+}
+
+TEST_P(FileWatcherTest, SavingThroughARenameIsAModification) {
+    const std::filesystem::path path = m_Directory / "shader.glsl";
+    Write(path, "old");
+    m_Watcher.Watch(path);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::filesystem::path temporary = m_Directory / "shader.glsl.tmp";
+    Write(temporary, "new");
+    std::filesystem::rename(temporary, path);
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "shader.glsl", FileStatus::Modified } }));
+}
+
+TEST_P(FileWatcherTest, UnwatchedPathsAndMissingDirectoriesBehave) {
+    const std::filesystem::path dropped = m_Directory / "dropped.txt";
+    const std::filesystem::path nested = m_Directory / "later" / "material.json";
+    m_Watcher.Watch(dropped);
+    m_Watcher.Watch(nested);
+    m_Watcher.Unwatch(dropped);
+    // A directory that does not exist yet cannot be notified on.
+    EXPECT_EQ(m_Watcher.GetPolledCount(), 1u);
+
+    Write(dropped, "ignored");
+    std::filesystem::create_directories(nested.parent_path());
+    Write(nested, "{}");
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "material.json", FileStatus::Created } }));
+    // Once it exists, the new directory is watched instead.
+    EXPECT_EQ(m_Watcher.GetPolledCount(), IsNotified() ? 0u : 1u);
+
+    std::filesystem::remove_all(nested.parent_path());
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "material.json", FileStatus::Removed } }));
+}
+
+TEST_P(FileWatcherTest, AttributeChangesAreNotModifications) {
+    const std::filesystem::path path = m_Directory / "texture.png";
+    Write(path, "a");
+    m_Watcher.Watch(path);
+
+    // IN_ATTRIB without a new write time: polling sees nothing, neither may inotify.
+    std::filesystem::permissions(path, std::filesystem::perms::owner_exec, std::filesystem::perm_options::add);
+    EXPECT_TRUE(Collect(std::chrono::milliseconds(500)).empty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Write(path, "b");
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "texture.png", FileStatus::Modified } }));
+}
+
+TEST_P(FileWatcherTest, QueueOverflowReportsOnlyChangedFiles) {
+    const std::filesystem::path unchanged = m_Directory / "unchanged.png";
+    const std::filesystem::path saved = m_Directory / "saved.png";
+    Write(unchanged, "a");
+    Write(saved, "a");
+    m_Watcher.Watch(unchanged);
+    m_Watcher.Watch(saved);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Write(saved, "b");
+    // Each file written is at least IN_CREATE and IN_CLOSE_WRITE: enough to
+    // overflow the default queue of 16384 events before the next Poll().
+    for (int i = 0; i < 10000; ++i) {
+        Write(m_Directory / ("flood" + std::to_string(i)), "");
+    }
+    EXPECT_EQ(Collect(), (std::vector<Change>{ { "saved.png", FileStatus::Modified } }));
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, FileWatcherTest, ::testing::Values(false, true),
+    [](const ::testing::TestParamInfo<bool>& info) { return info.param ? "Polling" : "Notified"; });
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <Zgine/Core/Jobs/JobGraph.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+class RecordingGraph {
+public:
+    Zgine::JobNodeId Add(Zgine::JobGraph& graph, const std::string& name) {
+        return graph.AddNode(name, [this, name] {
+            std::scoped_lock lock(m_Mutex);
+            m_Order.push_back(name);
+        });
+    }
+
+    size_t IndexOf(const std::string& name) const {
+        for (size_t i = 0; i < m_Order.size(); ++i) {
+            if (m_Order[i] == name) {
+                return i;
+            }
+        }
+        return m_Order.size();
+    }
+
+    std::vector<std::string>& GetOrder() { return m_Order; }
+
+private:
+    std::mutex m_Mutex;
+    std::vector<std::string> m_Order;
+};
+
+} // namespace
+
+TEST(JobGraphTest, DiamondRunsJoinAfterBothBranches) {
+    Zgine::JobSystem jobs(4);
+    Zgine::JobGraph graph;
+    RecordingGraph recorder;
+
+    const auto a = recorder.Add(graph, "A");
+    const auto b1 = recorder.Add(graph, "B1");
+    const auto b2 = recorder.Add(graph, "B2");
+    const auto c = recorder.Add(graph, "C");
+    graph.AddEdge(a, b1);
+    graph.AddEdge(a, b2);
+    graph.AddEdge(b1, c);
+    graph.AddEdge(b2, c);
+
+    ASSERT_TRUE(graph.Execute(jobs));
+
+    ASSERT_EQ(recorder.GetOrder().size(), 4u);
+    EXPECT_EQ(recorder.IndexOf("A"), 0u);
+    EXPECT_EQ(recorder.IndexOf("C"), 3u);
+}
+
+TEST(JobGraphTest, ReExecutesCompiledGraphEveryFrame) {
+    Zgine::JobSystem jobs(3);
+    Zgine::JobGraph graph;
+    std::atomic<uint32_t> leaves{0};
+    std::atomic<uint32_t> joinsSeenComplete{0};
+
+    std::vector<Zgine::JobNodeId> fanIn;
+    for (int i = 0; i < 32; ++i) {
+        fanIn.push_back(graph.AddNode("leaf", [&leaves] { leaves.fetch_add(1); }));
+    }
+    const auto join = graph.AddNode("join", [&] {
+        if (leaves.load() % 32 == 0) {
+            joinsSeenComplete.fetch_add(1);
+        }
+    });
+    for (Zgine::JobNodeId leaf : fanIn) {
+        graph.AddEdge(leaf, join);
+    }
+
+    ASSERT_TRUE(graph.Compile());
+    for (int frame = 0; frame < 100; ++frame) {
+        ASSERT_TRUE(graph.Execute(jobs));
+    }
+
+    EXPECT_EQ(leaves.load(), 32u * 100u);
+    EXPECT_EQ(joinsSeenComplete.load(), 100u);
+}
+
+TEST(JobGraphTest, RejectsCyclesWithoutRunningAnyNode) {
+    Zgine::JobSystem jobs(2);
+    Zgine::JobGraph graph;
+    bool ran = false;
+
+    const auto a = graph.AddNode("A", [&ran] { ran = true; });
+    const auto b = graph.AddNode("B", [&ran] { ran = true; });
+    graph.AddEdge(a, b);
+    graph.AddEdge(b, a);
+
+    EXPECT_FALSE(graph.Compile());
+    EXPECT_FALSE(graph.Execute(jobs));
+    EXPECT_FALSE(ran);
+}
+
+TEST(JobGraphTest, RejectsInvalidEdgesAndDeduplicatesRepeats) {
+    Zgine::JobGraph graph;
+    const auto a = graph.AddNode("A", {});
+    const auto b = graph.AddNode("B", {});
+
+    EXPECT_FALSE(graph.AddEdge(a, a));
+    EXPECT_FALSE(graph.AddEdge(a, 42));
+    EXPECT_TRUE(graph.AddEdge(a, b));
+    EXPECT_TRUE(graph.AddEdge(a, b));
+
+    ASSERT_TRUE(graph.Compile());
+    const std::vector<Zgine::JobNodeId> expected{a, b};
+    EXPECT_EQ(graph.GetTopologicalOrder(), expected);
+}
+
+TEST(JobGraphTest, SerialExecutionFollowsTopologicalOrder) {
+    Zgine::JobGraph graph;
+    RecordingGraph recorder;
+
+    const auto render = recorder.Add(graph, "Render");
+    const auto physics = recorder.Add(graph, "Physics");
+    const auto scripts = recorder.Add(graph, "Scripts");
+    graph.AddEdge(physics, scripts);
+    graph.AddEdge(scripts, render);
+
+    ASSERT_TRUE(graph.ExecuteSerial());
+
+    const std::vector<std::string> expected{"Physics", "Scripts", "Render"};
+    EXPECT_EQ(recorder.GetOrder(), expected);
+}
+
+TEST(JobGraphTest, NodesMayFanOutParallelWorkAndWait) {
+    Zgine::JobSystem jobs(2);
+    Zgine::JobGraph graph;
+    std::vector<uint32_t> values(4096, 1);
+    uint64_t sum = 0;
+
+    const auto scale = graph.AddNode("Scale", [&] {
+        jobs.ParallelFor(0, static_cast<uint32_t>(values.size()), 128, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                values[i] *= 3;
+            }
+        });
+    });
+    const auto reduce = graph.AddNode("Reduce", [&] {
+        for (uint32_t value : values) {
+            sum += value;
+        }
+    });
+    graph.AddEdge(scale, reduce);
+
+    ASSERT_TRUE(graph.Execute(jobs));
+    EXPECT_EQ(sum, 3u * 4096u);
+}
+
+TEST(JobGraphTest, EmptyGraphExecutesTrivially) {
+    Zgine::JobSystem jobs(1);
+    Zgine::JobGraph graph;
+    EXPECT_TRUE(graph.Execute(jobs));
+    EXPECT_TRUE(graph.IsCompiled());
+}
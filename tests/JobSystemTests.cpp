@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(JobSystemTest, RunWithCounterCompletesEveryJob) {
+    Zgine::JobSystem jobs(4);
+    Zgine::JobCounter counter;
+    std::atomic<uint32_t> executed{0};
+
+    for (int i = 0; i < 10000; ++i) {
+        jobs.Run([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(executed.load(), 10000u);
+}
+
+TEST(JobSystemTest, NestedJobsCanWaitInsideWorkers) {
+    Zgine::JobSystem jobs(2);
+    Zgine::JobCounter outer;
+    std::atomic<uint32_t> executed{0};
+
+    // More waiting parents than workers: only works if Wait helps instead of blocking.
+    for (int parent = 0; parent < 8; ++parent) {
+        jobs.Run([&jobs, &executed] {
+            Zgine::JobCounter inner;
+            for (int child = 0; child < 64; ++child) {
+                jobs.Run([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }, &inner);
+            }
+            jobs.Wait(inner);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+
+    EXPECT_EQ(executed.load(), 8u * 64u);
+}
+
+TEST(JobSystemTest, AcceptsJobsFromForeignThreads) {
+    Zgine::JobSystem jobs(3);
+    std::atomic<uint32_t> executed{0};
+
+    {
+        std::vector<std::jthread> producers;
+        for (int p = 0; p < 4; ++p) {
+            producers.emplace_back([&jobs, &executed] {
+                Zgine::JobCounter counter;
+                for (int i = 0; i < 2000; ++i) {
+                    jobs.Run([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+                }
+                jobs.Wait(counter);
+            });
+        }
+    }
+
+    EXPECT_EQ(executed.load(), 4u * 2000u);
+}
+
+TEST(JobSystemTest, WaitAllDrainsQueuedJobs) {
+    Zgine::JobSystem jobs(2);
+    std::atomic<uint32_t> executed{0};
+
+    for (int i = 0; i < 5000; ++i) {
+        jobs.Run([&executed] { executed.fetch_add(1, std::memory_order_relaxed); });
+    }
+    jobs.WaitAll();
+
+    EXPECT_EQ(executed.load(), 5000u);
+    EXPECT_EQ(jobs.GetPendingJobCount(), 0u);
+}
+
+TEST(JobSystemTest, OwnerWorkUnblocksJobsTheOwnerWaitsOn) {
+    Zgine::JobSystem jobs(2);
+    std::atomic<bool> requested{false};
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> ownerRuns{0};
+    jobs.SetOwnerWork([&]() {
+        if (!requested || done) {
+            return false;
+        }
+        ++ownerRuns;
+        done = true;
+        return true;
+    });
+
+    // The job waits for something only the owner does, after the owner blocked.
+    Zgine::JobCounter counter;
+    std::atomic<bool> started{false};
+    jobs.Run([&]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        requested = true;
+        jobs.NotifyOwner();
+        while (!done) {
+            std::this_thread::yield();
+        }
+    }, &counter);
+    while (!started) {
+        std::this_thread::yield();
+    }
+    jobs.Wait(counter);
+
+    EXPECT_TRUE(done);
+    EXPECT_EQ(ownerRuns, 1u);
+    jobs.SetOwnerWork(nullptr);
+}
+
+TEST(JobSystemTest, SubmitForwardsResultAndExceptions) {
+    Zgine::JobSystem jobs(1);
+    bool ran = false;
+
+    std::future<void> ok = jobs.Submit([&ran] { ran = true; });
+    std::future<void> failed = jobs.Submit([] { throw std::runtime_error("job failed"); });
+
+    ok.get();
+    EXPECT_TRUE(ran);
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(JobSystemTest, ParallelForCoversRangeExactlyOnce) {
+    Zgine::JobSystem jobs(4);
+    std::vector<std::atomic<uint32_t>> hits(10007);
+
+    jobs.ParallelFor(0, static_cast<uint32_t>(hits.size()), 64, [&hits](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (const auto& hit : hits) {
+        ASSERT_EQ(hit.load(), 1u);
+    }
+}
+
+TEST(JobSystemTest, ParallelForHandlesEmptyAndSingleChunkRanges) {
+    Zgine::JobSystem jobs(2);
+    uint32_t calls = 0;
+
+    jobs.ParallelFor(5, 5, 16, [&calls](uint32_t, uint32_t) { ++calls; });
+    EXPECT_EQ(calls, 0u);
+
+    jobs.ParallelFor(0, 10, 0, [&calls](uint32_t begin, uint32_t end) { calls += end - begin; });
+    EXPECT_EQ(calls, 10u);
+}
+
+TEST(JobSystemTest, ParallelReduceCombinesPartialsInChunkOrder) {
+    Zgine::JobSystem jobs(4);
+
+    const uint64_t sum = jobs.ParallelReduce<uint64_t>(0, 100000, 1000, 0,
+        [](uint32_t begin, uint32_t end) {
+            uint64_t partial = 0;
+            for (uint32_t i = begin; i < end; ++i) {
+                partial += i;
+            }
+            return partial;
+        },
+        [](uint64_t a, uint64_t b) { return a + b; });
+    EXPECT_EQ(sum, 100000ull * 99999ull / 2ull);
+
+    // Concatenation is order-sensitive: chunk order must be preserved.
+    const std::string digits = jobs.ParallelReduce<std::string>(0, 10, 3, std::string{},
+        [](uint32_t begin, uint32_t end) {
+            std::string part;
+            for (uint32_t i = begin; i < end; ++i) {
+                part += static_cast<char>('0' + i);
+            }
+            return part;
+        },
+        [](const std::string& a, const std::string& b) { return a + b; });
+    EXPECT_EQ(digits, "0123456789");
+}
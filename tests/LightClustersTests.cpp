@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <Zgine/Renderer/Lighting/LightClusters.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Core/Math/Math.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector4.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Zgine::LightClusters;
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+using Zgine::Math::Vector4;
+
+constexpr float kNear = 0.1f;
+constexpr float kFar = 100.0f;
+
+Matrix4 MakeView() {
+    return Matrix4::LookAt(Vector3(0.0f, 8.0f, 20.0f), Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+}
+
+Matrix4 MakePerspective() {
+    return Matrix4::Perspective(Zgine::Math::DegToRad(60.0f), 16.0f / 9.0f, kNear, kFar);
+}
+
+float Attenuation(float constant, float linear, float quadratic, float distance) {
+    return 1.0f / (constant + linear * distance + quadratic * distance * distance);
+}
+
+// Many small point and spot lights scattered around the origin.
+Zgine::LightingData MakeLights(uint32_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+    std::uniform_real_distribution<float> unit(0.2f, 1.0f);
+
+    Zgine::LightingData lights{};
+    for (uint32_t i = 0; i < count; ++i) {
+        const Vector3 at(position(rng), position(rng) * 0.25f, position(rng));
+        const Vector3 color(unit(rng), unit(rng), unit(rng));
+        if (i % 4 == 3) {
+            lights.spots.push_back({ at, Vector3(0.0f, -1.0f, 0.0f), color, unit(rng), 0.95f, 0.9f, 1.0f, 0.35f, 0.44f });
+        } else {
+            lights.points.push_back({ at, color, unit(rng), 1.0f, 0.7f, 1.8f });
+        }
+    }
+    return lights;
+}
+
+bool Contains(const std::vector<uint32_t>& indices, const Zgine::ClusterCell& cell, uint32_t light) {
+    const auto begin = indices.begin() + cell.Offset;
+    return std::find(begin, begin + cell.Count, light) != begin + cell.Count;
+}
+
+// Every light that reaches a point must be listed in the point's cluster.
+void ExpectConservative(const Matrix4& projection, uint32_t seed) {
+    const Matrix4 view = MakeView();
+    const Zgine::LightingData lights = MakeLights(300, seed);
+    LightClusters clusters;
+    clusters.Build(lights, view, projection, kNear, kFar);
+
+    const auto& gpuLights = clusters.GetLights();
+    ASSERT_EQ(gpuLights.size(), lights.points.size() + lights.spots.size());
+
+    std::mt19937 rng(seed + 1);
+    std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+    uint32_t samples = 0;
+    uint32_t litSamples = 0;
+    while (samples < 2000) {
+        const Vector3 world(position(rng), position(rng) * 0.25f, position(rng));
+        const Vector4 viewPoint = view * Vector4(world.x, world.y, world.z, 1.0f);
+        const Vector4 clip = projection * viewPoint;
+        if (std::abs(clip.x) > clip.w || std::abs(clip.y) > clip.w || std::abs(clip.z) > clip.w) {
+            continue;
+        }
+        ++samples;
+
+        const uint32_t cluster = clusters.FindCluster(Vector3(viewPoint.x, viewPoint.y, viewPoint.z));
+        const Zgine::AABB& bounds = clusters.GetClusterBounds(cluster);
+        EXPECT_GE(viewPoint.z, bounds.Min.z - 1e-3f);
+        EXPECT_LE(viewPoint.z, bounds.Max.z + 1e-3f);
+
+        const Zgine::ClusterCell& cell = clusters.GetCells()[cluster];
+        for (uint32_t light = 0; light < gpuLights.size(); ++light) {
+            const auto& data = gpuLights[light];
+            const float dx = data.Position[0] - world.x;
+            const float dy = data.Position[1] - world.y;
+            const float dz = data.Position[2] - world.z;
+            if (dx * dx + dy * dy + dz * dz <= data.Range * data.Range) {
+                ++litSamples;
+                EXPECT_TRUE(Contains(clusters.GetLightIndices(), cell, light))
+                    << "light " << light << " missing from cluster " << cluster;
+            }
+        }
+    }
+    EXPECT_GT(litSamples, 0u);
+}
+
+} // namespace
+
+TEST(LightClustersTest, RangeEndsWhereAttenuationReachesCutoff) {
+    const Vector3 white(1.0f);
+    const float range = LightClusters::ComputeLightRange(white, 2.0f, 1.0f, 0.09f, 0.032f);
+    EXPECT_NEAR(2.0f * Attenuation(1.0f, 0.09f, 0.032f, range), LightClusters::kLightCutoff, 1e-4f);
+
+    const float linearOnly = LightClusters::ComputeLightRange(white, 1.0f, 1.0f, 0.5f, 0.0f);
+    EXPECT_NEAR(Attenuation(1.0f, 0.5f, 0.0f, linearOnly), LightClusters::kLightCutoff, 1e-4f);
+
+    EXPECT_EQ(LightClusters::ComputeLightRange(Vector3(0.0f), 5.0f, 1.0f, 0.09f, 0.032f), 0.0f);
+    EXPECT_EQ(LightClusters::ComputeLightRange(white, 1.0f, 1.0f, 0.0f, 0.0f), LightClusters::kMaxLightRange);
+}
+
+TEST(LightClustersTest, KeepsEveryLightAndSkipsBlackOnes) {
+    Zgine::LightingData lights = MakeLights(64, 7);
+    lights.points.push_back({ Vector3(0.0f), Vector3(0.0f), 1.0f, 1.0f, 0.09f, 0.032f });
+
+    LightClusters clusters;
+    clusters.Build(lights, MakeView(), MakePerspective(), kNear, kFar);
+
+    EXPECT_EQ(clusters.GetLights().size(), lights.points.size() + lights.spots.size() - 1);
+    uint32_t spots = 0;
+    for (const auto& light : clusters.GetLights()) {
+        spots += light.Type == 1.0f ? 1u : 0u;
+    }
+    EXPECT_EQ(spots, lights.spots.size());
+
+    uint32_t listed = 0;
+    for (const Zgine::ClusterCell& cell : clusters.GetCells()) {
+        EXPECT_LE(cell.Offset + cell.Count, clusters.GetLightIndices().size());
+        listed += cell.Count;
+    }
+    EXPECT_EQ(listed, clusters.GetLightIndices().size());
+}
+
+TEST(LightClustersTest, SlicesCoverTheDepthRangeExponentially) {
+    LightClusters clusters;
+    clusters.Build(Zgine::LightingData{}, MakeView(), MakePerspective(), kNear, kFar);
+
+    const uint32_t slices = clusters.GetConfig().Slices;
+    EXPECT_EQ(clusters.GetSlice(0.0f), 0u);
+    EXPECT_EQ(clusters.GetSlice(kFar * 2.0f), slices - 1);
+    for (uint32_t slice = 1; slice < slices; ++slice) {
+        const float start = -clusters.GetClusterBounds(clusters.GetClusterIndex(0, 0, slice)).Max.z;
+        EXPECT_EQ(clusters.GetSlice(start * 1.001f), slice);
+        EXPECT_EQ(clusters.GetSlice(start * 0.999f), slice - 1);
+    }
+}
+
+TEST(LightClustersTest, PerspectiveClustersListEveryLightReachingThem) {
+    ExpectConservative(MakePerspective(), 11);
+}
+
+TEST(LightClustersTest, OrthographicClustersListEveryLightReachingThem) {
+    ExpectConservative(Matrix4::Ortho(-40.0f, 40.0f, -22.5f, 22.5f, kNear, kFar), 23);
+}
+
+TEST(LightClustersTest, ParallelBuildMatchesSerialBuild) {
+    const Zgine::LightingData lights = MakeLights(500, 3);
+    LightClusters serial;
+    serial.Build(lights, MakeView(), MakePerspective(), kNear, kFar);
+
+    Zgine::JobSystem jobs(4);
+    LightClusters parallel;
+    parallel.Build(lights, MakeView(), MakePerspective(), kNear, kFar, &jobs);
+
+    ASSERT_EQ(serial.GetLightIndices(), parallel.GetLightIndices());
+    ASSERT_EQ(serial.GetCells().size(), parallel.GetCells().size());
+    for (size_t i = 0; i < serial.GetCells().size(); ++i) {
+        EXPECT_EQ(serial.GetCells()[i].Offset, parallel.GetCells()[i].Offset);
+        EXPECT_EQ(serial.GetCells()[i].Count, parallel.GetCells()[i].Count);
+    }
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <Zgine/Core/Math/MathBatch.h>
+#include <Zgine/Core/Math/MathTypes.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+using Zgine::Math::Vector4;
+
+// The composition TransformComponent used before ComposeTransform existed.
+Matrix4 ReferenceCompose(const Vector3& t, const Vector3& r, const Vector3& s) {
+    using namespace Zgine::Math;
+    const Matrix4 rotation = Matrix4::Rotation(DegToRad(r.x), Vector3(1, 0, 0))
+                           * Matrix4::Rotation(DegToRad(r.y), Vector3(0, 1, 0))
+                           * Matrix4::Rotation(DegToRad(r.z), Vector3(0, 0, 1));
+    return Matrix4::Translation(t) * rotation * Matrix4::Scale(s);
+}
+
+Matrix4 ReferenceMultiply(const Matrix4& a, const Matrix4& b) {
+    Matrix4 result;
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += a(row, k) * b(k, col);
+            }
+            result(row, col) = sum;
+        }
+    }
+    return result;
+}
+
+void ExpectMatrixNear(const Matrix4& actual, const Matrix4& expected, float tolerance = 1e-5f) {
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_NEAR(actual.m[i], expected.m[i], tolerance) << "element " << i;
+    }
+}
+
+Matrix4 MakeMatrix(float seed) {
+    Matrix4 matrix;
+    for (int i = 0; i < 16; ++i) {
+        matrix.m[i] = std::sin(seed + static_cast<float>(i) * 0.37f) * 3.0f;
+    }
+    return matrix;
+}
+
+} // namespace
+
+TEST(MathBatchTest, MatrixOperatorsMatchReference) {
+    const Matrix4 a = MakeMatrix(0.5f);
+    const Matrix4 b = MakeMatrix(2.0f);
+    ExpectMatrixNear(a * b, ReferenceMultiply(a, b));
+
+    Matrix4 accumulated = a;
+    accumulated *= b;
+    ExpectMatrixNear(accumulated, ReferenceMultiply(a, b));
+
+    const Vector4 v = a * Vector4(1.0f, -2.0f, 3.0f, 1.0f);
+    for (int row = 0; row < 4; ++row) {
+        const float expected = a(row, 0) - 2.0f * a(row, 1) + 3.0f * a(row, 2) + a(row, 3);
+        EXPECT_NEAR(v[row], expected, 1e-4f);
+    }
+}
+
+TEST(MathBatchTest, ComposeTransformMatchesMatrixProduct) {
+    const Vector3 translation(1.0f, -2.0f, 3.5f);
+    const Vector3 scale(2.0f, 0.5f, 1.5f);
+    for (float angle : {0.0f, 30.0f, 90.0f, 135.0f, 180.0f, -270.0f, 725.0f}) {
+        const Vector3 rotation(angle, angle * 0.5f - 40.0f, 15.0f - angle);
+        ExpectMatrixNear(Zgine::Math::ComposeTransform(translation, rotation, scale),
+                         ReferenceCompose(translation, rotation, scale));
+    }
+}
+
+TEST(MathBatchTest, ComposeTransformsHandlesTailAndMatchesSingle) {
+    constexpr size_t count = 11; // two full SIMD groups plus a partial one
+    std::vector<float> tx(count), ty(count), tz(count), rx(count), ry(count), rz(count), sx(count), sy(count), sz(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float f = static_cast<float>(i);
+        tx[i] = f; ty[i] = -f * 0.5f; tz[i] = 2.0f;
+        rx[i] = f * 33.0f; ry[i] = 90.0f - f * 17.0f; rz[i] = f * f;
+        sx[i] = 1.0f + f * 0.1f; sy[i] = 1.0f; sz[i] = 0.25f + f;
+    }
+    const Zgine::Math::TransformStreamsSoA streams{
+        tx.data(), ty.data(), tz.data(), rx.data(), ry.data(), rz.data(), sx.data(), sy.data(), sz.data()
+    };
+
+    std::vector<Matrix4> out(count + 1, Matrix4(7.0f));
+    Zgine::Math::ComposeTransforms(streams, out.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Vector3 t(tx[i], ty[i], tz[i]);
+        const Vector3 r(rx[i], ry[i], rz[i]);
+        const Vector3 s(sx[i], sy[i], sz[i]);
+        ExpectMatrixNear(out[i], ReferenceCompose(t, r, s), 1e-4f);
+        ExpectMatrixNear(out[i], Zgine::Math::ComposeTransform(t, r, s), 1e-5f);
+    }
+    ExpectMatrixNear(out[count], Matrix4(7.0f), 0.0f);
+}
+
+TEST(MathBatchTest, TransformPointsAoSAndSoAAgree) {
+    const Matrix4 m = ReferenceCompose(Vector3(4.0f, 5.0f, 6.0f), Vector3(10.0f, 20.0f, 30.0f), Vector3(2.0f, 2.0f, 2.0f));
+
+    constexpr size_t count = 19;
+    std::vector<Vector3> points(count);
+    std::vector<float> xs(count), ys(count), zs(count);
+    for (size_t i = 0; i < count; ++i) {
+        points[i] = Vector3(static_cast<float>(i), 1.0f - static_cast<float>(i), 0.5f * static_cast<float>(i));
+        xs[i] = points[i].x; ys[i] = points[i].y; zs[i] = points[i].z;
+    }
+
+    std::vector<Vector3> aos(count);
+    Zgine::Math::TransformPoints(m, points.data(), aos.data(), count);
+    // In place on the SoA streams.
+    Zgine::Math::TransformPoints(m, xs.data(), ys.data(), zs.data(), xs.data(), ys.data(), zs.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Vector4 expected = m * Vector4(points[i].x, points[i].y, points[i].z, 1.0f);
+        EXPECT_NEAR(aos[i].x, expected.x, 1e-4f);
+        EXPECT_NEAR(aos[i].y, expected.y, 1e-4f);
+        EXPECT_NEAR(aos[i].z, expected.z, 1e-4f);
+        EXPECT_NEAR(xs[i], expected.x, 1e-4f);
+        EXPECT_NEAR(ys[i], expected.y, 1e-4f);
+        EXPECT_NEAR(zs[i], expected.z, 1e-4f);
+    }
+}
+
+TEST(MathBatchTest, MultiplyMatricesSupportsAliasing) {
+    constexpr size_t count = 5;
+    std::vector<Matrix4> lhs, rhs, expected;
+    for (size_t i = 0; i < count; ++i) {
+        lhs.push_back(MakeMatrix(static_cast<float>(i)));
+        rhs.push_back(MakeMatrix(static_cast<float>(i) + 10.0f));
+        expected.push_back(ReferenceMultiply(lhs.back(), rhs.back()));
+    }
+
+    std::vector<Matrix4> out = rhs;
+    Zgine::Math::MultiplyMatrices(lhs.data(), out.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        ExpectMatrixNear(out[i], expected[i], 1e-4f);
+    }
+
+    const Matrix4 parent = MakeMatrix(42.0f);
+    out = rhs;
+    Zgine::Math::MultiplyMatrices(parent, out.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        ExpectMatrixNear(out[i], ReferenceMultiply(parent, rhs[i]), 1e-4f);
+    }
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <Zgine/Resources/Mesh/MeshOptimizer.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <set>
+#include <tuple>
+
+using namespace Zgine;
+
+namespace {
+
+// Flat n x n quad grid in the XZ plane, triangles in row order.
+MeshData MakeGrid(uint32_t n) {
+    MeshData data;
+    for (uint32_t z = 0; z <= n; ++z) {
+        for (uint32_t x = 0; x <= n; ++x) {
+            Vertex vertex{};
+            vertex.Position = Math::Vector3(static_cast<float>(x), 0.0f, static_cast<float>(z));
+            vertex.Normal = Math::Vector3(0.0f, 1.0f, 0.0f);
+            data.Vertices.push_back(vertex);
+        }
+    }
+    for (uint32_t z = 0; z < n; ++z) {
+        for (uint32_t x = 0; x < n; ++x) {
+            const unsigned int i = z * (n + 1) + x;
+            data.Indices.insert(data.Indices.end(), { i, i + n + 1, i + 1, i + 1, i + n + 1, i + n + 2 });
+        }
+    }
+    return data;
+}
+
+// Triangles as position triples, rotated to a canonical first corner.
+std::multiset<std::array<float, 9>> Triangles(const MeshData& data, size_t first, size_t count) {
+    std::multiset<std::array<float, 9>> triangles;
+    for (size_t i = first; i < first + count; i += 3) {
+        std::array<const Vertex*, 3> corners = { &data.Vertices[data.Indices[i]], &data.Vertices[data.Indices[i + 1]],
+                                                 &data.Vertices[data.Indices[i + 2]] };
+        const auto less = [](const Vertex* a, const Vertex* b) {
+            return std::tie(a->Position.x, a->Position.y, a->Position.z)
+                 < std::tie(b->Position.x, b->Position.y, b->Position.z);
+        };
+        std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end(), less), corners.end());
+        std::array<float, 9> key{};
+        for (size_t k = 0; k < 3; ++k) {
+            key[k * 3] = corners[k]->Position.x;
+            key[k * 3 + 1] = corners[k]->Position.y;
+            key[k * 3 + 2] = corners[k]->Position.z;
+        }
+        triangles.insert(key);
+    }
+    return triangles;
+}
+
+} // namespace
+
+TEST(MeshOptimizerTest, WeldMergesIdenticalVertices) {
+    MeshData data = MakeGrid(2);
+    // Unshare the grid: every index gets its own copy of the vertex.
+    MeshData split;
+    for (unsigned int index : data.Indices) {
+        split.Indices.push_back(static_cast<unsigned int>(split.Vertices.size()));
+        split.Vertices.push_back(data.Vertices[index]);
+    }
+    const auto before = Triangles(split, 0, split.Indices.size());
+
+    EXPECT_EQ(MeshOptimizer::WeldVertices(split), 24u - 9u);
+    EXPECT_EQ(split.Vertices.size(), 9u);
+    EXPECT_EQ(Triangles(split, 0, split.Indices.size()), before);
+}
+
+TEST(MeshOptimizerTest, ReorderingKeepsTrianglesAndImprovesCacheUse) {
+    MeshData data = MakeGrid(32);
+    // Shuffle the triangles so the starting order has no locality.
+    const size_t triangleCount = data.Indices.size() / 3;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const size_t other = (t * 7919) % triangleCount;
+        std::swap_ranges(data.Indices.begin() + t * 3, data.Indices.begin() + t * 3 + 3,
+                         data.Indices.begin() + other * 3);
+    }
+    const auto before = Triangles(data, 0, data.Indices.size());
+    const float acmrBefore = MeshOptimizer::AnalyzeVertexCache(data.Indices.data(), data.Indices.size(),
+                                                               data.Vertices.size());
+
+    MeshOptimizer::OptimizeVertexCache(data.Indices.data(), data.Indices.size(), data.Vertices.size());
+    const float acmrAfter = MeshOptimizer::AnalyzeVertexCache(data.Indices.data(), data.Indices.size(),
+                                                              data.Vertices.size());
+    EXPECT_LT(acmrAfter, acmrBefore * 0.5f);
+    EXPECT_LT(acmrAfter, 1.0f);
+
+    MeshOptimizer::OptimizeOverdraw(data.Indices.data(), data.Indices.size(), data.Vertices, 1.05f);
+    MeshOptimizer::OptimizeVertexFetch(data);
+    EXPECT_EQ(Triangles(data, 0, data.Indices.size()), before);
+
+    // Fetch order: vertices are numbered by first use.
+    unsigned int next = 0;
+    for (unsigned int index : data.Indices) {
+        ASSERT_LE(index, next);
+        next = std::max(next, index + 1);
+    }
+}
+
+TEST(MeshOptimizerTest, SimplifyCollapsesFlatInteriorAndKeepsBorder) {
+    const MeshData data = MakeGrid(8);
+    float error = 1.0f;
+    const std::vector<unsigned int> lod = MeshOptimizer::Simplify(data.Vertices, data.Indices, 24, 0.01f, &error);
+
+    EXPECT_LT(lod.size(), data.Indices.size() / 2);
+    EXPECT_EQ(lod.size() % 3, 0u);
+    EXPECT_LT(error, 0.01f);
+
+    // A flat grid keeps its area: the border stays where it is.
+    float area = 0.0f;
+    for (size_t i = 0; i < lod.size(); i += 3) {
+        const Math::Vector3& a = data.Vertices[lod[i]].Position;
+        const Math::Vector3& b = data.Vertices[lod[i + 1]].Position;
+        const Math::Vector3& c = data.Vertices[lod[i + 2]].Position;
+        const float cross = (b.x - a.x) * (c.z - a.z) - (b.z - a.z) * (c.x - a.x);
+        EXPECT_LT(cross, 0.0f) << "triangle " << i / 3 << " flipped";
+        area += std::abs(cross) * 0.5f;
+    }
+    EXPECT_NEAR(area, 64.0f, 1e-3f);
+}
+
+TEST(MeshOptimizerTest, LodChainShrinksAndMeshSelectsByScreenSize) {
+    MeshData data = MakeGrid(16);
+    const size_t fullCount = data.Indices.size();
+    MeshOptimizer::BuildLodChain(data, 4, 0.5f, 0.01f, 0.4f);
+
+    ASSERT_GE(data.Lods.size(), 2u);
+    EXPECT_EQ(data.Lods[0].FirstIndex, 0u);
+    EXPECT_EQ(data.Lods[0].IndexCount, fullCount);
+    for (size_t i = 1; i < data.Lods.size(); ++i) {
+        EXPECT_EQ(data.Lods[i].FirstIndex, data.Lods[i - 1].FirstIndex + data.Lods[i - 1].IndexCount);
+        EXPECT_LT(data.Lods[i].IndexCount, data.Lods[i - 1].IndexCount);
+        EXPECT_LT(data.Lods[i].ScreenSize, data.Lods[i - 1].ScreenSize);
+    }
+    EXPECT_FLOAT_EQ(data.Lods[0].ScreenSize, 0.4f);
+    EXPECT_EQ(data.Lods.back().ScreenSize, 0.0f);
+    EXPECT_EQ(data.Indices.size(), data.Lods.back().FirstIndex + data.Lods.back().IndexCount);
+
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::None);
+    {
+        const Mesh mesh(data);
+        ASSERT_EQ(mesh.GetLodCount(), data.Lods.size());
+        EXPECT_EQ(mesh.SelectLod(1.0f), 0u);
+        EXPECT_EQ(mesh.SelectLod(0.4f), 0u);
+        EXPECT_EQ(mesh.SelectLod(0.39f), 1u);
+        EXPECT_EQ(mesh.SelectLod(0.0f), mesh.GetLodCount() - 1);
+        EXPECT_EQ(mesh.GetLodRange(1).IndexCount, data.Lods[1].IndexCount);
+
+        MeshData plain = MakeGrid(1);
+        const Mesh single(plain);
+        EXPECT_EQ(single.GetLodCount(), 1u);
+        EXPECT_EQ(single.SelectLod(0.0f), 0u);
+        EXPECT_EQ(single.GetLodRange(3).IndexCount, 6u);
+    }
+    RendererAPI::SetAPI(previous);
+}
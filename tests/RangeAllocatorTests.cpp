@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <Zgine/Core/Memory/RangeAllocator.h>
+
+using Zgine::RangeAllocator;
+
+TEST(RangeAllocatorTest, AllocatesFirstFitAndReportsExhaustion) {
+    RangeAllocator allocator(100);
+
+    EXPECT_EQ(allocator.Allocate(40), 0u);
+    EXPECT_EQ(allocator.Allocate(40), 40u);
+    EXPECT_EQ(allocator.GetUsed(), 80u);
+    EXPECT_EQ(allocator.Allocate(30), RangeAllocator::kInvalidOffset);
+    EXPECT_EQ(allocator.Allocate(0), RangeAllocator::kInvalidOffset);
+    EXPECT_EQ(allocator.Allocate(20), 80u);
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 0u);
+
+    // A freed hole is reused before anything later.
+    allocator.Free(0, 40);
+    EXPECT_EQ(allocator.Allocate(10), 0u);
+    EXPECT_EQ(allocator.Allocate(30), 10u);
+}
+
+TEST(RangeAllocatorTest, FreeCoalescesNeighbours) {
+    RangeAllocator allocator(90);
+    const uint32_t a = allocator.Allocate(30);
+    const uint32_t b = allocator.Allocate(30);
+    const uint32_t c = allocator.Allocate(30);
+
+    allocator.Free(a, 30);
+    allocator.Free(c, 30);
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 2u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 30u);
+    EXPECT_EQ(allocator.Allocate(60), RangeAllocator::kInvalidOffset);
+
+    // Freeing the middle joins all three into the original block.
+    allocator.Free(b, 30);
+    EXPECT_EQ(allocator.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 90u);
+    EXPECT_EQ(allocator.GetUsed(), 0u);
+    EXPECT_EQ(allocator.Allocate(90), 0u);
+
+    allocator.Reset(10);
+    EXPECT_EQ(allocator.GetCapacity(), 10u);
+    EXPECT_EQ(allocator.GetUsed(), 0u);
+    EXPECT_EQ(allocator.Allocate(10), 0u);
+}
@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+#include <Zgine/Renderer/Pipeline/RenderQueue.h>
+#include <Zgine/Renderer/RHI/RecordingRendererAPI.h>
+#include <Zgine/Renderer/RHI/Shader.h>
+#include <Zgine/Renderer/RHI/VertexArray.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+class FakeShader final : public Zgine::Shader {
+public:
+    void Bind() const override {}
+    void Unbind() const override {}
+    void SetUniform1i(const std::string&, int) override {}
+    void SetUniform1f(const std::string&, float) override {}
+    void SetUniform2f(const std::string&, float, float) override {}
+    void SetUniform3f(const std::string&, float, float, float) override {}
+    void SetUniform4f(const std::string&, float, float, float, float) override {}
+    void SetUniformMat3f(const std::string&, const Zgine::Math::Matrix3&) override {}
+    void SetUniformMat4f(const std::string&, const Zgine::Math::Matrix4&) override {}
+    void SetUniformBlockBinding(const std::string&, uint32_t) override {}
+    uint32_t GetID() const override { return 0; }
+    bool IsReady() const override { return true; }
+};
+
+class FakeVertexArray final : public Zgine::VertexArray {
+public:
+    void Bind() const override {}
+    void Unbind() const override {}
+    void AddVertexBuffer(const std::shared_ptr<Zgine::VertexBuffer>&) override {}
+    void SetIndexBuffer(const std::shared_ptr<Zgine::IndexBuffer>&) override {}
+    void SetInstanceBuffer(const std::shared_ptr<Zgine::VertexBuffer>&, uint32_t) override {}
+    uint32_t GetID() const override { return 0; }
+    const std::shared_ptr<Zgine::IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+private:
+    std::shared_ptr<Zgine::IndexBuffer> m_IndexBuffer;
+};
+
+struct CountingHooks {
+    std::vector<uint32_t> Materials;
+    std::vector<uint32_t> Instances; // entity ids in upload order
+    std::vector<uint32_t> Batches;   // first instance of each batch
+
+    void OnInstances(const Zgine::InstanceData* data, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            Instances.push_back(static_cast<uint32_t>(data[i].Transform(0, 3)));
+        }
+    }
+    void OnShader(Zgine::Shader&) {}
+    void OnMaterial(Zgine::Shader&, uint32_t material) { Materials.push_back(material); }
+    void OnBatch(Zgine::VertexArray&, uint32_t firstInstance) { Batches.push_back(firstInstance); }
+};
+
+} // namespace
+
+TEST(RenderQueueTest, SortKeyOrdersPassStateThenDepth) {
+    using Zgine::RenderPass;
+    namespace SortKey = Zgine::SortKey;
+
+    const uint32_t near = SortKey::QuantizeDepth(1.0f);
+    const uint32_t far = SortKey::QuantizeDepth(100.0f);
+    EXPECT_LT(near, far);
+    EXPECT_EQ(SortKey::QuantizeDepth(-5.0f), 0u);
+    EXPECT_LT(SortKey::QuantizeDepth(0.5f), near);
+
+    // Pass beats everything, then shader, material, mesh, and depth last.
+    EXPECT_LT(SortKey::Encode(RenderPass::Shadow, 255, 9, 9, far), SortKey::Encode(RenderPass::Opaque, 0, 0, 0, 0));
+    EXPECT_LT(SortKey::Encode(RenderPass::Opaque, 0, 9, 9, far), SortKey::Encode(RenderPass::Opaque, 1, 0, 0, 0));
+    EXPECT_LT(SortKey::Encode(RenderPass::Opaque, 1, 0, 9, far), SortKey::Encode(RenderPass::Opaque, 1, 1, 0, 0));
+    EXPECT_LT(SortKey::Encode(RenderPass::Opaque, 1, 1, 0, far), SortKey::Encode(RenderPass::Opaque, 1, 1, 1, 0));
+    EXPECT_LT(SortKey::Encode(RenderPass::Opaque, 1, 1, 1, near), SortKey::Encode(RenderPass::Opaque, 1, 1, 1, far));
+
+    const uint64_t key = SortKey::Encode(RenderPass::Opaque, 3, 1234, 7, near);
+    EXPECT_EQ(SortKey::GetPass(key), RenderPass::Opaque);
+    EXPECT_EQ(SortKey::GetMaterial(key), 1234u);
+}
+
+TEST(RenderQueueTest, RadixSortMatchesStableSort) {
+    std::mt19937_64 rng(7);
+    for (size_t count : {0u, 1u, 2u, 17u, 1000u, 5000u}) {
+        std::vector<Zgine::DrawPacket> packets(count);
+        for (size_t i = 0; i < count; ++i) {
+            // Few distinct values in the high fields, so some byte passes are skipped.
+            const uint64_t key = Zgine::SortKey::Encode(Zgine::RenderPass::Opaque,
+                static_cast<uint32_t>(rng() % 2), static_cast<uint32_t>(rng() % 40),
+                static_cast<uint32_t>(rng() % 5), static_cast<uint32_t>(rng() % 64));
+            packets[i] = Zgine::DrawPacket{key, static_cast<uint32_t>(i)};
+        }
+
+        std::vector<Zgine::DrawPacket> expected = packets;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](const Zgine::DrawPacket& a, const Zgine::DrawPacket& b) { return a.Key < b.Key; });
+
+        std::vector<Zgine::DrawPacket> scratch;
+        Zgine::SortDrawPackets(packets, scratch);
+        ASSERT_EQ(packets.size(), expected.size());
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(packets[i].Key, expected[i].Key);
+            EXPECT_EQ(packets[i].Item, expected[i].Item); // stable
+        }
+    }
+}
+
+TEST(RenderQueueTest, ExecuteBatchesInstancesAndSkipsRedundantBinds) {
+    FakeShader shaderA;
+    FakeShader shaderB;
+    FakeVertexArray cube;
+    FakeVertexArray sphere;
+    Zgine::Shader* shaders[] = {&shaderA, &shaderB};
+    Zgine::VertexArray* meshes[] = {&cube, &sphere};
+
+    // 2 shaders x 3 materials x 2 meshes x 4 instances, pushed in a scrambled order.
+    Zgine::RenderQueue queue;
+    uint32_t entity = 0;
+    for (uint32_t instance = 0; instance < 4; ++instance) {
+        for (uint32_t mesh = 0; mesh < 2; ++mesh) {
+            for (uint32_t material = 0; material < 3; ++material) {
+                for (uint32_t shader = 0; shader < 2; ++shader) {
+                    Zgine::DrawItem item;
+                    item.ShaderProgram = shaders[shader];
+                    item.Mesh = meshes[mesh];
+                    item.Material = material;
+                    item.IndexCount = 36;
+                    item.Entity = entity;
+                    item.Instance.Transform(0, 3) = static_cast<float>(entity++);
+                    queue.Push(Zgine::SortKey::Encode(Zgine::RenderPass::Opaque, shader, material, mesh,
+                        Zgine::SortKey::QuantizeDepth(10.0f - static_cast<float>(instance))), item);
+                }
+            }
+        }
+    }
+    queue.Sort();
+
+    Zgine::RecordingRendererAPI api;
+    Zgine::RenderStats stats;
+    CountingHooks hooks;
+    queue.Execute(api, stats, hooks);
+
+    using Type = Zgine::RecordedCommand::Type;
+    // One instanced draw per shader/material/mesh bucket.
+    EXPECT_EQ(stats.DrawCalls, 12u);
+    EXPECT_EQ(stats.Instances, 48u);
+    EXPECT_EQ(stats.Triangles, 48u * 12u);
+    EXPECT_EQ(stats.ShaderBinds, 2u);
+    EXPECT_EQ(stats.MaterialBinds, 6u);
+    EXPECT_EQ(stats.MeshBinds, 12u);
+    EXPECT_EQ(stats.GetStateChanges(), 20u);
+    EXPECT_EQ(api.CountCommands(Type::BindShader), 2u);
+    EXPECT_EQ(api.CountCommands(Type::BindVertexArray), 13u); // plus the final unbind
+    EXPECT_EQ(api.CountCommands(Type::DrawBound), 12u);
+    EXPECT_EQ(hooks.Materials, (std::vector<uint32_t>{0, 1, 2, 0, 1, 2}));
+    ASSERT_EQ(hooks.Batches.size(), 12u);
+    for (uint32_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(hooks.Batches[i], i * 4);
+    }
+
+    // Within one state bucket, nearest first.
+    const auto& commands = api.GetCommands();
+    ASSERT_EQ(commands.front().Kind, Type::BindShader);
+    EXPECT_EQ(commands.front().Object, &shaderA);
+    EXPECT_EQ(commands.back().Kind, Type::BindVertexArray);
+    EXPECT_EQ(commands.back().Object, nullptr);
+    for (const auto& command : commands) {
+        if (command.Kind == Type::DrawBound) {
+            EXPECT_EQ(command.Count, 36u);
+            EXPECT_EQ(command.Instances, 4u);
+        }
+    }
+    ASSERT_EQ(hooks.Instances.size(), 48u);
+    for (size_t i = 0; i + 1 < 4; ++i) {
+        EXPECT_GT(hooks.Instances[i], hooks.Instances[i + 1]); // later instances are closer
+    }
+}
+
+TEST(RenderQueueTest, PartitionKeepsBatchesWhole) {
+    FakeShader shader;
+    FakeVertexArray mesh;
+
+    // Batches of 1..7 instances: material i has i % 7 + 1 draws.
+    Zgine::RenderQueue queue;
+    uint32_t packets = 0;
+    for (uint32_t material = 0; material < 40; ++material) {
+        for (uint32_t instance = 0; instance <= material % 7; ++instance) {
+            Zgine::DrawItem item;
+            item.ShaderProgram = &shader;
+            item.Mesh = &mesh;
+            item.Material = material;
+            item.IndexCount = 36;
+            queue.Push(Zgine::SortKey::Encode(Zgine::RenderPass::Opaque, 0, material, 0, instance), item);
+            ++packets;
+        }
+    }
+    queue.Sort();
+
+    std::vector<Zgine::PacketRange> ranges;
+    for (uint32_t maxRanges : {1u, 3u, 8u, 1000u}) {
+        queue.Partition(maxRanges, ranges);
+        ASSERT_FALSE(ranges.empty());
+        EXPECT_LE(ranges.size(), std::min(maxRanges, packets));
+        EXPECT_EQ(ranges.front().Begin, 0u);
+        EXPECT_EQ(ranges.back().End, packets);
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            EXPECT_LT(ranges[i].Begin, ranges[i].End);
+            if (i > 0) {
+                EXPECT_EQ(ranges[i].Begin, ranges[i - 1].End);
+            }
+            // A range never starts inside a batch.
+            const auto& packetList = queue.GetPackets();
+            if (ranges[i].Begin > 0) {
+                EXPECT_NE(queue.GetItem(packetList[ranges[i].Begin - 1]).Material,
+                          queue.GetItem(packetList[ranges[i].Begin]).Material);
+            }
+        }
+    }
+
+    // With more ranges than batches every batch gets its own range.
+    queue.Partition(1000, ranges);
+    EXPECT_EQ(ranges.size(), 40u);
+
+    Zgine::RenderQueue empty;
+    empty.Partition(4, ranges);
+    EXPECT_TRUE(ranges.empty());
+}
+
+TEST(RenderQueueTest, ArenaMeshesShareOneVertexArray) {
+    FakeShader shader;
+    FakeVertexArray page;
+
+    // Two meshes sub-allocated from one page, three instances each.
+    struct Range { uint32_t IndexCount, FirstIndex; int32_t BaseVertex; };
+    const Range meshes[] = { { 36, 0, 0 }, { 60, 36, 24 } };
+
+    Zgine::RenderQueue queue;
+    for (uint32_t mesh = 0; mesh < 2; ++mesh) {
+        for (uint32_t instance = 0; instance < 3; ++instance) {
+            Zgine::DrawItem item;
+            item.ShaderProgram = &shader;
+            item.Mesh = &page;
+            item.IndexCount = meshes[mesh].IndexCount;
+            item.FirstIndex = meshes[mesh].FirstIndex;
+            item.BaseVertex = meshes[mesh].BaseVertex;
+            queue.Push(Zgine::SortKey::Encode(Zgine::RenderPass::Opaque, 0, 0, mesh, instance), item);
+        }
+    }
+    queue.Sort();
+
+    Zgine::RecordingRendererAPI api;
+    Zgine::RenderStats stats;
+    CountingHooks hooks;
+    queue.Execute(api, stats, hooks);
+
+    using Type = Zgine::RecordedCommand::Type;
+    EXPECT_EQ(stats.DrawCalls, 2u);
+    EXPECT_EQ(stats.MeshBinds, 1u);
+    EXPECT_EQ(stats.Triangles, 3u * (12u + 20u));
+    std::vector<Zgine::RecordedCommand> draws;
+    for (const auto& command : api.GetCommands()) {
+        if (command.Kind == Type::DrawBound) {
+            draws.push_back(command);
+        }
+    }
+    ASSERT_EQ(draws.size(), 2u);
+    for (size_t i = 0; i < 2; ++i) {
+        EXPECT_EQ(draws[i].Count, meshes[i].IndexCount);
+        EXPECT_EQ(draws[i].Instances, 3u);
+        EXPECT_EQ(draws[i].FirstIndex, meshes[i].FirstIndex);
+        EXPECT_EQ(draws[i].BaseVertex, meshes[i].BaseVertex);
+    }
+}
+
+TEST(RenderQueueTest, InstanceLayoutMatchesInstanceData) {
+    const Zgine::BufferLayout layout = Zgine::InstanceData::GetLayout();
+
+    EXPECT_TRUE(layout.IsPerInstance());
+    EXPECT_EQ(layout.GetStride(), sizeof(Zgine::InstanceData));
+    EXPECT_EQ(layout.GetAttributeCount(), 4u + 3u + 1u + 1u);
+    ASSERT_EQ(layout.GetElements().size(), 4u);
+    EXPECT_EQ(layout.GetElements()[0].Offset, offsetof(Zgine::InstanceData, Transform));
+    EXPECT_EQ(layout.GetElements()[1].Offset, offsetof(Zgine::InstanceData, NormalMatrix));
+    EXPECT_EQ(layout.GetElements()[2].Offset, offsetof(Zgine::InstanceData, Material));
+    EXPECT_EQ(layout.GetElements()[3].Offset, offsetof(Zgine::InstanceData, Surface));
+}
@@ -1,12 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <Zgine/Renderer/Lighting/LightClusters.h>
+#include <Zgine/Renderer/Pipeline/UniformBlocks.h>
 #include <Zgine/Renderer/RHI/BufferLayout.h>
 #include <Zgine/Renderer/RHI/IndexBuffer.h>
 #include <Zgine/Renderer/RHI/RendererAPI.h>
+#include <Zgine/Renderer/RHI/TextureBuffer.h>
+#include <Zgine/Renderer/RHI/UniformBuffer.h>
 #include <Zgine/Renderer/RHI/VertexBuffer.h>
 #include <Zgine/Renderer/RHI/VertexArray.h>
 
 #include <array>
+#include <cstddef>
 
 namespace {
 
@@ -77,9 +82,46 @@ TEST(RendererBackendTest, UnsupportedBackendFactoriesFailExplicitly) {
 
         EXPECT_EQ(Zgine::RendererAPI::Create(), nullptr);
         EXPECT_EQ(Zgine::VertexArray::Create(), nullptr);
+        EXPECT_EQ(Zgine::UniformBuffer::Create(sizeof(Zgine::CameraBlock), Zgine::UniformBinding::Camera), nullptr);
+        EXPECT_EQ(Zgine::TextureBuffer::Create(Zgine::TextureBufferFormat::RGBA32F, 1024), nullptr);
     }
 }
 
+TEST(RendererBackendTest, UniformBlocksFollowStd140Layout) {
+    // Offsets the GLSL blocks in assets/shaders get under std140.
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, CameraPosition), 64u);
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, EnableShadows), 76u);
+
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, ViewDepth), 80u);
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, ClusterDims), 96u);
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, ClusterDepth), 112u);
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, CascadeSplits), 128u);
+    EXPECT_EQ(offsetof(Zgine::CameraBlock, CascadeMatrices), 144u);
+
+    EXPECT_EQ(offsetof(Zgine::LightsBlock, Directional), 0u);
+    EXPECT_EQ(offsetof(Zgine::DirectionalLightBlock, Color), 16u);
+
+    // Texel layout the shaders fetch cluster lights with.
+    EXPECT_EQ(offsetof(Zgine::ClusterLight, Range), 12u);
+    EXPECT_EQ(offsetof(Zgine::ClusterLight, Type), 28u);
+    EXPECT_EQ(offsetof(Zgine::ClusterLight, CutOff), 44u);
+    EXPECT_EQ(offsetof(Zgine::ClusterLight, OuterCutOff), 60u);
+
+    EXPECT_EQ(offsetof(Zgine::MaterialBlock, UseAOMap), 16u);
+}
+
+TEST(RendererBackendTest, LightsBlockPremultipliesDirectionalIntensity) {
+    Zgine::LightingData lights{};
+    lights.directional.direction = Zgine::Math::Vector3(0.0f, -1.0f, 0.0f);
+    lights.directional.color = Zgine::Math::Vector3(1.0f, 0.5f, 0.25f);
+    lights.directional.intensity = 2.0f;
+
+    const Zgine::LightsBlock block = Zgine::MakeLightsBlock(lights);
+    EXPECT_FLOAT_EQ(block.Directional.Direction[1], -1.0f);
+    EXPECT_FLOAT_EQ(block.Directional.Color[0], 2.0f);
+    EXPECT_FLOAT_EQ(block.Directional.Color[2], 0.5f);
+}
+
 #if ZGINE_HAS_VULKAN
 TEST(RendererBackendTest, VulkanRendererAPIFactoryIsAvailableWhenSDKIsPresent) {
     RendererAPIGuard guard;
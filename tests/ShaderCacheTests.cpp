@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <Zgine/Renderer/Pipeline/ShaderSources.h>
+#include <Zgine/Renderer/RHI/ShaderCache.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+using Zgine::ShaderCache;
+
+constexpr const char* kDriver = "Vendor|Renderer|4.6";
+
+class ShaderCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+        m_Directory = std::filesystem::temp_directory_path() /
+            ("zgine-shader-cache-test-" + std::to_string(unique));
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Directory, ec);
+    }
+
+    static ShaderCache::Entry MakeEntry() {
+        ShaderCache::Entry entry;
+        entry.Format = 0x1234;
+        entry.Binary = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        return entry;
+    }
+
+    std::filesystem::path m_Directory;
+};
+
+TEST(ShaderCacheKeyTest, ChangesWithSourcesAndDriver) {
+    const uint64_t key = ShaderCache::ComputeKey({ "vert", "frag" }, kDriver);
+
+    EXPECT_EQ(ShaderCache::ComputeKey({ "vert", "frag" }, kDriver), key);
+    EXPECT_NE(ShaderCache::ComputeKey({ "vert", "frag2" }, kDriver), key);
+    EXPECT_NE(ShaderCache::ComputeKey({ "#define A\nvert", "frag" }, kDriver), key);
+    EXPECT_NE(ShaderCache::ComputeKey({ "vert", "frag" }, "Vendor|Renderer|4.5"), key);
+    // Stage boundaries are part of the key.
+    EXPECT_NE(ShaderCache::ComputeKey({ "ver", "tfrag" }, kDriver), key);
+    EXPECT_NE(ShaderCache::ComputeKey({ "frag", "vert" }, kDriver), key);
+}
+
+TEST_F(ShaderCacheTest, StoresAndLoadsEntries) {
+    ShaderCache cache(m_Directory);
+    const uint64_t key = ShaderCache::ComputeKey({ "vert", "frag" }, kDriver);
+
+    ShaderCache::Entry loaded;
+    EXPECT_FALSE(cache.Load(key, loaded));
+    ASSERT_TRUE(cache.Store(key, MakeEntry()));
+
+    // A new cache over the same directory sees the entry, as on the next run.
+    ShaderCache warm(m_Directory);
+    ASSERT_TRUE(warm.Load(key, loaded));
+    EXPECT_EQ(loaded.Format, MakeEntry().Format);
+    EXPECT_EQ(loaded.Binary, MakeEntry().Binary);
+    EXPECT_EQ(warm.GetHitCount(), 1u);
+    EXPECT_EQ(cache.GetMissCount(), 1u);
+
+    warm.Remove(key);
+    EXPECT_FALSE(warm.Load(key, loaded));
+}
+
+TEST_F(ShaderCacheTest, RejectsCorruptAndMisplacedEntries) {
+    ShaderCache cache(m_Directory);
+    const uint64_t key = 42;
+    const uint64_t otherKey = 43;
+    ASSERT_TRUE(cache.Store(key, MakeEntry()));
+
+    // An entry copied under another key's name is not trusted.
+    std::filesystem::copy_file(cache.GetEntryPath(key), cache.GetEntryPath(otherKey));
+    ShaderCache::Entry loaded;
+    EXPECT_FALSE(cache.Load(otherKey, loaded));
+
+    // Flip the last payload byte.
+    {
+        std::fstream file(cache.GetEntryPath(key), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(0xFF));
+    }
+    EXPECT_FALSE(cache.Load(key, loaded));
+
+    // Truncated files are misses too.
+    std::filesystem::resize_file(cache.GetEntryPath(key), 8);
+    EXPECT_FALSE(cache.Load(key, loaded));
+}
+
+TEST(ShaderSourceTest, PreprocessingMakesKeysLineEndingIndependent) {
+    const std::string normalized = "#version 330 core\nvoid main() {}\n";
+    EXPECT_EQ(Zgine::PreprocessShaderSource(normalized), normalized);
+    EXPECT_EQ(Zgine::PreprocessShaderSource("#version 330 core\r\nvoid main() {}\r\n"), normalized);
+    EXPECT_EQ(Zgine::PreprocessShaderSource("\xEF\xBB\xBF#version 330 core\rvoid main() {}\r"), normalized);
+    EXPECT_EQ(Zgine::PreprocessShaderSource(""), "");
+
+    EXPECT_EQ(ShaderCache::ComputeKey({ Zgine::PreprocessShaderSource("a\r\nb") }, kDriver),
+              ShaderCache::ComputeKey({ "a\nb" }, kDriver));
+}
+
+} // namespace
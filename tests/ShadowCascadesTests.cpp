@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <Zgine/Renderer/Lighting/ShadowCascades.h>
+#include <Zgine/Core/Math/Math.h>
+#include <Zgine/Core/Math/Matrix4.h>
+#include <Zgine/Core/Math/Vector4.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+namespace {
+
+using Zgine::Math::Matrix4;
+using Zgine::Math::Vector3;
+using Zgine::Math::Vector4;
+
+constexpr float kNear = 0.1f;
+constexpr float kFar = 500.0f;
+constexpr float kFovY = 60.0f;
+constexpr float kAspect = 16.0f / 9.0f;
+
+using Cascades = std::array<Zgine::ShadowCascade, Zgine::kMaxShadowCascades>;
+
+Matrix4 MakeProjection() {
+    return Matrix4::Perspective(Zgine::Math::DegToRad(kFovY), kAspect, kNear, kFar);
+}
+
+// A camera at @p eye looking down -Z, so view space is world space shifted by eye.
+Matrix4 MakeView(const Vector3& eye) {
+    return Matrix4::LookAt(eye, Vector3(eye.x, eye.y, eye.z - 1.0f), Vector3(0.0f, 1.0f, 0.0f));
+}
+
+Vector3 LightDirection() {
+    return Vector3(0.3f, -1.0f, -0.4f);
+}
+
+uint32_t Fit(const Zgine::ShadowCascadeSettings& settings, const Vector3& eye, Cascades& cascades) {
+    return Zgine::FitShadowCascades(settings, MakeView(eye), MakeProjection(), kNear, kFar, LightDirection(), cascades);
+}
+
+bool InsideClip(const Matrix4& viewProjection, const Vector3& world, float epsilon = 1e-4f) {
+    const Vector4 clip = viewProjection * Vector4(world.x, world.y, world.z, 1.0f);
+    return std::abs(clip.x) <= clip.w + epsilon && std::abs(clip.y) <= clip.w + epsilon
+        && std::abs(clip.z) <= clip.w + epsilon;
+}
+
+} // namespace
+
+TEST(ShadowCascadesTest, SplitsBlendUniformAndLogarithmic) {
+    EXPECT_FLOAT_EQ(Zgine::ComputeCascadeSplit(3, 4, 1.0f, 100.0f, 0.5f), 100.0f);
+    EXPECT_FLOAT_EQ(Zgine::ComputeCascadeSplit(0, 4, 1.0f, 101.0f, 0.0f), 26.0f);
+    EXPECT_NEAR(Zgine::ComputeCascadeSplit(1, 4, 1.0f, 10000.0f, 1.0f), 100.0f, 1e-2f);
+
+    float previous = 1.0f;
+    for (uint32_t i = 0; i < 4; ++i) {
+        const float split = Zgine::ComputeCascadeSplit(i, 4, 1.0f, 100.0f, 0.75f);
+        EXPECT_GT(split, previous);
+        previous = split;
+    }
+}
+
+TEST(ShadowCascadesTest, CascadesCoverTheirFrustumSlices) {
+    Zgine::ShadowCascadeSettings settings;
+    Cascades cascades;
+    const Vector3 eye(3.0f, 2.0f, 7.0f);
+    ASSERT_EQ(Fit(settings, eye, cascades), 4u);
+
+    EXPECT_FLOAT_EQ(cascades[0].SplitNear, kNear);
+    EXPECT_FLOAT_EQ(cascades[3].SplitFar, settings.MaxDistance);
+
+    // Random points of each slice, built in view space and moved to the eye.
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> fraction(0.0f, 1.0f);
+    const float tanY = std::tan(Zgine::Math::DegToRad(kFovY) * 0.5f);
+    for (uint32_t c = 0; c < 4; ++c) {
+        const Zgine::ShadowCascade& cascade = cascades[c];
+        if (c > 0) {
+            EXPECT_FLOAT_EQ(cascade.SplitNear, cascades[c - 1].SplitFar);
+            EXPECT_GT(cascade.Radius, cascades[c - 1].Radius);
+        }
+        for (int i = 0; i < 500; ++i) {
+            const float depth = cascade.SplitNear + (cascade.SplitFar - cascade.SplitNear) * fraction(rng);
+            const Vector3 point(eye.x + unit(rng) * depth * tanY * kAspect, eye.y + unit(rng) * depth * tanY, eye.z - depth);
+            EXPECT_TRUE(InsideClip(cascade.ViewProjection, point)) << "cascade " << c << " misses a point at depth " << depth;
+        }
+    }
+}
+
+TEST(ShadowCascadesTest, CastersTowardsTheLightStayInTheMap) {
+    Zgine::ShadowCascadeSettings settings;
+    settings.CasterDistance = 40.0f;
+    Cascades cascades;
+    Fit(settings, Vector3(0.0f), cascades);
+
+    const Vector3 direction = Zgine::Math::Normalize(LightDirection());
+    for (const Zgine::ShadowCascade& cascade : cascades) {
+        const Vector3 caster = cascade.Center - direction * (cascade.Radius + settings.CasterDistance * 0.9f);
+        EXPECT_TRUE(InsideClip(cascade.ViewProjection, caster));
+        const Vector3 tooFar = cascade.Center - direction * (cascade.Radius + settings.CasterDistance * 1.1f);
+        EXPECT_FALSE(InsideClip(cascade.ViewProjection, tooFar));
+    }
+}
+
+TEST(ShadowCascadesTest, CascadesAreStableUnderCameraMotion) {
+    Zgine::ShadowCascadeSettings settings;
+    settings.Resolution = 1024;
+    Cascades still;
+    Fit(settings, Vector3(0.0f, 2.0f, 0.0f), still);
+
+    // Turning the camera keeps every cascade the same size.
+    Cascades turned;
+    const Matrix4 turnedView = Matrix4::LookAt(Vector3(0.0f, 2.0f, 0.0f), Vector3(1.0f, 2.0f, -0.2f), Vector3(0.0f, 1.0f, 0.0f));
+    Zgine::FitShadowCascades(settings, turnedView, MakeProjection(), kNear, kFar, LightDirection(), turned);
+    for (uint32_t c = 0; c < 4; ++c) {
+        EXPECT_FLOAT_EQ(turned[c].Radius, still[c].Radius);
+    }
+
+    // Moving it shifts the map by whole texels: the world origin stays on a texel corner.
+    Cascades moved;
+    Fit(settings, Vector3(0.37f, 2.11f, -1.53f), moved);
+    const float halfResolution = static_cast<float>(settings.Resolution) * 0.5f;
+    for (uint32_t c = 0; c < 4; ++c) {
+        EXPECT_FLOAT_EQ(moved[c].Radius, still[c].Radius);
+        const Vector4 origin = moved[c].ViewProjection * Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+        const float texelX = origin.x * halfResolution;
+        const float texelY = origin.y * halfResolution;
+        EXPECT_NEAR(texelX, std::round(texelX), 2e-2f);
+        EXPECT_NEAR(texelY, std::round(texelY), 2e-2f);
+    }
+}
+
+TEST(ShadowCascadesTest, CascadeCountIsClamped) {
+    Zgine::ShadowCascadeSettings settings;
+    Cascades cascades;
+    settings.CascadeCount = 0;
+    EXPECT_EQ(Fit(settings, Vector3(0.0f), cascades), 1u);
+    EXPECT_FLOAT_EQ(cascades[0].SplitFar, settings.MaxDistance);
+    settings.CascadeCount = 9;
+    EXPECT_EQ(Fit(settings, Vector3(0.0f), cascades), Zgine::kMaxShadowCascades);
+}
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 #include <Zgine/World/Systems/SystemManager.h>
 #include <Zgine/World/Core/World.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -50,12 +56,73 @@ public:
         return m_Priority;
     }
 
+    void SetPriority(int priority) {
+        m_Priority = priority;
+    }
+
 private:
     std::vector<std::string>* m_Order = nullptr;
     std::string m_Name;
     int m_Priority = 100;
 };
 
+struct PositionData {};
+struct VelocityData {};
+
+class AccessTestSystem final : public Zgine::ISystem {
+public:
+    using AccessFn = std::function<void(Zgine::SystemAccess&)>;
+
+    AccessTestSystem(std::string name, int priority, AccessFn describe, std::function<void()> update,
+                     std::function<void()> fixedUpdate = [] {})
+        : m_Name(std::move(name)), m_Priority(priority), m_Describe(std::move(describe)),
+          m_Update(std::move(update)), m_FixedUpdate(std::move(fixedUpdate)) {}
+
+    void Initialize() override {}
+    void Shutdown() override {}
+
+    void Update(Zgine::World* world, float deltaTime) override {
+        (void)world;
+        (void)deltaTime;
+        m_Update();
+    }
+
+    void FixedUpdate(Zgine::World* world, float fixedDeltaTime) override {
+        (void)world;
+        (void)fixedDeltaTime;
+        m_FixedUpdate();
+    }
+
+    void DescribeAccess(Zgine::SystemPhase phase, Zgine::SystemAccess& access) const override {
+        if (phase == Zgine::SystemPhase::Update) {
+            m_Describe(access);
+        }
+    }
+
+    const char* GetName() const override { return m_Name.c_str(); }
+    int GetPriority() const override { return m_Priority; }
+
+private:
+    std::string m_Name;
+    int m_Priority = 100;
+    AccessFn m_Describe;
+    std::function<void()> m_Update;
+    std::function<void()> m_FixedUpdate;
+};
+
+// Records the order of updates from any thread.
+struct ThreadSafeLog {
+    std::mutex Mutex;
+    std::vector<std::string> Entries;
+
+    std::function<void()> Append(std::string entry) {
+        return [this, entry = std::move(entry)] {
+            std::scoped_lock lock(Mutex);
+            Entries.push_back(entry);
+        };
+    }
+};
+
 } // namespace
 
 TEST(SystemManagerTest, InterleavesOwnedAndExternalSystemsByPriority) {
@@ -169,3 +236,250 @@ TEST(SystemManagerTest, DisabledSystemsDoNotReceiveLifecycleOrUpdates) {
     EXPECT_EQ(order[4], "stop:enabled");
     EXPECT_EQ(order[5], "shutdown:enabled");
 }
+
+TEST(SystemAccessTest, ConflictsOnlyWhenAWriteOverlaps) {
+    Zgine::SystemAccess reader;
+    reader.Read<PositionData>();
+    Zgine::SystemAccess otherReader;
+    otherReader.Read<PositionData, VelocityData>();
+    Zgine::SystemAccess writer;
+    writer.Write<PositionData>();
+    Zgine::SystemAccess unrelated;
+    unrelated.Write<VelocityData>();
+    Zgine::SystemAccess exclusive;
+    exclusive.SetExclusive();
+    Zgine::SystemAccess none;
+
+    EXPECT_FALSE(reader.ConflictsWith(otherReader));
+    EXPECT_TRUE(reader.ConflictsWith(writer));
+    EXPECT_TRUE(writer.ConflictsWith(reader));
+    EXPECT_TRUE(writer.ConflictsWith(writer));
+    EXPECT_FALSE(writer.ConflictsWith(unrelated));
+    EXPECT_TRUE(otherReader.ConflictsWith(unrelated));
+    EXPECT_TRUE(exclusive.ConflictsWith(none));
+    EXPECT_FALSE(none.ConflictsWith(writer));
+}
+
+TEST(SystemManagerTest, ScheduleOrdersOnlyConflictingSystems) {
+    Zgine::SystemManager manager;
+    auto noop = [] {};
+
+    manager.RegisterSystem<AccessTestSystem>("write-position", 10,
+        [](Zgine::SystemAccess& a) { a.Write<PositionData>(); }, noop);
+    manager.RegisterSystem<AccessTestSystem>("write-velocity", 20,
+        [](Zgine::SystemAccess& a) { a.Write<VelocityData>(); }, noop);
+    manager.RegisterSystem<AccessTestSystem>("read-position", 30,
+        [](Zgine::SystemAccess& a) { a.Read<PositionData>(); }, noop);
+
+    const Zgine::JobGraph& schedule = manager.GetSchedule(Zgine::SystemPhase::Update);
+    ASSERT_TRUE(schedule.IsCompiled());
+    ASSERT_EQ(schedule.GetNodeCount(), 3u);
+
+    // Nodes follow priority order; the reader must come after the position writer.
+    const auto& order = schedule.GetTopologicalOrder();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(schedule.GetNodeName(order[0]), "write-position");
+    EXPECT_EQ(schedule.GetNodeName(order[1]), "write-velocity");
+    EXPECT_EQ(schedule.GetNodeName(order[2]), "read-position");
+}
+
+TEST(SystemManagerTest, ConflictingAndUndeclaredSystemsKeepPriorityOrderOnJobSystem) {
+    Zgine::JobSystem jobs(3);
+    Zgine::SystemManager manager;
+    manager.SetJobSystem(&jobs);
+    ThreadSafeLog log;
+
+    manager.RegisterSystem<AccessTestSystem>("writer", 10,
+        [](Zgine::SystemAccess& a) { a.Write<PositionData>(); }, log.Append("writer"));
+    manager.RegisterSystem<AccessTestSystem>("independent", 15,
+        [](Zgine::SystemAccess& a) { a.Write<VelocityData>(); }, [] {});
+    manager.RegisterSystem<AccessTestSystem>("reader", 20,
+        [](Zgine::SystemAccess& a) { a.Read<PositionData>(); }, log.Append("reader"));
+    manager.RegisterSystem<AccessTestSystem>("exclusive", 30,
+        [](Zgine::SystemAccess& a) { a.SetExclusive(); }, log.Append("exclusive"));
+    manager.RegisterSystem<AccessTestSystem>("last-reader", 40,
+        [](Zgine::SystemAccess& a) { a.Read<PositionData>(); }, log.Append("last-reader"));
+
+    constexpr int kFrames = 200;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        manager.UpdateAll(nullptr, 0.016f);
+    }
+
+    ASSERT_EQ(log.Entries.size(), 4u * kFrames);
+    for (int frame = 0; frame < kFrames; ++frame) {
+        EXPECT_EQ(log.Entries[frame * 4 + 0], "writer");
+        EXPECT_EQ(log.Entries[frame * 4 + 1], "reader");
+        EXPECT_EQ(log.Entries[frame * 4 + 2], "exclusive");
+        EXPECT_EQ(log.Entries[frame * 4 + 3], "last-reader");
+    }
+}
+
+TEST(SystemManagerTest, RunsNonConflictingSystemsConcurrently) {
+    Zgine::JobSystem jobs(2);
+    Zgine::SystemManager manager;
+    manager.SetJobSystem(&jobs);
+
+    // Each system waits until both have started; this only succeeds if the
+    // manager actually overlaps them.
+    std::atomic<int> started{0};
+    std::atomic<bool> overlapped{true};
+    auto rendezvous = [&started, &overlapped] {
+        started.fetch_add(1);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (started.load() < 2) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                overlapped = false;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+
+    manager.RegisterSystem<AccessTestSystem>("positions", 10,
+        [](Zgine::SystemAccess& a) { a.Write<PositionData>(); }, rendezvous);
+    manager.RegisterSystem<AccessTestSystem>("velocities", 20,
+        [](Zgine::SystemAccess& a) { a.Write<VelocityData>(); }, rendezvous);
+
+    manager.UpdateAll(nullptr, 0.016f);
+
+    EXPECT_EQ(started.load(), 2);
+    EXPECT_TRUE(overlapped.load());
+}
+
+TEST(SystemManagerTest, PhasesASystemDoesNotDescribeRunExclusively) {
+    Zgine::JobSystem jobs(2);
+    Zgine::SystemManager manager;
+    manager.SetJobSystem(&jobs);
+
+    // Disjoint Update declarations, but FixedUpdate is left undeclared, as an
+    // override handling only Update leaves it.
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+    auto fixedUpdate = [&running, &overlapped] {
+        if (running.fetch_add(1) != 0) {
+            overlapped = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        running.fetch_sub(1);
+    };
+    manager.RegisterSystem<AccessTestSystem>("positions", 10,
+        [](Zgine::SystemAccess& a) { a.Write<PositionData>(); }, [] {}, fixedUpdate);
+    manager.RegisterSystem<AccessTestSystem>("velocities", 20,
+        [](Zgine::SystemAccess& a) { a.Write<VelocityData>(); }, [] {}, fixedUpdate);
+
+    EXPECT_EQ(manager.GetSchedule(Zgine::SystemPhase::FixedUpdate).GetTopologicalOrder().size(), 2u);
+    for (int step = 0; step < 20; ++step) {
+        manager.FixedUpdateAll(nullptr, 1.0f / 60.0f);
+    }
+    EXPECT_FALSE(overlapped.load());
+
+    Zgine::SystemAccess silent;
+    EXPECT_FALSE(silent.IsDeclared());
+    EXPECT_TRUE(silent.SetNoAccess().IsDeclared());
+    EXPECT_FALSE(silent.IsExclusive());
+}
+
+TEST(SystemManagerTest, RebuildsScheduleAfterRemovingSystem) {
+    Zgine::JobSystem jobs(2);
+    Zgine::SystemManager manager;
+    manager.SetJobSystem(&jobs);
+    std::vector<std::string> order;
+
+    manager.RegisterSystem<OrderedTestSystem>(&order, "kept", 10);
+    manager.RegisterSystem<AccessTestSystem>("removed", 20,
+        [](Zgine::SystemAccess& a) { a.Read<PositionData>(); }, [&order] { order.push_back("removed"); });
+    manager.UpdateAll(nullptr, 0.016f);
+    ASSERT_EQ(order.size(), 2u);
+
+    manager.RemoveSystem<AccessTestSystem>();
+    manager.UpdateAll(nullptr, 0.016f);
+
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[2], "kept");
+    EXPECT_EQ(manager.GetSchedule(Zgine::SystemPhase::Update).GetNodeCount(), 1u);
+}
+
+TEST(SystemManagerTest, PicksUpPriorityAndEnabledChangesWithoutReregistering) {
+    Zgine::SystemManager manager;
+    std::vector<std::string> order;
+
+    auto first = std::make_unique<OrderedTestSystem>(&order, "first", 10);
+    auto second = std::make_unique<OrderedTestSystem>(&order, "second", 20);
+    manager.RegisterExternalSystem(first.get());
+    manager.RegisterExternalSystem(second.get());
+
+    manager.UpdateAll(nullptr, 0.016f);
+    first->SetPriority(30);
+    manager.UpdateAll(nullptr, 0.016f);
+    second->SetEnabled(false);
+    manager.UpdateAll(nullptr, 0.016f);
+    second->SetEnabled(true);
+    manager.UpdateAll(nullptr, 0.016f);
+
+    const std::vector<std::string> expected{
+        "first", "second",
+        "second", "first",
+        "first",
+        "second", "first"};
+    EXPECT_EQ(order, expected);
+}
+
+TEST(SystemManagerTest, SystemsToggledEarlierInThePhaseTakeEffectImmediately) {
+    for (bool timing : { false, true }) {
+        Zgine::SystemManager manager;
+        manager.SetTimingEnabled(timing);
+        std::vector<std::string> order;
+
+        Zgine::ISystem* disabledLater = nullptr;
+        Zgine::ISystem* enabledLater = nullptr;
+        manager.RegisterSystem<AccessTestSystem>("toggler", 10, [](Zgine::SystemAccess&) {}, [&] {
+            disabledLater->SetEnabled(false);
+            enabledLater->SetEnabled(true);
+        });
+        disabledLater = manager.RegisterSystem<OrderedTestSystem>(&order, "disabled", 20);
+        enabledLater = manager.RegisterSystem<OrderedTestSystem>(&order, "enabled", 30);
+        enabledLater->SetEnabled(false);
+
+        manager.UpdateAll(nullptr, 0.016f);
+        EXPECT_EQ(order, std::vector<std::string>{ "enabled" }) << "timing " << timing;
+    }
+}
+
+TEST(SystemManagerTest, CollectsPerSystemTimingsInDispatchOrder) {
+    Zgine::SystemManager manager;
+    std::vector<std::string> order;
+
+    manager.RegisterSystem<OrderedTestSystem>(&order, "late", 50);
+    auto* early = manager.RegisterSystem<OrderedTestSystem>(&order, "early", 10);
+    manager.SetTimingEnabled(true);
+
+    for (int i = 0; i < 3; ++i) {
+        manager.UpdateAll(nullptr, 0.016f);
+    }
+    manager.FixedUpdateAll(nullptr, 1.0f / 60.0f);
+
+    auto timings = manager.GetSystemTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_STREQ(timings[0].Name, "early");
+    EXPECT_EQ(timings[0].Priority, 10);
+    EXPECT_STREQ(timings[1].Name, "late");
+    for (const Zgine::SystemTiming& timing : timings) {
+        EXPECT_EQ(timing.UpdateCount, 3u);
+        EXPECT_EQ(timing.FixedUpdateCount, 1u);
+        EXPECT_GE(timing.TotalUpdateMs, timing.LastUpdateMs);
+    }
+
+    // Counters survive a rebuild of the dispatch table.
+    early->SetEnabled(false);
+    manager.UpdateAll(nullptr, 0.016f);
+    timings = manager.GetSystemTimings();
+    EXPECT_EQ(timings[0].UpdateCount, 3u);
+    EXPECT_EQ(timings[1].UpdateCount, 4u);
+
+    manager.ResetSystemTimings();
+    manager.SetTimingEnabled(false);
+    manager.UpdateAll(nullptr, 0.016f);
+    timings = manager.GetSystemTimings();
+    EXPECT_EQ(timings[1].UpdateCount, 0u);
+    EXPECT_STREQ(timings[1].Name, "late");
+}
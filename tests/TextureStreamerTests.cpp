@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <Zgine/Resources/Texture/TextureStreamer.h>
+#include <Zgine/Resources/Import/AssetCooker.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Zgine;
+
+namespace {
+
+// Keeps the resident level the streamer asks for and counts the bytes a
+// backend would upload for it: the levels that were not resident yet.
+class FakeTexture final : public Texture {
+public:
+    FakeTexture(const std::vector<TextureMip>& mips, uint32_t firstMip)
+        : m_Width(mips.front().Width), m_Height(mips.front().Height),
+          m_ResidentMip(static_cast<uint32_t>(mips.size())) {
+        SetResidentMips(mips, firstMip);
+    }
+
+    void Bind(uint32_t) const override {}
+    void Unbind() const override {}
+    uint32_t GetWidth() const override { return m_Width; }
+    uint32_t GetHeight() const override { return m_Height; }
+    uint32_t GetID() const override { return 1; }
+    const std::string& GetFilePath() const override { return m_Path; }
+    size_t GetMemorySize() const override { return m_MemorySize; }
+    uint32_t GetResidentMip() const override { return m_ResidentMip; }
+
+    bool SetResidentMips(const std::vector<TextureMip>& mips, uint32_t firstMip) override {
+        for (size_t level = firstMip; level < m_ResidentMip; ++level) {
+            m_UploadedBytes += mips[level].Size;
+        }
+        m_ResidentMip = firstMip;
+        m_MemorySize = 0;
+        for (size_t level = firstMip; level < mips.size(); ++level) {
+            m_MemorySize += mips[level].Size;
+        }
+        return true;
+    }
+
+    size_t GetUploadedBytes() const { return m_UploadedBytes; }
+
+private:
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    std::string m_Path = "fake";
+    size_t m_MemorySize = 0;
+    uint32_t m_ResidentMip = 0;
+    size_t m_UploadedBytes = 0;
+};
+
+class TextureStreamerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+        m_Directory = std::filesystem::temp_directory_path() / ("zgine-streamer-test-" + std::to_string(unique));
+        std::filesystem::create_directories(m_Directory);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Directory, ec);
+    }
+
+    // A cooked RGBA8 chain from size x size down to 1x1.
+    std::shared_ptr<const CookedTexture> CookSquare(const std::string& name, uint32_t size) {
+        std::vector<std::vector<uint8_t>> levels;
+        std::vector<TextureMip> mips;
+        for (uint32_t width = size;; width /= 2) {
+            levels.emplace_back(static_cast<size_t>(width) * width * 4, static_cast<uint8_t>(width));
+            if (width == 1) {
+                break;
+            }
+        }
+        uint32_t width = size;
+        for (const auto& level : levels) {
+            mips.push_back({ width, width, level.data(), level.size() });
+            width = std::max(width / 2, 1u);
+        }
+        const std::filesystem::path path = m_Directory / (name + AssetCooker::kExtension);
+        if (!AssetCooker::WriteTexture(path, CookKey{ 1 }, TextureFormat::RGBA8, mips)) {
+            return nullptr;
+        }
+        std::optional<CookedTexture> cooked = CookedTexture::Open(path, CookKey{ 1 });
+        return cooked ? std::make_shared<const CookedTexture>(std::move(*cooked)) : nullptr;
+    }
+
+    std::filesystem::path m_Directory;
+};
+
+constexpr size_t LevelBytes(uint32_t size) {
+    return static_cast<size_t>(size) * size * 4;
+}
+
+} // namespace
+
+TEST(TextureStreamerMath, TailAndDesiredMips) {
+    std::vector<TextureMip> mips;
+    for (uint32_t size = 1024; size >= 1; size /= 2) {
+        mips.push_back({ size, size / 2 ? size / 2 : 1, nullptr, 0 });
+    }
+    // 1024x512 reaches 64 on both sides at level 4 (64x32).
+    EXPECT_EQ(TextureStreamer::GetTailMip(mips, 64), 4u);
+    EXPECT_EQ(TextureStreamer::GetTailMip(mips, 0), static_cast<uint32_t>(mips.size() - 1));
+
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 1024, 2048.0f), 0u);
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 1024, 1024.0f), 0u);
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 1024, 1000.0f), 0u); // level 1 would be undersampled
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 1024, 512.0f), 1u);
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 256, 100.0f), 3u);
+    EXPECT_EQ(TextureStreamer::GetDesiredMip(1024, 1024, 0.0f), std::numeric_limits<uint32_t>::max());
+}
+
+TEST_F(TextureStreamerTest, RequestedMipsStreamInAndDecayToTheTail) {
+    auto source = CookSquare("albedo.png", 256);
+    ASSERT_NE(source, nullptr);
+
+    TextureStreamerConfig config;
+    config.TailSize = 32;
+    config.RetainFrames = 2;
+    TextureStreamer streamer(config);
+
+    const uint32_t tail = TextureStreamer::GetTailMip(source->GetMips(), config.TailSize);
+    ASSERT_EQ(tail, 3u);
+    auto texture = std::make_shared<FakeTexture>(source->GetMips(), tail);
+    streamer.Register(texture, source);
+
+    // Not requested: the tail stays.
+    streamer.Update();
+    EXPECT_EQ(texture->GetResidentMip(), tail);
+    EXPECT_EQ(streamer.GetStats().TextureCount, 1u);
+
+    // 128 pixels want level 1; without a JobSystem the load runs inline.
+    // Only the levels above the tail are uploaded, and charged.
+    const size_t tailUploaded = texture->GetUploadedBytes();
+    streamer.Request(texture.get(), 128.0f);
+    streamer.Update();
+    EXPECT_EQ(texture->GetResidentMip(), 1u);
+    EXPECT_EQ(streamer.GetStats().UploadedBytes, LevelBytes(128) + LevelBytes(64));
+    EXPECT_EQ(texture->GetUploadedBytes() - tailUploaded, streamer.GetStats().UploadedBytes);
+
+    // The largest request of a frame wins.
+    streamer.Request(texture.get(), 16.0f);
+    streamer.Request(texture.get(), 300.0f);
+    streamer.Update();
+    EXPECT_EQ(texture->GetResidentMip(), 0u);
+    EXPECT_EQ(streamer.GetStats().UploadedBytes, LevelBytes(256));
+
+    // Kept for RetainFrames updates, then evicted back to the tail without an upload.
+    streamer.Update();
+    EXPECT_EQ(texture->GetResidentMip(), 0u);
+    const size_t uploaded = texture->GetUploadedBytes();
+    streamer.Update();
+    EXPECT_EQ(texture->GetResidentMip(), tail);
+    EXPECT_EQ(streamer.GetStats().EvictedBytes, LevelBytes(256) + LevelBytes(128) + LevelBytes(64));
+    EXPECT_EQ(streamer.GetStats().UploadedBytes, 0u);
+    EXPECT_EQ(texture->GetUploadedBytes(), uploaded);
+
+    // Dropped once the texture is gone.
+    texture.reset();
+    streamer.Update();
+    EXPECT_EQ(streamer.GetStats().TextureCount, 0u);
+}
+
+TEST_F(TextureStreamerTest, GpuBudgetEvictsTheLeastRecentlyRequestedFirst) {
+    auto source = CookSquare("shared.png", 256);
+    ASSERT_NE(source, nullptr);
+
+    TextureStreamerConfig config;
+    config.TailSize = 32;
+    // Both tails plus one full chain above them.
+    const size_t tailBytes = LevelBytes(32) + LevelBytes(16) + LevelBytes(8) + LevelBytes(4)
+                           + LevelBytes(2) + LevelBytes(1);
+    const size_t highBytes = LevelBytes(256) + LevelBytes(128) + LevelBytes(64);
+    config.GpuBudgetBytes = 2 * tailBytes + highBytes;
+    TextureStreamer streamer(config);
+
+    auto older = std::make_shared<FakeTexture>(source->GetMips(), 3);
+    auto newer = std::make_shared<FakeTexture>(source->GetMips(), 3);
+    streamer.Register(older, source);
+    streamer.Register(newer, source);
+    streamer.Update();
+
+    streamer.Request(older.get(), 256.0f);
+    streamer.Update();
+    EXPECT_EQ(older->GetResidentMip(), 0u);
+
+    // Both are still wanted, but only one full chain fits: the one asked for
+    // longer ago gives its high mips up.
+    streamer.Request(newer.get(), 256.0f);
+    streamer.Update();
+    EXPECT_EQ(older->GetResidentMip(), 3u);
+    EXPECT_EQ(newer->GetResidentMip(), 0u);
+    EXPECT_EQ(streamer.GetStats().ResidentBytes, config.GpuBudgetBytes);
+
+    // Evicted levels come back once the budget allows.
+    TextureStreamerConfig larger = config;
+    larger.GpuBudgetBytes = 2 * (tailBytes + highBytes);
+    streamer.SetConfig(larger);
+    streamer.Request(older.get(), 256.0f);
+    streamer.Request(newer.get(), 256.0f);
+    streamer.Update();
+    EXPECT_EQ(older->GetResidentMip(), 0u);
+    EXPECT_EQ(newer->GetResidentMip(), 0u);
+}
+
+TEST_F(TextureStreamerTest, UploadsRespectThePerFrameBudgetAndRunOnJobs) {
+    auto source = CookSquare("detail.png", 128);
+    ASSERT_NE(source, nullptr);
+
+    TextureStreamerConfig config;
+    config.TailSize = 16;
+    config.UploadBytesPerFrame = 1; // one texture per update
+    TextureStreamer streamer(config);
+    JobSystem jobs(2);
+    streamer.SetJobSystem(&jobs);
+
+    std::vector<std::shared_ptr<FakeTexture>> textures;
+    for (int i = 0; i < 3; ++i) {
+        textures.push_back(std::make_shared<FakeTexture>(source->GetMips(), 3));
+        streamer.Register(textures.back(), source);
+    }
+
+    uint32_t upgraded = 0;
+    for (int frame = 0; frame < 100 && upgraded < textures.size(); ++frame) {
+        for (const auto& texture : textures) {
+            streamer.Request(texture.get(), 128.0f);
+        }
+        streamer.Update();
+
+        uint32_t now = 0;
+        for (const auto& texture : textures) {
+            now += texture->GetResidentMip() == 0 ? 1u : 0u;
+        }
+        EXPECT_LE(now, upgraded + 1);
+        upgraded = now;
+        if (upgraded < textures.size()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(upgraded, textures.size());
+    streamer.SetJobSystem(nullptr);
+}
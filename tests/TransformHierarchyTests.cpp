@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <Zgine/World/Core/World.h>
+#include <Zgine/World/Core/Entity.h>
+#include <Zgine/World/Components/Components.h>
+#include <Zgine/World/Systems/TransformSystem.h>
+#include <Zgine/Core/Jobs/JobSystem.h>
+#include <Zgine/Core/Math/Matrix4.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+void ExpectVectorNear(const Zgine::Math::Vector3& actual, const Zgine::Math::Vector3& expected) {
+    EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+    EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+    EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+}
+
+Zgine::Math::Vector3 WorldPosition(Zgine::Entity entity) {
+    return Zgine::Math::ExtractTranslation(entity.GetComponent<Zgine::WorldTransformComponent>().WorldMatrix);
+}
+
+} // namespace
+
+TEST(TransformHierarchyTest, NewEntitiesCarryWorldTransform) {
+    Zgine::World world;
+    Zgine::Entity entity = world.CreateEntity("Entity");
+
+    ASSERT_TRUE(entity.HasComponent<Zgine::WorldTransformComponent>());
+    EXPECT_FALSE(entity.GetComponent<Zgine::WorldTransformComponent>().IsValid());
+
+    EXPECT_EQ(world.UpdateWorldTransforms(), 1u);
+    EXPECT_TRUE(entity.GetComponent<Zgine::WorldTransformComponent>().IsValid());
+}
+
+TEST(TransformHierarchyTest, ChildWorldMatrixComposesParent) {
+    Zgine::World world;
+    Zgine::Entity parent = world.CreateEntity("Parent");
+    Zgine::Entity child = world.CreateEntity("Child", parent);
+    parent.GetComponent<Zgine::TransformComponent>().Translation = {1.0f, 2.0f, 3.0f};
+    parent.GetComponent<Zgine::TransformComponent>().Scale = {2.0f, 2.0f, 2.0f};
+    child.GetComponent<Zgine::TransformComponent>().Translation = {4.0f, 5.0f, 6.0f};
+
+    world.UpdateWorldTransforms();
+
+    ExpectVectorNear(WorldPosition(parent), {1.0f, 2.0f, 3.0f});
+    ExpectVectorNear(WorldPosition(child), {9.0f, 12.0f, 15.0f});
+}
+
+TEST(TransformHierarchyTest, UnchangedHierarchyIsNotRecomputed) {
+    Zgine::World world;
+    Zgine::Entity parent = world.CreateEntity("Parent");
+    world.CreateEntity("Child", parent);
+    world.CreateEntity("Other");
+
+    EXPECT_EQ(world.UpdateWorldTransforms(), 3u);
+    const uint32_t version = parent.GetComponent<Zgine::WorldTransformComponent>().Version;
+
+    EXPECT_EQ(world.UpdateWorldTransforms(), 0u);
+    EXPECT_EQ(parent.GetComponent<Zgine::WorldTransformComponent>().Version, version);
+}
+
+TEST(TransformHierarchyTest, MovingParentPropagatesToDescendantsOnly) {
+    Zgine::World world;
+    Zgine::Entity root = world.CreateEntity("Root");
+    Zgine::Entity child = world.CreateEntity("Child", root);
+    Zgine::Entity grandChild = world.CreateEntity("GrandChild", child);
+    Zgine::Entity unrelated = world.CreateEntity("Unrelated");
+    grandChild.GetComponent<Zgine::TransformComponent>().Translation = {0.0f, 1.0f, 0.0f};
+    world.UpdateWorldTransforms();
+
+    child.GetComponent<Zgine::TransformComponent>().Translation = {10.0f, 0.0f, 0.0f};
+
+    EXPECT_EQ(world.UpdateWorldTransforms(), 2u);
+    ExpectVectorNear(WorldPosition(grandChild), {10.0f, 1.0f, 0.0f});
+    ExpectVectorNear(WorldPosition(root), {0.0f, 0.0f, 0.0f});
+    ExpectVectorNear(WorldPosition(unrelated), {0.0f, 0.0f, 0.0f});
+}
+
+TEST(TransformHierarchyTest, ReparentingAndDestroyingRebuildOrder) {
+    Zgine::World world;
+    Zgine::Entity first = world.CreateEntity("First");
+    Zgine::Entity second = world.CreateEntity("Second");
+    Zgine::Entity child = world.CreateEntity("Child", first);
+    first.GetComponent<Zgine::TransformComponent>().Translation = {1.0f, 0.0f, 0.0f};
+    second.GetComponent<Zgine::TransformComponent>().Translation = {0.0f, 0.0f, 5.0f};
+    world.UpdateWorldTransforms();
+    ExpectVectorNear(WorldPosition(child), {1.0f, 0.0f, 0.0f});
+
+    world.SetParent(child, second);
+    world.UpdateWorldTransforms();
+    ExpectVectorNear(WorldPosition(child), {0.0f, 0.0f, 5.0f});
+
+    world.DestroyEntity(first);
+    world.UpdateWorldTransforms();
+    ExpectVectorNear(WorldPosition(child), {0.0f, 0.0f, 5.0f});
+}
+
+TEST(TransformHierarchyTest, ParallelUpdateMatchesSerialResult) {
+    Zgine::World world;
+    std::vector<Zgine::Entity> leaves;
+    for (int rootIndex = 0; rootIndex < 256; ++rootIndex) {
+        Zgine::Entity root = world.CreateEntity("Root" + std::to_string(rootIndex));
+        root.GetComponent<Zgine::TransformComponent>().Translation = {static_cast<float>(rootIndex), 0.0f, 0.0f};
+        Zgine::Entity parent = root;
+        for (int depth = 0; depth < 7; ++depth) {
+            parent = world.CreateEntity("Node", parent);
+            parent.GetComponent<Zgine::TransformComponent>().Translation = {0.0f, 1.0f, 0.0f};
+        }
+        leaves.push_back(parent);
+    }
+
+    Zgine::JobSystem jobs(3);
+    Zgine::TransformSystem system;
+    system.SetJobSystem(&jobs);
+    system.Update(&world, 0.016f);
+
+    EXPECT_EQ(system.GetLastUpdatedCount(), 256u * 8u);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        ExpectVectorNear(WorldPosition(leaves[i]), {static_cast<float>(i), 7.0f, 0.0f});
+    }
+
+    system.Update(&world, 0.016f);
+    EXPECT_EQ(system.GetLastUpdatedCount(), 0u);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <Zgine/Resources/Mesh/Mesh.h>
+#include <Zgine/Resources/Mesh/VertexFormat.h>
+#include <cmath>
+#include <cstring>
+
+using namespace Zgine;
+
+TEST(VertexFormatTest, LayoutsMatchStridesAndShrinkVertices) {
+    EXPECT_EQ(GetVertexLayout(VertexFormat::Float).GetStride(), GetVertexStride(VertexFormat::Float));
+    EXPECT_EQ(GetVertexLayout(VertexFormat::Quantized).GetStride(), GetVertexStride(VertexFormat::Quantized));
+    EXPECT_EQ(GetVertexLayout(VertexFormat::QuantizedColor).GetStride(), GetVertexStride(VertexFormat::QuantizedColor));
+
+    EXPECT_EQ(GetVertexStride(VertexFormat::Float), 48u);
+    EXPECT_EQ(GetVertexStride(VertexFormat::Quantized), 16u);
+    EXPECT_EQ(GetVertexStride(VertexFormat::QuantizedColor), 20u);
+
+    // Same shader inputs in the same order for every format.
+    const BufferLayout quantized = GetVertexLayout(VertexFormat::Quantized);
+    ASSERT_EQ(quantized.GetElements().size(), 3u);
+    EXPECT_EQ(quantized.GetElements()[0].Name, "a_Position");
+    EXPECT_TRUE(quantized.GetElements()[0].Normalized);
+    EXPECT_EQ(quantized.GetElements()[1].Name, "a_Normal");
+    EXPECT_EQ(quantized.GetElements()[2].Name, "a_TexCoord");
+
+    for (VertexFormat format : { VertexFormat::Float, VertexFormat::Quantized, VertexFormat::QuantizedColor }) {
+        EXPECT_EQ(VertexFormatFromString(VertexFormatToString(format)), format);
+    }
+    EXPECT_EQ(VertexFormatFromString("bogus"), VertexFormat::Float);
+}
+
+TEST(VertexFormatTest, HalfFloatRoundTrips) {
+    using VertexQuantization::FloatToHalf;
+    using VertexQuantization::HalfToFloat;
+
+    EXPECT_EQ(FloatToHalf(0.0f), 0x0000u);
+    EXPECT_EQ(FloatToHalf(1.0f), 0x3C00u);
+    EXPECT_EQ(FloatToHalf(-2.0f), 0xC000u);
+    EXPECT_EQ(FloatToHalf(65504.0f), 0x7BFFu);
+    EXPECT_EQ(FloatToHalf(1.0e6f), 0x7C00u);
+    EXPECT_EQ(FloatToHalf(std::ldexp(1.0f, -24)), 0x0001u);
+
+    for (float value : { 0.5f, 0.333f, -0.75f, 3.1416f, 1000.25f, 1.0e-5f }) {
+        const float decoded = HalfToFloat(FloatToHalf(value));
+        EXPECT_NEAR(decoded, value, std::fabs(value) * 0.001f + 1.0e-7f) << value;
+    }
+    EXPECT_TRUE(std::isinf(HalfToFloat(0x7C00u)));
+}
+
+TEST(VertexFormatTest, NormalsPackToTenBitsPerAxis) {
+    using VertexQuantization::PackSnorm1010102;
+    using VertexQuantization::UnpackSnorm1010102;
+
+    const Math::Vector3 axes[] = {
+        Math::Vector3(1.0f, 0.0f, 0.0f), Math::Vector3(0.0f, -1.0f, 0.0f), Math::Vector3(0.0f, 0.0f, 1.0f),
+        Math::Vector3(0.57735f, -0.57735f, 0.57735f),
+    };
+    for (const Math::Vector3& axis : axes) {
+        const Math::Vector3 decoded = UnpackSnorm1010102(PackSnorm1010102(axis));
+        EXPECT_NEAR(decoded.x, axis.x, 1.0f / 511.0f);
+        EXPECT_NEAR(decoded.y, axis.y, 1.0f / 511.0f);
+        EXPECT_NEAR(decoded.z, axis.z, 1.0f / 511.0f);
+    }
+    EXPECT_EQ(PackSnorm1010102(Math::Vector3(0.0f)) >> 30, 0u);
+}
+
+TEST(VertexFormatTest, QuantizedPositionsDequantizeWithinBounds) {
+    std::vector<Vertex> vertices(3);
+    vertices[0].Position = Math::Vector3(-10.0f, 0.0f, 2.0f);
+    vertices[1].Position = Math::Vector3(30.0f, 0.0f, 4.0f);
+    vertices[2].Position = Math::Vector3(7.123f, 0.0f, 3.3f);
+    for (Vertex& vertex : vertices) {
+        vertex.Normal = Math::Vector3(0.0f, 1.0f, 0.0f);
+        vertex.TexCoords = Math::Vector2(0.25f, 0.75f);
+        vertex.Color = Math::Vector4(1.0f, 0.5f, 0.0f, 1.0f);
+    }
+    const AABB bounds(Math::Vector3(-10.0f, 0.0f, 2.0f), Math::Vector3(30.0f, 0.0f, 4.0f));
+
+    const std::vector<uint8_t> bytes = VertexQuantization::EncodeVertices(vertices, VertexFormat::QuantizedColor, bounds);
+    ASSERT_EQ(bytes.size(), vertices.size() * 20u);
+
+    const Math::Vector3 scale = VertexQuantization::GetDequantizeScale(VertexFormat::QuantizedColor, bounds);
+    const Math::Vector3 offset = VertexQuantization::GetDequantizeOffset(VertexFormat::QuantizedColor, bounds);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        uint16_t position[4];
+        std::memcpy(position, &bytes[i * 20], sizeof(position));
+        // What the vertex fetch and the folded model matrix do on the GPU.
+        EXPECT_NEAR(offset.x + scale.x * position[0] / 65535.0f, vertices[i].Position.x, 40.0f / 65535.0f);
+        EXPECT_NEAR(offset.y + scale.y * position[1] / 65535.0f, vertices[i].Position.y, 1.0e-6f);
+        EXPECT_NEAR(offset.z + scale.z * position[2] / 65535.0f, vertices[i].Position.z, 2.0f / 65535.0f);
+
+        uint16_t uv[2];
+        std::memcpy(uv, &bytes[i * 20 + 12], sizeof(uv));
+        EXPECT_FLOAT_EQ(VertexQuantization::HalfToFloat(uv[0]), 0.25f);
+        EXPECT_FLOAT_EQ(VertexQuantization::HalfToFloat(uv[1]), 0.75f);
+        EXPECT_EQ(bytes[i * 20 + 16], 255u);
+        EXPECT_EQ(bytes[i * 20 + 17], 128u);
+        EXPECT_EQ(bytes[i * 20 + 18], 0u);
+    }
+
+    const std::vector<uint8_t> full = VertexQuantization::EncodeVertices(vertices, VertexFormat::Float, bounds);
+    ASSERT_EQ(full.size(), vertices.size() * sizeof(Vertex));
+    EXPECT_EQ(std::memcmp(full.data(), vertices.data(), full.size()), 0);
+}